@@ -58,6 +58,14 @@ extern "C" {
     #endif
 #endif
 
+// RISC-V cores with the M extension use the register-blocked scalar kernels.
+// Define ARM_MATH_RISCV_DISABLE to build the generic C fallback instead.
+#if defined(__riscv) && defined(__riscv_mul) && !defined(ARM_MATH_RISCV_DISABLE)
+    #ifndef ARM_MATH_RISCV
+        #define ARM_MATH_RISCV 1
+    #endif
+#endif
+
 /**
  *
  * @brief Limits macros
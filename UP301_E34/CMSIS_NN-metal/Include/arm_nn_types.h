@@ -135,7 +135,8 @@ typedef struct
     int32_t input_offset;  /**< The negative of the zero value for the input tensor */
     int32_t output_offset; /**< The negative of the zero value for the output tensor */
     cmsis_nn_tile stride;
-    cmsis_nn_tile padding;
+    cmsis_nn_tile padding; /**< Top/left padding. The bottom/right padding follows from the output dimensions and
+                                may differ from it, e.g. for a PAD operator folded into the convolution. */
     cmsis_nn_tile dilation;
     cmsis_nn_activation activation;
 } cmsis_nn_conv_params;
@@ -159,7 +160,7 @@ typedef struct
     int32_t output_offset; /**< The negative of the zero value for the output tensor */
     int32_t ch_mult;       /**< Channel Multiplier. ch_mult * in_ch = out_ch */
     cmsis_nn_tile stride;
-    cmsis_nn_tile padding;
+    cmsis_nn_tile padding; /**< Top/left padding. The bottom/right padding follows from the output dimensions. */
     cmsis_nn_tile dilation;
     cmsis_nn_activation activation;
 } cmsis_nn_dw_conv_params;
@@ -237,6 +238,19 @@ typedef struct
     arm_nn_activation_type activation_type;
 } cmsis_nn_lstm_gate;
 
+/**
+ * CMSIS-NN object for the weights of all four LSTM gates interleaved into one matrix, see
+ * arm_lstm_interleave_gates_s8(). Row 4 * j + g holds gate g of hidden unit j, with the gates ordered forget, input,
+ * cell, output, so one pass over the input computes all gates of a unit.
+ */
+typedef struct
+{
+    const int8_t *input_weights;       /**< [hidden_size * 4][input_size] */
+    const void *input_effective_bias;  /**< [hidden_size * 4], int32 for s8 and int64 for s16 input */
+    const int8_t *hidden_weights;      /**< [hidden_size * 4][hidden_size] */
+    const void *hidden_effective_bias; /**< [hidden_size * 4], int32 for s8 and int64 for s16 input */
+} cmsis_nn_lstm_fused_gates;
+
 /** CMSIS-NN object for LSTM parameters*/
 typedef struct
 {
@@ -264,6 +278,7 @@ typedef struct
     cmsis_nn_lstm_gate input_gate;
     cmsis_nn_lstm_gate cell_gate;
     cmsis_nn_lstm_gate output_gate;
+    const cmsis_nn_lstm_fused_gates *fused_gates; /**< Interleaved gate weights or NULL to compute gate by gate */
 } cmsis_nn_lstm_params;
 
 /** CMSIS-NN object for LSTM scratch buffers*/
@@ -274,6 +289,65 @@ typedef struct
     void *cell_state;
 } cmsis_nn_lstm_context;
 
+/** CMSIS-NN object to describe the output rows or channels [start, end) computed by one call of a slice function */
+typedef struct
+{
+    int32_t start; /**< First row or channel */
+    int32_t end;   /**< One past the last row or channel */
+} cmsis_nn_slice;
+
+/** Work item handed to a scheduler worker. Computes @p slice using the worker's own context @p ctx. */
+typedef arm_cmsis_nn_status (*cmsis_nn_task)(const void *args,
+                                             const cmsis_nn_context *ctx,
+                                             const cmsis_nn_slice *slice);
+
+/** CMSIS-NN object to fan the slices of a layer out to workers, e.g. harts or threads */
+typedef struct
+{
+    int32_t num_workers;                /**< Number of workers, including the caller. At most 8. */
+    const cmsis_nn_context *worker_ctx; /**< One context per worker, each with the buffer of a slice call */
+    void *platform;                     /**< Passed to run, e.g. a thread pool or hart mailbox */
+    /**
+     * Runs task(args, &ctx[i], &slices[i]) for i in [0, num_slices) and returns when all of them have finished.
+     * Returns the first status that is not ARM_CMSIS_NN_SUCCESS. NULL runs the tasks one after the other on the
+     * calling core.
+     */
+    arm_cmsis_nn_status (*run)(void *platform,
+                               cmsis_nn_task task,
+                               const void *args,
+                               const cmsis_nn_context *ctx,
+                               const cmsis_nn_slice *slices,
+                               int32_t num_slices);
+} cmsis_nn_scheduler;
+
+/**
+ * Loop nest of a broadcasting elementwise operation, see arm_nn_broadcast_init(). The output is written
+ * contiguously, one inner run of inner_size elements per outer index.
+ */
+typedef struct
+{
+    int32_t outer_size[3];     /**< Outer loop counts, outermost first */
+    int32_t outer_stride_1[3]; /**< Input 1 element stride of each outer loop, 0 if broadcast along it */
+    int32_t outer_stride_2[3]; /**< Input 2 element stride of each outer loop, 0 if broadcast along it */
+    int32_t inner_size;        /**< Length of the inner run */
+    int32_t inner_stride_1;    /**< 1 if input 1 is contiguous along the inner run, 0 if it is a scalar there */
+    int32_t inner_stride_2;    /**< 1 if input 2 is contiguous along the inner run, 0 if it is a scalar there */
+} cmsis_nn_broadcast;
+
+/**
+ * Header at the start of s8 fully connected weights packed by arm_fully_connected_pack_weights_s8(). It is followed
+ * by one int32 kernel sum per output row and then by the weight panels.
+ */
+typedef struct
+{
+    int32_t magic;        /**< CMSIS_NN_PACKED_WEIGHTS_MAGIC */
+    int32_t version;      /**< Layout version, CMSIS_NN_PACKED_WEIGHTS_VERSION */
+    int32_t rows;         /**< Number of output channels */
+    int32_t cols;         /**< Accumulation depth */
+    int32_t input_offset; /**< Input offset folded into the kernel sums */
+    int32_t panel_rows;   /**< Rows interleaved in one panel, FC_PACKED_S8_PANEL_ROWS */
+} cmsis_nn_packed_weights_header;
+
 /**
  * @} // end group genPubTypes
  */
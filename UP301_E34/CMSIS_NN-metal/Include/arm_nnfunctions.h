@@ -453,6 +453,124 @@ arm_cmsis_nn_status arm_convolve_s8(const cmsis_nn_context *ctx,
  */
 int32_t arm_convolve_s4_get_buffer_size(const cmsis_nn_dims *input_dims, const cmsis_nn_dims *filter_dims);
 
+/**
+ * @brief Basic convolution function with packed int4 activations and int4 weights
+ * @param[in, out] ctx            Function context that contains the additional buffer required by the function.
+ *                                arm_convolve_s4_s4_get_buffer_size will return the buffer_size.
+ *                                The caller is expected to clear the buffer ,if applicable, for security reasons.
+ * @param[in]      conv_params    Convolution parameters (e.g. strides, dilations, pads,...).
+ *                                Range of conv_params->input_offset  : [-7, 8]
+ *                                Range of conv_params->output_offset : [-8, 7]
+ *                                conv_params->activation is within [-8, 7]
+ * @param[in]      quant_params   Per-channel quantization info.
+ *                                It contains the multiplier and shift values to be applied to each output channel
+ * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]      input_data     Input (activation) data pointer. Data type: int8 packed with 2x int4, element 2 * n
+ *                                in the low nibble of byte n
+ * @param[in]      filter_dims    Filter tensor dimensions. Format: [C_OUT, HK, WK, C_IN] where HK and WK are the
+ *                                spatial filter dimensions
+ * @param[in]      packed_filter_data Packed filter data pointer. Data type: int8 packed with 2x int4
+ * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+ * @param[in]      bias_data      Optional bias data pointer. Data type: int32
+ * @param[in]      output_dims    Output tensor dimensions. Format: [N, H, W, C_OUT]
+ * @param[out]     output_data    Output data pointer. Data type: int8 packed with 2x int4
+ *
+ * @return     The function returns either
+ *                  <code>ARM_CMSIS_NN_ARG_ERROR</code> if no buffer is provided or,
+ *                  <code>ARM_CMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    1. Supported framework: TensorFlow Lite micro
+ *    2. Activations stay packed in memory, which halves the activation traffic and the size of the tensors in the
+ *       arena. Up to four im2col columns are unpacked at a time and their results are packed into the output,
+ *       so neither the input nor the output is ever held unpacked.
+ *
+ */
+arm_cmsis_nn_status arm_convolve_s4_s4(const cmsis_nn_context *ctx,
+                                       const cmsis_nn_conv_params *conv_params,
+                                       const cmsis_nn_per_channel_quant_params *quant_params,
+                                       const cmsis_nn_dims *input_dims,
+                                       const int8_t *input_data,
+                                       const cmsis_nn_dims *filter_dims,
+                                       const int8_t *packed_filter_data,
+                                       const cmsis_nn_dims *bias_dims,
+                                       const int32_t *bias_data,
+                                       const cmsis_nn_dims *output_dims,
+                                       int8_t *output_data);
+
+/**
+ * @brief Get the required buffer size for arm_convolve_s4_s4
+ *
+ * @param[in]       input_dims            Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]       filter_dims           Filter tensor dimensions. Format: [C_OUT, HK, WK, C_IN] where HK and WK
+ *                                        are the spatial filter dimensions
+ * @param[in]       output_dims           Output tensor dimensions. Format: [N, H, W, C_OUT]
+ * @return          The function returns required buffer size(bytes)
+ *
+ */
+int32_t arm_convolve_s4_s4_get_buffer_size(const cmsis_nn_dims *input_dims,
+                                           const cmsis_nn_dims *filter_dims,
+                                           const cmsis_nn_dims *output_dims);
+
+/**
+ * @brief Basic convolution function with packed int4 activations and int8 weights
+ * @param[in, out] ctx            Function context that contains the additional buffer required by the function.
+ *                                arm_convolve_s4_s8_get_buffer_size will return the buffer_size.
+ *                                The caller is expected to clear the buffer ,if applicable, for security reasons.
+ * @param[in]      conv_params    Convolution parameters (e.g. strides, dilations, pads,...).
+ *                                Range of conv_params->input_offset  : [-7, 8]
+ *                                Range of conv_params->output_offset : [-8, 7]
+ *                                conv_params->activation is within [-8, 7]
+ * @param[in]      quant_params   Per-channel quantization info.
+ *                                It contains the multiplier and shift values to be applied to each output channel
+ * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]      input_data     Input (activation) data pointer. Data type: int8 packed with 2x int4, element 2 * n
+ *                                in the low nibble of byte n
+ * @param[in]      filter_dims    Filter tensor dimensions. Format: [C_OUT, HK, WK, C_IN] where HK and WK are the
+ *                                spatial filter dimensions
+ * @param[in]      filter_data    Filter data pointer. Data type: int8
+ * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+ * @param[in]      bias_data      Optional bias data pointer. Data type: int32
+ * @param[in]      output_dims    Output tensor dimensions. Format: [N, H, W, C_OUT]
+ * @param[out]     output_data    Output data pointer. Data type: int8 packed with 2x int4
+ *
+ * @return     The function returns either
+ *                  <code>ARM_CMSIS_NN_ARG_ERROR</code> if no buffer is provided or,
+ *                  <code>ARM_CMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    1. Supported framework: TensorFlow Lite micro
+ *    2. Activations stay packed in memory, which halves the activation traffic and the size of the tensors in the
+ *       arena. Up to four im2col columns are unpacked at a time and their results are packed into the output,
+ *       so neither the input nor the output is ever held unpacked.
+ *
+ */
+arm_cmsis_nn_status arm_convolve_s4_s8(const cmsis_nn_context *ctx,
+                                       const cmsis_nn_conv_params *conv_params,
+                                       const cmsis_nn_per_channel_quant_params *quant_params,
+                                       const cmsis_nn_dims *input_dims,
+                                       const int8_t *input_data,
+                                       const cmsis_nn_dims *filter_dims,
+                                       const int8_t *filter_data,
+                                       const cmsis_nn_dims *bias_dims,
+                                       const int32_t *bias_data,
+                                       const cmsis_nn_dims *output_dims,
+                                       int8_t *output_data);
+
+/**
+ * @brief Get the required buffer size for arm_convolve_s4_s8
+ *
+ * @param[in]       input_dims            Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]       filter_dims           Filter tensor dimensions. Format: [C_OUT, HK, WK, C_IN] where HK and WK
+ *                                        are the spatial filter dimensions
+ * @param[in]       output_dims           Output tensor dimensions. Format: [N, H, W, C_OUT]
+ * @return          The function returns required buffer size(bytes)
+ *
+ */
+int32_t arm_convolve_s4_s8_get_buffer_size(const cmsis_nn_dims *input_dims,
+                                           const cmsis_nn_dims *filter_dims,
+                                           const cmsis_nn_dims *output_dims);
+
 /**
  * @brief Get the required buffer size for s8 convolution function
  *
@@ -464,6 +582,135 @@ int32_t arm_convolve_s4_get_buffer_size(const cmsis_nn_dims *input_dims, const c
  */
 int32_t arm_convolve_s8_get_buffer_size(const cmsis_nn_dims *input_dims, const cmsis_nn_dims *filter_dims);
 
+/**
+ * @brief s8 3x3 stride 1 convolution in the Winograd F(2x2, 3x3) domain
+ * @param[in, out] ctx                  Function context that contains the additional buffer required by the
+ *                                      function. arm_convolve_winograd_s8_get_buffer_size will return the
+ *                                      buffer_size. The caller is expected to clear the buffer, if applicable, for
+ *                                      security reasons.
+ * @param[in]      conv_params          Convolution parameters (e.g. strides, dilations, pads,...).
+ *                                      Range of conv_params->input_offset  : [-127, 128]
+ *                                      Range of conv_params->output_offset : [-128, 127]
+ * @param[in]      quant_params         Per-channel quantization info.
+ *                                      It contains the multiplier and shift values to be applied to each output
+ *                                      channel
+ * @param[in]      input_dims           Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]      input_data           Input (activation) data pointer. Data type: int8
+ * @param[in]      filter_dims          Filter tensor dimensions. Format: [C_OUT, 3, 3, C_IN]
+ * @param[in]      winograd_filter_data Filter transformed by arm_convolve_winograd_s8_transform_filter.
+ *                                      Data type: int16
+ * @param[in]      bias_dims            Bias tensor dimensions. Format: [C_OUT]
+ * @param[in]      bias_data            Optional bias data pointer. Data type: int32
+ * @param[in]      output_dims          Output tensor dimensions. Format: [N, H, W, C_OUT]
+ * @param[out]     output_data          Output data pointer. Data type: int8
+ *
+ * @return     The function returns <code>ARM_CMSIS_NN_SUCCESS</code> if successful or
+ *                                  <code>ARM_CMSIS_NN_ARG_ERROR</code> if the parameters are not supported, see
+ *                                  arm_convolve_winograd_s8_get_filter_size().
+ *
+ * @details
+ *    1. Supported framework: TensorFlow Lite micro
+ *    2. The output is bit-exact against arm_convolve_s8. The filter and input transforms are scaled to stay in
+ *       integers and the output tile is divided back exactly, so no rounding is introduced.
+ *    3. Multiplications per output are 4 * C_IN instead of 9 * C_IN, at the cost of 16 * C_IN * C_OUT int16
+ *       transformed filter values.
+ *
+ */
+arm_cmsis_nn_status arm_convolve_winograd_s8(const cmsis_nn_context *ctx,
+                                             const cmsis_nn_conv_params *conv_params,
+                                             const cmsis_nn_per_channel_quant_params *quant_params,
+                                             const cmsis_nn_dims *input_dims,
+                                             const int8_t *input_data,
+                                             const cmsis_nn_dims *filter_dims,
+                                             const int16_t *winograd_filter_data,
+                                             const cmsis_nn_dims *bias_dims,
+                                             const int32_t *bias_data,
+                                             const cmsis_nn_dims *output_dims,
+                                             int8_t *output_data);
+
+/**
+ * @brief Get the size of the transformed filter for arm_convolve_winograd_s8
+ *
+ * @param[in]       conv_params           Convolution parameters (e.g. strides, dilations, pads,...).
+ * @param[in]       input_dims            Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]       filter_dims           Filter tensor dimensions. Format: [C_OUT, HK, WK, CK]
+ * @param[in]       output_dims           Output tensor dimensions. Format: [N, H, W, C_OUT]
+ * @return          The function returns the transformed filter size (bytes), or 0 if arm_convolve_winograd_s8 does
+ *                  not support the parameters: it requires a 3x3 filter, stride 1, dilation 1, no grouping and at
+ *                  most 1024 input channels.
+ *
+ */
+int32_t arm_convolve_winograd_s8_get_filter_size(const cmsis_nn_conv_params *conv_params,
+                                                 const cmsis_nn_dims *input_dims,
+                                                 const cmsis_nn_dims *filter_dims,
+                                                 const cmsis_nn_dims *output_dims);
+
+/**
+ * @brief Transform an s8 3x3 filter for arm_convolve_winograd_s8. Intended to run once, e.g. at model prepare time.
+ *
+ * @param[in]       filter_dims           Filter tensor dimensions. Format: [C_OUT, 3, 3, C_IN]
+ * @param[in]       output_dims           Output tensor dimensions. Format: [N, H, W, C_OUT]
+ * @param[in]       filter_data           Filter data pointer. Data type: int8
+ * @param[out]      winograd_filter_data  Transformed filter, arm_convolve_winograd_s8_get_filter_size() bytes.
+ *                                        Data type: int16
+ * @return          The function returns <code>ARM_CMSIS_NN_SUCCESS</code> or <code>ARM_CMSIS_NN_ARG_ERROR</code>
+ *                  if the filter is not 3x3.
+ *
+ */
+arm_cmsis_nn_status arm_convolve_winograd_s8_transform_filter(const cmsis_nn_dims *filter_dims,
+                                                              const cmsis_nn_dims *output_dims,
+                                                              const int8_t *filter_data,
+                                                              int16_t *winograd_filter_data);
+
+/**
+ * @brief Get the required buffer size for arm_convolve_winograd_s8
+ *
+ * @param[in]       input_dims            Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @return          The function returns required buffer size(bytes)
+ *
+ */
+int32_t arm_convolve_winograd_s8_get_buffer_size(const cmsis_nn_dims *input_dims);
+
+/**
+ * @brief s8 convolution that reads the input in place instead of through an im2col buffer
+ * @param[in]      ctx            Function context. Not used, ctx->buf may be NULL.
+ * @param[in]      conv_params    Convolution parameters (e.g. strides, dilations, pads,...).
+ *                                Range of conv_params->input_offset  : [-127, 128]
+ *                                Range of conv_params->output_offset : [-128, 127]
+ * @param[in]      quant_params   Per-channel quantization info.
+ *                                It contains the multiplier and shift values to be applied to each output channel
+ * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]      input_data     Input (activation) data pointer. Data type: int8
+ * @param[in]      filter_dims    Filter tensor dimensions. Format: [C_OUT, HK, WK, CK]. CK != C_IN is used for
+ *                                grouped convolution, see arm_convolve_s8().
+ * @param[in]      filter_data    Filter data pointer. Data type: int8
+ * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+ * @param[in]      bias_data      Optional bias data pointer. Data type: int32
+ * @param[in]      output_dims    Output tensor dimensions. Format: [N, H, W, C_OUT]
+ * @param[out]     output_data    Output data pointer. Data type: int8
+ *
+ * @return     The function returns <code>ARM_CMSIS_NN_SUCCESS</code> if successful or
+ *                                  <code>ARM_CMSIS_NN_ARG_ERROR</code> if incorrect arguments
+ *
+ * @details
+ *    1. Supported framework: TensorFlow Lite micro
+ *    2. No additional memory is required. The kernel window is clamped to the valid input region instead of
+ *       padding, so results match arm_convolve_s8 without upscaling. It is slower than arm_convolve_s8 and is meant
+ *       for layers where the im2col buffer does not fit the memory budget.
+ *
+ */
+arm_cmsis_nn_status arm_convolve_implicit_s8(const cmsis_nn_context *ctx,
+                                             const cmsis_nn_conv_params *conv_params,
+                                             const cmsis_nn_per_channel_quant_params *quant_params,
+                                             const cmsis_nn_dims *input_dims,
+                                             const int8_t *input_data,
+                                             const cmsis_nn_dims *filter_dims,
+                                             const int8_t *filter_data,
+                                             const cmsis_nn_dims *bias_dims,
+                                             const int32_t *bias_data,
+                                             const cmsis_nn_dims *output_dims,
+                                             int8_t *output_data);
+
 /**
  * @brief Wrapper to select optimal transposed convolution algorithm depending on parameters.
  * @param[in, out] ctx                   Function context that contains the additional buffer if required by the
@@ -667,6 +914,44 @@ arm_cmsis_nn_status arm_convolve_s16(const cmsis_nn_context *ctx,
  */
 int32_t arm_convolve_s16_get_buffer_size(const cmsis_nn_dims *input_dims, const cmsis_nn_dims *filter_dims);
 
+/**
+ * @brief s16 convolution that reads the input in place instead of through an im2col buffer
+ * @param[in]      ctx            Function context. Not used, ctx->buf may be NULL.
+ * @param[in]      conv_params    Convolution parameters (e.g. strides, dilations, pads,...).
+ *                                conv_params->input_offset  : Not used
+ *                                conv_params->output_offset : Not used
+ * @param[in]      quant_params   Per-channel quantization info.
+ *                                It contains the multiplier and shift values to be applied to each output channel
+ * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]      input_data     Input (activation) data pointer. Data type: int16
+ * @param[in]      filter_dims    Filter tensor dimensions. Format: [C_OUT, HK, WK, C_IN]
+ * @param[in]      filter_data    Filter data pointer. Data type: int8
+ * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+ * @param[in]      bias_data      Struct with optional bias data pointer. Bias data type can be int64 or int32 depending
+ *                                flag in struct.
+ * @param[in]      output_dims    Output tensor dimensions. Format: [N, H, W, C_OUT]
+ * @param[out]     output_data    Output data pointer. Data type: int16
+ *
+ * @return     The function returns <code>ARM_CMSIS_NN_SUCCESS</code> if successful or
+ *                                  <code>ARM_CMSIS_NN_ARG_ERROR</code> if incorrect arguments
+ *
+ * @details
+ *    1. Supported framework: TensorFlow Lite micro
+ *    2. No additional memory is required. See arm_convolve_implicit_s8() for when to prefer it.
+ *
+ */
+arm_cmsis_nn_status arm_convolve_implicit_s16(const cmsis_nn_context *ctx,
+                                              const cmsis_nn_conv_params *conv_params,
+                                              const cmsis_nn_per_channel_quant_params *quant_params,
+                                              const cmsis_nn_dims *input_dims,
+                                              const int16_t *input_data,
+                                              const cmsis_nn_dims *filter_dims,
+                                              const int8_t *filter_data,
+                                              const cmsis_nn_dims *bias_dims,
+                                              const cmsis_nn_bias_data *bias_data,
+                                              const cmsis_nn_dims *output_dims,
+                                              int16_t *output_data);
+
 /**
  * @brief Fast s4 version for 1x1 convolution (non-square shape)
  *
@@ -1019,6 +1304,7 @@ int32_t arm_convolve_1_x_n_s4_get_buffer_size(const cmsis_nn_conv_params *conv_p
  *        -# arm_depthwise_conv_s8()
  *        -# arm_depthwise_conv_3x3_s8() - Cortex-M CPUs with DSP extension only
  *        -# arm_depthwise_conv_s8_opt()
+ *        -# arm_depthwise_conv_row_reuse_s8() - RISC-V CPUs without DSP extension only
  *    - Check details of arm_depthwise_conv_s8_opt() for potential data that can be accessed outside of the
  * boundary.
  */
@@ -1436,6 +1722,7 @@ int32_t arm_depthwise_conv_fast_s16_get_buffer_size(const cmsis_nn_dims *input_d
  *      -# Number of input channel equals number of output channels
  *      -# Filter height and width equals 3
  *      -# Padding along x is either 0 or 1.
+ *      -# Padding on the right, as implied by the output width, is at most 1.
  *
  */
 arm_cmsis_nn_status arm_depthwise_conv_3x3_s8(const cmsis_nn_context *ctx,
@@ -1529,6 +1816,55 @@ arm_cmsis_nn_status arm_depthwise_conv_s4_opt(const cmsis_nn_context *ctx,
  */
 int32_t arm_depthwise_conv_s8_opt_get_buffer_size(const cmsis_nn_dims *input_dims, const cmsis_nn_dims *filter_dims);
 
+/**
+ * @brief s8 depthwise convolution function with channel multiplier of 1 that reuses loaded input rows and columns.
+ *        Refer arm_depthwise_conv_s8() for function argument details.
+ *
+ * @param[in, out] ctx             Function context that contains the additional buffer.
+ *                                 arm_depthwise_conv_row_reuse_s8_get_buffer_size() provides the buffer size.
+ *
+ * @return     The function returns one of the following
+ *                <code>ARM_CMSIS_NN_ARG_ERROR</code> - input channel != output channel, ch_mult != 1,
+ *                                                      dilation != 1 or ctx->buf is NULL
+ *                <code>ARM_CMSIS_NN_SUCCESS</code> - Successful operation
+ *
+ * @details
+ *    - Supported framework: TensorFlow Lite
+ *    - Written for cores without SIMD such as RV32IMC. Channels are processed in blocks of CH_IN_BLOCK_ROW_REUSE.
+ *      The kernel height input rows of a block are kept in a rolling line buffer, one line per channel with the
+ *      padding filled in, so moving to the next output row only loads the stride new input rows.
+ *    - Along a line the 3x3 kernel (stride 1 or 2) keeps its window in registers and loads only the columns that
+ *      enter it. The 5x5 kernel (stride 1) computes four outputs per pass to share loaded columns and weights.
+ *      Other sizes use a generic loop over the line buffer.
+ *    - Batches are supported.
+ *
+ */
+arm_cmsis_nn_status arm_depthwise_conv_row_reuse_s8(const cmsis_nn_context *ctx,
+                                                    const cmsis_nn_dw_conv_params *dw_conv_params,
+                                                    const cmsis_nn_per_channel_quant_params *quant_params,
+                                                    const cmsis_nn_dims *input_dims,
+                                                    const int8_t *input_data,
+                                                    const cmsis_nn_dims *filter_dims,
+                                                    const int8_t *filter_data,
+                                                    const cmsis_nn_dims *bias_dims,
+                                                    const int32_t *bias_data,
+                                                    const cmsis_nn_dims *output_dims,
+                                                    int8_t *output_data);
+
+/**
+ * @brief Get the required buffer size for arm_depthwise_conv_row_reuse_s8()
+ * @param[in]       dw_conv_params  Depthwise convolution parameters. Only the stride is used.
+ * @param[in]       input_dims      Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]       filter_dims     Filter tensor dimensions. Format: [1, H, W, C_OUT]
+ * @param[in]       output_dims     Output tensor dimensions. Format: [N, H, W, C_OUT]
+ * @return          The function returns required buffer size in bytes
+ *
+ */
+int32_t arm_depthwise_conv_row_reuse_s8_get_buffer_size(const cmsis_nn_dw_conv_params *dw_conv_params,
+                                                        const cmsis_nn_dims *input_dims,
+                                                        const cmsis_nn_dims *filter_dims,
+                                                        const cmsis_nn_dims *output_dims);
+
 /**
  * @brief Get the required buffer size for optimized s4 depthwise convolution
  * function with constraint that in_channel equals out_channel.
@@ -1602,27 +1938,27 @@ arm_cmsis_nn_status arm_fully_connected_s4(const cmsis_nn_context *ctx,
                                            int8_t *output_data);
 
 /**
- * @brief Basic s8 Fully Connected function.
+ * @brief Fully Connected function with packed int4 activations and int4 weights.
  *
- * @param[in, out] ctx           Function context (e.g. temporary buffer). Check the function
- *                               definition file to see if an additional buffer is required.
- *                               Optional function {API}_get_buffer_size() provides the buffer
- *                               size if an additional buffer is required.
- *                               The caller is expected to clear the buffer, if applicable, for security reasons.
+ * @param[in, out] ctx           Function context that contains the additional buffer required by the function.
+ *                               arm_fully_connected_s4_s4_get_buffer_size() provides the buffer size.
+ *                               The caller is expected to clear the buffer ,if applicable, for security reasons.
  * @param[in]      fc_params     Fully Connected layer parameters.
- *                               Range of fc_params->input_offset  : [-127, 128]
+ *                               Range of fc_params->input_offset  : [-7, 8]
  *                               fc_params->filter_offset : 0
- *                               Range of fc_params->output_offset : [-128, 127]
+ *                               Range of fc_params->output_offset : [-8, 7]
+ *                               fc_params->activation is within [-8, 7]
  * @param[in]      quant_params  Per-tensor quantization info.
  *                               It contains the multiplier and shift value to be applied to the output tensor.
  * @param[in]      input_dims    Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
  *                               Input dimension is taken as Nx(H * W * C_IN)
- * @param[in]      input_data    Input (activation) data pointer. Data type: int8
+ * @param[in]      input_data    Input (activation) data pointer. Data type: int8 packed with 2x int4, element 2 * n
+ *                               in the low nibble of byte n
  * @param[in]      filter_dims   Two dimensional filter dimensions. Format: [N, C]
  *                               N : accumulation depth and equals (H * W * C_IN) from input_dims
  *                               C : output depth and equals C_OUT in output_dims
  *                               H & W : Not used
- * @param[in]      filter_data   Filter data pointer. Data type: int8
+ * @param[in]      filter_data   Filter data pointer. Data type: int8_t packed 4-bit weights
  * @param[in]      bias_dims     Bias tensor dimensions. Format: [C_OUT]
  *                               N, H, W : Not used
  * @param[in]      bias_data     Bias data pointer. Data type: int32
@@ -1630,44 +1966,52 @@ arm_cmsis_nn_status arm_fully_connected_s4(const cmsis_nn_context *ctx,
  *                               N : Batches
  *                               C_OUT : Output depth
  *                               H & W : Not used.
- * @param[in, out] output_data    Output data pointer. Data type: int8
- *
+ * @param[in, out] output_data   Output data pointer. Data type: int8 packed with 2x int4
  * @return     The function returns either
- *                  <code>ARM_CMSIS_NN_ARG_ERROR</code> if argument constraints fail. or,
+ *                  <code>ARM_CMSIS_NN_ARG_ERROR</code> if no buffer is provided or,
  *                  <code>ARM_CMSIS_NN_SUCCESS</code> on successful completion.
  *
  * @details
  *    - Supported framework: TensorFlow Lite
+ *    - The batches are packed back to back, so a batch starts in the middle of a byte when C_IN or C_OUT is odd.
  */
-arm_cmsis_nn_status arm_fully_connected_s8(const cmsis_nn_context *ctx,
-                                           const cmsis_nn_fc_params *fc_params,
-                                           const cmsis_nn_per_tensor_quant_params *quant_params,
-                                           const cmsis_nn_dims *input_dims,
-                                           const int8_t *input_data,
-                                           const cmsis_nn_dims *filter_dims,
-                                           const int8_t *filter_data,
-                                           const cmsis_nn_dims *bias_dims,
-                                           const int32_t *bias_data,
-                                           const cmsis_nn_dims *output_dims,
-                                           int8_t *output_data);
+arm_cmsis_nn_status arm_fully_connected_s4_s4(const cmsis_nn_context *ctx,
+                                              const cmsis_nn_fc_params *fc_params,
+                                              const cmsis_nn_per_tensor_quant_params *quant_params,
+                                              const cmsis_nn_dims *input_dims,
+                                              const int8_t *input_data,
+                                              const cmsis_nn_dims *filter_dims,
+                                              const int8_t *filter_data,
+                                              const cmsis_nn_dims *bias_dims,
+                                              const int32_t *bias_data,
+                                              const cmsis_nn_dims *output_dims,
+                                              int8_t *output_data);
 
 /**
- * @brief Basic s8 Fully Connected function using per channel quantization.
+ * @brief Get size of additional buffer required by arm_fully_connected_s4_s4().
+ * @param[in]      filter_dims             dimension of filter
+ * @return         The function returns    required buffer size in bytes
  *
- * @param[in, out] ctx           Function context (e.g. temporary buffer). Check the function
- *                               definition file to see if an additional buffer is required.
- *                               Optional function {API}_get_buffer_size() provides the buffer
- *                               size if an additional buffer is required.
- *                               The caller is expected to clear the buffer, if applicable, for security reasons.
+ */
+int32_t arm_fully_connected_s4_s4_get_buffer_size(const cmsis_nn_dims *filter_dims);
+
+/**
+ * @brief Fully Connected function with packed int4 activations and int8 weights.
+ *
+ * @param[in, out] ctx           Function context that contains the additional buffer required by the function.
+ *                               arm_fully_connected_s4_s8_get_buffer_size() provides the buffer size.
+ *                               The caller is expected to clear the buffer ,if applicable, for security reasons.
  * @param[in]      fc_params     Fully Connected layer parameters.
- *                               Range of fc_params->input_offset  : [-127, 128]
- *                               fc_params->filter_offset : 0
- *                               Range of fc_params->output_offset : [-128, 127]
- * @param[in]      quant_params  Per-channel quantization info.
- *                               It contains the multiplier and shift values to be applied to each output channel
+ *                               Range of fc_params->input_offset  : [-7, 8]
+ *                               Range of fc_params->filter_offset : [-127, 128]
+ *                               Range of fc_params->output_offset : [-8, 7]
+ *                               fc_params->activation is within [-8, 7]
+ * @param[in]      quant_params  Per-tensor quantization info.
+ *                               It contains the multiplier and shift value to be applied to the output tensor.
  * @param[in]      input_dims    Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
  *                               Input dimension is taken as Nx(H * W * C_IN)
- * @param[in]      input_data    Input (activation) data pointer. Data type: int8
+ * @param[in]      input_data    Input (activation) data pointer. Data type: int8 packed with 2x int4, element 2 * n
+ *                               in the low nibble of byte n
  * @param[in]      filter_dims   Two dimensional filter dimensions. Format: [N, C]
  *                               N : accumulation depth and equals (H * W * C_IN) from input_dims
  *                               C : output depth and equals C_OUT in output_dims
@@ -1680,31 +2024,139 @@ arm_cmsis_nn_status arm_fully_connected_s8(const cmsis_nn_context *ctx,
  *                               N : Batches
  *                               C_OUT : Output depth
  *                               H & W : Not used.
- * @param[in, out] output_data    Output data pointer. Data type: int8
- *
+ * @param[in, out] output_data   Output data pointer. Data type: int8 packed with 2x int4
  * @return     The function returns either
- *                  <code>ARM_CMSIS_NN_ARG_ERROR</code> if argument constraints fail. or,
+ *                  <code>ARM_CMSIS_NN_ARG_ERROR</code> if no buffer is provided or,
  *                  <code>ARM_CMSIS_NN_SUCCESS</code> on successful completion.
  *
  * @details
  *    - Supported framework: TensorFlow Lite
+ *    - The batches are packed back to back, so a batch starts in the middle of a byte when C_IN or C_OUT is odd.
  */
-arm_cmsis_nn_status arm_fully_connected_per_channel_s8(const cmsis_nn_context *ctx,
-                                                       const cmsis_nn_fc_params *fc_params,
-                                                       const cmsis_nn_per_channel_quant_params *quant_params,
-                                                       const cmsis_nn_dims *input_dims,
-                                                       const int8_t *input_data,
-                                                       const cmsis_nn_dims *filter_dims,
-                                                       const int8_t *filter_data,
-                                                       const cmsis_nn_dims *bias_dims,
-                                                       const int32_t *bias_data,
-                                                       const cmsis_nn_dims *output_dims,
-                                                       int8_t *output_data);
-
-/**
- * @brief s8 Fully Connected layer wrapper function
- *
- * @param[in, out] ctx           Function context (e.g. temporary buffer). Check the function
+arm_cmsis_nn_status arm_fully_connected_s4_s8(const cmsis_nn_context *ctx,
+                                              const cmsis_nn_fc_params *fc_params,
+                                              const cmsis_nn_per_tensor_quant_params *quant_params,
+                                              const cmsis_nn_dims *input_dims,
+                                              const int8_t *input_data,
+                                              const cmsis_nn_dims *filter_dims,
+                                              const int8_t *filter_data,
+                                              const cmsis_nn_dims *bias_dims,
+                                              const int32_t *bias_data,
+                                              const cmsis_nn_dims *output_dims,
+                                              int8_t *output_data);
+
+/**
+ * @brief Get size of additional buffer required by arm_fully_connected_s4_s8().
+ * @param[in]      filter_dims             dimension of filter
+ * @return         The function returns    required buffer size in bytes
+ *
+ */
+int32_t arm_fully_connected_s4_s8_get_buffer_size(const cmsis_nn_dims *filter_dims);
+
+/**
+ * @brief Basic s8 Fully Connected function.
+ *
+ * @param[in, out] ctx           Function context (e.g. temporary buffer). Check the function
+ *                               definition file to see if an additional buffer is required.
+ *                               Optional function {API}_get_buffer_size() provides the buffer
+ *                               size if an additional buffer is required.
+ *                               The caller is expected to clear the buffer, if applicable, for security reasons.
+ * @param[in]      fc_params     Fully Connected layer parameters.
+ *                               Range of fc_params->input_offset  : [-127, 128]
+ *                               fc_params->filter_offset : 0
+ *                               Range of fc_params->output_offset : [-128, 127]
+ * @param[in]      quant_params  Per-tensor quantization info.
+ *                               It contains the multiplier and shift value to be applied to the output tensor.
+ * @param[in]      input_dims    Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ *                               Input dimension is taken as Nx(H * W * C_IN)
+ * @param[in]      input_data    Input (activation) data pointer. Data type: int8
+ * @param[in]      filter_dims   Two dimensional filter dimensions. Format: [N, C]
+ *                               N : accumulation depth and equals (H * W * C_IN) from input_dims
+ *                               C : output depth and equals C_OUT in output_dims
+ *                               H & W : Not used
+ * @param[in]      filter_data   Filter data pointer. Data type: int8
+ * @param[in]      bias_dims     Bias tensor dimensions. Format: [C_OUT]
+ *                               N, H, W : Not used
+ * @param[in]      bias_data     Bias data pointer. Data type: int32
+ * @param[in]      output_dims   Output tensor dimensions. Format: [N, C_OUT]
+ *                               N : Batches
+ *                               C_OUT : Output depth
+ *                               H & W : Not used.
+ * @param[in, out] output_data    Output data pointer. Data type: int8
+ *
+ * @return     The function returns either
+ *                  <code>ARM_CMSIS_NN_ARG_ERROR</code> if argument constraints fail. or,
+ *                  <code>ARM_CMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    - Supported framework: TensorFlow Lite
+ */
+arm_cmsis_nn_status arm_fully_connected_s8(const cmsis_nn_context *ctx,
+                                           const cmsis_nn_fc_params *fc_params,
+                                           const cmsis_nn_per_tensor_quant_params *quant_params,
+                                           const cmsis_nn_dims *input_dims,
+                                           const int8_t *input_data,
+                                           const cmsis_nn_dims *filter_dims,
+                                           const int8_t *filter_data,
+                                           const cmsis_nn_dims *bias_dims,
+                                           const int32_t *bias_data,
+                                           const cmsis_nn_dims *output_dims,
+                                           int8_t *output_data);
+
+/**
+ * @brief Basic s8 Fully Connected function using per channel quantization.
+ *
+ * @param[in, out] ctx           Function context (e.g. temporary buffer). Check the function
+ *                               definition file to see if an additional buffer is required.
+ *                               Optional function {API}_get_buffer_size() provides the buffer
+ *                               size if an additional buffer is required.
+ *                               The caller is expected to clear the buffer, if applicable, for security reasons.
+ * @param[in]      fc_params     Fully Connected layer parameters.
+ *                               Range of fc_params->input_offset  : [-127, 128]
+ *                               fc_params->filter_offset : 0
+ *                               Range of fc_params->output_offset : [-128, 127]
+ * @param[in]      quant_params  Per-channel quantization info.
+ *                               It contains the multiplier and shift values to be applied to each output channel
+ * @param[in]      input_dims    Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ *                               Input dimension is taken as Nx(H * W * C_IN)
+ * @param[in]      input_data    Input (activation) data pointer. Data type: int8
+ * @param[in]      filter_dims   Two dimensional filter dimensions. Format: [N, C]
+ *                               N : accumulation depth and equals (H * W * C_IN) from input_dims
+ *                               C : output depth and equals C_OUT in output_dims
+ *                               H & W : Not used
+ * @param[in]      filter_data   Filter data pointer. Data type: int8
+ * @param[in]      bias_dims     Bias tensor dimensions. Format: [C_OUT]
+ *                               N, H, W : Not used
+ * @param[in]      bias_data     Bias data pointer. Data type: int32
+ * @param[in]      output_dims   Output tensor dimensions. Format: [N, C_OUT]
+ *                               N : Batches
+ *                               C_OUT : Output depth
+ *                               H & W : Not used.
+ * @param[in, out] output_data    Output data pointer. Data type: int8
+ *
+ * @return     The function returns either
+ *                  <code>ARM_CMSIS_NN_ARG_ERROR</code> if argument constraints fail. or,
+ *                  <code>ARM_CMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    - Supported framework: TensorFlow Lite
+ */
+arm_cmsis_nn_status arm_fully_connected_per_channel_s8(const cmsis_nn_context *ctx,
+                                                       const cmsis_nn_fc_params *fc_params,
+                                                       const cmsis_nn_per_channel_quant_params *quant_params,
+                                                       const cmsis_nn_dims *input_dims,
+                                                       const int8_t *input_data,
+                                                       const cmsis_nn_dims *filter_dims,
+                                                       const int8_t *filter_data,
+                                                       const cmsis_nn_dims *bias_dims,
+                                                       const int32_t *bias_data,
+                                                       const cmsis_nn_dims *output_dims,
+                                                       int8_t *output_data);
+
+/**
+ * @brief s8 Fully Connected layer wrapper function
+ *
+ * @param[in, out] ctx           Function context (e.g. temporary buffer). Check the function
  *                               definition file to see if an additional buffer is required.
  *                               Optional function {API}_get_buffer_size() provides the buffer
  *                               size if an additional buffer is required.
@@ -1818,6 +2270,98 @@ int32_t arm_fully_connected_s8_get_buffer_size_dsp(const cmsis_nn_dims *filter_d
  */
 int32_t arm_fully_connected_s8_get_buffer_size_mve(const cmsis_nn_dims *filter_dims);
 
+#define FC_PACKED_S8_PANEL_ROWS (4)
+#define FC_PACKED_S8_PANEL_COLS (4)
+#define CMSIS_NN_PACKED_WEIGHTS_MAGIC (0x504E4E43)
+#define CMSIS_NN_PACKED_WEIGHTS_VERSION (1)
+
+/**
+ * @brief Get the size of s8 fully connected weights packed by arm_fully_connected_pack_weights_s8().
+ * @param[in]      filter_dims             dimension of filter
+ * @return         The function returns    size of the packed weights in bytes
+ *
+ */
+int32_t arm_fully_connected_packed_s8_get_weights_size(const cmsis_nn_dims *filter_dims);
+
+/**
+ * @brief Pack s8 fully connected weights for arm_fully_connected_packed_s8().
+ *
+ * @param[in]    fc_params     Fully Connected layer parameters. Only input_offset and filter_offset are used.
+ *                             Range of fc_params->input_offset  : [-127, 128]
+ *                             fc_params->filter_offset must be 0
+ * @param[in]    filter_dims   Filter tensor dimensions. Format: [N, H, W, C] where
+ *                             N: accumulation depth. The product of N and C must be at least
+ *                             sizeof(cmsis_nn_packed_weights_header).
+ *                             C: output depth
+ * @param[in]    filter_data   Filter data pointer. Data type: int8, layout [C, N]
+ * @param[in]    bias_data     Bias data pointer. Data type: int32. Can be NULL.
+ * @param[out]   packed_data   Packed weights of arm_fully_connected_packed_s8_get_weights_size() bytes. 4 byte aligned.
+ *
+ * @return     The function returns either
+ *                  <code>ARM_CMSIS_NN_ARG_ERROR</code> if argument constraints fail. or,
+ *                  <code>ARM_CMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    Layout of the packed weights:
+ *    1. cmsis_nn_packed_weights_header
+ *    2. One int32 kernel sum per output channel: bias + input_offset * sum of the row
+ *    3. Panels of FC_PACKED_S8_PANEL_ROWS rows. Within a panel, blocks of FC_PACKED_S8_PANEL_COLS columns of
+ *       each row follow each other, first row first. Rows and columns past the end of the filter are zero.
+ *
+ *    Intended to be run offline, e.g. on the host when converting a model, so that neither the kernel sums nor
+ *    the reordering has to be done at runtime.
+ */
+arm_cmsis_nn_status arm_fully_connected_pack_weights_s8(const cmsis_nn_fc_params *fc_params,
+                                                        const cmsis_nn_dims *filter_dims,
+                                                        const int8_t *filter_data,
+                                                        const int32_t *bias_data,
+                                                        int8_t *packed_data);
+
+/**
+ * @brief Check if fully connected weights were packed by arm_fully_connected_pack_weights_s8().
+ * @param[in]      filter_dims     dimension of filter
+ * @param[in]      filter_data     weights to check
+ * @return         true if filter_data starts with a packed weights header that matches filter_dims
+ *
+ */
+bool arm_fully_connected_s8_is_packed(const cmsis_nn_dims *filter_dims, const int8_t *filter_data);
+
+/**
+ * @brief s8 Fully Connected function on weights packed by arm_fully_connected_pack_weights_s8().
+ *
+ * @param[in]      fc_params     Fully Connected layer parameters.
+ *                               fc_params->input_offset must be the offset the weights were packed with.
+ *                               Range of fc_params->output_offset : [-128, 127]
+ * @param[in]      quant_params  Per-channel or per-tensor quantization info. Check struct definition for details.
+ * @param[in]      input_dims    Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ *                               Input dimension is taken as Nx(H * W * C_IN)
+ * @param[in]      input_data    Input (activation) data pointer. Data type: int8
+ * @param[in]      filter_dims   Two dimensional filter dimensions. Format: [N, C]
+ *                               N : accumulation depth and equals (H * W * C_IN) from input_dims
+ *                               C : output depth and equals C_OUT in output_dims
+ * @param[in]      packed_data   Packed weights. 4 byte aligned.
+ * @param[in]      output_dims   Output tensor dimensions. Format: [N, C_OUT]
+ * @param[in, out] output_data   Output data pointer. Data type: int8
+ *
+ * @return     The function returns either
+ *                  <code>ARM_CMSIS_NN_ARG_ERROR</code> if argument constraints fail. or,
+ *                  <code>ARM_CMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    1. Supported framework: TensorFlow Lite
+ *    2. The bias is part of the kernel sums of the packed weights.
+ *    3. Each panel is read front to back and every input block is loaded once per panel, no scratch buffer is
+ *       needed.
+ */
+arm_cmsis_nn_status arm_fully_connected_packed_s8(const cmsis_nn_fc_params *fc_params,
+                                                  const cmsis_nn_quant_params *quant_params,
+                                                  const cmsis_nn_dims *input_dims,
+                                                  const int8_t *input_data,
+                                                  const cmsis_nn_dims *filter_dims,
+                                                  const int8_t *packed_data,
+                                                  const cmsis_nn_dims *output_dims,
+                                                  int8_t *output_data);
+
 /**
  * @brief Basic s16 Fully Connected function.
  *
@@ -2032,6 +2576,171 @@ arm_cmsis_nn_status arm_elementwise_mul_s16(const int16_t *input_1_vect,
                                             const int32_t out_activation_max,
                                             const int32_t block_size);
 
+/**
+ * @brief s8 elementwise add of two tensors with broadcast
+ * @param[in]       input_1_vect        pointer to input tensor 1
+ * @param[in]       input_1_dims        input 1 tensor dimensions. Format: [N, H, W, C]
+ * @param[in]       input_2_vect        pointer to input tensor 2
+ * @param[in]       input_2_dims        input 2 tensor dimensions. Format: [N, H, W, C]
+ * @param[in]       input_1_offset      offset for input 1. Range: -127 to 128
+ * @param[in]       input_1_mult        multiplier for input 1
+ * @param[in]       input_1_shift       shift for input 1
+ * @param[in]       input_2_offset      offset for input 2. Range: -127 to 128
+ * @param[in]       input_2_mult        multiplier for input 2
+ * @param[in]       input_2_shift       shift for input 2
+ * @param[in]       left_shift          input left shift
+ * @param[in,out]   output              pointer to output tensor
+ * @param[in]       output_dims         output tensor dimensions. Format: [N, H, W, C]
+ * @param[in]       out_offset          output offset. Range: -128 to 127
+ * @param[in]       out_mult            output multiplier
+ * @param[in]       out_shift           output shift
+ * @param[in]       out_activation_min  minimum value to clamp output to. Min: -128
+ * @param[in]       out_activation_max  maximum value to clamp output to. Max: 127
+ * @return          The function returns either
+ *                  <code>ARM_CMSIS_NN_ARG_ERROR</code> if the dimensions cannot be broadcast or
+ *                  <code>ARM_CMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ * @details   Each dimension of an input must either match the output or be 1, in which case that input is broadcast
+ *            along it. Supported patterns include scalar, row, column, channel and batch broadcast. The loop nest is
+ *            planned by arm_nn_broadcast_init() so that the innermost loop always walks a contiguous run of the
+ *            output, with either both inputs contiguous or one of them held constant.
+ *
+ *            Supported framework: TensorFlow Lite micro
+ */
+arm_cmsis_nn_status arm_elementwise_add_broadcast_s8(const int8_t *input_1_vect,
+                                                     const cmsis_nn_dims *input_1_dims,
+                                                     const int8_t *input_2_vect,
+                                                     const cmsis_nn_dims *input_2_dims,
+                                                     const int32_t input_1_offset,
+                                                     const int32_t input_1_mult,
+                                                     const int32_t input_1_shift,
+                                                     const int32_t input_2_offset,
+                                                     const int32_t input_2_mult,
+                                                     const int32_t input_2_shift,
+                                                     const int32_t left_shift,
+                                                     int8_t *output,
+                                                     const cmsis_nn_dims *output_dims,
+                                                     const int32_t out_offset,
+                                                     const int32_t out_mult,
+                                                     const int32_t out_shift,
+                                                     const int32_t out_activation_min,
+                                                     const int32_t out_activation_max);
+
+/**
+ * @brief s16 elementwise add of two tensors with broadcast
+ * @param[in]       input_1_vect        pointer to input tensor 1
+ * @param[in]       input_1_dims        input 1 tensor dimensions. Format: [N, H, W, C]
+ * @param[in]       input_2_vect        pointer to input tensor 2
+ * @param[in]       input_2_dims        input 2 tensor dimensions. Format: [N, H, W, C]
+ * @param[in]       input_1_offset      offset for input 1. Not used.
+ * @param[in]       input_1_mult        multiplier for input 1
+ * @param[in]       input_1_shift       shift for input 1
+ * @param[in]       input_2_offset      offset for input 2. Not used.
+ * @param[in]       input_2_mult        multiplier for input 2
+ * @param[in]       input_2_shift       shift for input 2
+ * @param[in]       left_shift          input left shift
+ * @param[in,out]   output              pointer to output tensor
+ * @param[in]       output_dims         output tensor dimensions. Format: [N, H, W, C]
+ * @param[in]       out_offset          output offset. Not used.
+ * @param[in]       out_mult            output multiplier
+ * @param[in]       out_shift           output shift
+ * @param[in]       out_activation_min  minimum value to clamp output to. Min: -32768
+ * @param[in]       out_activation_max  maximum value to clamp output to. Max: 32767
+ * @return          The function returns either
+ *                  <code>ARM_CMSIS_NN_ARG_ERROR</code> if the dimensions cannot be broadcast or
+ *                  <code>ARM_CMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ * @details   Refer to arm_elementwise_add_broadcast_s8() for the supported broadcast patterns.
+ */
+arm_cmsis_nn_status arm_elementwise_add_broadcast_s16(const int16_t *input_1_vect,
+                                                      const cmsis_nn_dims *input_1_dims,
+                                                      const int16_t *input_2_vect,
+                                                      const cmsis_nn_dims *input_2_dims,
+                                                      const int32_t input_1_offset,
+                                                      const int32_t input_1_mult,
+                                                      const int32_t input_1_shift,
+                                                      const int32_t input_2_offset,
+                                                      const int32_t input_2_mult,
+                                                      const int32_t input_2_shift,
+                                                      const int32_t left_shift,
+                                                      int16_t *output,
+                                                      const cmsis_nn_dims *output_dims,
+                                                      const int32_t out_offset,
+                                                      const int32_t out_mult,
+                                                      const int32_t out_shift,
+                                                      const int32_t out_activation_min,
+                                                      const int32_t out_activation_max);
+
+/**
+ * @brief s8 elementwise multiplication of two tensors with broadcast
+ * @param[in]       input_1_vect        pointer to input tensor 1
+ * @param[in]       input_1_dims        input 1 tensor dimensions. Format: [N, H, W, C]
+ * @param[in]       input_2_vect        pointer to input tensor 2
+ * @param[in]       input_2_dims        input 2 tensor dimensions. Format: [N, H, W, C]
+ * @param[in]       input_1_offset      offset for input 1. Range: -127 to 128
+ * @param[in]       input_2_offset      offset for input 2. Range: -127 to 128
+ * @param[in,out]   output              pointer to output tensor
+ * @param[in]       output_dims         output tensor dimensions. Format: [N, H, W, C]
+ * @param[in]       out_offset          output offset. Range: -128 to 127
+ * @param[in]       out_mult            output multiplier
+ * @param[in]       out_shift           output shift
+ * @param[in]       out_activation_min  minimum value to clamp output to. Min: -128
+ * @param[in]       out_activation_max  maximum value to clamp output to. Max: 127
+ * @return          The function returns either
+ *                  <code>ARM_CMSIS_NN_ARG_ERROR</code> if the dimensions cannot be broadcast or
+ *                  <code>ARM_CMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ * @details   Refer to arm_elementwise_add_broadcast_s8() for the supported broadcast patterns.
+ */
+arm_cmsis_nn_status arm_elementwise_mul_broadcast_s8(const int8_t *input_1_vect,
+                                                     const cmsis_nn_dims *input_1_dims,
+                                                     const int8_t *input_2_vect,
+                                                     const cmsis_nn_dims *input_2_dims,
+                                                     const int32_t input_1_offset,
+                                                     const int32_t input_2_offset,
+                                                     int8_t *output,
+                                                     const cmsis_nn_dims *output_dims,
+                                                     const int32_t out_offset,
+                                                     const int32_t out_mult,
+                                                     const int32_t out_shift,
+                                                     const int32_t out_activation_min,
+                                                     const int32_t out_activation_max);
+
+/**
+ * @brief s16 elementwise multiplication of two tensors with broadcast
+ * @param[in]       input_1_vect        pointer to input tensor 1
+ * @param[in]       input_1_dims        input 1 tensor dimensions. Format: [N, H, W, C]
+ * @param[in]       input_2_vect        pointer to input tensor 2
+ * @param[in]       input_2_dims        input 2 tensor dimensions. Format: [N, H, W, C]
+ * @param[in]       input_1_offset      offset for input 1. Not used.
+ * @param[in]       input_2_offset      offset for input 2. Not used.
+ * @param[in,out]   output              pointer to output tensor
+ * @param[in]       output_dims         output tensor dimensions. Format: [N, H, W, C]
+ * @param[in]       out_offset          output offset. Not used.
+ * @param[in]       out_mult            output multiplier
+ * @param[in]       out_shift           output shift
+ * @param[in]       out_activation_min  minimum value to clamp output to. Min: -32768
+ * @param[in]       out_activation_max  maximum value to clamp output to. Max: 32767
+ * @return          The function returns either
+ *                  <code>ARM_CMSIS_NN_ARG_ERROR</code> if the dimensions cannot be broadcast or
+ *                  <code>ARM_CMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ * @details   Refer to arm_elementwise_add_broadcast_s8() for the supported broadcast patterns.
+ */
+arm_cmsis_nn_status arm_elementwise_mul_broadcast_s16(const int16_t *input_1_vect,
+                                                      const cmsis_nn_dims *input_1_dims,
+                                                      const int16_t *input_2_vect,
+                                                      const cmsis_nn_dims *input_2_dims,
+                                                      const int32_t input_1_offset,
+                                                      const int32_t input_2_offset,
+                                                      int16_t *output,
+                                                      const cmsis_nn_dims *output_dims,
+                                                      const int32_t out_offset,
+                                                      const int32_t out_mult,
+                                                      const int32_t out_shift,
+                                                      const int32_t out_activation_min,
+                                                      const int32_t out_activation_max);
+
 /**
  * @defgroup Acti Activation Functions
  *
@@ -2151,6 +2860,53 @@ int32_t arm_avgpool_s8_get_buffer_size_dsp(const int dim_dst_width, const int ch
  */
 int32_t arm_avgpool_s8_get_buffer_size_mve(const int dim_dst_width, const int ch_src);
 
+/**
+ * @brief s8 average pooling with a cost per output that does not depend on the window size.
+ *
+ * @param[in, out] ctx          Function context with a temporary buffer of at least
+ *                              arm_avgpool_sliding_s8_get_buffer_size() bytes
+ * @param[in]      pool_params  Pooling parameters
+ * @param[in]      input_dims   Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]      input_data   Input (activation) data pointer. Data type: int8
+ * @param[in]      filter_dims  Filter tensor dimensions. Format: [H, W]
+ *                              Argument N and C are not used.
+ * @param[in]      output_dims  Output tensor dimensions. Format: [H, W, C_OUT]
+ *                              Argument N is not used.
+ *                              C_OUT equals C_IN.
+ * @param[in, out] output_data  Output data pointer. Data type: int8
+ *
+ * @return     The function returns either
+ *                  <code>ARM_CMSIS_NN_ARG_ERROR</code> if argument constraints fail. or,
+ *                  <code>ARM_CMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    - Bit-exact with arm_avgpool_s8(). The window sum is kept as a running sum, separately along the height and the
+ *      width, so each output costs O(stride.w * stride.h) additions instead of O(H * W).
+ *    - arm_avgpool_s8() calls this function for windows of at least POOL_SLIDING_WINDOW_MIN_KERNEL_SIZE elements
+ *      that overlap, when ctx->size is large enough.
+ *    - Every window must cover at least one input element.
+ *
+ */
+arm_cmsis_nn_status arm_avgpool_sliding_s8(const cmsis_nn_context *ctx,
+                                           const cmsis_nn_pool_params *pool_params,
+                                           const cmsis_nn_dims *input_dims,
+                                           const int8_t *input_data,
+                                           const cmsis_nn_dims *filter_dims,
+                                           const cmsis_nn_dims *output_dims,
+                                           int8_t *output_data);
+
+/**
+ * @brief Get the required buffer size for arm_avgpool_sliding_s8()
+ * @param[in]       input_dims    Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]       filter_dims   Filter tensor dimensions. Format: [H, W]
+ * @param[in]       output_dims   Output tensor dimensions. Format: [H, W, C_OUT]
+ * @return          The function returns required buffer size in bytes
+ *
+ */
+int32_t arm_avgpool_sliding_s8_get_buffer_size(const cmsis_nn_dims *input_dims,
+                                               const cmsis_nn_dims *filter_dims,
+                                               const cmsis_nn_dims *output_dims);
+
 /**
  * @brief s16 average pooling function.
  *
@@ -2241,13 +2997,62 @@ int32_t arm_avgpool_s16_get_buffer_size_mve(const int dim_dst_width, const int c
  *    - Supported Framework: TensorFlow Lite
  *
  */
-arm_cmsis_nn_status arm_max_pool_s8(const cmsis_nn_context *ctx,
-                                    const cmsis_nn_pool_params *pool_params,
-                                    const cmsis_nn_dims *input_dims,
-                                    const int8_t *input_data,
-                                    const cmsis_nn_dims *filter_dims,
-                                    const cmsis_nn_dims *output_dims,
-                                    int8_t *output_data);
+arm_cmsis_nn_status arm_max_pool_s8(const cmsis_nn_context *ctx,
+                                    const cmsis_nn_pool_params *pool_params,
+                                    const cmsis_nn_dims *input_dims,
+                                    const int8_t *input_data,
+                                    const cmsis_nn_dims *filter_dims,
+                                    const cmsis_nn_dims *output_dims,
+                                    int8_t *output_data);
+
+/**
+ * @brief s8 max pooling with a cost per output that does not depend on the window size.
+ *
+ * @param[in, out] ctx          Function context with a temporary buffer of at least
+ *                              arm_max_pool_sliding_s8_get_buffer_size() bytes
+ * @param[in]      pool_params  Pooling parameters
+ * @param[in]      input_dims   Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]      input_data   Input (activation) data pointer. The input tensor must not
+ *                              overlap with the output tensor. Data type: int8
+ * @param[in]      filter_dims  Filter tensor dimensions. Format: [H, W]
+ *                              Argument N and C are not used.
+ * @param[in]      output_dims  Output tensor dimensions. Format: [H, W, C_OUT]
+ *                              Argument N is not used.
+ *                              C_OUT equals C_IN.
+ * @param[in, out] output_data  Output data pointer. Data type: int8
+ *
+ * @return     The function returns either
+ *                  <code>ARM_CMSIS_NN_ARG_ERROR</code> if argument constraints fail. or,
+ *                  <code>ARM_CMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    - Same result as arm_max_pool_s8(). Uses the van Herk/Gil-Werman algorithm separately along the width and the
+ *      height: the input is split into blocks of the window size, and every window is the maximum of a block
+ *      suffix and the next block's prefix. Each output costs O(stride.w * stride.h) comparisons instead of O(H * W).
+ *    - arm_max_pool_s8() calls this function for windows of at least POOL_SLIDING_WINDOW_MIN_KERNEL_SIZE elements
+ *      that overlap, when ctx->size is large enough.
+ *    - Every window must cover at least one input element.
+ *
+ */
+arm_cmsis_nn_status arm_max_pool_sliding_s8(const cmsis_nn_context *ctx,
+                                            const cmsis_nn_pool_params *pool_params,
+                                            const cmsis_nn_dims *input_dims,
+                                            const int8_t *input_data,
+                                            const cmsis_nn_dims *filter_dims,
+                                            const cmsis_nn_dims *output_dims,
+                                            int8_t *output_data);
+
+/**
+ * @brief Get the required buffer size for arm_max_pool_sliding_s8()
+ * @param[in]       input_dims    Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]       filter_dims   Filter tensor dimensions. Format: [H, W]
+ * @param[in]       output_dims   Output tensor dimensions. Format: [H, W, C_OUT]
+ * @return          The function returns required buffer size in bytes
+ *
+ */
+int32_t arm_max_pool_sliding_s8_get_buffer_size(const cmsis_nn_dims *input_dims,
+                                                const cmsis_nn_dims *filter_dims,
+                                                const cmsis_nn_dims *output_dims);
 
 /**
  * @brief s16 max pooling function.
@@ -2312,6 +3117,77 @@ void arm_softmax_s8(const int8_t *input,
                     const int32_t diff_min,
                     int8_t *output);
 
+/** Number of entries of the exponent table of arm_softmax_lut_s8 and arm_softmax_top_k_s8 */
+#define SOFTMAX_S8_EXP_LUT_SIZE (256)
+
+/**
+ * @brief Fill the exponent table used by the table driven s8 softmax functions
+ * @param[in]  mult      Input quantization multiplier
+ * @param[in]  shift     Input quantization shift within the range [0, 31]
+ * @param[in]  diff_min  Minimum difference with max in row. Used to check if
+ *                       the quantized exponential operation can be performed
+ * @param[out] exp_lut   Table of SOFTMAX_S8_EXP_LUT_SIZE entries. Entry i holds the quantized exponent of a
+ *                       difference of -i to the row maximum, or 0 when -i is smaller than diff_min.
+ * @return               The function returns
+ *                           <code>ARM_CMSIS_NN_ARG_ERROR</code> if shift is outside [0, 31]
+ *                           <code>ARM_CMSIS_NN_SUCCESS</code> - Successful operation
+ *
+ * @details The table only depends on the input scale and beta of the layer, so it is meant to be filled once when
+ *          the layer is prepared and shared by every inference.
+ *
+ */
+arm_cmsis_nn_status arm_softmax_s8_exp_lut_init(const int32_t mult,
+                                                const int32_t shift,
+                                                const int32_t diff_min,
+                                                int32_t *exp_lut);
+
+/**
+ * @brief S8 softmax function using a precomputed exponent table
+ * @param[in]  input     Pointer to the input tensor
+ * @param[in]  num_rows  Number of rows in the input tensor
+ * @param[in]  row_size  Number of elements in each input row
+ * @param[in]  exp_lut   Exponent table filled by arm_softmax_s8_exp_lut_init
+ * @param[out] output    Pointer to the output tensor
+ *
+ * @details Bit exact with arm_softmax_s8 called with the mult, shift and diff_min the table was filled with. The
+ *          exponent of every element is a table lookup instead of a polynomial evaluation. Rows longer than
+ *          SOFTMAX_S8_EXP_LUT_SIZE are mapped through a per row table of the 256 possible outputs.
+ *
+ * @note Supported framework: TensorFlow Lite micro (bit-accurate)
+ *
+ */
+void arm_softmax_lut_s8(const int8_t *input,
+                        const int32_t num_rows,
+                        const int32_t row_size,
+                        const int32_t *exp_lut,
+                        int8_t *output);
+
+/**
+ * @brief S8 softmax function returning only the k largest probabilities of every row
+ * @param[in]  input     Pointer to the input tensor
+ * @param[in]  num_rows  Number of rows in the input tensor
+ * @param[in]  row_size  Number of elements in each input row
+ * @param[in]  exp_lut   Exponent table filled by arm_softmax_s8_exp_lut_init
+ * @param[in]  k         Number of results per row, within the range [1, row_size]
+ * @param[out] scores    Pointer to the k probabilities of every row, largest first. Size num_rows * k.
+ * @param[out] indices   Pointer to the k column indices of the scores. Size num_rows * k.
+ * @return               The function returns
+ *                           <code>ARM_CMSIS_NN_ARG_ERROR</code> if k is outside [1, row_size]
+ *                           <code>ARM_CMSIS_NN_SUCCESS</code> - Successful operation
+ *
+ * @details The scores are bit exact with the corresponding elements of arm_softmax_lut_s8. Elements with equal input
+ *          are returned in column order. The full distribution is never written, which saves the output tensor
+ *          and a separate argmax pass for classifier heads.
+ *
+ */
+arm_cmsis_nn_status arm_softmax_top_k_s8(const int8_t *input,
+                                         const int32_t num_rows,
+                                         const int32_t row_size,
+                                         const int32_t *exp_lut,
+                                         const int32_t k,
+                                         int8_t *scores,
+                                         int32_t *indices);
+
 /**
  * @brief S8 to s16 softmax function
  * @param[in]  input     Pointer to the input tensor
@@ -2430,6 +3306,39 @@ arm_cmsis_nn_status arm_transpose_s8(const int8_t *input_data,
                                      const cmsis_nn_dims *const output_dims,
                                      const cmsis_nn_transpose_params *const transpose_params);
 
+/** Largest number of dimensions supported by arm_transpose_tiled_s8 */
+#define TRANSPOSE_TILED_MAX_DIMS (5)
+
+/**
+ * @brief Cache blocked transpose function
+ *
+ * @param[in]       input_data            Input (activation) data pointer. Data type: int8
+ * @param[out]      output_data           Output data pointer. Data type: int8
+ * @param[in]       input_shape           Input tensor shape, outermost dimension first. Contains
+ *                                        transpose_params->num_dims elements.
+ * @param[in]       transpose_params      Transpose parameters. Contains permutation dimensions.
+ *                                        num_dims must be in the range [1, TRANSPOSE_TILED_MAX_DIMS].
+ *
+ * @return          The function returns either
+ *                      <code>ARM_CMSIS_NN_ARG_ERROR</code> if argument constraints fail. or,
+ *                      <code>ARM_CMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    1. Unit dimensions are dropped and dimensions that stay adjacent after the permutation are merged, so any
+ *       permutation is reduced to a copy of contiguous rows or a 2D transpose nested in up to three outer loops.
+ *    2. The 2D transpose is processed in square tiles of 8x8 elements. Full tiles move 4x4 blocks with word
+ *       loads and word stores, which keeps the number of memory accesses per element low and the working set
+ *       of a tile within a few cache lines on both sides.
+ *    3. The output dimensions are the input dimensions permuted with transpose_params->permutations.
+ *
+ * @note The output is expected to be in a memory area that does not overlap with the input's
+ *
+ */
+arm_cmsis_nn_status arm_transpose_tiled_s8(const int8_t *input_data,
+                                           int8_t *const output_data,
+                                           const int32_t *const input_shape,
+                                           const cmsis_nn_transpose_params *const transpose_params);
+
 /**
  * @defgroup Concatenation Concatenation Functions
  *
@@ -2678,6 +3587,69 @@ arm_cmsis_nn_status arm_svdf_s8(const cmsis_nn_context *ctx,
                                 const cmsis_nn_dims *output_dims,
                                 int8_t *output_data);
 
+/**
+ * @brief s8 SVDF function with 8 bit state tensor kept as a circular buffer and 8 bit time weights
+ *
+ * @param[in, out] ctx                Function context (e.g. temporary buffer). Check the function
+ *                                    definition file to see if an additional buffer is required.
+ *                                    Optional function arm_svdf_s8_get_buffer_size() provides the buffer
+ *                                    size if an additional buffer is required.
+ *                                    The caller is expected to clear the buffer, if applicable, for security reasons.
+ * @param[in]   input_ctx             Temporary scratch buffer
+ *                                    The caller is expected to clear the buffer, if applicable, for security reasons.
+ * @param[in]   output_ctx            Temporary output scratch buffer
+ *                                    The caller is expected to clear the buffer, if applicable, for security reasons.
+ * @param[in]   svdf_params           SVDF Parameters
+ *                                    Range of svdf_params->input_offset  : [-128, 127]
+ *                                    Range of svdf_params->output_offset  : [-128, 127]
+ * @param[in]   input_quant_params    Input quantization parameters
+ * @param[in]   output_quant_params   Output quantization parameters
+ * @param[in]   input_dims            Input tensor dimensions
+ * @param[in]   input_data            Pointer to input tensor
+ * @param[in]   state_dims            State tensor dimensions
+ * @param[in]   state_data            Pointer to state tensor
+ * @param[in, out] state_head         Index of the oldest entry in every row of the state tensor.
+ *                                    Range of *state_head : [0, weights_time_dims->h - 1]
+ *                                    Set to 0 together with the state, it is advanced by one on every call.
+ * @param[in]   weights_feature_dims  Weights (feature) tensor dimensions
+ * @param[in]   weights_feature_data  Pointer to the weights (feature) tensor
+ * @param[in]   weights_time_dims     Weights (time) tensor dimensions
+ * @param[in]   weights_time_data     Pointer to the weights (time) tensor
+ * @param[in]   bias_dims             Bias tensor dimensions
+ * @param[in]   bias_data             Pointer to bias tensor
+ * @param[in]   output_dims           Output tensor dimensions
+ * @param[out]  output_data           Pointer to the output tensor
+ *
+ * @return     The function returns either
+ *                  <code>ARM_CMSIS_NN_ARG_ERROR</code> if argument constraints fail. or,
+ *                  <code>ARM_CMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    1. Supported framework: TensorFlow Lite micro
+ *    2. Same result as arm_svdf_s8(), but the state is not shifted on every call. The new sample of each state row
+ *       overwrites the oldest one at the head, and the time weights dot product runs over the row in two contiguous
+ *       parts. The state tensor rows are therefore rotated by *state_head compared to arm_svdf_s8().
+ */
+arm_cmsis_nn_status arm_svdf_circular_s8(const cmsis_nn_context *ctx,
+                                         const cmsis_nn_context *input_ctx,
+                                         const cmsis_nn_context *output_ctx,
+                                         const cmsis_nn_svdf_params *svdf_params,
+                                         const cmsis_nn_per_tensor_quant_params *input_quant_params,
+                                         const cmsis_nn_per_tensor_quant_params *output_quant_params,
+                                         const cmsis_nn_dims *input_dims,
+                                         const int8_t *input_data,
+                                         const cmsis_nn_dims *state_dims,
+                                         int8_t *state_data,
+                                         int32_t *state_head,
+                                         const cmsis_nn_dims *weights_feature_dims,
+                                         const int8_t *weights_feature_data,
+                                         const cmsis_nn_dims *weights_time_dims,
+                                         const int8_t *weights_time_data,
+                                         const cmsis_nn_dims *bias_dims,
+                                         const int32_t *bias_data,
+                                         const cmsis_nn_dims *output_dims,
+                                         int8_t *output_data);
+
 /**
  * @brief s8 SVDF function with 16 bit state tensor and 16 bit time weights
  *
@@ -2801,6 +3773,48 @@ arm_cmsis_nn_status arm_lstm_unidirectional_s16(const int16_t *input,
                                                 const cmsis_nn_lstm_params *params,
                                                 cmsis_nn_lstm_context *buffers);
 
+/**
+ * @brief Interleave the weights and effective biases of the four LSTM gates for the fused gate kernel, s8 input.
+ *
+ * @param[in]   params                   LSTM parameters with the gate by gate weights and effective biases
+ * @param[out]  input_weights            4 * hidden_size * input_size bytes
+ * @param[out]  input_effective_bias     4 * hidden_size elements
+ * @param[out]  hidden_weights           4 * hidden_size * hidden_size bytes
+ * @param[out]  hidden_effective_bias    4 * hidden_size elements
+ * @param[out]  fused_gates              Filled with pointers to the arrays above. Set params->fused_gates to it to
+ *                                       make arm_lstm_unidirectional_s8 compute all gates in one pass per step.
+ *
+ * @return     The function returns either
+ *                  <code>ARM_CMSIS_NN_ARG_ERROR</code> if a gate has no weights or effective biases or
+ *                  <code>ARM_CMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ * @details Meant to be called once at init time. The output of the LSTM is bit-exact with the gate by gate version.
+ *          Each step then reads the inputs once instead of once per gate, at the cost of a copy of the weights.
+ *
+ */
+arm_cmsis_nn_status arm_lstm_interleave_gates_s8(const cmsis_nn_lstm_params *params,
+                                                 int8_t *input_weights,
+                                                 int32_t *input_effective_bias,
+                                                 int8_t *hidden_weights,
+                                                 int32_t *hidden_effective_bias,
+                                                 cmsis_nn_lstm_fused_gates *fused_gates);
+
+/**
+ * @brief Interleave the weights and effective biases of the four LSTM gates for the fused gate kernel, s16 input.
+ *        Arguments as for arm_lstm_interleave_gates_s8, with 64 bit effective biases.
+ *
+ * @return     The function returns either
+ *                  <code>ARM_CMSIS_NN_ARG_ERROR</code> if a gate has no weights or effective biases or
+ *                  <code>ARM_CMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ */
+arm_cmsis_nn_status arm_lstm_interleave_gates_s16(const cmsis_nn_lstm_params *params,
+                                                  int8_t *input_weights,
+                                                  int64_t *input_effective_bias,
+                                                  int8_t *hidden_weights,
+                                                  int64_t *hidden_effective_bias,
+                                                  cmsis_nn_lstm_fused_gates *fused_gates);
+
 /**
  * @brief Batch matmul function with 8 bit input and output.
  *
@@ -2952,6 +3966,283 @@ arm_cmsis_nn_status arm_maximum_s8(const cmsis_nn_context *ctx,
                                    int8_t *output_data,
                                    const cmsis_nn_dims *output_dims);
 
+/**
+ * @defgroup Parallel Partitioned Execution
+ *
+ * Layers split into independent slices of output rows or output channels. A slice call computes part of the layer
+ * on the calling core and can be run from any number of cores at the same time, as long as each call has its own
+ * scratch buffer. The parallel functions use a cmsis_nn_scheduler to fan the slices out to the workers; the
+ * platform provides the workers, e.g. harts woken by a software interrupt or threads on a host.
+ *
+ */
+
+/** Maximum number of workers of a cmsis_nn_scheduler */
+#define CMSIS_NN_MAX_WORKERS (8)
+
+/**
+ * @brief Split [0, total) into one even slice per worker and run a task on every slice.
+ *
+ * @param[in]   scheduler   Workers to run the slices on. With <code>run</code> set to NULL the slices are run one
+ *                          after the other on the calling core.
+ * @param[in]   task        Function computing a slice
+ * @param[in]   args        Passed unchanged to task
+ * @param[in]   total       Number of rows or channels to split. Fewer slices than workers are created when
+ *                          total < num_workers.
+ *
+ * @return     The function returns either
+ *                  <code>ARM_CMSIS_NN_ARG_ERROR</code> if the scheduler is invalid or
+ *                  the first status of a task that is not <code>ARM_CMSIS_NN_SUCCESS</code> or
+ *                  <code>ARM_CMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ */
+arm_cmsis_nn_status
+arm_nn_parallel_run(const cmsis_nn_scheduler *scheduler, cmsis_nn_task task, const void *args, int32_t total);
+
+/**
+ * @brief Output rows [rows->start, rows->end) of arm_convolve_wrapper_s8().
+ *
+ * @param[in, out] ctx            Scratch buffer of this slice, at least
+ *                                arm_convolve_wrapper_s8_slice_get_buffer_size() bytes
+ * @param[in]      rows           Output rows to compute, 0 <= rows->start <= rows->end <= output_dims->h. The rows
+ *                                are computed for every batch.
+ *
+ * The remaining arguments are the same as for arm_convolve_wrapper_s8(). Only the output rows of the slice are
+ * written, and only the input rows under their kernel windows are read.
+ *
+ * @return     The function returns either
+ *                  <code>ARM_CMSIS_NN_ARG_ERROR</code> if the row range is invalid or the wrapper fails,
+ *                  <code>ARM_CMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ */
+arm_cmsis_nn_status arm_convolve_wrapper_s8_slice(const cmsis_nn_context *ctx,
+                                                  const cmsis_nn_conv_params *conv_params,
+                                                  const cmsis_nn_per_channel_quant_params *quant_params,
+                                                  const cmsis_nn_dims *input_dims,
+                                                  const int8_t *input_data,
+                                                  const cmsis_nn_dims *filter_dims,
+                                                  const int8_t *filter_data,
+                                                  const cmsis_nn_dims *bias_dims,
+                                                  const int32_t *bias_data,
+                                                  const cmsis_nn_dims *output_dims,
+                                                  int8_t *output_data,
+                                                  const cmsis_nn_slice *rows);
+
+/**
+ * @brief Get the buffer size needed by arm_convolve_wrapper_s8_slice() for any row range.
+ *
+ * A slice without padding rows may select another kernel than the full layer, so this can be larger than
+ * arm_convolve_wrapper_s8_get_buffer_size(). Arguments as for arm_convolve_wrapper_s8_get_buffer_size().
+ *
+ * @return      Size of the scratch buffer of one worker in bytes
+ *
+ */
+int32_t arm_convolve_wrapper_s8_slice_get_buffer_size(const cmsis_nn_conv_params *conv_params,
+                                                      const cmsis_nn_dims *input_dims,
+                                                      const cmsis_nn_dims *filter_dims,
+                                                      const cmsis_nn_dims *output_dims);
+
+/**
+ * @brief arm_convolve_wrapper_s8() with the output rows split over the scheduler workers.
+ *
+ * @param[in]   scheduler   Workers, each with a buffer of arm_convolve_wrapper_s8_slice_get_buffer_size() bytes
+ *
+ * The remaining arguments are the same as for arm_convolve_wrapper_s8(). The output is bit-exact with it.
+ *
+ * @return     The function returns the status of arm_nn_parallel_run()
+ *
+ */
+arm_cmsis_nn_status arm_convolve_wrapper_s8_parallel(const cmsis_nn_scheduler *scheduler,
+                                                     const cmsis_nn_conv_params *conv_params,
+                                                     const cmsis_nn_per_channel_quant_params *quant_params,
+                                                     const cmsis_nn_dims *input_dims,
+                                                     const int8_t *input_data,
+                                                     const cmsis_nn_dims *filter_dims,
+                                                     const int8_t *filter_data,
+                                                     const cmsis_nn_dims *bias_dims,
+                                                     const int32_t *bias_data,
+                                                     const cmsis_nn_dims *output_dims,
+                                                     int8_t *output_data);
+
+/**
+ * @brief Output rows [rows->start, rows->end) of arm_depthwise_conv_wrapper_s8().
+ *
+ * @param[in, out] ctx            Scratch buffer of this slice, at least
+ *                                arm_depthwise_conv_wrapper_s8_slice_get_buffer_size() bytes
+ * @param[in]      rows           Output rows to compute, 0 <= rows->start <= rows->end <= output_dims->h
+ *
+ * The remaining arguments are the same as for arm_depthwise_conv_wrapper_s8().
+ *
+ * @return     The function returns either
+ *                  <code>ARM_CMSIS_NN_ARG_ERROR</code> if the row range is invalid or the wrapper fails,
+ *                  <code>ARM_CMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ */
+arm_cmsis_nn_status arm_depthwise_conv_wrapper_s8_slice(const cmsis_nn_context *ctx,
+                                                        const cmsis_nn_dw_conv_params *dw_conv_params,
+                                                        const cmsis_nn_per_channel_quant_params *quant_params,
+                                                        const cmsis_nn_dims *input_dims,
+                                                        const int8_t *input_data,
+                                                        const cmsis_nn_dims *filter_dims,
+                                                        const int8_t *filter_data,
+                                                        const cmsis_nn_dims *bias_dims,
+                                                        const int32_t *bias_data,
+                                                        const cmsis_nn_dims *output_dims,
+                                                        int8_t *output_data,
+                                                        const cmsis_nn_slice *rows);
+
+/**
+ * @brief Get the buffer size needed by arm_depthwise_conv_wrapper_s8_slice() for any row range.
+ *        Arguments as for arm_depthwise_conv_wrapper_s8_get_buffer_size().
+ *
+ * @return      Size of the scratch buffer of one worker in bytes
+ *
+ */
+int32_t arm_depthwise_conv_wrapper_s8_slice_get_buffer_size(const cmsis_nn_dw_conv_params *dw_conv_params,
+                                                            const cmsis_nn_dims *input_dims,
+                                                            const cmsis_nn_dims *filter_dims,
+                                                            const cmsis_nn_dims *output_dims);
+
+/**
+ * @brief arm_depthwise_conv_wrapper_s8() with the output rows split over the scheduler workers.
+ *
+ * @param[in]   scheduler   Workers, each with a buffer of arm_depthwise_conv_wrapper_s8_slice_get_buffer_size()
+ *                          bytes
+ *
+ * The remaining arguments are the same as for arm_depthwise_conv_wrapper_s8().
+ *
+ * @return     The function returns the status of arm_nn_parallel_run()
+ *
+ */
+arm_cmsis_nn_status arm_depthwise_conv_wrapper_s8_parallel(const cmsis_nn_scheduler *scheduler,
+                                                           const cmsis_nn_dw_conv_params *dw_conv_params,
+                                                           const cmsis_nn_per_channel_quant_params *quant_params,
+                                                           const cmsis_nn_dims *input_dims,
+                                                           const int8_t *input_data,
+                                                           const cmsis_nn_dims *filter_dims,
+                                                           const int8_t *filter_data,
+                                                           const cmsis_nn_dims *bias_dims,
+                                                           const int32_t *bias_data,
+                                                           const cmsis_nn_dims *output_dims,
+                                                           int8_t *output_data);
+
+/**
+ * @brief Output channels [channels->start, channels->end) of arm_fully_connected_s8().
+ *
+ * @param[in]   ctx             Kernel sums of the full layer, if arm_fully_connected_s8() needs them. The slice
+ *                              reads the sums of its own channels.
+ * @param[in]   channels        Output channels to compute, 0 <= channels->start <= channels->end <= output_dims->c.
+ *                              The channels are computed for every batch.
+ *
+ * The remaining arguments are the same as for arm_fully_connected_s8().
+ *
+ * @return     The function returns either
+ *                  <code>ARM_CMSIS_NN_ARG_ERROR</code> if the channel range is invalid or
+ *                  <code>ARM_CMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ */
+arm_cmsis_nn_status arm_fully_connected_s8_slice(const cmsis_nn_context *ctx,
+                                                 const cmsis_nn_fc_params *fc_params,
+                                                 const cmsis_nn_per_tensor_quant_params *quant_params,
+                                                 const cmsis_nn_dims *input_dims,
+                                                 const int8_t *input,
+                                                 const cmsis_nn_dims *filter_dims,
+                                                 const int8_t *kernel,
+                                                 const cmsis_nn_dims *bias_dims,
+                                                 const int32_t *bias,
+                                                 const cmsis_nn_dims *output_dims,
+                                                 int8_t *output,
+                                                 const cmsis_nn_slice *channels);
+
+/**
+ * @brief arm_fully_connected_s8() with the output channels split over the scheduler workers.
+ *
+ * @param[in]   scheduler   Workers. The worker buffers are not used.
+ * @param[in]   ctx         Kernel sums shared by all workers, as for arm_fully_connected_s8()
+ *
+ * The remaining arguments are the same as for arm_fully_connected_s8().
+ *
+ * @return     The function returns the status of arm_nn_parallel_run()
+ *
+ */
+arm_cmsis_nn_status arm_fully_connected_s8_parallel(const cmsis_nn_scheduler *scheduler,
+                                                    const cmsis_nn_context *ctx,
+                                                    const cmsis_nn_fc_params *fc_params,
+                                                    const cmsis_nn_per_tensor_quant_params *quant_params,
+                                                    const cmsis_nn_dims *input_dims,
+                                                    const int8_t *input,
+                                                    const cmsis_nn_dims *filter_dims,
+                                                    const int8_t *kernel,
+                                                    const cmsis_nn_dims *bias_dims,
+                                                    const int32_t *bias,
+                                                    const cmsis_nn_dims *output_dims,
+                                                    int8_t *output);
+
+/**
+ * @brief Output rows [rows->start, rows->end) of arm_avgpool_s8().
+ *
+ * @param[in, out] ctx          Scratch buffer of this slice, at least arm_avgpool_s8_get_buffer_size() bytes
+ * @param[in]      rows         Output rows to compute, 0 <= rows->start <= rows->end <= output_dims->h
+ *
+ * The remaining arguments are the same as for arm_avgpool_s8().
+ *
+ * @return     The function returns either
+ *                  <code>ARM_CMSIS_NN_ARG_ERROR</code> if the row range is invalid or pooling fails,
+ *                  <code>ARM_CMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ */
+arm_cmsis_nn_status arm_avgpool_s8_slice(const cmsis_nn_context *ctx,
+                                         const cmsis_nn_pool_params *pool_params,
+                                         const cmsis_nn_dims *input_dims,
+                                         const int8_t *input_data,
+                                         const cmsis_nn_dims *filter_dims,
+                                         const cmsis_nn_dims *output_dims,
+                                         int8_t *output_data,
+                                         const cmsis_nn_slice *rows);
+
+/**
+ * @brief Output rows [rows->start, rows->end) of arm_max_pool_s8(). Arguments as for arm_avgpool_s8_slice().
+ *
+ */
+arm_cmsis_nn_status arm_max_pool_s8_slice(const cmsis_nn_context *ctx,
+                                          const cmsis_nn_pool_params *pool_params,
+                                          const cmsis_nn_dims *input_dims,
+                                          const int8_t *input_data,
+                                          const cmsis_nn_dims *filter_dims,
+                                          const cmsis_nn_dims *output_dims,
+                                          int8_t *output_data,
+                                          const cmsis_nn_slice *rows);
+
+/**
+ * @brief arm_avgpool_s8() with the output rows split over the scheduler workers.
+ *
+ * @param[in]   scheduler   Workers, each with a buffer of arm_avgpool_s8_get_buffer_size() bytes
+ *
+ * The remaining arguments are the same as for arm_avgpool_s8().
+ *
+ * @return     The function returns the status of arm_nn_parallel_run()
+ *
+ */
+arm_cmsis_nn_status arm_avgpool_s8_parallel(const cmsis_nn_scheduler *scheduler,
+                                            const cmsis_nn_pool_params *pool_params,
+                                            const cmsis_nn_dims *input_dims,
+                                            const int8_t *input_data,
+                                            const cmsis_nn_dims *filter_dims,
+                                            const cmsis_nn_dims *output_dims,
+                                            int8_t *output_data);
+
+/**
+ * @brief arm_max_pool_s8() with the output rows split over the scheduler workers. Arguments as for
+ *        arm_avgpool_s8_parallel().
+ *
+ */
+arm_cmsis_nn_status arm_max_pool_s8_parallel(const cmsis_nn_scheduler *scheduler,
+                                             const cmsis_nn_pool_params *pool_params,
+                                             const cmsis_nn_dims *input_dims,
+                                             const int8_t *input_data,
+                                             const cmsis_nn_dims *filter_dims,
+                                             const cmsis_nn_dims *output_dims,
+                                             int8_t *output_data);
+
 #ifdef __cplusplus
 }
 #endif
@@ -68,6 +68,12 @@ extern "C" {
 // An additional requirement for this signed 4 variant is that it must be an even number.
 #define S4_CH_IN_BLOCK_MVE (124)
 
+// Number of channels processed in a block by the row reuse DW Conv (arm_depthwise_conv_row_reuse_s8)
+// Requirement: Greater than 0.
+// The line buffer holds kernel height rows of this many channels, so a larger block makes the input
+// reads longer and the scratch buffer bigger.
+#define CH_IN_BLOCK_ROW_REUSE (16)
+
 // For input of int16 when number of columns are above this limit int64 accumulation is needed
 // to not loose precision.
 #define MAX_COL_COUNT (512)
@@ -76,6 +82,12 @@ extern "C" {
 // channels. This is based on heuristics and may be finetuned depending on other parameters of the operator
 #define REVERSE_TCOL_EFFICIENT_THRESHOLD (16)
 
+// Pooling windows of at least this many elements are computed with the sliding window kernels, whose cost per output
+// does not depend on the window size, when the windows overlap and the context buffer is large enough.
+#ifndef POOL_SLIDING_WINDOW_MIN_KERNEL_SIZE
+    #define POOL_SLIDING_WINDOW_MIN_KERNEL_SIZE (25)
+#endif
+
 // Threshold for number of output channels that decide whether to convert a depthwise conv to a
 // regular conv operation when number of input channels is one.
 // Only applicable for processors with MVE extension.
@@ -149,6 +161,42 @@ union arm_nn_long_long
  * @} // end group groupPrivTypes
  */
 
+/**
+ * @defgroup supportParallel Partitioning
+ *
+ * Helpers for the slice functions of the partitioned execution API
+ *
+ */
+
+/**
+ * @brief Input rows read by a slice of output rows
+ * @param[in]    rows         Output rows [start, end) of the slice
+ * @param[in]    input_h      Input height of the full layer
+ * @param[in]    kernel_h     Kernel height
+ * @param[in]    stride_h     Stride along the height
+ * @param[in]    dilation_h   Dilation along the height
+ * @param[in]    pad_h        Top padding of the full layer
+ * @param[out]   input_start  First input row read by the slice
+ * @param[out]   input_rows   Number of input rows read by the slice
+ * @param[out]   slice_pad_h  Top padding as seen by the slice
+ *
+ * \par Description:
+ *
+ * Running a layer function on input rows [input_start, input_start + input_rows) with slice_pad_h as top padding and
+ * rows->end - rows->start output rows gives exactly the output rows of the slice. Padding below the slice is
+ * implicit, as it is for the full layer.
+ *
+ */
+void arm_nn_row_slice(const cmsis_nn_slice *rows,
+                      const int32_t input_h,
+                      const int32_t kernel_h,
+                      const int32_t stride_h,
+                      const int32_t dilation_h,
+                      const int32_t pad_h,
+                      int32_t *input_start,
+                      int32_t *input_rows,
+                      int32_t *slice_pad_h);
+
 /**
  * @defgroup supportConversion Data Conversion
  *
@@ -202,6 +250,30 @@ void arm_s8_to_s16_unordered_with_offset(const int8_t *src, int16_t *dst, int32_
 
 #endif
 
+/**
+ * @brief Unpacks int4 values stored two per byte to an int8 vector
+ * @param[in]    src           pointer to the packed int4 data. Element 2 * n is stored in the low nibble and element
+ *                             2 * n + 1 in the high nibble of src[n], e.g. [0x1, 0x2, 0x3] is stored as [0x21, 0x03].
+ * @param[in]    src_offset    index of the first element to unpack. It may be odd.
+ * @param[in]    num_elements  number of elements to unpack
+ * @param[out]   dst           pointer to the sign extended int8 output vector
+ *
+ */
+void arm_nn_unpack_s4(const int8_t *src, const int32_t src_offset, int32_t num_elements, int8_t *dst);
+
+/**
+ * @brief Packs int8 values in the range [-8, 7] two per byte
+ * @param[in]    src           pointer to the int8 input vector
+ * @param[in]    num_elements  number of elements to pack
+ * @param[out]   dst           pointer to the packed int4 data, same layout as for arm_nn_unpack_s4
+ * @param[in]    dst_offset    index of the first element to write. It may be odd.
+ *
+ * @details Only the written nibbles change, so rows that start or end in the middle of a byte can be packed one at
+ *          a time.
+ *
+ */
+void arm_nn_pack_s4(const int8_t *src, int32_t num_elements, int8_t *dst, const int32_t dst_offset);
+
 /**
  * @brief Get the required buffer size for optimized s8 depthwise convolution
  *        function with constraint that in_channel equals out_channel.
@@ -1175,6 +1247,80 @@ __STATIC_FORCEINLINE void arm_memset_s8(int8_t *dst, const int8_t val, uint32_t
 #endif
 }
 
+/**
+ * @brief           Check if a pooling layer is better served by the sliding window kernels
+ * @param[in]       pool_params  Pooling parameters
+ * @param[in]       filter_dims  Pooling window dimensions
+ * @return          True if the window has at least POOL_SLIDING_WINDOW_MIN_KERNEL_SIZE elements and consecutive
+ *                  windows overlap in at least one direction
+ *
+ */
+__STATIC_FORCEINLINE bool arm_nn_pool_use_sliding_window(const cmsis_nn_pool_params *pool_params,
+                                                         const cmsis_nn_dims *filter_dims)
+{
+    return filter_dims->w * filter_dims->h >= POOL_SLIDING_WINDOW_MIN_KERNEL_SIZE &&
+        (pool_params->stride.w < filter_dims->w || pool_params->stride.h < filter_dims->h);
+}
+
+/**
+ * @brief           Check if a convolution reads its whole receptive field from the input, i.e. it has no padding on
+ *                  any side
+ * @param[in]       conv_params  Convolution parameters. The padding is the top/left padding.
+ * @param[in]       input_dims   Input dimensions
+ * @param[in]       filter_dims  Filter dimensions
+ * @param[in]       output_dims  Output dimensions, which imply the bottom/right padding
+ * @return          True if the padding is zero and the last window ends inside the input
+ *
+ */
+__STATIC_FORCEINLINE bool arm_nn_conv_is_unpadded(const cmsis_nn_conv_params *conv_params,
+                                                  const cmsis_nn_dims *input_dims,
+                                                  const cmsis_nn_dims *filter_dims,
+                                                  const cmsis_nn_dims *output_dims)
+{
+    return conv_params->padding.w == 0 && conv_params->padding.h == 0 &&
+        (output_dims->w - 1) * conv_params->stride.w + (filter_dims->w - 1) * conv_params->dilation.w < input_dims->w &&
+        (output_dims->h - 1) * conv_params->stride.h + (filter_dims->h - 1) * conv_params->dilation.h < input_dims->h;
+}
+
+/**
+ * @brief           Check if the horizontal padding of a convolution is split as for TensorFlow SAME padding, with the
+ *                  right side getting at most one element more than the left side
+ * @param[in]       conv_params  Convolution parameters. The padding is the left padding.
+ * @param[in]       input_dims   Input dimensions
+ * @param[in]       filter_dims  Filter dimensions
+ * @param[in]       output_dims  Output dimensions, which imply the right padding
+ * @return          True if the padding is balanced
+ *
+ */
+__STATIC_FORCEINLINE bool arm_nn_conv_padding_is_balanced_x(const cmsis_nn_conv_params *conv_params,
+                                                            const cmsis_nn_dims *input_dims,
+                                                            const cmsis_nn_dims *filter_dims,
+                                                            const cmsis_nn_dims *output_dims)
+{
+    const int32_t total_pad =
+        (output_dims->w - 1) * conv_params->stride.w + (filter_dims->w - 1) * conv_params->dilation.w + 1 -
+        input_dims->w;
+    return conv_params->padding.w * 2 + total_pad % 2 == total_pad;
+}
+
+/**
+ * @brief           Get the right padding of a depthwise convolution, which is implied by the output width
+ * @param[in]       dw_conv_params  Depthwise convolution parameters. The padding is the left padding.
+ * @param[in]       input_dims      Input dimensions
+ * @param[in]       filter_dims     Filter dimensions
+ * @param[in]       output_dims     Output dimensions
+ * @return          Number of padded columns on the right, negative if the last input columns are not read
+ *
+ */
+__STATIC_FORCEINLINE int32_t arm_nn_dw_conv_padding_right(const cmsis_nn_dw_conv_params *dw_conv_params,
+                                                          const cmsis_nn_dims *input_dims,
+                                                          const cmsis_nn_dims *filter_dims,
+                                                          const cmsis_nn_dims *output_dims)
+{
+    return (output_dims->w - 1) * dw_conv_params->stride.w + (filter_dims->w - 1) * dw_conv_params->dilation.w + 1 -
+        input_dims->w - dw_conv_params->padding.w;
+}
+
 #if defined(ARM_MATH_DSP)
 
 /**
@@ -2051,6 +2197,50 @@ arm_cmsis_nn_status arm_nn_lstm_calculate_gate_s16(const int16_t *data_in,
                                                    int16_t *output,
                                                    const int32_t batch_offset);
 
+/**
+ * @brief Updates all four LSTM gates of a range of hidden units in one pass over the inputs, int8x8_16 version.
+ *
+ * @param[in]   data_in          Data input of one batch
+ * @param[in]   hidden_in        Hidden state/ recurrent input of one batch, NULL in the first time step
+ * @param[in]   params           Struct containing all information about the lstm_operation, see arm_nn_types.
+ *                               params->fused_gates must be set, see arm_lstm_interleave_gates_s8.
+ * @param[in]   unit_start       First hidden unit
+ * @param[in]   num_units        Number of hidden units
+ * @param[out]  forget_gate      Activated forget gate, num_units elements
+ * @param[out]  input_gate       Activated input gate, num_units elements
+ * @param[out]  cell_gate        Activated cell gate, num_units elements
+ * @param[out]  output_gate      Activated output gate, num_units elements
+ * @return                       The function returns ARM_CMSIS_NN_SUCCESS
+ *
+ * @details The result is bit-exact with four calls of arm_nn_lstm_calculate_gate_s8_s16.
+ */
+arm_cmsis_nn_status arm_nn_lstm_fused_gates_s8_s16(const int8_t *data_in,
+                                                   const int8_t *hidden_in,
+                                                   const cmsis_nn_lstm_params *params,
+                                                   const int32_t unit_start,
+                                                   const int32_t num_units,
+                                                   int16_t *forget_gate,
+                                                   int16_t *input_gate,
+                                                   int16_t *cell_gate,
+                                                   int16_t *output_gate);
+
+/**
+ * @brief Updates all four LSTM gates of a range of hidden units in one pass over the inputs, int16x8_16 version.
+ *        Arguments as for arm_nn_lstm_fused_gates_s8_s16, with params->fused_gates from
+ *        arm_lstm_interleave_gates_s16.
+ *
+ * @return                       The function returns ARM_CMSIS_NN_SUCCESS
+ */
+arm_cmsis_nn_status arm_nn_lstm_fused_gates_s16(const int16_t *data_in,
+                                                const int16_t *hidden_in,
+                                                const cmsis_nn_lstm_params *params,
+                                                const int32_t unit_start,
+                                                const int32_t num_units,
+                                                int16_t *forget_gate,
+                                                int16_t *input_gate,
+                                                int16_t *cell_gate,
+                                                int16_t *output_gate);
+
 /**
  * @brief The result of the multiplication is accumulated to the passed result buffer.
  * Multiplies a matrix by a "batched" vector (i.e. a matrix with a batch dimension composed by input vectors independent
@@ -2192,6 +2382,27 @@ arm_cmsis_nn_status arm_elementwise_mul_acc_s16(const int16_t *input_1_vect,
                                                 const int32_t out_activation_max,
                                                 const int32_t block_size);
 
+/**
+ * @brief           Plan the loops of a broadcasting elementwise operation
+ * @param[in]       input_1_dims  Input 1 tensor dimensions
+ * @param[in]       input_2_dims  Input 2 tensor dimensions
+ * @param[in]       output_dims   Output tensor dimensions
+ * @param[out]      broadcast     Loop nest with contiguous inner runs
+ * @return          <code>ARM_CMSIS_NN_ARG_ERROR</code> if a dimension of an input is neither 1 nor that of the
+ *                  output, or if an output dimension is not the larger of the input ones.
+ *                  <code>ARM_CMSIS_NN_SUCCESS</code> otherwise.
+ *
+ * @details         Dimensions of size 1 in the output are dropped, and neighbouring dimensions along which the same
+ *                  input is broadcast (or neither is) are merged. The innermost merged dimension becomes the inner
+ *                  run, which is an elementwise vector operation or a scalar-vector one. Row, column, channel and
+ *                  scalar broadcasts therefore all end up in a contiguous inner loop.
+ *
+ */
+arm_cmsis_nn_status arm_nn_broadcast_init(const cmsis_nn_dims *input_1_dims,
+                                          const cmsis_nn_dims *input_2_dims,
+                                          const cmsis_nn_dims *output_dims,
+                                          cmsis_nn_broadcast *broadcast);
+
 /**
  * @brief Check if a broadcast is required between 2 cmsis_nn_dims.
  * @param[in]       shape_1             pointer to input tensor 1
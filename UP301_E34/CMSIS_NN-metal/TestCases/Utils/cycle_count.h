@@ -0,0 +1,37 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <stdint.h>
+
+#if !defined(__riscv)
+    #include <time.h>
+#endif
+
+/* Free-running counter for benchmarks. It counts core cycles on RISC-V; on other targets it falls back to the C
+ * clock() ticks, which are only meaningful as a ratio between two measurements. */
+static inline uint32_t get_cycle_count(void)
+{
+#if defined(__riscv)
+    uint32_t cycles;
+    __asm volatile("rdcycle %0" : "=r"(cycles));
+    return cycles;
+#else
+    return (uint32_t)clock();
+#endif
+}
@@ -0,0 +1,90 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <arm_nn_types.h>
+#include <stdint.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #define THREAD_SCHEDULER_AVAILABLE
+    #include <pthread.h>
+    #include <time.h>
+
+typedef struct
+{
+    cmsis_nn_task task;
+    const void *args;
+    const cmsis_nn_context *ctx;
+    const cmsis_nn_slice *slice;
+    arm_cmsis_nn_status status;
+} thread_scheduler_job;
+
+static void *thread_scheduler_worker(void *arg)
+{
+    thread_scheduler_job *job = (thread_scheduler_job *)arg;
+    job->status = job->task(job->args, job->ctx, job->slice);
+    return NULL;
+}
+
+/* cmsis_nn_scheduler run hook for hosts. The caller computes the first slice while one thread per remaining slice
+ * computes the others. */
+static arm_cmsis_nn_status thread_scheduler_run(void *platform,
+                                                cmsis_nn_task task,
+                                                const void *args,
+                                                const cmsis_nn_context *ctx,
+                                                const cmsis_nn_slice *slices,
+                                                int32_t num_slices)
+{
+    (void)platform;
+    pthread_t threads[CMSIS_NN_MAX_WORKERS];
+    thread_scheduler_job jobs[CMSIS_NN_MAX_WORKERS];
+    int32_t started[CMSIS_NN_MAX_WORKERS] = {0};
+
+    for (int32_t i = 1; i < num_slices; i++)
+    {
+        jobs[i] = (thread_scheduler_job){task, args, &ctx[i], &slices[i], ARM_CMSIS_NN_SUCCESS};
+        started[i] = pthread_create(&threads[i], NULL, thread_scheduler_worker, &jobs[i]) == 0;
+        if (!started[i])
+        {
+            jobs[i].status = task(args, &ctx[i], &slices[i]);
+        }
+    }
+
+    arm_cmsis_nn_status status = num_slices > 0 ? task(args, &ctx[0], &slices[0]) : ARM_CMSIS_NN_SUCCESS;
+    for (int32_t i = 1; i < num_slices; i++)
+    {
+        if (started[i])
+        {
+            pthread_join(threads[i], NULL);
+        }
+        if (status == ARM_CMSIS_NN_SUCCESS)
+        {
+            status = jobs[i].status;
+        }
+    }
+    return status;
+}
+
+/* Wall clock in microseconds. clock() adds up the time of all threads, so it cannot show a speedup. */
+static inline uint64_t thread_scheduler_time_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u;
+}
+#endif
@@ -0,0 +1,752 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Benchmark of the CMSIS-NN kernels on the reference data of the unit tests.
+ *
+ * Every case runs its kernel once and checks the output against the reference, then times BENCHMARK_ITERATIONS
+ * further calls with get_cycle_count(). One line per case is printed as CSV, or as a JSON array when
+ * BENCHMARK_OUTPUT_JSON is defined or "--json" is passed on a hosted target. The counter ticks are core cycles on
+ * RISC-V and clock() ticks elsewhere, so host numbers only compare runs on the same machine.
+ *
+ * "macs" is the number of multiply-accumulates for convolution and fully connected layers, and the number of
+ * element operations (window elements for pooling, elements otherwise) for the remaining kernels. compare_benchmark.py
+ * compares two runs and flags regressions.
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arm_nnfunctions.h"
+
+#include "../TestData/add/test_data.h"
+#include "../TestData/avgpooling/test_data.h"
+#include "../TestData/basic/test_data.h"
+#include "../TestData/depthwise_eq_in_out_ch/test_data.h"
+#include "../TestData/fully_connected/test_data.h"
+#include "../TestData/fully_connected_int16_big/test_data.h"
+#include "../TestData/int16xint8_dilation_1/test_data.h"
+#include "../TestData/kernel1x1/test_data.h"
+#include "../TestData/maxpooling/test_data.h"
+#include "../TestData/mul/test_data.h"
+#include "../TestData/softmax/test_data.h"
+#include "../Utils/cycle_count.h"
+#include "../Utils/utils.h"
+#include "../Utils/validate.h"
+
+#ifndef BENCHMARK_ITERATIONS
+    #define BENCHMARK_ITERATIONS (100)
+#endif
+
+/* Shape of the generated depthwise layers */
+#define DW_GENERATED_H (16)
+#define DW_GENERATED_W (16)
+#define DW_GENERATED_CH (32)
+
+typedef struct
+{
+    int64_t macs;
+    uint32_t total_cycles;
+    bool valid;
+} benchmark_result;
+
+typedef struct
+{
+    const char *kernel;
+    const char *data;
+    void (*run)(benchmark_result *result);
+} benchmark_case;
+
+/*
+ * Checks the first call of a kernel, then times BENCHMARK_ITERATIONS more as one interval. Timing the whole loop
+ * keeps the coarse host clock() usable for kernels shorter than one tick.
+ */
+#define BENCHMARK_KERNEL(result, call, check)                                                                          \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        (result)->valid = (call) == ARM_CMSIS_NN_SUCCESS && (check);                                                   \
+        const uint32_t start = get_cycle_count();                                                                      \
+        for (int32_t i = 0; i < BENCHMARK_ITERATIONS; i++)                                                             \
+        {                                                                                                              \
+            (void)(call);                                                                                              \
+        }                                                                                                              \
+        (result)->total_cycles = get_cycle_count() - start;                                                            \
+    } while (0)
+
+static int64_t conv_macs(const cmsis_nn_dims *input_dims,
+                         const cmsis_nn_dims *filter_dims,
+                         const cmsis_nn_dims *output_dims)
+{
+    return (int64_t)input_dims->n * output_dims->h * output_dims->w * output_dims->c * filter_dims->h * filter_dims->w *
+        input_dims->c;
+}
+
+static void convolve_wrapper_s8_basic(benchmark_result *result)
+{
+    int8_t output[BASIC_DST_SIZE] = {0};
+
+    cmsis_nn_context ctx;
+    cmsis_nn_conv_params conv_params;
+    cmsis_nn_per_channel_quant_params quant_params;
+    cmsis_nn_dims input_dims = {BASIC_INPUT_BATCHES, BASIC_INPUT_H, BASIC_INPUT_W, BASIC_IN_CH};
+    cmsis_nn_dims filter_dims = {BASIC_OUT_CH, BASIC_FILTER_Y, BASIC_FILTER_X, BASIC_IN_CH};
+    cmsis_nn_dims bias_dims = {1, 1, 1, BASIC_OUT_CH};
+    cmsis_nn_dims output_dims = {BASIC_INPUT_BATCHES, BASIC_OUTPUT_H, BASIC_OUTPUT_W, BASIC_OUT_CH};
+
+    conv_params.padding.w = BASIC_PAD_X;
+    conv_params.padding.h = BASIC_PAD_Y;
+    conv_params.stride.w = BASIC_STRIDE_X;
+    conv_params.stride.h = BASIC_STRIDE_Y;
+    conv_params.dilation.w = BASIC_DILATION_X;
+    conv_params.dilation.h = BASIC_DILATION_Y;
+    conv_params.input_offset = BASIC_INPUT_OFFSET;
+    conv_params.output_offset = BASIC_OUTPUT_OFFSET;
+    conv_params.activation.min = BASIC_OUT_ACTIVATION_MIN;
+    conv_params.activation.max = BASIC_OUT_ACTIVATION_MAX;
+    quant_params.multiplier = (int32_t *)basic_output_mult;
+    quant_params.shift = (int32_t *)basic_output_shift;
+
+    ctx.size = arm_convolve_wrapper_s8_get_buffer_size(&conv_params, &input_dims, &filter_dims, &output_dims);
+    ctx.buf = malloc(ctx.size);
+
+    result->macs = conv_macs(&input_dims, &filter_dims, &output_dims);
+    BENCHMARK_KERNEL(result,
+                     arm_convolve_wrapper_s8(&ctx,
+                                             &conv_params,
+                                             &quant_params,
+                                             &input_dims,
+                                             basic_input,
+                                             &filter_dims,
+                                             basic_weights,
+                                             &bias_dims,
+                                             basic_biases,
+                                             &output_dims,
+                                             output),
+                     validate(output, basic_output_ref, BASIC_DST_SIZE));
+
+    free(ctx.buf);
+}
+
+static void convolve_wrapper_s8_kernel1x1(benchmark_result *result)
+{
+    int8_t output[KERNEL1X1_DST_SIZE] = {0};
+
+    cmsis_nn_context ctx;
+    cmsis_nn_conv_params conv_params;
+    cmsis_nn_per_channel_quant_params quant_params;
+    cmsis_nn_dims input_dims = {KERNEL1X1_INPUT_BATCHES, KERNEL1X1_INPUT_H, KERNEL1X1_INPUT_W, KERNEL1X1_IN_CH};
+    cmsis_nn_dims filter_dims = {KERNEL1X1_OUT_CH, KERNEL1X1_FILTER_Y, KERNEL1X1_FILTER_X, KERNEL1X1_IN_CH};
+    cmsis_nn_dims bias_dims = {1, 1, 1, KERNEL1X1_OUT_CH};
+    cmsis_nn_dims output_dims = {KERNEL1X1_INPUT_BATCHES, KERNEL1X1_OUTPUT_H, KERNEL1X1_OUTPUT_W, KERNEL1X1_OUT_CH};
+
+    conv_params.padding.w = KERNEL1X1_PAD_X;
+    conv_params.padding.h = KERNEL1X1_PAD_Y;
+    conv_params.stride.w = KERNEL1X1_STRIDE_X;
+    conv_params.stride.h = KERNEL1X1_STRIDE_Y;
+    conv_params.dilation.w = KERNEL1X1_DILATION_X;
+    conv_params.dilation.h = KERNEL1X1_DILATION_Y;
+    conv_params.input_offset = KERNEL1X1_INPUT_OFFSET;
+    conv_params.output_offset = KERNEL1X1_OUTPUT_OFFSET;
+    conv_params.activation.min = KERNEL1X1_OUT_ACTIVATION_MIN;
+    conv_params.activation.max = KERNEL1X1_OUT_ACTIVATION_MAX;
+    quant_params.multiplier = (int32_t *)kernel1x1_output_mult;
+    quant_params.shift = (int32_t *)kernel1x1_output_shift;
+
+    ctx.size = arm_convolve_wrapper_s8_get_buffer_size(&conv_params, &input_dims, &filter_dims, &output_dims);
+    ctx.buf = malloc(ctx.size);
+
+    result->macs = conv_macs(&input_dims, &filter_dims, &output_dims);
+    BENCHMARK_KERNEL(result,
+                     arm_convolve_wrapper_s8(&ctx,
+                                             &conv_params,
+                                             &quant_params,
+                                             &input_dims,
+                                             kernel1x1_input,
+                                             &filter_dims,
+                                             kernel1x1_weights,
+                                             &bias_dims,
+                                             kernel1x1_biases,
+                                             &output_dims,
+                                             output),
+                     validate(output, kernel1x1_output_ref, KERNEL1X1_DST_SIZE));
+
+    free(ctx.buf);
+}
+
+typedef arm_cmsis_nn_status (*dw_conv_s8_fn)(const cmsis_nn_context *ctx,
+                                              const cmsis_nn_dw_conv_params *dw_conv_params,
+                                              const cmsis_nn_per_channel_quant_params *quant_params,
+                                              const cmsis_nn_dims *input_dims,
+                                              const int8_t *input_data,
+                                              const cmsis_nn_dims *filter_dims,
+                                              const int8_t *filter_data,
+                                              const cmsis_nn_dims *bias_dims,
+                                              const int32_t *bias_data,
+                                              const cmsis_nn_dims *output_dims,
+                                              int8_t *output_data);
+
+/* One buffer large enough for every s8 depthwise kernel, so that they can be compared on the same data */
+static int32_t dw_conv_s8_buffer_size(const cmsis_nn_dw_conv_params *dw_conv_params,
+                                      const cmsis_nn_dims *input_dims,
+                                      const cmsis_nn_dims *filter_dims,
+                                      const cmsis_nn_dims *output_dims)
+{
+    int32_t size = arm_depthwise_conv_wrapper_s8_get_buffer_size(dw_conv_params, input_dims, filter_dims, output_dims);
+    const int32_t opt_size = arm_depthwise_conv_s8_opt_get_buffer_size(input_dims, filter_dims);
+    const int32_t row_reuse_size =
+        arm_depthwise_conv_row_reuse_s8_get_buffer_size(dw_conv_params, input_dims, filter_dims, output_dims);
+
+    size = opt_size > size ? opt_size : size;
+    return row_reuse_size > size ? row_reuse_size : size;
+}
+
+static void depthwise_eq_in_out_ch(benchmark_result *result, const dw_conv_s8_fn kernel)
+{
+    int8_t output[DEPTHWISE_EQ_IN_OUT_CH_DST_SIZE] = {0};
+
+    cmsis_nn_context ctx;
+    cmsis_nn_dw_conv_params dw_conv_params;
+    cmsis_nn_per_channel_quant_params quant_params;
+    cmsis_nn_dims input_dims = {DEPTHWISE_EQ_IN_OUT_CH_INPUT_BATCHES,
+                                DEPTHWISE_EQ_IN_OUT_CH_INPUT_H,
+                                DEPTHWISE_EQ_IN_OUT_CH_INPUT_W,
+                                DEPTHWISE_EQ_IN_OUT_CH_IN_CH};
+    cmsis_nn_dims filter_dims = {
+        1, DEPTHWISE_EQ_IN_OUT_CH_FILTER_Y, DEPTHWISE_EQ_IN_OUT_CH_FILTER_X, DEPTHWISE_EQ_IN_OUT_CH_OUT_CH};
+    cmsis_nn_dims bias_dims = {1, 1, 1, DEPTHWISE_EQ_IN_OUT_CH_OUT_CH};
+    cmsis_nn_dims output_dims = {DEPTHWISE_EQ_IN_OUT_CH_INPUT_BATCHES,
+                                 DEPTHWISE_EQ_IN_OUT_CH_OUTPUT_H,
+                                 DEPTHWISE_EQ_IN_OUT_CH_OUTPUT_W,
+                                 DEPTHWISE_EQ_IN_OUT_CH_OUT_CH};
+
+    dw_conv_params.padding.w = DEPTHWISE_EQ_IN_OUT_CH_PAD_X;
+    dw_conv_params.padding.h = DEPTHWISE_EQ_IN_OUT_CH_PAD_Y;
+    dw_conv_params.stride.w = DEPTHWISE_EQ_IN_OUT_CH_STRIDE_X;
+    dw_conv_params.stride.h = DEPTHWISE_EQ_IN_OUT_CH_STRIDE_Y;
+    dw_conv_params.dilation.w = DEPTHWISE_EQ_IN_OUT_CH_DILATION_X;
+    dw_conv_params.dilation.h = DEPTHWISE_EQ_IN_OUT_CH_DILATION_Y;
+    dw_conv_params.ch_mult = DEPTHWISE_EQ_IN_OUT_CH_CH_MULT;
+    dw_conv_params.input_offset = DEPTHWISE_EQ_IN_OUT_CH_INPUT_OFFSET;
+    dw_conv_params.output_offset = DEPTHWISE_EQ_IN_OUT_CH_OUTPUT_OFFSET;
+    dw_conv_params.activation.min = DEPTHWISE_EQ_IN_OUT_CH_OUT_ACTIVATION_MIN;
+    dw_conv_params.activation.max = DEPTHWISE_EQ_IN_OUT_CH_OUT_ACTIVATION_MAX;
+    quant_params.multiplier = (int32_t *)depthwise_eq_in_out_ch_output_mult;
+    quant_params.shift = (int32_t *)depthwise_eq_in_out_ch_output_shift;
+
+    const int32_t *bias_data = get_bias_address(depthwise_eq_in_out_ch_biases, DEPTHWISE_EQ_IN_OUT_CH_IN_CH);
+
+    ctx.size = dw_conv_s8_buffer_size(&dw_conv_params, &input_dims, &filter_dims, &output_dims);
+    ctx.buf = malloc(ctx.size);
+
+    result->macs =
+        (int64_t)output_dims.n * output_dims.h * output_dims.w * output_dims.c * filter_dims.h * filter_dims.w;
+    BENCHMARK_KERNEL(result,
+                     kernel(&ctx,
+                            &dw_conv_params,
+                            &quant_params,
+                            &input_dims,
+                            depthwise_eq_in_out_ch_input,
+                            &filter_dims,
+                            depthwise_eq_in_out_ch_weights,
+                            &bias_dims,
+                            bias_data,
+                            &output_dims,
+                            output),
+                     validate(output, depthwise_eq_in_out_ch_output_ref, DEPTHWISE_EQ_IN_OUT_CH_DST_SIZE));
+
+    free(ctx.buf);
+}
+
+static void depthwise_conv_wrapper_s8_eq_in_out_ch(benchmark_result *result)
+{
+    depthwise_eq_in_out_ch(result, arm_depthwise_conv_wrapper_s8);
+}
+
+static void depthwise_conv_s8_opt_eq_in_out_ch(benchmark_result *result)
+{
+    depthwise_eq_in_out_ch(result, arm_depthwise_conv_s8_opt);
+}
+
+static void depthwise_conv_row_reuse_s8_eq_in_out_ch(benchmark_result *result)
+{
+    depthwise_eq_in_out_ch(result, arm_depthwise_conv_row_reuse_s8);
+}
+
+/*
+ * Generated 3x3 and 5x5 layers, stride 1 with same padding, with an output reference from arm_depthwise_conv_s8.
+ * The unit test vectors are too small to show the effect of input reuse.
+ */
+static void depthwise_generated(benchmark_result *result, const dw_conv_s8_fn kernel, const int32_t kernel_size)
+{
+    static int8_t input[DW_GENERATED_H * DW_GENERATED_W * DW_GENERATED_CH];
+    static int8_t weights[5 * 5 * DW_GENERATED_CH];
+    static int8_t output[DW_GENERATED_H * DW_GENERATED_W * DW_GENERATED_CH];
+    static int8_t output_ref[DW_GENERATED_H * DW_GENERATED_W * DW_GENERATED_CH];
+    static int32_t bias[DW_GENERATED_CH];
+    static int32_t multiplier[DW_GENERATED_CH];
+    static int32_t shift[DW_GENERATED_CH];
+    const int32_t size = DW_GENERATED_H * DW_GENERATED_W * DW_GENERATED_CH;
+
+    cmsis_nn_context ctx = {NULL, 0};
+    cmsis_nn_dw_conv_params dw_conv_params;
+    cmsis_nn_per_channel_quant_params quant_params;
+    cmsis_nn_dims input_dims = {1, DW_GENERATED_H, DW_GENERATED_W, DW_GENERATED_CH};
+    cmsis_nn_dims filter_dims = {1, kernel_size, kernel_size, DW_GENERATED_CH};
+    cmsis_nn_dims bias_dims = {1, 1, 1, DW_GENERATED_CH};
+    cmsis_nn_dims output_dims = {1, DW_GENERATED_H, DW_GENERATED_W, DW_GENERATED_CH};
+
+    for (int32_t i = 0; i < size; i++)
+    {
+        input[i] = (int8_t)((i * 37 + 11) % 256 - 128);
+    }
+    for (int32_t i = 0; i < kernel_size * kernel_size * DW_GENERATED_CH; i++)
+    {
+        weights[i] = (int8_t)((i * 53 + 7) % 255 - 127);
+    }
+    for (int32_t i = 0; i < DW_GENERATED_CH; i++)
+    {
+        bias[i] = (i * 997) % 4001 - 2000;
+        multiplier[i] = 1073741824 + i * 12345678;
+        shift[i] = -8;
+    }
+
+    dw_conv_params.padding.w = kernel_size / 2;
+    dw_conv_params.padding.h = kernel_size / 2;
+    dw_conv_params.stride.w = 1;
+    dw_conv_params.stride.h = 1;
+    dw_conv_params.dilation.w = 1;
+    dw_conv_params.dilation.h = 1;
+    dw_conv_params.ch_mult = 1;
+    dw_conv_params.input_offset = 3;
+    dw_conv_params.output_offset = -5;
+    dw_conv_params.activation.min = -128;
+    dw_conv_params.activation.max = 127;
+    quant_params.multiplier = multiplier;
+    quant_params.shift = shift;
+
+    arm_depthwise_conv_s8(&ctx,
+                          &dw_conv_params,
+                          &quant_params,
+                          &input_dims,
+                          input,
+                          &filter_dims,
+                          weights,
+                          &bias_dims,
+                          bias,
+                          &output_dims,
+                          output_ref);
+
+    ctx.size = dw_conv_s8_buffer_size(&dw_conv_params, &input_dims, &filter_dims, &output_dims);
+    ctx.buf = malloc(ctx.size);
+
+    result->macs = (int64_t)size * kernel_size * kernel_size;
+    BENCHMARK_KERNEL(result,
+                     kernel(&ctx,
+                            &dw_conv_params,
+                            &quant_params,
+                            &input_dims,
+                            input,
+                            &filter_dims,
+                            weights,
+                            &bias_dims,
+                            bias,
+                            &output_dims,
+                            output),
+                     validate(output, output_ref, size));
+
+    free(ctx.buf);
+}
+
+static void depthwise_conv_s8_opt_3x3(benchmark_result *result)
+{
+    depthwise_generated(result, arm_depthwise_conv_s8_opt, 3);
+}
+
+static void depthwise_conv_3x3_s8_3x3(benchmark_result *result)
+{
+    depthwise_generated(result, arm_depthwise_conv_3x3_s8, 3);
+}
+
+static void depthwise_conv_row_reuse_s8_3x3(benchmark_result *result)
+{
+    depthwise_generated(result, arm_depthwise_conv_row_reuse_s8, 3);
+}
+
+static void depthwise_conv_s8_opt_5x5(benchmark_result *result)
+{
+    depthwise_generated(result, arm_depthwise_conv_s8_opt, 5);
+}
+
+static void depthwise_conv_row_reuse_s8_5x5(benchmark_result *result)
+{
+    depthwise_generated(result, arm_depthwise_conv_row_reuse_s8, 5);
+}
+
+static void fully_connected_s8(benchmark_result *result)
+{
+    int8_t output[FULLY_CONNECTED_DST_SIZE] = {0};
+
+    cmsis_nn_context ctx;
+    cmsis_nn_fc_params fc_params;
+    cmsis_nn_per_tensor_quant_params quant_params;
+    cmsis_nn_dims input_dims = {
+        FULLY_CONNECTED_INPUT_BATCHES, FULLY_CONNECTED_INPUT_H, FULLY_CONNECTED_INPUT_W, FULLY_CONNECTED_IN_CH};
+    cmsis_nn_dims filter_dims = {FULLY_CONNECTED_ACCUMULATION_DEPTH, 1, 1, FULLY_CONNECTED_OUT_CH};
+    cmsis_nn_dims bias_dims = {1, 1, 1, FULLY_CONNECTED_OUT_CH};
+    cmsis_nn_dims output_dims = {FULLY_CONNECTED_INPUT_BATCHES, 1, 1, FULLY_CONNECTED_OUT_CH};
+
+    fc_params.input_offset = FULLY_CONNECTED_INPUT_OFFSET;
+    fc_params.filter_offset = 0;
+    fc_params.output_offset = FULLY_CONNECTED_OUTPUT_OFFSET;
+    fc_params.activation.min = FULLY_CONNECTED_OUT_ACTIVATION_MIN;
+    fc_params.activation.max = FULLY_CONNECTED_OUT_ACTIVATION_MAX;
+    quant_params.multiplier = FULLY_CONNECTED_OUTPUT_MULTIPLIER;
+    quant_params.shift = FULLY_CONNECTED_OUTPUT_SHIFT;
+
+    ctx.size = arm_fully_connected_s8_get_buffer_size(&filter_dims);
+    ctx.buf = malloc(ctx.size);
+
+#if defined(ARM_MATH_MVEI)
+    arm_vector_sum_s8(ctx.buf,
+                      filter_dims.n,
+                      output_dims.c,
+                      fully_connected_weights,
+                      fc_params.input_offset,
+                      fc_params.filter_offset,
+                      fully_connected_biases);
+#endif
+
+    result->macs = (int64_t)output_dims.n * output_dims.c * filter_dims.n;
+    BENCHMARK_KERNEL(result,
+                     arm_fully_connected_s8(&ctx,
+                                            &fc_params,
+                                            &quant_params,
+                                            &input_dims,
+                                            fully_connected_input,
+                                            &filter_dims,
+                                            fully_connected_weights,
+                                            &bias_dims,
+                                            fully_connected_biases,
+                                            &output_dims,
+                                            output),
+                     validate(output, fully_connected_output_ref, FULLY_CONNECTED_DST_SIZE));
+
+    free(ctx.buf);
+}
+
+static void convolve_wrapper_s16_dilation_1(benchmark_result *result)
+{
+    int16_t output[INT16XINT8_DILATION_1_DST_SIZE] = {0};
+
+    cmsis_nn_context ctx;
+    cmsis_nn_conv_params conv_params;
+    cmsis_nn_per_channel_quant_params quant_params;
+    cmsis_nn_dims input_dims = {INT16XINT8_DILATION_1_INPUT_BATCHES,
+                                INT16XINT8_DILATION_1_INPUT_H,
+                                INT16XINT8_DILATION_1_INPUT_W,
+                                INT16XINT8_DILATION_1_IN_CH};
+    cmsis_nn_dims filter_dims = {INT16XINT8_DILATION_1_OUT_CH,
+                                 INT16XINT8_DILATION_1_FILTER_Y,
+                                 INT16XINT8_DILATION_1_FILTER_X,
+                                 INT16XINT8_DILATION_1_IN_CH};
+    cmsis_nn_dims bias_dims = {1, 1, 1, INT16XINT8_DILATION_1_OUT_CH};
+    cmsis_nn_dims output_dims = {INT16XINT8_DILATION_1_INPUT_BATCHES,
+                                 INT16XINT8_DILATION_1_OUTPUT_H,
+                                 INT16XINT8_DILATION_1_OUTPUT_W,
+                                 INT16XINT8_DILATION_1_OUT_CH};
+    const cmsis_nn_bias_data bias_data = {int16xint8_dilation_1_biases, false};
+
+    conv_params.padding.w = INT16XINT8_DILATION_1_PAD_X;
+    conv_params.padding.h = INT16XINT8_DILATION_1_PAD_Y;
+    conv_params.stride.w = INT16XINT8_DILATION_1_STRIDE_X;
+    conv_params.stride.h = INT16XINT8_DILATION_1_STRIDE_Y;
+    conv_params.dilation.w = INT16XINT8_DILATION_1_DILATION_X;
+    conv_params.dilation.h = INT16XINT8_DILATION_1_DILATION_Y;
+    conv_params.input_offset = INT16XINT8_DILATION_1_INPUT_OFFSET;
+    conv_params.output_offset = INT16XINT8_DILATION_1_OUTPUT_OFFSET;
+    conv_params.activation.min = INT16XINT8_DILATION_1_OUT_ACTIVATION_MIN;
+    conv_params.activation.max = INT16XINT8_DILATION_1_OUT_ACTIVATION_MAX;
+    quant_params.multiplier = (int32_t *)int16xint8_dilation_1_output_mult;
+    quant_params.shift = (int32_t *)int16xint8_dilation_1_output_shift;
+
+    ctx.size = arm_convolve_wrapper_s16_get_buffer_size(&conv_params, &input_dims, &filter_dims, &output_dims);
+    ctx.buf = malloc(ctx.size);
+
+    result->macs = conv_macs(&input_dims, &filter_dims, &output_dims);
+    BENCHMARK_KERNEL(result,
+                     arm_convolve_wrapper_s16(&ctx,
+                                              &conv_params,
+                                              &quant_params,
+                                              &input_dims,
+                                              int16xint8_dilation_1_input,
+                                              &filter_dims,
+                                              int16xint8_dilation_1_weights,
+                                              &bias_dims,
+                                              &bias_data,
+                                              &output_dims,
+                                              output),
+                     validate_s16(output, int16xint8_dilation_1_output_ref, INT16XINT8_DILATION_1_DST_SIZE));
+
+    free(ctx.buf);
+}
+
+static void fully_connected_s16_big(benchmark_result *result)
+{
+    int16_t output[FULLY_CONNECTED_INT16_BIG_DST_SIZE] = {0};
+
+    cmsis_nn_context ctx;
+    cmsis_nn_fc_params fc_params;
+    cmsis_nn_per_tensor_quant_params quant_params;
+    cmsis_nn_dims input_dims = {FULLY_CONNECTED_INT16_BIG_INPUT_BATCHES,
+                                FULLY_CONNECTED_INT16_BIG_INPUT_H,
+                                FULLY_CONNECTED_INT16_BIG_INPUT_W,
+                                FULLY_CONNECTED_INT16_BIG_IN_CH};
+    cmsis_nn_dims filter_dims = {FULLY_CONNECTED_INT16_BIG_ACCUMULATION_DEPTH,
+                                 FULLY_CONNECTED_INT16_BIG_INPUT_H,
+                                 FULLY_CONNECTED_INT16_BIG_INPUT_W,
+                                 FULLY_CONNECTED_INT16_BIG_OUT_CH};
+    cmsis_nn_dims bias_dims = {1, 1, 1, FULLY_CONNECTED_INT16_BIG_OUT_CH};
+    cmsis_nn_dims output_dims = {FULLY_CONNECTED_INT16_BIG_INPUT_BATCHES, 1, 1, FULLY_CONNECTED_INT16_BIG_OUT_CH};
+
+    fc_params.input_offset = 0;
+    fc_params.filter_offset = 0;
+    fc_params.output_offset = 0;
+    fc_params.activation.min = FULLY_CONNECTED_INT16_BIG_OUT_ACTIVATION_MIN;
+    fc_params.activation.max = FULLY_CONNECTED_INT16_BIG_OUT_ACTIVATION_MAX;
+    quant_params.multiplier = FULLY_CONNECTED_INT16_BIG_OUTPUT_MULTIPLIER;
+    quant_params.shift = FULLY_CONNECTED_INT16_BIG_OUTPUT_SHIFT;
+
+    ctx.size = arm_fully_connected_s16_get_buffer_size(&filter_dims);
+    ctx.buf = malloc(ctx.size);
+
+    result->macs = (int64_t)output_dims.n * output_dims.c * filter_dims.n;
+    BENCHMARK_KERNEL(result,
+                     arm_fully_connected_s16(&ctx,
+                                             &fc_params,
+                                             &quant_params,
+                                             &input_dims,
+                                             fully_connected_int16_big_input,
+                                             &filter_dims,
+                                             fully_connected_int16_big_weights,
+                                             &bias_dims,
+                                             fully_connected_int16_big_biases,
+                                             &output_dims,
+                                             output),
+                     validate_s16(output, fully_connected_int16_big_output_ref, FULLY_CONNECTED_INT16_BIG_DST_SIZE));
+
+    free(ctx.buf);
+}
+
+static void avgpool_s8(benchmark_result *result)
+{
+    int8_t output[AVGPOOLING_OUTPUT_W * AVGPOOLING_OUTPUT_H * AVGPOOLING_BATCH_SIZE * AVGPOOLING_OUTPUT_C] = {0};
+
+    cmsis_nn_context ctx;
+    cmsis_nn_pool_params pool_params;
+    cmsis_nn_dims input_dims = {AVGPOOLING_BATCH_SIZE, AVGPOOLING_INPUT_H, AVGPOOLING_INPUT_W, AVGPOOLING_INPUT_C};
+    cmsis_nn_dims filter_dims = {1, AVGPOOLING_FILTER_H, AVGPOOLING_FILTER_W, 1};
+    cmsis_nn_dims output_dims = {AVGPOOLING_BATCH_SIZE, AVGPOOLING_OUTPUT_H, AVGPOOLING_OUTPUT_W, AVGPOOLING_OUTPUT_C};
+
+    pool_params.padding.w = AVGPOOLING_PADDING_W;
+    pool_params.padding.h = AVGPOOLING_PADDING_H;
+    pool_params.stride.w = AVGPOOLING_STRIDE_W;
+    pool_params.stride.h = AVGPOOLING_STRIDE_H;
+    pool_params.activation.min = AVGPOOLING_ACTIVATION_MIN;
+    pool_params.activation.max = AVGPOOLING_ACTIVATION_MAX;
+
+    ctx.size = arm_avgpool_s8_get_buffer_size(AVGPOOLING_OUTPUT_W, AVGPOOLING_INPUT_C);
+    ctx.buf = malloc(ctx.size);
+
+    result->macs =
+        (int64_t)output_dims.n * output_dims.h * output_dims.w * output_dims.c * filter_dims.h * filter_dims.w;
+    BENCHMARK_KERNEL(
+        result,
+        arm_avgpool_s8(&ctx, &pool_params, &input_dims, avgpooling_input_tensor, &filter_dims, &output_dims, output),
+        validate(output, avgpooling_output, sizeof(output)));
+
+    free(ctx.buf);
+}
+
+static void max_pool_s8(benchmark_result *result)
+{
+    int8_t output[MAXPOOLING_OUTPUT_W * MAXPOOLING_OUTPUT_H * MAXPOOLING_BATCH_SIZE * MAXPOOLING_OUTPUT_C] = {0};
+
+    cmsis_nn_context ctx = {};
+    cmsis_nn_pool_params pool_params;
+    cmsis_nn_dims input_dims = {MAXPOOLING_BATCH_SIZE, MAXPOOLING_INPUT_H, MAXPOOLING_INPUT_W, MAXPOOLING_INPUT_C};
+    cmsis_nn_dims filter_dims = {1, MAXPOOLING_FILTER_H, MAXPOOLING_FILTER_W, 1};
+    cmsis_nn_dims output_dims = {MAXPOOLING_BATCH_SIZE, MAXPOOLING_OUTPUT_H, MAXPOOLING_OUTPUT_W, MAXPOOLING_OUTPUT_C};
+
+    pool_params.padding.w = MAXPOOLING_PADDING_W;
+    pool_params.padding.h = MAXPOOLING_PADDING_H;
+    pool_params.stride.w = MAXPOOLING_STRIDE_W;
+    pool_params.stride.h = MAXPOOLING_STRIDE_H;
+    pool_params.activation.min = MAXPOOLING_ACTIVATION_MIN;
+    pool_params.activation.max = MAXPOOLING_ACTIVATION_MAX;
+
+    result->macs =
+        (int64_t)output_dims.n * output_dims.h * output_dims.w * output_dims.c * filter_dims.h * filter_dims.w;
+    BENCHMARK_KERNEL(
+        result,
+        arm_max_pool_s8(&ctx, &pool_params, &input_dims, maxpooling_input_tensor, &filter_dims, &output_dims, output),
+        validate(output, maxpooling_output, sizeof(output)));
+}
+
+static void elementwise_add_s8(benchmark_result *result)
+{
+    int8_t output[ADD_DST_SIZE] = {0};
+
+    result->macs = ADD_DST_SIZE;
+    BENCHMARK_KERNEL(result,
+                     arm_elementwise_add_s8(add_input1,
+                                            add_input2,
+                                            ADD_INPUT1_OFFSET,
+                                            ADD_INPUT1_MULT,
+                                            ADD_INPUT1_SHIFT,
+                                            ADD_INPUT2_OFFSET,
+                                            ADD_INPUT2_MULT,
+                                            ADD_INPUT2_SHIFT,
+                                            ADD_LEFT_SHIFT,
+                                            output,
+                                            ADD_OUTPUT_OFFSET,
+                                            ADD_OUTPUT_MULT,
+                                            ADD_OUTPUT_SHIFT,
+                                            ADD_OUT_ACTIVATION_MIN,
+                                            ADD_OUT_ACTIVATION_MAX,
+                                            ADD_DST_SIZE),
+                     validate(output, add_output_ref, ADD_DST_SIZE));
+}
+
+static void elementwise_mul_s8(benchmark_result *result)
+{
+    int8_t output[MUL_DST_SIZE] = {0};
+
+    result->macs = MUL_DST_SIZE;
+    BENCHMARK_KERNEL(result,
+                     arm_elementwise_mul_s8(mul_input1,
+                                            mul_input2,
+                                            MUL_INPUT1_OFFSET,
+                                            MUL_INPUT2_OFFSET,
+                                            output,
+                                            MUL_OUTPUT_OFFSET,
+                                            MUL_OUTPUT_MULT,
+                                            MUL_OUTPUT_SHIFT,
+                                            MUL_OUT_ACTIVATION_MIN,
+                                            MUL_OUT_ACTIVATION_MAX,
+                                            MUL_DST_SIZE),
+                     validate(output, mul_output_ref, MUL_DST_SIZE));
+}
+
+static void softmax_s8(benchmark_result *result)
+{
+    int8_t output[SOFTMAX_DST_SIZE] = {0};
+
+    /* arm_softmax_s8 has no return value */
+    result->macs = SOFTMAX_DST_SIZE;
+    BENCHMARK_KERNEL(result,
+                     (arm_softmax_s8(softmax_input,
+                                     SOFTMAX_NUM_ROWS,
+                                     SOFTMAX_ROW_SIZE,
+                                     SOFTMAX_INPUT_MULT,
+                                     SOFTMAX_INPUT_LEFT_SHIFT,
+                                     SOFTMAX_DIFF_MIN,
+                                     output),
+                      ARM_CMSIS_NN_SUCCESS),
+                     validate(output, softmax_output_ref, SOFTMAX_DST_SIZE));
+}
+
+static const benchmark_case benchmark_cases[] = {
+    {"arm_convolve_wrapper_s8", "basic", convolve_wrapper_s8_basic},
+    {"arm_convolve_wrapper_s8", "kernel1x1", convolve_wrapper_s8_kernel1x1},
+    {"arm_depthwise_conv_wrapper_s8", "depthwise_eq_in_out_ch", depthwise_conv_wrapper_s8_eq_in_out_ch},
+    {"arm_depthwise_conv_s8_opt", "depthwise_eq_in_out_ch", depthwise_conv_s8_opt_eq_in_out_ch},
+    {"arm_depthwise_conv_row_reuse_s8", "depthwise_eq_in_out_ch", depthwise_conv_row_reuse_s8_eq_in_out_ch},
+    {"arm_depthwise_conv_s8_opt", "generated_3x3", depthwise_conv_s8_opt_3x3},
+    {"arm_depthwise_conv_3x3_s8", "generated_3x3", depthwise_conv_3x3_s8_3x3},
+    {"arm_depthwise_conv_row_reuse_s8", "generated_3x3", depthwise_conv_row_reuse_s8_3x3},
+    {"arm_depthwise_conv_s8_opt", "generated_5x5", depthwise_conv_s8_opt_5x5},
+    {"arm_depthwise_conv_row_reuse_s8", "generated_5x5", depthwise_conv_row_reuse_s8_5x5},
+    {"arm_fully_connected_s8", "fully_connected", fully_connected_s8},
+    {"arm_convolve_wrapper_s16", "int16xint8_dilation_1", convolve_wrapper_s16_dilation_1},
+    {"arm_fully_connected_s16", "fully_connected_int16_big", fully_connected_s16_big},
+    {"arm_avgpool_s8", "avgpooling", avgpool_s8},
+    {"arm_max_pool_s8", "maxpooling", max_pool_s8},
+    {"arm_elementwise_add_s8", "add", elementwise_add_s8},
+    {"arm_elementwise_mul_s8", "mul", elementwise_mul_s8},
+    {"arm_softmax_s8", "softmax", softmax_s8},
+};
+
+int main(int argc, char **argv)
+{
+#if defined(BENCHMARK_OUTPUT_JSON)
+    bool json = true;
+#else
+    bool json = false;
+#endif
+    for (int i = 1; i < argc; i++)
+    {
+        json = json || strcmp(argv[i], "--json") == 0;
+    }
+
+    const int32_t num_cases = sizeof(benchmark_cases) / sizeof(benchmark_cases[0]);
+    int32_t num_invalid = 0;
+
+    printf(json ? "[\n" : "kernel,data,macs,iterations,cycles,macs_per_cycle,valid\n");
+    for (int32_t i = 0; i < num_cases; i++)
+    {
+        const benchmark_case *bench = &benchmark_cases[i];
+        benchmark_result result = {0};
+        bench->run(&result);
+        num_invalid += !result.valid;
+
+        const double cycles = (double)result.total_cycles / BENCHMARK_ITERATIONS;
+        const double macs_per_cycle = result.total_cycles ? result.macs / cycles : 0.0;
+        if (json)
+        {
+            printf("  {\"kernel\": \"%s\", \"data\": \"%s\", \"macs\": %lld, \"iterations\": %d, \"cycles\": %.1f, "
+                   "\"macs_per_cycle\": %.4f, \"valid\": %s}%s\n",
+                   bench->kernel,
+                   bench->data,
+                   (long long)result.macs,
+                   BENCHMARK_ITERATIONS,
+                   cycles,
+                   macs_per_cycle,
+                   result.valid ? "true" : "false",
+                   i + 1 < num_cases ? "," : "");
+        }
+        else
+        {
+            printf("%s,%s,%lld,%d,%.1f,%.4f,%d\n",
+                   bench->kernel,
+                   bench->data,
+                   (long long)result.macs,
+                   BENCHMARK_ITERATIONS,
+                   cycles,
+                   macs_per_cycle,
+                   result.valid);
+        }
+    }
+    if (json)
+    {
+        printf("]\n");
+    }
+
+    return num_invalid != 0;
+}
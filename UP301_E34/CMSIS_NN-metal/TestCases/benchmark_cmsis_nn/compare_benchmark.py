@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+#
+# SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+"""Compare a benchmark_cmsis_nn run against a stored baseline.
+
+Both files may be the CSV or the JSON output of benchmark_cmsis_nn. A case regresses when its cycles per call grow
+by more than the threshold. The script exits with 1 on regressions, on cases whose output no longer matches the
+reference, and on cases missing from the current run, so that it can gate CI.
+
+    compare_benchmark.py baseline.csv current.csv [--threshold 0.05]
+    compare_benchmark.py baseline.csv current.csv --update    # store current.csv as the new baseline
+"""
+
+import argparse
+import csv
+import json
+import shutil
+import sys
+
+
+def load(path):
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    if text.lstrip().startswith("["):
+        rows = json.loads(text)
+    else:
+        rows = list(csv.DictReader(line for line in text.splitlines() if line.strip()))
+
+    results = {}
+    for row in rows:
+        valid = row["valid"]
+        if isinstance(valid, str):
+            valid = valid.strip().lower() in ("1", "true")
+        results[(row["kernel"], row["data"])] = {
+            "cycles": float(row["cycles"]),
+            "macs_per_cycle": float(row["macs_per_cycle"]),
+            "valid": valid,
+        }
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline", help="stored benchmark_cmsis_nn output")
+    parser.add_argument("current", help="benchmark_cmsis_nn output to check")
+    parser.add_argument("--threshold",
+                        type=float,
+                        default=0.05,
+                        help="allowed relative increase of cycles per call (default: %(default)s)")
+    parser.add_argument("--update",
+                        action="store_true",
+                        help="replace the baseline with the current run when it passes")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    current = load(args.current)
+    failures = 0
+
+    print(f"{'kernel':32} {'data':28} {'base cycles':>12} {'cycles':>12} {'change':>8}  MACs/cycle")
+    for key in sorted(set(baseline) | set(current)):
+        kernel, data = key
+        if key not in current:
+            print(f"{kernel:32} {data:28} {'':>12} {'':>12} {'':>8}  MISSING")
+            failures += 1
+            continue
+
+        cur = current[key]
+        note = ""
+        if not cur["valid"]:
+            note = "  INVALID OUTPUT"
+            failures += 1
+
+        if key not in baseline:
+            print(f"{kernel:32} {data:28} {'':>12} {cur['cycles']:12.1f} {'':>8}  "
+                  f"{cur['macs_per_cycle']:.4f} NEW{note}")
+            continue
+
+        base = baseline[key]
+        change = (cur["cycles"] - base["cycles"]) / base["cycles"] if base["cycles"] > 0 else 0.0
+        if change > args.threshold:
+            note += "  REGRESSION"
+            failures += 1
+        print(f"{kernel:32} {data:28} {base['cycles']:12.1f} {cur['cycles']:12.1f} {change:+8.1%}  "
+              f"{cur['macs_per_cycle']:.4f}{note}")
+
+    if failures:
+        print(f"{failures} case(s) failed", file=sys.stderr)
+        return 1
+
+    if args.update:
+        shutil.copyfile(args.current, args.baseline)
+        print(f"Baseline {args.baseline} updated")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -326,6 +326,205 @@ void avgpooling_5_arm_avgpool_s8(void)
                  AVGPOOLING_5_OUTPUT_W * AVGPOOLING_5_OUTPUT_H * AVGPOOLING_5_BATCH_SIZE * AVGPOOLING_5_OUTPUT_C));
 }
 
+void avgpooling_sliding_arm_avgpool_s8(void)
+{
+    const arm_cmsis_nn_status expected = ARM_CMSIS_NN_SUCCESS;
+    int8_t output[AVGPOOLING_OUTPUT_W * AVGPOOLING_OUTPUT_H * AVGPOOLING_BATCH_SIZE * AVGPOOLING_OUTPUT_C] = {0};
+
+    cmsis_nn_context ctx;
+    cmsis_nn_pool_params pool_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims output_dims;
+
+    const int8_t *input_data = avgpooling_input_tensor;
+
+    input_dims.n = AVGPOOLING_BATCH_SIZE;
+    input_dims.w = AVGPOOLING_INPUT_W;
+    input_dims.h = AVGPOOLING_INPUT_H;
+    input_dims.c = AVGPOOLING_INPUT_C;
+    filter_dims.w = AVGPOOLING_FILTER_W;
+    filter_dims.h = AVGPOOLING_FILTER_H;
+    output_dims.w = AVGPOOLING_OUTPUT_W;
+    output_dims.h = AVGPOOLING_OUTPUT_H;
+    output_dims.c = AVGPOOLING_OUTPUT_C;
+
+    pool_params.padding.w = AVGPOOLING_PADDING_W;
+    pool_params.padding.h = AVGPOOLING_PADDING_H;
+    pool_params.stride.w = AVGPOOLING_STRIDE_W;
+    pool_params.stride.h = AVGPOOLING_STRIDE_H;
+
+    pool_params.activation.min = AVGPOOLING_ACTIVATION_MIN;
+    pool_params.activation.max = AVGPOOLING_ACTIVATION_MAX;
+
+    ctx.size = arm_avgpool_sliding_s8_get_buffer_size(&input_dims, &filter_dims, &output_dims);
+    ctx.buf = malloc(ctx.size);
+
+    arm_cmsis_nn_status result =
+        arm_avgpool_sliding_s8(&ctx, &pool_params, &input_dims, input_data, &filter_dims, &output_dims, output);
+
+    if (ctx.buf)
+    {
+        memset(ctx.buf, 0, ctx.size);
+        free(ctx.buf);
+    }
+    TEST_ASSERT_EQUAL(expected, result);
+    TEST_ASSERT_TRUE(
+        validate(output,
+                 avgpooling_output,
+                 AVGPOOLING_OUTPUT_W * AVGPOOLING_OUTPUT_H * AVGPOOLING_BATCH_SIZE * AVGPOOLING_OUTPUT_C));
+}
+
+void avgpooling_1_sliding_arm_avgpool_s8(void)
+{
+    const arm_cmsis_nn_status expected = ARM_CMSIS_NN_SUCCESS;
+    int8_t output[AVGPOOLING_1_OUTPUT_W * AVGPOOLING_1_OUTPUT_H * AVGPOOLING_1_BATCH_SIZE * AVGPOOLING_1_OUTPUT_C] = {
+        0};
+
+    cmsis_nn_context ctx;
+    cmsis_nn_pool_params pool_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims output_dims;
+
+    const int8_t *input_data = avgpooling_1_input_tensor;
+
+    input_dims.n = AVGPOOLING_1_BATCH_SIZE;
+    input_dims.w = AVGPOOLING_1_INPUT_W;
+    input_dims.h = AVGPOOLING_1_INPUT_H;
+    input_dims.c = AVGPOOLING_1_INPUT_C;
+    filter_dims.w = AVGPOOLING_1_FILTER_W;
+    filter_dims.h = AVGPOOLING_1_FILTER_H;
+    output_dims.w = AVGPOOLING_1_OUTPUT_W;
+    output_dims.h = AVGPOOLING_1_OUTPUT_H;
+    output_dims.c = AVGPOOLING_1_OUTPUT_C;
+
+    pool_params.padding.w = AVGPOOLING_1_PADDING_W;
+    pool_params.padding.h = AVGPOOLING_1_PADDING_H;
+    pool_params.stride.w = AVGPOOLING_1_STRIDE_W;
+    pool_params.stride.h = AVGPOOLING_1_STRIDE_H;
+
+    pool_params.activation.min = AVGPOOLING_1_ACTIVATION_MIN;
+    pool_params.activation.max = AVGPOOLING_1_ACTIVATION_MAX;
+
+    ctx.size = arm_avgpool_sliding_s8_get_buffer_size(&input_dims, &filter_dims, &output_dims);
+    ctx.buf = malloc(ctx.size);
+
+    arm_cmsis_nn_status result =
+        arm_avgpool_s8(&ctx, &pool_params, &input_dims, input_data, &filter_dims, &output_dims, output);
+
+    if (ctx.buf)
+    {
+        memset(ctx.buf, 0, ctx.size);
+        free(ctx.buf);
+    }
+    TEST_ASSERT_EQUAL(expected, result);
+    TEST_ASSERT_TRUE(
+        validate(output,
+                 avgpooling_1_output,
+                 AVGPOOLING_1_OUTPUT_W * AVGPOOLING_1_OUTPUT_H * AVGPOOLING_1_BATCH_SIZE * AVGPOOLING_1_OUTPUT_C));
+}
+
+void avgpooling_4_sliding_arm_avgpool_s8(void)
+{
+    const arm_cmsis_nn_status expected = ARM_CMSIS_NN_SUCCESS;
+    int8_t output[AVGPOOLING_4_OUTPUT_W * AVGPOOLING_4_OUTPUT_H * AVGPOOLING_4_BATCH_SIZE * AVGPOOLING_4_OUTPUT_C] = {
+        0};
+
+    cmsis_nn_context ctx;
+    cmsis_nn_pool_params pool_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims output_dims;
+
+    const int8_t *input_data = avgpooling_4_input_tensor;
+
+    input_dims.n = AVGPOOLING_4_BATCH_SIZE;
+    input_dims.w = AVGPOOLING_4_INPUT_W;
+    input_dims.h = AVGPOOLING_4_INPUT_H;
+    input_dims.c = AVGPOOLING_4_INPUT_C;
+    filter_dims.w = AVGPOOLING_4_FILTER_W;
+    filter_dims.h = AVGPOOLING_4_FILTER_H;
+    output_dims.w = AVGPOOLING_4_OUTPUT_W;
+    output_dims.h = AVGPOOLING_4_OUTPUT_H;
+    output_dims.c = AVGPOOLING_4_OUTPUT_C;
+
+    pool_params.padding.w = AVGPOOLING_4_PADDING_W;
+    pool_params.padding.h = AVGPOOLING_4_PADDING_H;
+    pool_params.stride.w = AVGPOOLING_4_STRIDE_W;
+    pool_params.stride.h = AVGPOOLING_4_STRIDE_H;
+
+    pool_params.activation.min = AVGPOOLING_4_ACTIVATION_MIN;
+    pool_params.activation.max = AVGPOOLING_4_ACTIVATION_MAX;
+
+    ctx.size = arm_avgpool_sliding_s8_get_buffer_size(&input_dims, &filter_dims, &output_dims);
+    ctx.buf = malloc(ctx.size);
+
+    arm_cmsis_nn_status result =
+        arm_avgpool_sliding_s8(&ctx, &pool_params, &input_dims, input_data, &filter_dims, &output_dims, output);
+
+    if (ctx.buf)
+    {
+        memset(ctx.buf, 0, ctx.size);
+        free(ctx.buf);
+    }
+    TEST_ASSERT_EQUAL(expected, result);
+    TEST_ASSERT_TRUE(
+        validate(output,
+                 avgpooling_4_output,
+                 AVGPOOLING_4_OUTPUT_W * AVGPOOLING_4_OUTPUT_H * AVGPOOLING_4_BATCH_SIZE * AVGPOOLING_4_OUTPUT_C));
+}
+
+void avgpooling_5_sliding_arm_avgpool_s8(void)
+{
+    const arm_cmsis_nn_status expected = ARM_CMSIS_NN_SUCCESS;
+    int8_t output[AVGPOOLING_5_OUTPUT_W * AVGPOOLING_5_OUTPUT_H * AVGPOOLING_5_BATCH_SIZE * AVGPOOLING_5_OUTPUT_C] = {
+        0};
+
+    cmsis_nn_context ctx;
+    cmsis_nn_pool_params pool_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims output_dims;
+
+    const int8_t *input_data = avgpooling_5_input_tensor;
+
+    input_dims.n = AVGPOOLING_5_BATCH_SIZE;
+    input_dims.w = AVGPOOLING_5_INPUT_W;
+    input_dims.h = AVGPOOLING_5_INPUT_H;
+    input_dims.c = AVGPOOLING_5_INPUT_C;
+    filter_dims.w = AVGPOOLING_5_FILTER_W;
+    filter_dims.h = AVGPOOLING_5_FILTER_H;
+    output_dims.w = AVGPOOLING_5_OUTPUT_W;
+    output_dims.h = AVGPOOLING_5_OUTPUT_H;
+    output_dims.c = AVGPOOLING_5_OUTPUT_C;
+
+    pool_params.padding.w = AVGPOOLING_5_PADDING_W;
+    pool_params.padding.h = AVGPOOLING_5_PADDING_H;
+    pool_params.stride.w = AVGPOOLING_5_STRIDE_W;
+    pool_params.stride.h = AVGPOOLING_5_STRIDE_H;
+
+    pool_params.activation.min = AVGPOOLING_5_ACTIVATION_MIN;
+    pool_params.activation.max = AVGPOOLING_5_ACTIVATION_MAX;
+
+    ctx.size = arm_avgpool_sliding_s8_get_buffer_size(&input_dims, &filter_dims, &output_dims);
+    ctx.buf = malloc(ctx.size);
+
+    arm_cmsis_nn_status result =
+        arm_avgpool_sliding_s8(&ctx, &pool_params, &input_dims, input_data, &filter_dims, &output_dims, output);
+
+    if (ctx.buf)
+    {
+        memset(ctx.buf, 0, ctx.size);
+        free(ctx.buf);
+    }
+    TEST_ASSERT_EQUAL(expected, result);
+    TEST_ASSERT_TRUE(
+        validate(output,
+                 avgpooling_5_output,
+                 AVGPOOLING_5_OUTPUT_W * AVGPOOLING_5_OUTPUT_H * AVGPOOLING_5_BATCH_SIZE * AVGPOOLING_5_OUTPUT_C));
+}
+
 void buffer_size_mve_arm_avgpool_s8(void)
 {
 #if defined(ARM_MATH_MVEI)
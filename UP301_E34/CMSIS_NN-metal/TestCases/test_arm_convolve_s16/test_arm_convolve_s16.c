@@ -395,6 +395,24 @@ void int16xint8_dilation_2_arm_convolve_s16(void)
     }
     TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
     TEST_ASSERT_TRUE(validate_s16(output, output_ref, output_ref_size));
+    memset(output, 0, sizeof(output));
+
+    ctx.buf = NULL;
+    ctx.size = 0;
+
+    result = arm_convolve_implicit_s16(&ctx,
+                                       &conv_params,
+                                       &quant_params,
+                                       &input_dims,
+                                       input_data,
+                                       &filter_dims,
+                                       kernel_data,
+                                       &bias_dims,
+                                       &bias_data,
+                                       &output_dims,
+                                       output);
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+    TEST_ASSERT_TRUE(validate_s16(output, output_ref, output_ref_size));
 }
 
 void int16xint8_dilation_3_arm_convolve_s16(void)
@@ -869,6 +887,24 @@ void int16xint8xint32_1_arm_convolve_s16(void)
     }
     TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
     TEST_ASSERT_TRUE(validate_s16(output, output_ref, output_ref_size));
+    memset(output, 0, sizeof(output));
+
+    ctx.buf = NULL;
+    ctx.size = 0;
+
+    result = arm_convolve_implicit_s16(&ctx,
+                                       &conv_params,
+                                       &quant_params,
+                                       &input_dims,
+                                       input_data,
+                                       &filter_dims,
+                                       kernel_data,
+                                       &bias_dims,
+                                       &bias_data,
+                                       &output_dims,
+                                       output);
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+    TEST_ASSERT_TRUE(validate_s16(output, output_ref, output_ref_size));
 }
 
 void int16xint8xint32_2_arm_convolve_s16(void)
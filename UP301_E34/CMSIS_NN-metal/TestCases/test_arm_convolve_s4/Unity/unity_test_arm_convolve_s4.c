@@ -66,3 +66,6 @@ void test_conv_1_x_n_2_arm_convolve_s4(void) { conv_1_x_n_2_arm_convolve_s4(); }
 void test_conv_1_x_n_3_arm_convolve_s4(void) { conv_1_x_n_3_arm_convolve_s4(); }
 void test_conv_1_x_n_4_arm_convolve_s4(void) { conv_1_x_n_4_arm_convolve_s4(); }
 void test_conv_1_x_n_5_arm_convolve_s4(void) { conv_1_x_n_5_arm_convolve_s4(); }
+
+void test_int4_activations_arm_convolve_s4_s4(void) { int4_activations_arm_convolve_s4_s4(); }
+void test_int4_activations_arm_convolve_s4_s8(void) { int4_activations_arm_convolve_s4_s8(); }
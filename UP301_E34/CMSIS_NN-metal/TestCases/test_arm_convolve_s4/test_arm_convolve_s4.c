@@ -19,6 +19,8 @@
 #include <stdlib.h>
 
 #include <arm_nnfunctions.h>
+#include <arm_nnsupportfunctions.h>
+#include <stdbool.h>
 #include <unity.h>
 
 #include "../TestData/basic_2_int4/test_data.h"
@@ -1876,3 +1878,155 @@ void conv_1_x_n_5_arm_convolve_s4(void)
     TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
     TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
 }
+
+#define INT4_ACT_BATCHES (2)
+#define INT4_ACT_INPUT_W (5)
+#define INT4_ACT_INPUT_H (4)
+#define INT4_ACT_IN_CH (3)
+#define INT4_ACT_OUT_CH (5)
+#define INT4_ACT_FILTER_X (3)
+#define INT4_ACT_FILTER_Y (3)
+#define INT4_ACT_OUTPUT_W (3)
+#define INT4_ACT_OUTPUT_H (2)
+#define INT4_ACT_INPUT_SIZE (INT4_ACT_BATCHES * INT4_ACT_INPUT_H * INT4_ACT_INPUT_W * INT4_ACT_IN_CH)
+#define INT4_ACT_FILTER_SIZE (INT4_ACT_OUT_CH * INT4_ACT_FILTER_Y * INT4_ACT_FILTER_X * INT4_ACT_IN_CH)
+#define INT4_ACT_DST_SIZE (INT4_ACT_BATCHES * INT4_ACT_OUTPUT_H * INT4_ACT_OUTPUT_W * INT4_ACT_OUT_CH)
+
+/* Runs arm_convolve_s4_s4 or arm_convolve_s4_s8 on packed int4 activations and compares them with arm_convolve_s4
+ * or arm_convolve_wrapper_s8 on the unpacked activations. The odd channel counts make pixels start in the middle of
+ * a byte, and stride 2 with padding 1 covers the padded im2col columns. */
+static void int4_activations_convolve(const bool int4_weights)
+{
+    int8_t input[INT4_ACT_INPUT_SIZE];
+    int8_t packed_input[(INT4_ACT_INPUT_SIZE + 1) / 2];
+    int8_t weights[INT4_ACT_FILTER_SIZE];
+    int8_t packed_weights[(INT4_ACT_FILTER_SIZE + 1) / 2];
+    int32_t bias[INT4_ACT_OUT_CH];
+    int32_t multiplier[INT4_ACT_OUT_CH];
+    int32_t shift[INT4_ACT_OUT_CH];
+    int8_t output_ref[INT4_ACT_DST_SIZE];
+    int8_t packed_output_ref[(INT4_ACT_DST_SIZE + 1) / 2];
+    int8_t packed_output[(INT4_ACT_DST_SIZE + 1) / 2];
+
+    srand(int4_weights ? 3 : 4);
+    for (int i = 0; i < INT4_ACT_INPUT_SIZE; i++)
+    {
+        input[i] = (int8_t)(rand() % 16 - 8);
+    }
+    for (int i = 0; i < INT4_ACT_FILTER_SIZE; i++)
+    {
+        weights[i] = int4_weights ? (int8_t)(rand() % 16 - 8) : (int8_t)(rand() % 256 - 128);
+    }
+    for (int i = 0; i < INT4_ACT_OUT_CH; i++)
+    {
+        bias[i] = rand() % 200 - 100;
+        multiplier[i] = 0x40000000 + rand() % 0x3FFFFFFF;
+        shift[i] = (int4_weights ? -5 : -9) - rand() % 2;
+    }
+    arm_nn_pack_s4(input, INT4_ACT_INPUT_SIZE, packed_input, 0);
+    arm_nn_pack_s4(weights, INT4_ACT_FILTER_SIZE, packed_weights, 0);
+
+    cmsis_nn_context ctx;
+    cmsis_nn_conv_params conv_params;
+    cmsis_nn_per_channel_quant_params quant_params = {multiplier, shift};
+    cmsis_nn_dims input_dims = {INT4_ACT_BATCHES, INT4_ACT_INPUT_H, INT4_ACT_INPUT_W, INT4_ACT_IN_CH};
+    cmsis_nn_dims filter_dims = {INT4_ACT_OUT_CH, INT4_ACT_FILTER_Y, INT4_ACT_FILTER_X, INT4_ACT_IN_CH};
+    cmsis_nn_dims bias_dims = {1, 1, 1, INT4_ACT_OUT_CH};
+    cmsis_nn_dims output_dims = {INT4_ACT_BATCHES, INT4_ACT_OUTPUT_H, INT4_ACT_OUTPUT_W, INT4_ACT_OUT_CH};
+
+    conv_params.padding.w = 1;
+    conv_params.padding.h = 1;
+    conv_params.stride.w = 2;
+    conv_params.stride.h = 2;
+    conv_params.dilation.w = 1;
+    conv_params.dilation.h = 1;
+    conv_params.input_offset = -1;
+    conv_params.output_offset = 1;
+    conv_params.activation.min = -8;
+    conv_params.activation.max = 7;
+
+    /* Reference on unpacked activations */
+    int32_t buf_size = int4_weights
+        ? arm_convolve_s4_get_buffer_size(&input_dims, &filter_dims)
+        : arm_convolve_wrapper_s8_get_buffer_size(&conv_params, &input_dims, &filter_dims, &output_dims);
+    ctx.buf = malloc(buf_size);
+    ctx.size = buf_size;
+    arm_cmsis_nn_status result;
+    if (int4_weights)
+    {
+        result = arm_convolve_s4(&ctx,
+                                 &conv_params,
+                                 &quant_params,
+                                 &input_dims,
+                                 input,
+                                 &filter_dims,
+                                 packed_weights,
+                                 &bias_dims,
+                                 bias,
+                                 &output_dims,
+                                 output_ref);
+    }
+    else
+    {
+        result = arm_convolve_wrapper_s8(&ctx,
+                                         &conv_params,
+                                         &quant_params,
+                                         &input_dims,
+                                         input,
+                                         &filter_dims,
+                                         weights,
+                                         &bias_dims,
+                                         bias,
+                                         &output_dims,
+                                         output_ref);
+    }
+    free(ctx.buf);
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+    arm_nn_pack_s4(output_ref, INT4_ACT_DST_SIZE, packed_output_ref, 0);
+
+    buf_size = int4_weights ? arm_convolve_s4_s4_get_buffer_size(&input_dims, &filter_dims, &output_dims)
+                            : arm_convolve_s4_s8_get_buffer_size(&input_dims, &filter_dims, &output_dims);
+    ctx.buf = malloc(buf_size);
+    ctx.size = buf_size;
+    memset(packed_output, 0, sizeof(packed_output));
+    if (int4_weights)
+    {
+        result = arm_convolve_s4_s4(&ctx,
+                                    &conv_params,
+                                    &quant_params,
+                                    &input_dims,
+                                    packed_input,
+                                    &filter_dims,
+                                    packed_weights,
+                                    &bias_dims,
+                                    bias,
+                                    &output_dims,
+                                    packed_output);
+    }
+    else
+    {
+        result = arm_convolve_s4_s8(&ctx,
+                                    &conv_params,
+                                    &quant_params,
+                                    &input_dims,
+                                    packed_input,
+                                    &filter_dims,
+                                    weights,
+                                    &bias_dims,
+                                    bias,
+                                    &output_dims,
+                                    packed_output);
+    }
+    if (ctx.buf)
+    {
+        // The caller is responsible to clear the scratch buffers for security reasons if applicable.
+        memset(ctx.buf, 0, buf_size);
+        free(ctx.buf);
+    }
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+    TEST_ASSERT_TRUE(validate(packed_output, packed_output_ref, sizeof(packed_output)));
+}
+
+void int4_activations_arm_convolve_s4_s4(void) { int4_activations_convolve(true); }
+
+void int4_activations_arm_convolve_s4_s8(void) { int4_activations_convolve(false); }
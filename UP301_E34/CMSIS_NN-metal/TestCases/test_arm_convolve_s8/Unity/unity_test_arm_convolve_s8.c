@@ -60,3 +60,5 @@ void test_conv_2x2_dilation_5x5_input_arm_convolve_s8(void) { conv_2x2_dilation_
 void test_buffer_size_arm_convolve_s8(void) { buffer_size_arm_convolve_s8(); }
 void test_buffer_size_mve_arm_convolve_s8(void) { buffer_size_mve_arm_convolve_s8(); }
 void test_buffer_size_dsp_arm_convolve_s8(void) { buffer_size_dsp_arm_convolve_s8(); }
+void test_asym_pad_1x1_arm_convolve_s8(void) { asym_pad_1x1_arm_convolve_s8(); }
+void test_asym_pad_1xn_arm_convolve_s8(void) { asym_pad_1xn_arm_convolve_s8(); }
@@ -225,6 +225,24 @@ void stride2pad1_arm_convolve_s8(void)
     }
     TEST_ASSERT_EQUAL(expected, result);
     TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
+    memset(output, 0, sizeof(output));
+
+    ctx.buf = NULL;
+    ctx.size = 0;
+
+    result = arm_convolve_implicit_s8(&ctx,
+                                      &conv_params,
+                                      &quant_params,
+                                      &input_dims,
+                                      input_data,
+                                      &filter_dims,
+                                      kernel_data,
+                                      &bias_dims,
+                                      bias_data,
+                                      &output_dims,
+                                      output);
+    TEST_ASSERT_EQUAL(expected, result);
+    TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
 }
 
 void conv_2_arm_convolve_s8(void)
@@ -510,6 +528,24 @@ void conv_4_arm_convolve_s8(void)
     }
     TEST_ASSERT_EQUAL(expected, result);
     TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
+    memset(output, 0, sizeof(output));
+
+    ctx.buf = NULL;
+    ctx.size = 0;
+
+    result = arm_convolve_implicit_s8(&ctx,
+                                      &conv_params,
+                                      &quant_params,
+                                      &input_dims,
+                                      input_data,
+                                      &filter_dims,
+                                      kernel_data,
+                                      &bias_dims,
+                                      bias_data,
+                                      &output_dims,
+                                      output);
+    TEST_ASSERT_EQUAL(expected, result);
+    TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
 }
 
 void conv_out_activation_arm_convolve_s8(void)
@@ -576,6 +612,24 @@ void conv_out_activation_arm_convolve_s8(void)
     }
     TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
     TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
+    memset(output, 0, sizeof(output));
+
+    ctx.buf = NULL;
+    ctx.size = 0;
+
+    result = arm_convolve_implicit_s8(&ctx,
+                                      &conv_params,
+                                      &quant_params,
+                                      &input_dims,
+                                      input_data,
+                                      &filter_dims,
+                                      kernel_data,
+                                      &bias_dims,
+                                      bias_data,
+                                      &output_dims,
+                                      output);
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+    TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
 }
 
 void conv_2x2_dilation_arm_convolve_s8(void)
@@ -950,6 +1004,24 @@ void conv_2x3_dilation_arm_convolve_s8(void)
     }
     TEST_ASSERT_EQUAL(expected, result);
     TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
+    memset(output, 0, sizeof(output));
+
+    ctx.buf = NULL;
+    ctx.size = 0;
+
+    result = arm_convolve_implicit_s8(&ctx,
+                                      &conv_params,
+                                      &quant_params,
+                                      &input_dims,
+                                      input_data,
+                                      &filter_dims,
+                                      kernel_data,
+                                      &bias_dims,
+                                      bias_data,
+                                      &output_dims,
+                                      output);
+    TEST_ASSERT_EQUAL(expected, result);
+    TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
 }
 
 void conv_3x2_dilation_arm_convolve_s8(void)
@@ -1136,6 +1208,24 @@ void conv_dilation_golden_arm_convolve_s8(void)
     }
     TEST_ASSERT_EQUAL(expected, result);
     TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
+    memset(output, 0, sizeof(output));
+
+    ctx.buf = NULL;
+    ctx.size = 0;
+
+    result = arm_convolve_implicit_s8(&ctx,
+                                      &conv_params,
+                                      &quant_params,
+                                      &input_dims,
+                                      input_data,
+                                      &filter_dims,
+                                      kernel_data,
+                                      &bias_dims,
+                                      bias_data,
+                                      &output_dims,
+                                      output);
+    TEST_ASSERT_EQUAL(expected, result);
+    TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
 }
 
 void conv_5_arm_convolve_s8(void)
@@ -1349,3 +1439,115 @@ void buffer_size_dsp_arm_convolve_s8(void)
     TEST_ASSERT_EQUAL(wrapper_buf_size, dsp_wrapper_buf_size);
 #endif
 }
+
+#define ASYM_PAD_MAX_INPUT_SIZE (1 * 8 * 8 * 4)
+#define ASYM_PAD_MAX_OUTPUT_SIZE (1 * 8 * 8 * 2)
+
+/*
+ * Runs the wrapper on a convolution whose bottom/right padding differs from its top/left padding, as left by a PAD
+ * operator folded into the convolution, and compares it with arm_convolve_s8 which handles any padding.
+ */
+static void asym_pad_arm_convolve_s8(const cmsis_nn_dims *input_dims,
+                                     const cmsis_nn_dims *filter_dims,
+                                     const cmsis_nn_dims *output_dims,
+                                     const int32_t pad_x,
+                                     const int32_t pad_y)
+{
+    int8_t input_data[ASYM_PAD_MAX_INPUT_SIZE];
+    int8_t filter_data[ASYM_PAD_MAX_INPUT_SIZE];
+    int32_t bias_data[2];
+    int32_t output_mult[2];
+    int32_t output_shift[2];
+    int8_t output_ref[ASYM_PAD_MAX_OUTPUT_SIZE];
+    int8_t output[ASYM_PAD_MAX_OUTPUT_SIZE];
+    const int32_t input_size = input_dims->n * input_dims->h * input_dims->w * input_dims->c;
+    const int32_t filter_size = output_dims->c * filter_dims->h * filter_dims->w * filter_dims->c;
+    const int32_t output_size = output_dims->n * output_dims->h * output_dims->w * output_dims->c;
+
+    for (int32_t i = 0; i < input_size; i++)
+    {
+        input_data[i] = (int8_t)((i * 37) % 255 - 127);
+    }
+    for (int32_t i = 0; i < filter_size; i++)
+    {
+        filter_data[i] = (int8_t)((i * 53) % 201 - 100);
+    }
+    for (int32_t i = 0; i < output_dims->c; i++)
+    {
+        bias_data[i] = 100 * i - 50;
+        output_mult[i] = 1473012819 + i * 1000;
+        output_shift[i] = -7;
+    }
+
+    cmsis_nn_context ctx;
+    cmsis_nn_conv_params conv_params;
+    cmsis_nn_per_channel_quant_params quant_params = {output_mult, output_shift};
+    cmsis_nn_dims bias_dims = {1, 1, 1, output_dims->c};
+
+    conv_params.padding.w = pad_x;
+    conv_params.padding.h = pad_y;
+    conv_params.stride.w = 1;
+    conv_params.stride.h = 1;
+    conv_params.dilation.w = 1;
+    conv_params.dilation.h = 1;
+    conv_params.input_offset = 3;
+    conv_params.output_offset = -4;
+    conv_params.activation.min = -128;
+    conv_params.activation.max = 127;
+
+    int32_t buf_size = arm_convolve_s8_get_buffer_size(input_dims, filter_dims);
+    ctx.buf = malloc(buf_size);
+    ctx.size = buf_size;
+    arm_cmsis_nn_status result = arm_convolve_s8(&ctx,
+                                                 &conv_params,
+                                                 &quant_params,
+                                                 input_dims,
+                                                 input_data,
+                                                 filter_dims,
+                                                 filter_data,
+                                                 &bias_dims,
+                                                 bias_data,
+                                                 NULL,
+                                                 output_dims,
+                                                 output_ref);
+    free(ctx.buf);
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+
+    buf_size = arm_convolve_wrapper_s8_get_buffer_size(&conv_params, input_dims, filter_dims, output_dims);
+    ctx.buf = malloc(buf_size);
+    ctx.size = buf_size;
+    result = arm_convolve_wrapper_s8(&ctx,
+                                     &conv_params,
+                                     &quant_params,
+                                     input_dims,
+                                     input_data,
+                                     filter_dims,
+                                     filter_data,
+                                     &bias_dims,
+                                     bias_data,
+                                     output_dims,
+                                     output);
+    free(ctx.buf);
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+    TEST_ASSERT_TRUE(validate(output, output_ref, output_size));
+}
+
+void asym_pad_1x1_arm_convolve_s8(void)
+{
+    // 1x1 convolution padded on the bottom and right only.
+    const cmsis_nn_dims input_dims = {1, 3, 3, 4};
+    const cmsis_nn_dims filter_dims = {2, 1, 1, 4};
+    const cmsis_nn_dims output_dims = {1, 4, 4, 2};
+
+    asym_pad_arm_convolve_s8(&input_dims, &filter_dims, &output_dims, 0, 0);
+}
+
+void asym_pad_1xn_arm_convolve_s8(void)
+{
+    // 1x3 convolution padded by two on the left only.
+    const cmsis_nn_dims input_dims = {1, 1, 8, 4};
+    const cmsis_nn_dims filter_dims = {2, 1, 3, 4};
+    const cmsis_nn_dims output_dims = {1, 1, 8, 2};
+
+    asym_pad_arm_convolve_s8(&input_dims, &filter_dims, &output_dims, 2, 0);
+}
@@ -0,0 +1,333 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <arm_nnfunctions.h>
+#include <unity.h>
+
+#include "../TestData/conv_2/test_data.h"
+#include "../TestData/conv_out_activation/test_data.h"
+#include "../TestData/stride2pad1/test_data.h"
+#include "../Utils/cycle_count.h"
+#include "../Utils/validate.h"
+
+static arm_cmsis_nn_status run_winograd(const cmsis_nn_conv_params *conv_params,
+                                        const cmsis_nn_per_channel_quant_params *quant_params,
+                                        const cmsis_nn_dims *input_dims,
+                                        const int8_t *input_data,
+                                        const cmsis_nn_dims *filter_dims,
+                                        const int8_t *filter_data,
+                                        const int32_t *bias_data,
+                                        const cmsis_nn_dims *output_dims,
+                                        int8_t *output)
+{
+    cmsis_nn_context ctx;
+    cmsis_nn_dims bias_dims = {0};
+
+    const int32_t filter_size =
+        arm_convolve_winograd_s8_get_filter_size(conv_params, input_dims, filter_dims, output_dims);
+    TEST_ASSERT_TRUE(filter_size > 0);
+    int16_t *winograd_filter = malloc(filter_size);
+    const arm_cmsis_nn_status transform_result =
+        arm_convolve_winograd_s8_transform_filter(filter_dims, output_dims, filter_data, winograd_filter);
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, transform_result);
+
+    const int32_t buf_size = arm_convolve_winograd_s8_get_buffer_size(input_dims);
+    ctx.buf = malloc(buf_size);
+    ctx.size = buf_size;
+
+    arm_cmsis_nn_status result = arm_convolve_winograd_s8(&ctx,
+                                                          conv_params,
+                                                          quant_params,
+                                                          input_dims,
+                                                          input_data,
+                                                          filter_dims,
+                                                          winograd_filter,
+                                                          &bias_dims,
+                                                          bias_data,
+                                                          output_dims,
+                                                          output);
+    if (ctx.buf)
+    {
+        memset(ctx.buf, 0, buf_size);
+        free(ctx.buf);
+    }
+    free(winograd_filter);
+    return result;
+}
+
+void conv_2_arm_convolve_winograd_s8(void)
+{
+    int8_t output[CONV_2_DST_SIZE] = {0};
+
+    cmsis_nn_conv_params conv_params;
+    cmsis_nn_per_channel_quant_params quant_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims output_dims;
+
+    input_dims.n = CONV_2_INPUT_BATCHES;
+    input_dims.w = CONV_2_INPUT_W;
+    input_dims.h = CONV_2_INPUT_H;
+    input_dims.c = CONV_2_IN_CH;
+    filter_dims.w = CONV_2_FILTER_X;
+    filter_dims.h = CONV_2_FILTER_Y;
+    filter_dims.c = CONV_2_IN_CH;
+    output_dims.w = CONV_2_OUTPUT_W;
+    output_dims.h = CONV_2_OUTPUT_H;
+    output_dims.c = CONV_2_OUT_CH;
+
+    conv_params.padding.w = CONV_2_PAD_X;
+    conv_params.padding.h = CONV_2_PAD_Y;
+    conv_params.stride.w = CONV_2_STRIDE_X;
+    conv_params.stride.h = CONV_2_STRIDE_Y;
+    conv_params.dilation.w = CONV_2_DILATION_X;
+    conv_params.dilation.h = CONV_2_DILATION_Y;
+
+    conv_params.input_offset = CONV_2_INPUT_OFFSET;
+    conv_params.output_offset = CONV_2_OUTPUT_OFFSET;
+    conv_params.activation.min = CONV_2_OUT_ACTIVATION_MIN;
+    conv_params.activation.max = CONV_2_OUT_ACTIVATION_MAX;
+    quant_params.multiplier = (int32_t *)conv_2_output_mult;
+    quant_params.shift = (int32_t *)conv_2_output_shift;
+
+    arm_cmsis_nn_status result = run_winograd(&conv_params,
+                                              &quant_params,
+                                              &input_dims,
+                                              conv_2_input,
+                                              &filter_dims,
+                                              conv_2_weights,
+                                              conv_2_biases,
+                                              &output_dims,
+                                              output);
+
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+    TEST_ASSERT_TRUE(validate(output, conv_2_output_ref, CONV_2_DST_SIZE));
+}
+
+void conv_out_activation_arm_convolve_winograd_s8(void)
+{
+    int8_t output[CONV_OUT_ACTIVATION_DST_SIZE] = {0};
+
+    cmsis_nn_conv_params conv_params;
+    cmsis_nn_per_channel_quant_params quant_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims output_dims;
+
+    input_dims.n = CONV_OUT_ACTIVATION_INPUT_BATCHES;
+    input_dims.w = CONV_OUT_ACTIVATION_INPUT_W;
+    input_dims.h = CONV_OUT_ACTIVATION_INPUT_H;
+    input_dims.c = CONV_OUT_ACTIVATION_IN_CH;
+    filter_dims.w = CONV_OUT_ACTIVATION_FILTER_X;
+    filter_dims.h = CONV_OUT_ACTIVATION_FILTER_Y;
+    filter_dims.c = CONV_OUT_ACTIVATION_IN_CH;
+    output_dims.w = CONV_OUT_ACTIVATION_OUTPUT_W;
+    output_dims.h = CONV_OUT_ACTIVATION_OUTPUT_H;
+    output_dims.c = CONV_OUT_ACTIVATION_OUT_CH;
+
+    conv_params.padding.w = CONV_OUT_ACTIVATION_PAD_X;
+    conv_params.padding.h = CONV_OUT_ACTIVATION_PAD_Y;
+    conv_params.stride.w = CONV_OUT_ACTIVATION_STRIDE_X;
+    conv_params.stride.h = CONV_OUT_ACTIVATION_STRIDE_Y;
+    conv_params.dilation.w = CONV_OUT_ACTIVATION_DILATION_X;
+    conv_params.dilation.h = CONV_OUT_ACTIVATION_DILATION_Y;
+
+    conv_params.input_offset = CONV_OUT_ACTIVATION_INPUT_OFFSET;
+    conv_params.output_offset = CONV_OUT_ACTIVATION_OUTPUT_OFFSET;
+    conv_params.activation.min = CONV_OUT_ACTIVATION_OUT_ACTIVATION_MIN;
+    conv_params.activation.max = CONV_OUT_ACTIVATION_OUT_ACTIVATION_MAX;
+    quant_params.multiplier = (int32_t *)conv_out_activation_output_mult;
+    quant_params.shift = (int32_t *)conv_out_activation_output_shift;
+
+    arm_cmsis_nn_status result = run_winograd(&conv_params,
+                                              &quant_params,
+                                              &input_dims,
+                                              conv_out_activation_input,
+                                              &filter_dims,
+                                              conv_out_activation_weights,
+                                              conv_out_activation_biases,
+                                              &output_dims,
+                                              output);
+
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+    TEST_ASSERT_TRUE(validate(output, conv_out_activation_output_ref, CONV_OUT_ACTIVATION_DST_SIZE));
+}
+
+void unsupported_arm_convolve_winograd_s8(void)
+{
+    int8_t output[STRIDE2PAD1_DST_SIZE] = {0};
+    int16_t buf[16];
+
+    cmsis_nn_context ctx;
+    cmsis_nn_conv_params conv_params;
+    cmsis_nn_per_channel_quant_params quant_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims bias_dims = {0};
+    cmsis_nn_dims output_dims;
+
+    input_dims.n = STRIDE2PAD1_INPUT_BATCHES;
+    input_dims.w = STRIDE2PAD1_INPUT_W;
+    input_dims.h = STRIDE2PAD1_INPUT_H;
+    input_dims.c = STRIDE2PAD1_IN_CH;
+    filter_dims.w = STRIDE2PAD1_FILTER_X;
+    filter_dims.h = STRIDE2PAD1_FILTER_Y;
+    filter_dims.c = STRIDE2PAD1_IN_CH;
+    output_dims.w = STRIDE2PAD1_OUTPUT_W;
+    output_dims.h = STRIDE2PAD1_OUTPUT_H;
+    output_dims.c = STRIDE2PAD1_OUT_CH;
+
+    conv_params.padding.w = STRIDE2PAD1_PAD_X;
+    conv_params.padding.h = STRIDE2PAD1_PAD_Y;
+    conv_params.stride.w = STRIDE2PAD1_STRIDE_X;
+    conv_params.stride.h = STRIDE2PAD1_STRIDE_Y;
+    conv_params.dilation.w = STRIDE2PAD1_DILATION_X;
+    conv_params.dilation.h = STRIDE2PAD1_DILATION_Y;
+
+    conv_params.input_offset = STRIDE2PAD1_INPUT_OFFSET;
+    conv_params.output_offset = STRIDE2PAD1_OUTPUT_OFFSET;
+    conv_params.activation.min = STRIDE2PAD1_OUT_ACTIVATION_MIN;
+    conv_params.activation.max = STRIDE2PAD1_OUT_ACTIVATION_MAX;
+    quant_params.multiplier = (int32_t *)stride2pad1_output_mult;
+    quant_params.shift = (int32_t *)stride2pad1_output_shift;
+
+    const int32_t filter_size =
+        arm_convolve_winograd_s8_get_filter_size(&conv_params, &input_dims, &filter_dims, &output_dims);
+    TEST_ASSERT_EQUAL(0, filter_size);
+
+    ctx.buf = buf;
+    ctx.size = sizeof(buf);
+    arm_cmsis_nn_status result = arm_convolve_winograd_s8(&ctx,
+                                                          &conv_params,
+                                                          &quant_params,
+                                                          &input_dims,
+                                                          stride2pad1_input,
+                                                          &filter_dims,
+                                                          buf,
+                                                          &bias_dims,
+                                                          stride2pad1_biases,
+                                                          &output_dims,
+                                                          output);
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_ARG_ERROR, result);
+}
+
+/*
+ * Runs a 3x3 stride 1 layer through arm_convolve_s8 and arm_convolve_winograd_s8, checks that the outputs match and
+ * prints the cycles per MAC of the direct convolution for both.
+ */
+void benchmark_arm_convolve_winograd_s8(void)
+{
+    enum
+    {
+        IN_W = 16,
+        IN_H = 16,
+        IN_CH = 16,
+        OUT_CH = 16,
+        MACS = IN_W * IN_H * OUT_CH * 9 * IN_CH
+    };
+
+    cmsis_nn_context ctx;
+    cmsis_nn_conv_params conv_params;
+    cmsis_nn_per_channel_quant_params quant_params;
+    cmsis_nn_dims input_dims = {1, IN_H, IN_W, IN_CH};
+    cmsis_nn_dims filter_dims = {OUT_CH, 3, 3, IN_CH};
+    cmsis_nn_dims bias_dims = {1, 1, 1, OUT_CH};
+    cmsis_nn_dims output_dims = {1, IN_H, IN_W, OUT_CH};
+
+    int8_t *input = malloc(IN_W * IN_H * IN_CH);
+    int8_t *filter = malloc(OUT_CH * 9 * IN_CH);
+    int8_t *output_ref = malloc(IN_W * IN_H * OUT_CH);
+    int8_t *output = malloc(IN_W * IN_H * OUT_CH);
+    int32_t bias[OUT_CH];
+    int32_t multiplier[OUT_CH];
+    int32_t shift[OUT_CH];
+
+    srand(1);
+    for (int i = 0; i < IN_W * IN_H * IN_CH; i++)
+    {
+        input[i] = (int8_t)(rand() % 256 - 128);
+    }
+    for (int i = 0; i < OUT_CH * 9 * IN_CH; i++)
+    {
+        filter[i] = (int8_t)(rand() % 256 - 128);
+    }
+    for (int i = 0; i < OUT_CH; i++)
+    {
+        bias[i] = rand() % 20000 - 10000;
+        multiplier[i] = 0x40000000 + rand() % 0x3FFFFFFF;
+        shift[i] = -10 - rand() % 4;
+    }
+
+    conv_params.padding.w = 1;
+    conv_params.padding.h = 1;
+    conv_params.stride.w = 1;
+    conv_params.stride.h = 1;
+    conv_params.dilation.w = 1;
+    conv_params.dilation.h = 1;
+    conv_params.input_offset = 3;
+    conv_params.output_offset = -7;
+    conv_params.activation.min = -128;
+    conv_params.activation.max = 127;
+    quant_params.multiplier = multiplier;
+    quant_params.shift = shift;
+
+    const int32_t buf_size = arm_convolve_s8_get_buffer_size(&input_dims, &filter_dims);
+    ctx.buf = malloc(buf_size);
+    ctx.size = buf_size;
+
+    uint32_t start = get_cycle_count();
+    arm_cmsis_nn_status result = arm_convolve_s8(&ctx,
+                                                 &conv_params,
+                                                 &quant_params,
+                                                 &input_dims,
+                                                 input,
+                                                 &filter_dims,
+                                                 filter,
+                                                 &bias_dims,
+                                                 bias,
+                                                 NULL,
+                                                 &output_dims,
+                                                 output_ref);
+    const uint32_t direct_cycles = get_cycle_count() - start;
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+    free(ctx.buf);
+
+    start = get_cycle_count();
+    result = run_winograd(
+        &conv_params, &quant_params, &input_dims, input, &filter_dims, filter, bias, &output_dims, output);
+    const uint32_t winograd_cycles = get_cycle_count() - start;
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+    TEST_ASSERT_TRUE(validate(output, output_ref, IN_W * IN_H * OUT_CH));
+
+    printf("3x3 conv %dx%dx%d -> %d: arm_convolve_s8 %.3f cycles/MAC, arm_convolve_winograd_s8 %.3f cycles/MAC "
+           "(filter transform included)\n",
+           IN_W,
+           IN_H,
+           IN_CH,
+           OUT_CH,
+           (double)direct_cycles / MACS,
+           (double)winograd_cycles / MACS);
+
+    free(input);
+    free(filter);
+    free(output_ref);
+    free(output);
+}
@@ -98,7 +98,7 @@ void depthwise_kernel_3x3_arm_depthwise_conv_3x3_s8(void)
     const int32_t buf_size =
         arm_depthwise_conv_wrapper_s8_get_buffer_size(&dw_conv_params, &input_dims, &filter_dims, &output_dims);
 
-#if defined(ARM_MATH_MVEI)
+#if defined(ARM_MATH_MVEI) || defined(ARM_MATH_RISCV)
     TEST_ASSERT_TRUE(buf_size > 0);
 #else
     TEST_ASSERT_EQUAL(buf_size, 0);
@@ -199,7 +199,7 @@ void depthwise_kernel_3x3_arm_depthwise_conv_3x3_1_s8(void)
         arm_depthwise_conv_wrapper_s8_get_buffer_size(&dw_conv_params, &input_dims, &filter_dims, &output_dims);
 
     // Not 3x3 variant since negative test.
-#if defined(ARM_MATH_DSP)
+#if defined(ARM_MATH_DSP) || defined(ARM_MATH_RISCV)
     TEST_ASSERT_TRUE(buf_size > 0);
 #else
     TEST_ASSERT_EQUAL(buf_size, 0);
@@ -301,7 +301,7 @@ void depthwise_kernel_3x3_null_bias_arm_depthwise_conv_3x3_null_bias_s8(void)
     const int32_t buf_size =
         arm_depthwise_conv_wrapper_s8_get_buffer_size(&dw_conv_params, &input_dims, &filter_dims, &output_dims);
 
-#if defined(ARM_MATH_MVEI)
+#if defined(ARM_MATH_MVEI) || defined(ARM_MATH_RISCV)
     TEST_ASSERT_TRUE(buf_size > 0);
 #else
     TEST_ASSERT_EQUAL(buf_size, 0);
@@ -403,7 +403,7 @@ void stride2pad1_arm_depthwise_conv_3x3_s8(void)
     const int32_t buf_size =
         arm_depthwise_conv_wrapper_s8_get_buffer_size(&dw_conv_params, &input_dims, &filter_dims, &output_dims);
 
-#if defined(ARM_MATH_MVEI)
+#if defined(ARM_MATH_MVEI) || defined(ARM_MATH_RISCV)
     TEST_ASSERT_TRUE(buf_size > 0);
 #else
     TEST_ASSERT_EQUAL(buf_size, 0);
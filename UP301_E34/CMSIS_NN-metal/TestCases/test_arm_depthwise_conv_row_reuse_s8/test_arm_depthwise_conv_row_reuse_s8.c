@@ -0,0 +1,328 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <arm_nnfunctions.h>
+#include <unity.h>
+
+#include "../TestData/depthwise_eq_in_out_ch/test_data.h"
+#include "../TestData/depthwise_kernel_3x3/test_data.h"
+#include "../TestData/depthwise_mult_batches/test_data.h"
+#include "../Utils/utils.h"
+#include "../Utils/validate.h"
+
+#define GENERATED_MAX_SIZE (2048)
+/* More than one channel block of the row reuse kernel, with a partial last block */
+#define GENERATED_CHANNELS (19)
+
+static arm_cmsis_nn_status run_row_reuse(const cmsis_nn_dw_conv_params *dw_conv_params,
+                                         const cmsis_nn_per_channel_quant_params *quant_params,
+                                         const cmsis_nn_dims *input_dims,
+                                         const int8_t *input_data,
+                                         const cmsis_nn_dims *filter_dims,
+                                         const int8_t *filter_data,
+                                         const int32_t *bias_data,
+                                         const cmsis_nn_dims *output_dims,
+                                         int8_t *output)
+{
+    cmsis_nn_context ctx;
+    const cmsis_nn_dims bias_dims = {0};
+
+    ctx.size = arm_depthwise_conv_row_reuse_s8_get_buffer_size(dw_conv_params, input_dims, filter_dims, output_dims);
+    TEST_ASSERT_TRUE(ctx.size > 0);
+    ctx.buf = malloc(ctx.size);
+
+    const arm_cmsis_nn_status result = arm_depthwise_conv_row_reuse_s8(&ctx,
+                                                                       dw_conv_params,
+                                                                       quant_params,
+                                                                       input_dims,
+                                                                       input_data,
+                                                                       filter_dims,
+                                                                       filter_data,
+                                                                       &bias_dims,
+                                                                       bias_data,
+                                                                       output_dims,
+                                                                       output);
+    if (ctx.buf)
+    {
+        // The caller is responsible to clear the scratch buffers for security reasons if applicable.
+        memset(ctx.buf, 0, ctx.size);
+        free(ctx.buf);
+    }
+    return result;
+}
+
+void depthwise_kernel_3x3_arm_depthwise_conv_row_reuse_s8(void)
+{
+    int8_t output[DEPTHWISE_KERNEL_3X3_DST_SIZE] = {0};
+
+    cmsis_nn_dw_conv_params dw_conv_params;
+    cmsis_nn_per_channel_quant_params quant_params;
+    const cmsis_nn_dims input_dims = {DEPTHWISE_KERNEL_3X3_INPUT_BATCHES,
+                                      DEPTHWISE_KERNEL_3X3_INPUT_H,
+                                      DEPTHWISE_KERNEL_3X3_INPUT_W,
+                                      DEPTHWISE_KERNEL_3X3_IN_CH};
+    const cmsis_nn_dims filter_dims = {
+        1, DEPTHWISE_KERNEL_3X3_FILTER_Y, DEPTHWISE_KERNEL_3X3_FILTER_X, DEPTHWISE_KERNEL_3X3_OUT_CH};
+    const cmsis_nn_dims output_dims = {DEPTHWISE_KERNEL_3X3_INPUT_BATCHES,
+                                       DEPTHWISE_KERNEL_3X3_OUTPUT_H,
+                                       DEPTHWISE_KERNEL_3X3_OUTPUT_W,
+                                       DEPTHWISE_KERNEL_3X3_OUT_CH};
+
+    dw_conv_params.padding.w = DEPTHWISE_KERNEL_3X3_PAD_X;
+    dw_conv_params.padding.h = DEPTHWISE_KERNEL_3X3_PAD_Y;
+    dw_conv_params.stride.w = DEPTHWISE_KERNEL_3X3_STRIDE_X;
+    dw_conv_params.stride.h = DEPTHWISE_KERNEL_3X3_STRIDE_Y;
+    dw_conv_params.dilation.w = DEPTHWISE_KERNEL_3X3_DILATION_X;
+    dw_conv_params.dilation.h = DEPTHWISE_KERNEL_3X3_DILATION_Y;
+    dw_conv_params.ch_mult = DEPTHWISE_KERNEL_3X3_CH_MULT;
+    dw_conv_params.input_offset = DEPTHWISE_KERNEL_3X3_INPUT_OFFSET;
+    dw_conv_params.output_offset = DEPTHWISE_KERNEL_3X3_OUTPUT_OFFSET;
+    dw_conv_params.activation.min = DEPTHWISE_KERNEL_3X3_OUT_ACTIVATION_MIN;
+    dw_conv_params.activation.max = DEPTHWISE_KERNEL_3X3_OUT_ACTIVATION_MAX;
+    quant_params.multiplier = (int32_t *)depthwise_kernel_3x3_output_mult;
+    quant_params.shift = (int32_t *)depthwise_kernel_3x3_output_shift;
+
+    const arm_cmsis_nn_status result = run_row_reuse(&dw_conv_params,
+                                                     &quant_params,
+                                                     &input_dims,
+                                                     depthwise_kernel_3x3_input,
+                                                     &filter_dims,
+                                                     depthwise_kernel_3x3_weights,
+                                                     depthwise_kernel_3x3_biases,
+                                                     &output_dims,
+                                                     output);
+
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+    TEST_ASSERT_TRUE(validate(output, depthwise_kernel_3x3_output_ref, DEPTHWISE_KERNEL_3X3_DST_SIZE));
+}
+
+void depthwise_mult_batches_arm_depthwise_conv_row_reuse_s8(void)
+{
+    int8_t output[DEPTHWISE_MULT_BATCHES_DST_SIZE] = {0};
+
+    cmsis_nn_dw_conv_params dw_conv_params;
+    cmsis_nn_per_channel_quant_params quant_params;
+    const cmsis_nn_dims input_dims = {DEPTHWISE_MULT_BATCHES_INPUT_BATCHES,
+                                      DEPTHWISE_MULT_BATCHES_INPUT_H,
+                                      DEPTHWISE_MULT_BATCHES_INPUT_W,
+                                      DEPTHWISE_MULT_BATCHES_IN_CH};
+    const cmsis_nn_dims filter_dims = {
+        1, DEPTHWISE_MULT_BATCHES_FILTER_Y, DEPTHWISE_MULT_BATCHES_FILTER_X, DEPTHWISE_MULT_BATCHES_OUT_CH};
+    const cmsis_nn_dims output_dims = {DEPTHWISE_MULT_BATCHES_INPUT_BATCHES,
+                                       DEPTHWISE_MULT_BATCHES_OUTPUT_H,
+                                       DEPTHWISE_MULT_BATCHES_OUTPUT_W,
+                                       DEPTHWISE_MULT_BATCHES_OUT_CH};
+
+    dw_conv_params.padding.w = DEPTHWISE_MULT_BATCHES_PAD_X;
+    dw_conv_params.padding.h = DEPTHWISE_MULT_BATCHES_PAD_Y;
+    dw_conv_params.stride.w = DEPTHWISE_MULT_BATCHES_STRIDE_X;
+    dw_conv_params.stride.h = DEPTHWISE_MULT_BATCHES_STRIDE_Y;
+    dw_conv_params.dilation.w = DEPTHWISE_MULT_BATCHES_DILATION_X;
+    dw_conv_params.dilation.h = DEPTHWISE_MULT_BATCHES_DILATION_Y;
+    dw_conv_params.ch_mult = DEPTHWISE_MULT_BATCHES_CH_MULT;
+    dw_conv_params.input_offset = DEPTHWISE_MULT_BATCHES_INPUT_OFFSET;
+    dw_conv_params.output_offset = DEPTHWISE_MULT_BATCHES_OUTPUT_OFFSET;
+    dw_conv_params.activation.min = DEPTHWISE_MULT_BATCHES_OUT_ACTIVATION_MIN;
+    dw_conv_params.activation.max = DEPTHWISE_MULT_BATCHES_OUT_ACTIVATION_MAX;
+    quant_params.multiplier = (int32_t *)depthwise_mult_batches_output_mult;
+    quant_params.shift = (int32_t *)depthwise_mult_batches_output_shift;
+
+    const arm_cmsis_nn_status result = run_row_reuse(&dw_conv_params,
+                                                     &quant_params,
+                                                     &input_dims,
+                                                     depthwise_mult_batches_input,
+                                                     &filter_dims,
+                                                     depthwise_mult_batches_weights,
+                                                     depthwise_mult_batches_biases,
+                                                     &output_dims,
+                                                     output);
+
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+    TEST_ASSERT_TRUE(validate(output, depthwise_mult_batches_output_ref, DEPTHWISE_MULT_BATCHES_DST_SIZE));
+}
+
+void depthwise_eq_in_out_ch_arm_depthwise_conv_row_reuse_s8(void)
+{
+    int8_t output[DEPTHWISE_EQ_IN_OUT_CH_DST_SIZE] = {0};
+
+    cmsis_nn_dw_conv_params dw_conv_params;
+    cmsis_nn_per_channel_quant_params quant_params;
+    const cmsis_nn_dims input_dims = {DEPTHWISE_EQ_IN_OUT_CH_INPUT_BATCHES,
+                                      DEPTHWISE_EQ_IN_OUT_CH_INPUT_H,
+                                      DEPTHWISE_EQ_IN_OUT_CH_INPUT_W,
+                                      DEPTHWISE_EQ_IN_OUT_CH_IN_CH};
+    const cmsis_nn_dims filter_dims = {
+        1, DEPTHWISE_EQ_IN_OUT_CH_FILTER_Y, DEPTHWISE_EQ_IN_OUT_CH_FILTER_X, DEPTHWISE_EQ_IN_OUT_CH_OUT_CH};
+    const cmsis_nn_dims output_dims = {DEPTHWISE_EQ_IN_OUT_CH_INPUT_BATCHES,
+                                       DEPTHWISE_EQ_IN_OUT_CH_OUTPUT_H,
+                                       DEPTHWISE_EQ_IN_OUT_CH_OUTPUT_W,
+                                       DEPTHWISE_EQ_IN_OUT_CH_OUT_CH};
+
+    dw_conv_params.padding.w = DEPTHWISE_EQ_IN_OUT_CH_PAD_X;
+    dw_conv_params.padding.h = DEPTHWISE_EQ_IN_OUT_CH_PAD_Y;
+    dw_conv_params.stride.w = DEPTHWISE_EQ_IN_OUT_CH_STRIDE_X;
+    dw_conv_params.stride.h = DEPTHWISE_EQ_IN_OUT_CH_STRIDE_Y;
+    dw_conv_params.dilation.w = DEPTHWISE_EQ_IN_OUT_CH_DILATION_X;
+    dw_conv_params.dilation.h = DEPTHWISE_EQ_IN_OUT_CH_DILATION_Y;
+    dw_conv_params.ch_mult = DEPTHWISE_EQ_IN_OUT_CH_CH_MULT;
+    dw_conv_params.input_offset = DEPTHWISE_EQ_IN_OUT_CH_INPUT_OFFSET;
+    dw_conv_params.output_offset = DEPTHWISE_EQ_IN_OUT_CH_OUTPUT_OFFSET;
+    dw_conv_params.activation.min = DEPTHWISE_EQ_IN_OUT_CH_OUT_ACTIVATION_MIN;
+    dw_conv_params.activation.max = DEPTHWISE_EQ_IN_OUT_CH_OUT_ACTIVATION_MAX;
+    quant_params.multiplier = (int32_t *)depthwise_eq_in_out_ch_output_mult;
+    quant_params.shift = (int32_t *)depthwise_eq_in_out_ch_output_shift;
+
+    const int32_t *bias_data = get_bias_address(depthwise_eq_in_out_ch_biases, DEPTHWISE_EQ_IN_OUT_CH_IN_CH);
+
+    const arm_cmsis_nn_status result = run_row_reuse(&dw_conv_params,
+                                                     &quant_params,
+                                                     &input_dims,
+                                                     depthwise_eq_in_out_ch_input,
+                                                     &filter_dims,
+                                                     depthwise_eq_in_out_ch_weights,
+                                                     bias_data,
+                                                     &output_dims,
+                                                     output);
+
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+    TEST_ASSERT_TRUE(validate(output, depthwise_eq_in_out_ch_output_ref, DEPTHWISE_EQ_IN_OUT_CH_DST_SIZE));
+}
+
+/*
+ * Runs the row reuse kernel on generated data and checks it against arm_depthwise_conv_s8. Covers the 3x3 and 5x5
+ * paths, which the reference vectors above do not reach with stride 1, and a channel count that leaves a partial
+ * channel block.
+ */
+static void compare_with_depthwise_conv_s8(const int32_t kernel_size, const int32_t stride, const int32_t pad)
+{
+    static int8_t input[GENERATED_MAX_SIZE];
+    static int8_t weights[GENERATED_MAX_SIZE];
+    static int8_t output[GENERATED_MAX_SIZE];
+    static int8_t output_ref[GENERATED_MAX_SIZE];
+    static int32_t bias[GENERATED_CHANNELS];
+    static int32_t multiplier[GENERATED_CHANNELS];
+    static int32_t shift[GENERATED_CHANNELS];
+
+    const int32_t channels = GENERATED_CHANNELS;
+    const int32_t input_w = 11;
+    const int32_t input_h = 7;
+    const int32_t output_w = (input_w + 2 * pad - kernel_size) / stride + 1;
+    const int32_t output_h = (input_h + 2 * pad - kernel_size) / stride + 1;
+
+    const cmsis_nn_dims input_dims = {1, input_h, input_w, channels};
+    const cmsis_nn_dims filter_dims = {1, kernel_size, kernel_size, channels};
+    const cmsis_nn_dims bias_dims = {1, 1, 1, channels};
+    const cmsis_nn_dims output_dims = {1, output_h, output_w, channels};
+    cmsis_nn_dw_conv_params dw_conv_params;
+    cmsis_nn_per_channel_quant_params quant_params;
+    cmsis_nn_context ctx = {NULL, 0};
+
+    TEST_ASSERT_TRUE(input_h * input_w * channels <= GENERATED_MAX_SIZE);
+    TEST_ASSERT_TRUE(output_h * output_w * channels <= GENERATED_MAX_SIZE);
+
+    for (int32_t i = 0; i < input_h * input_w * channels; i++)
+    {
+        input[i] = (int8_t)((i * 37 + 11) % 256 - 128);
+    }
+    for (int32_t i = 0; i < kernel_size * kernel_size * channels; i++)
+    {
+        weights[i] = (int8_t)((i * 53 + 7) % 255 - 127);
+    }
+    for (int32_t i = 0; i < channels; i++)
+    {
+        bias[i] = (i * 997) % 4001 - 2000;
+        multiplier[i] = 1073741824 + i * 12345678;
+        shift[i] = -7 - (i % 3);
+    }
+
+    dw_conv_params.padding.w = pad;
+    dw_conv_params.padding.h = pad;
+    dw_conv_params.stride.w = stride;
+    dw_conv_params.stride.h = stride;
+    dw_conv_params.dilation.w = 1;
+    dw_conv_params.dilation.h = 1;
+    dw_conv_params.ch_mult = 1;
+    dw_conv_params.input_offset = 3;
+    dw_conv_params.output_offset = -5;
+    dw_conv_params.activation.min = -128;
+    dw_conv_params.activation.max = 127;
+    quant_params.multiplier = multiplier;
+    quant_params.shift = shift;
+
+    arm_cmsis_nn_status result = arm_depthwise_conv_s8(&ctx,
+                                                       &dw_conv_params,
+                                                       &quant_params,
+                                                       &input_dims,
+                                                       input,
+                                                       &filter_dims,
+                                                       weights,
+                                                       &bias_dims,
+                                                       bias,
+                                                       &output_dims,
+                                                       output_ref);
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+
+    result = run_row_reuse(
+        &dw_conv_params, &quant_params, &input_dims, input, &filter_dims, weights, bias, &output_dims, output);
+
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+    TEST_ASSERT_TRUE(validate(output, output_ref, output_h * output_w * channels));
+}
+
+void kernel_3x3_stride_1_arm_depthwise_conv_row_reuse_s8(void) { compare_with_depthwise_conv_s8(3, 1, 1); }
+
+void kernel_3x3_stride_2_arm_depthwise_conv_row_reuse_s8(void) { compare_with_depthwise_conv_s8(3, 2, 1); }
+
+void kernel_5x5_stride_1_arm_depthwise_conv_row_reuse_s8(void) { compare_with_depthwise_conv_s8(5, 1, 2); }
+
+void kernel_5x5_stride_2_arm_depthwise_conv_row_reuse_s8(void) { compare_with_depthwise_conv_s8(5, 2, 2); }
+
+void ch_mult_arm_depthwise_conv_row_reuse_s8(void)
+{
+    int8_t output[1] = {0};
+    int8_t buf[1] = {0};
+
+    const cmsis_nn_context ctx = {buf, sizeof(buf)};
+    cmsis_nn_dw_conv_params dw_conv_params = {0};
+    const cmsis_nn_per_channel_quant_params quant_params = {NULL, NULL};
+    const cmsis_nn_dims input_dims = {1, 1, 1, 1};
+    const cmsis_nn_dims filter_dims = {1, 1, 1, 2};
+    const cmsis_nn_dims bias_dims = {0};
+    const cmsis_nn_dims output_dims = {1, 1, 1, 2};
+
+    dw_conv_params.ch_mult = 2;
+    dw_conv_params.dilation.w = 1;
+    dw_conv_params.dilation.h = 1;
+
+    const arm_cmsis_nn_status result = arm_depthwise_conv_row_reuse_s8(&ctx,
+                                                                       &dw_conv_params,
+                                                                       &quant_params,
+                                                                       &input_dims,
+                                                                       output,
+                                                                       &filter_dims,
+                                                                       output,
+                                                                       &bias_dims,
+                                                                       NULL,
+                                                                       &output_dims,
+                                                                       output);
+
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_ARG_ERROR, result);
+}
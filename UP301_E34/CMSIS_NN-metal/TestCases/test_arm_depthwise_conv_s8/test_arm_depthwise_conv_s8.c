@@ -193,7 +193,13 @@ void depthwise_mult_batches_arm_depthwise_conv_s8(void)
     const int32_t buf_size =
         arm_depthwise_conv_wrapper_s8_get_buffer_size(&dw_conv_params, &input_dims, &filter_dims, &output_dims);
 
+#if defined(ARM_MATH_RISCV) && !defined(ARM_MATH_DSP) && !defined(ARM_MATH_MVEI)
+    TEST_ASSERT_EQUAL(
+        arm_depthwise_conv_row_reuse_s8_get_buffer_size(&dw_conv_params, &input_dims, &filter_dims, &output_dims),
+        buf_size);
+#else
     TEST_ASSERT_EQUAL(buf_size, 0);
+#endif
 
     ctx.buf = malloc(buf_size);
     ctx.size = buf_size;
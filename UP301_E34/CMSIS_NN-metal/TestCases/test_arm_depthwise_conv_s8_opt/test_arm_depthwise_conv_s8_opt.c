@@ -106,7 +106,13 @@ void basic_arm_depthwise_conv_s8_opt(void)
     const int32_t wrapper_buf_size =
         arm_depthwise_conv_wrapper_s8_get_buffer_size(&dw_conv_params, &input_dims, &filter_dims, &output_dims);
 
+#if defined(ARM_MATH_RISCV) && !defined(ARM_MATH_DSP) && !defined(ARM_MATH_MVEI)
+    TEST_ASSERT_EQUAL(
+        arm_depthwise_conv_row_reuse_s8_get_buffer_size(&dw_conv_params, &input_dims, &filter_dims, &output_dims),
+        wrapper_buf_size);
+#else
     TEST_ASSERT_EQUAL(wrapper_buf_size, ctx.size);
+#endif
 
     ctx.buf = malloc(wrapper_buf_size);
 
@@ -207,7 +213,13 @@ void depthwise_eq_in_out_ch_arm_depthwise_conv_s8_opt(void)
     const int32_t wrapper_buf_size =
         arm_depthwise_conv_wrapper_s8_get_buffer_size(&dw_conv_params, &input_dims, &filter_dims, &output_dims);
 
+#if defined(ARM_MATH_RISCV) && !defined(ARM_MATH_DSP) && !defined(ARM_MATH_MVEI)
+    TEST_ASSERT_EQUAL(
+        arm_depthwise_conv_row_reuse_s8_get_buffer_size(&dw_conv_params, &input_dims, &filter_dims, &output_dims),
+        wrapper_buf_size);
+#else
     TEST_ASSERT_EQUAL(wrapper_buf_size, ctx.size);
+#endif
 
     ctx.buf = malloc(wrapper_buf_size);
 
@@ -307,7 +319,13 @@ void depthwise_sub_block_arm_depthwise_conv_s8_opt(void)
     const int32_t wrapper_buf_size =
         arm_depthwise_conv_wrapper_s8_get_buffer_size(&dw_conv_params, &input_dims, &filter_dims, &output_dims);
 
+#if defined(ARM_MATH_RISCV) && !defined(ARM_MATH_DSP) && !defined(ARM_MATH_MVEI)
+    TEST_ASSERT_EQUAL(
+        arm_depthwise_conv_row_reuse_s8_get_buffer_size(&dw_conv_params, &input_dims, &filter_dims, &output_dims),
+        wrapper_buf_size);
+#else
     TEST_ASSERT_EQUAL(wrapper_buf_size, ctx.size);
+#endif
 
     ctx.buf = malloc(wrapper_buf_size);
 
@@ -409,7 +427,13 @@ void depthwise_out_activation_arm_depthwise_conv_s8_opt(void)
     const int32_t buf_size =
         arm_depthwise_conv_wrapper_s8_get_buffer_size(&dw_conv_params, &input_dims, &filter_dims, &output_dims);
 
+#if defined(ARM_MATH_RISCV) && !defined(ARM_MATH_DSP) && !defined(ARM_MATH_MVEI)
+    TEST_ASSERT_EQUAL(
+        arm_depthwise_conv_row_reuse_s8_get_buffer_size(&dw_conv_params, &input_dims, &filter_dims, &output_dims),
+        buf_size);
+#else
     TEST_ASSERT_EQUAL(buf_size, ctx.size);
+#endif
 
     ctx.buf = malloc(buf_size);
     ctx.size = buf_size;
@@ -511,7 +535,13 @@ void depthwise_null_bias_0_arm_depthwise_conv_s8_opt(void)
     const int32_t buf_size =
         arm_depthwise_conv_wrapper_s8_get_buffer_size(&dw_conv_params, &input_dims, &filter_dims, &output_dims);
 
+#if defined(ARM_MATH_RISCV) && !defined(ARM_MATH_DSP) && !defined(ARM_MATH_MVEI)
+    TEST_ASSERT_EQUAL(
+        arm_depthwise_conv_row_reuse_s8_get_buffer_size(&dw_conv_params, &input_dims, &filter_dims, &output_dims),
+        buf_size);
+#else
     TEST_ASSERT_EQUAL(buf_size, ctx.size);
+#endif
 
     ctx.buf = malloc(buf_size);
     ctx.size = buf_size;
@@ -612,7 +642,13 @@ void depthwise_x_stride_arm_depthwise_conv_s8_opt(void)
     const int32_t wrapper_buf_size =
         arm_depthwise_conv_wrapper_s8_get_buffer_size(&dw_conv_params, &input_dims, &filter_dims, &output_dims);
 
+#if defined(ARM_MATH_RISCV) && !defined(ARM_MATH_DSP) && !defined(ARM_MATH_MVEI)
+    TEST_ASSERT_EQUAL(
+        arm_depthwise_conv_row_reuse_s8_get_buffer_size(&dw_conv_params, &input_dims, &filter_dims, &output_dims),
+        wrapper_buf_size);
+#else
     TEST_ASSERT_EQUAL(wrapper_buf_size, ctx.size);
+#endif
 
     ctx.buf = malloc(wrapper_buf_size);
 
@@ -670,7 +706,13 @@ void buffer_size_arm_depthwise_conv_s8_opt(void)
     const int32_t wrapper_buf_size =
         arm_depthwise_conv_wrapper_s8_get_buffer_size(&conv_params, &input_dims, &filter_dims, &output_dims);
 
+#if defined(ARM_MATH_RISCV) && !defined(ARM_MATH_DSP) && !defined(ARM_MATH_MVEI)
+    TEST_ASSERT_EQUAL(
+        arm_depthwise_conv_row_reuse_s8_get_buffer_size(&conv_params, &input_dims, &filter_dims, &output_dims),
+        wrapper_buf_size);
+#else
     TEST_ASSERT_EQUAL(wrapper_buf_size, buf_size);
+#endif
 }
 
 void buffer_size_mve_arm_depthwise_conv_s8_opt(void)
@@ -46,3 +46,13 @@ void tearDown(void) {}
 
 void test_add_s16_arm_elementwise_add_s16(void) { add_s16_arm_elementwise_add_s16(); }
 void test_add_s16_spill_arm_elementwise_add_s16(void) { add_s16_spill_arm_elementwise_add_s16(); }
+
+void test_add_s16_broadcast_channel_arm_elementwise_add_s16(void) { add_s16_broadcast_channel_arm_elementwise_add_s16(); }
+
+void test_add_s16_broadcast_scalar_arm_elementwise_add_s16(void) { add_s16_broadcast_scalar_arm_elementwise_add_s16(); }
+
+void test_add_s16_broadcast_row_column_arm_elementwise_add_s16(void) { add_s16_broadcast_row_column_arm_elementwise_add_s16(); }
+
+void test_add_s16_broadcast_batch_arm_elementwise_add_s16(void) { add_s16_broadcast_batch_arm_elementwise_add_s16(); }
+
+void test_add_s16_broadcast_param_fail_arm_elementwise_add_s16(void) { add_s16_broadcast_param_fail_arm_elementwise_add_s16(); }
@@ -45,3 +45,13 @@ void setUp(void)
 void tearDown(void) {}
 
 void test_add_arm_elementwise_add_s8(void) { add_arm_elementwise_add_s8(); }
+
+void test_add_broadcast_channel_arm_elementwise_add_s8(void) { add_broadcast_channel_arm_elementwise_add_s8(); }
+
+void test_add_broadcast_scalar_arm_elementwise_add_s8(void) { add_broadcast_scalar_arm_elementwise_add_s8(); }
+
+void test_add_broadcast_row_column_arm_elementwise_add_s8(void) { add_broadcast_row_column_arm_elementwise_add_s8(); }
+
+void test_add_broadcast_batch_arm_elementwise_add_s8(void) { add_broadcast_batch_arm_elementwise_add_s8(); }
+
+void test_add_broadcast_param_fail_arm_elementwise_add_s8(void) { add_broadcast_param_fail_arm_elementwise_add_s8(); }
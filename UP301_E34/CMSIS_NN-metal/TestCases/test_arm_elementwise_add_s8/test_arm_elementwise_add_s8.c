@@ -66,3 +66,162 @@ void add_arm_elementwise_add_s8(void)
     TEST_ASSERT_EQUAL(expected, result);
     TEST_ASSERT_TRUE(validate(output, add_output_ref, ADD_DST_SIZE));
 }
+
+#define ADD_BROADCAST_W (ADD_DST_SIZE / 32)
+
+static void broadcast_input_s8(const int8_t *src,
+                               const cmsis_nn_dims *dims,
+                               const cmsis_nn_dims *output_dims,
+                               int8_t *dst)
+{
+    for (int32_t n = 0; n < output_dims->n; n++)
+    {
+        for (int32_t h = 0; h < output_dims->h; h++)
+        {
+            for (int32_t w = 0; w < output_dims->w; w++)
+            {
+                for (int32_t c = 0; c < output_dims->c; c++)
+                {
+                    *dst++ =
+                        src[(((n % dims->n) * dims->h + h % dims->h) * dims->w + w % dims->w) * dims->c + c % dims->c];
+                }
+            }
+        }
+    }
+}
+
+/* Compares the broadcast kernel with arm_elementwise_add_s8() on inputs that are broadcast beforehand. */
+static void add_broadcast_s8(const cmsis_nn_dims input_1_dims, const cmsis_nn_dims input_2_dims)
+{
+    const arm_cmsis_nn_status expected = ARM_CMSIS_NN_SUCCESS;
+    const cmsis_nn_dims output_dims = {input_1_dims.n > input_2_dims.n ? input_1_dims.n : input_2_dims.n,
+                                       input_1_dims.h > input_2_dims.h ? input_1_dims.h : input_2_dims.h,
+                                       input_1_dims.w > input_2_dims.w ? input_1_dims.w : input_2_dims.w,
+                                       input_1_dims.c > input_2_dims.c ? input_1_dims.c : input_2_dims.c};
+    const int32_t size = output_dims.n * output_dims.h * output_dims.w * output_dims.c;
+    int8_t input_1[ADD_DST_SIZE];
+    int8_t input_2[ADD_DST_SIZE];
+    int8_t output_ref[ADD_DST_SIZE] = {0};
+    int8_t output[ADD_DST_SIZE] = {0};
+
+    const int8_t *input_data1 = add_input1;
+    const int8_t *input_data2 = add_input2;
+
+    const int32_t input_1_mult = ADD_INPUT1_MULT;
+    const int32_t input_1_shift = ADD_INPUT1_SHIFT;
+    const int32_t input_1_offset = ADD_INPUT1_OFFSET;
+    const int32_t input_2_mult = ADD_INPUT2_MULT;
+    const int32_t input_2_shift = ADD_INPUT2_SHIFT;
+    const int32_t input_2_offset = ADD_INPUT2_OFFSET;
+
+    const int32_t left_shift = ADD_LEFT_SHIFT;
+
+    const int32_t out_offset = ADD_OUTPUT_OFFSET;
+    const int32_t out_mult = ADD_OUTPUT_MULT;
+    const int32_t out_shift = ADD_OUTPUT_SHIFT;
+
+    const int32_t out_activation_min = ADD_OUT_ACTIVATION_MIN;
+    const int32_t out_activation_max = ADD_OUT_ACTIVATION_MAX;
+
+    broadcast_input_s8(input_data1, &input_1_dims, &output_dims, input_1);
+    broadcast_input_s8(input_data2, &input_2_dims, &output_dims, input_2);
+
+    arm_elementwise_add_s8(input_1,
+                           input_2,
+                           input_1_offset,
+                           input_1_mult,
+                           input_1_shift,
+                           input_2_offset,
+                           input_2_mult,
+                           input_2_shift,
+                           left_shift,
+                           output_ref,
+                           out_offset,
+                           out_mult,
+                           out_shift,
+                           out_activation_min,
+                           out_activation_max,
+                           size);
+
+    arm_cmsis_nn_status result = arm_elementwise_add_broadcast_s8(input_data1,
+                                                                  &input_1_dims,
+                                                                  input_data2,
+                                                                  &input_2_dims,
+                                                                  input_1_offset,
+                                                                  input_1_mult,
+                                                                  input_1_shift,
+                                                                  input_2_offset,
+                                                                  input_2_mult,
+                                                                  input_2_shift,
+                                                                  left_shift,
+                                                                  output,
+                                                                  &output_dims,
+                                                                  out_offset,
+                                                                  out_mult,
+                                                                  out_shift,
+                                                                  out_activation_min,
+                                                                  out_activation_max);
+
+    TEST_ASSERT_EQUAL(expected, result);
+    TEST_ASSERT_TRUE(validate(output, output_ref, size));
+}
+
+void add_broadcast_channel_arm_elementwise_add_s8(void)
+{
+    const cmsis_nn_dims input_1_dims = {1, 2, ADD_BROADCAST_W, 16};
+    const cmsis_nn_dims input_2_dims = {1, 1, 1, 16};
+    add_broadcast_s8(input_1_dims, input_2_dims);
+}
+
+void add_broadcast_scalar_arm_elementwise_add_s8(void)
+{
+    const cmsis_nn_dims input_1_dims = {1, 1, 1, 1};
+    const cmsis_nn_dims input_2_dims = {1, 2, ADD_BROADCAST_W, 16};
+    add_broadcast_s8(input_1_dims, input_2_dims);
+}
+
+void add_broadcast_row_column_arm_elementwise_add_s8(void)
+{
+    const cmsis_nn_dims input_1_dims = {1, 2, 1, 16};
+    const cmsis_nn_dims input_2_dims = {1, 1, ADD_BROADCAST_W, 1};
+    add_broadcast_s8(input_1_dims, input_2_dims);
+}
+
+void add_broadcast_batch_arm_elementwise_add_s8(void)
+{
+    const cmsis_nn_dims input_1_dims = {2, 1, ADD_BROADCAST_W, 16};
+    const cmsis_nn_dims input_2_dims = {1, 1, ADD_BROADCAST_W, 16};
+    add_broadcast_s8(input_1_dims, input_2_dims);
+}
+
+void add_broadcast_param_fail_arm_elementwise_add_s8(void)
+{
+    const arm_cmsis_nn_status expected = ARM_CMSIS_NN_ARG_ERROR;
+    const cmsis_nn_dims input_1_dims = {1, 2, ADD_BROADCAST_W, 16};
+    const cmsis_nn_dims input_2_dims = {1, 2, 2, 16};
+    int8_t output[ADD_DST_SIZE] = {0};
+
+    const int8_t *input_data1 = add_input1;
+    const int8_t *input_data2 = add_input2;
+
+    arm_cmsis_nn_status result = arm_elementwise_add_broadcast_s8(input_data1,
+                                                                  &input_1_dims,
+                                                                  input_data2,
+                                                                  &input_2_dims,
+                                                                  0,
+                                                                  0,
+                                                                  0,
+                                                                  0,
+                                                                  0,
+                                                                  0,
+                                                                  0,
+                                                                  output,
+                                                                  &input_1_dims,
+                                                                  0,
+                                                                  0,
+                                                                  0,
+                                                                  ADD_OUT_ACTIVATION_MIN,
+                                                                  ADD_OUT_ACTIVATION_MAX);
+
+    TEST_ASSERT_EQUAL(expected, result);
+}
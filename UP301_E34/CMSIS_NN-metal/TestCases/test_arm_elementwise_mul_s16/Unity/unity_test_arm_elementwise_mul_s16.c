@@ -47,3 +47,13 @@ void tearDown(void) {}
 void test_mul_s16_arm_elementwise_mul_s16(void) { mul_s16_arm_elementwise_mul_s16(); }
 
 void test_mul_s16_spill_arm_elementwise_mul_s16(void) { mul_s16_spill_arm_elementwise_mul_s16(); }
+
+void test_mul_s16_broadcast_channel_arm_elementwise_mul_s16(void) { mul_s16_broadcast_channel_arm_elementwise_mul_s16(); }
+
+void test_mul_s16_broadcast_scalar_arm_elementwise_mul_s16(void) { mul_s16_broadcast_scalar_arm_elementwise_mul_s16(); }
+
+void test_mul_s16_broadcast_row_column_arm_elementwise_mul_s16(void) { mul_s16_broadcast_row_column_arm_elementwise_mul_s16(); }
+
+void test_mul_s16_broadcast_batch_arm_elementwise_mul_s16(void) { mul_s16_broadcast_batch_arm_elementwise_mul_s16(); }
+
+void test_mul_s16_broadcast_param_fail_arm_elementwise_mul_s16(void) { mul_s16_broadcast_param_fail_arm_elementwise_mul_s16(); }
@@ -90,3 +90,141 @@ void mul_s16_spill_arm_elementwise_mul_s16(void)
     TEST_ASSERT_EQUAL(expected, result);
     TEST_ASSERT_TRUE(validate_s16(output, mul_s16_spill_output_ref, MUL_S16_SPILL_DST_SIZE));
 }
+
+#define MUL_S16_BROADCAST_W (MUL_S16_DST_SIZE / 32)
+
+static void broadcast_input_s16(const int16_t *src,
+                                const cmsis_nn_dims *dims,
+                                const cmsis_nn_dims *output_dims,
+                                int16_t *dst)
+{
+    for (int32_t n = 0; n < output_dims->n; n++)
+    {
+        for (int32_t h = 0; h < output_dims->h; h++)
+        {
+            for (int32_t w = 0; w < output_dims->w; w++)
+            {
+                for (int32_t c = 0; c < output_dims->c; c++)
+                {
+                    *dst++ =
+                        src[(((n % dims->n) * dims->h + h % dims->h) * dims->w + w % dims->w) * dims->c + c % dims->c];
+                }
+            }
+        }
+    }
+}
+
+/* Compares the broadcast kernel with arm_elementwise_mul_s16() on inputs that are broadcast beforehand. */
+static void mul_broadcast_s16(const cmsis_nn_dims input_1_dims, const cmsis_nn_dims input_2_dims)
+{
+    const arm_cmsis_nn_status expected = ARM_CMSIS_NN_SUCCESS;
+    const cmsis_nn_dims output_dims = {input_1_dims.n > input_2_dims.n ? input_1_dims.n : input_2_dims.n,
+                                       input_1_dims.h > input_2_dims.h ? input_1_dims.h : input_2_dims.h,
+                                       input_1_dims.w > input_2_dims.w ? input_1_dims.w : input_2_dims.w,
+                                       input_1_dims.c > input_2_dims.c ? input_1_dims.c : input_2_dims.c};
+    const int32_t size = output_dims.n * output_dims.h * output_dims.w * output_dims.c;
+    int16_t input_1[MUL_S16_DST_SIZE];
+    int16_t input_2[MUL_S16_DST_SIZE];
+    int16_t output_ref[MUL_S16_DST_SIZE] = {0};
+    int16_t output[MUL_S16_DST_SIZE] = {0};
+
+    const int16_t *input_data1 = mul_s16_input1;
+    const int16_t *input_data2 = mul_s16_input2;
+
+    const int32_t input_1_offset = MUL_S16_INPUT1_OFFSET;
+    const int32_t input_2_offset = MUL_S16_INPUT2_OFFSET;
+
+    const int32_t out_offset = MUL_S16_OUTPUT_OFFSET;
+    const int32_t out_mult = MUL_S16_OUTPUT_MULT;
+    const int32_t out_shift = MUL_S16_OUTPUT_SHIFT;
+
+    const int32_t out_activation_min = MUL_S16_OUT_ACTIVATION_MIN;
+    const int32_t out_activation_max = MUL_S16_OUT_ACTIVATION_MAX;
+
+    broadcast_input_s16(input_data1, &input_1_dims, &output_dims, input_1);
+    broadcast_input_s16(input_data2, &input_2_dims, &output_dims, input_2);
+
+    arm_elementwise_mul_s16(input_1,
+                            input_2,
+                            input_1_offset,
+                            input_2_offset,
+                            output_ref,
+                            out_offset,
+                            out_mult,
+                            out_shift,
+                            out_activation_min,
+                            out_activation_max,
+                            size);
+
+    arm_cmsis_nn_status result = arm_elementwise_mul_broadcast_s16(input_data1,
+                                                                   &input_1_dims,
+                                                                   input_data2,
+                                                                   &input_2_dims,
+                                                                   input_1_offset,
+                                                                   input_2_offset,
+                                                                   output,
+                                                                   &output_dims,
+                                                                   out_offset,
+                                                                   out_mult,
+                                                                   out_shift,
+                                                                   out_activation_min,
+                                                                   out_activation_max);
+
+    TEST_ASSERT_EQUAL(expected, result);
+    TEST_ASSERT_TRUE(validate_s16(output, output_ref, size));
+}
+
+void mul_s16_broadcast_channel_arm_elementwise_mul_s16(void)
+{
+    const cmsis_nn_dims input_1_dims = {1, 2, MUL_S16_BROADCAST_W, 16};
+    const cmsis_nn_dims input_2_dims = {1, 1, 1, 16};
+    mul_broadcast_s16(input_1_dims, input_2_dims);
+}
+
+void mul_s16_broadcast_scalar_arm_elementwise_mul_s16(void)
+{
+    const cmsis_nn_dims input_1_dims = {1, 1, 1, 1};
+    const cmsis_nn_dims input_2_dims = {1, 2, MUL_S16_BROADCAST_W, 16};
+    mul_broadcast_s16(input_1_dims, input_2_dims);
+}
+
+void mul_s16_broadcast_row_column_arm_elementwise_mul_s16(void)
+{
+    const cmsis_nn_dims input_1_dims = {1, 2, 1, 16};
+    const cmsis_nn_dims input_2_dims = {1, 1, MUL_S16_BROADCAST_W, 1};
+    mul_broadcast_s16(input_1_dims, input_2_dims);
+}
+
+void mul_s16_broadcast_batch_arm_elementwise_mul_s16(void)
+{
+    const cmsis_nn_dims input_1_dims = {2, 1, MUL_S16_BROADCAST_W, 16};
+    const cmsis_nn_dims input_2_dims = {1, 1, MUL_S16_BROADCAST_W, 16};
+    mul_broadcast_s16(input_1_dims, input_2_dims);
+}
+
+void mul_s16_broadcast_param_fail_arm_elementwise_mul_s16(void)
+{
+    const arm_cmsis_nn_status expected = ARM_CMSIS_NN_ARG_ERROR;
+    const cmsis_nn_dims input_1_dims = {1, 2, MUL_S16_BROADCAST_W, 16};
+    const cmsis_nn_dims input_2_dims = {1, 2, 2, 16};
+    int16_t output[MUL_S16_DST_SIZE] = {0};
+
+    const int16_t *input_data1 = mul_s16_input1;
+    const int16_t *input_data2 = mul_s16_input2;
+
+    arm_cmsis_nn_status result = arm_elementwise_mul_broadcast_s16(input_data1,
+                                                                   &input_1_dims,
+                                                                   input_data2,
+                                                                   &input_2_dims,
+                                                                   0,
+                                                                   0,
+                                                                   output,
+                                                                   &input_1_dims,
+                                                                   0,
+                                                                   0,
+                                                                   0,
+                                                                   MUL_S16_OUT_ACTIVATION_MIN,
+                                                                   MUL_S16_OUT_ACTIVATION_MAX);
+
+    TEST_ASSERT_EQUAL(expected, result);
+}
@@ -45,3 +45,13 @@ void setUp(void)
 void tearDown(void) {}
 
 void test_mul_arm_elementwise_mul_s8(void) { mul_arm_elementwise_mul_s8(); }
+
+void test_mul_broadcast_channel_arm_elementwise_mul_s8(void) { mul_broadcast_channel_arm_elementwise_mul_s8(); }
+
+void test_mul_broadcast_scalar_arm_elementwise_mul_s8(void) { mul_broadcast_scalar_arm_elementwise_mul_s8(); }
+
+void test_mul_broadcast_row_column_arm_elementwise_mul_s8(void) { mul_broadcast_row_column_arm_elementwise_mul_s8(); }
+
+void test_mul_broadcast_batch_arm_elementwise_mul_s8(void) { mul_broadcast_batch_arm_elementwise_mul_s8(); }
+
+void test_mul_broadcast_param_fail_arm_elementwise_mul_s8(void) { mul_broadcast_param_fail_arm_elementwise_mul_s8(); }
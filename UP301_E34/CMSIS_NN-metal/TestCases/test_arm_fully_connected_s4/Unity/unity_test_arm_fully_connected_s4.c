@@ -49,4 +49,8 @@ void test_fully_connected_arm_fully_connected_s4_2(void) { fully_connected_int4_
 void test_fully_connected_arm_fully_connected_s4_3(void) { fully_connected_int4_arm_fully_connected_s4_3(); }
 void test_fully_connected_arm_fully_connected_s4_4(void) { fully_connected_int4_arm_fully_connected_s4_4(); }
 void test_fully_connected_arm_fully_connected_s4_5(void) { fully_connected_int4_arm_fully_connected_s4_5(); }
-void test_fully_connected_arm_fully_connected_s4_6(void) { fully_connected_int4_arm_fully_connected_s4_6(); }
\ No newline at end of file
+void test_fully_connected_arm_fully_connected_s4_6(void) { fully_connected_int4_arm_fully_connected_s4_6(); }
+
+void test_int4_activations_arm_fully_connected_s4_s4(void) { int4_activations_arm_fully_connected_s4_s4(); }
+
+void test_int4_activations_arm_fully_connected_s4_s8(void) { int4_activations_arm_fully_connected_s4_s8(); }
@@ -17,6 +17,8 @@
  */
 
 #include <arm_nnfunctions.h>
+#include <arm_nnsupportfunctions.h>
+#include <stdbool.h>
 #include <stdlib.h>
 #include <unity.h>
 
@@ -405,4 +407,163 @@ void fully_connected_int4_arm_fully_connected_s4_6(void)
     }
     TEST_ASSERT_EQUAL(expected, result);
     TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
-}
\ No newline at end of file
+}
+#define INT4_ACT_BATCHES (3)
+#define INT4_ACT_ACCUM_DEPTH (7)
+#define INT4_ACT_OUT_CH (5)
+#define INT4_ACT_INPUT_SIZE (INT4_ACT_BATCHES * INT4_ACT_ACCUM_DEPTH)
+#define INT4_ACT_DST_SIZE (INT4_ACT_BATCHES * INT4_ACT_OUT_CH)
+
+/* Runs arm_fully_connected_s4_s4 or arm_fully_connected_s4_s8 on packed int4 activations and compares them with
+ * arm_fully_connected_s4 or arm_fully_connected_s8 on the unpacked activations. The odd depths make every other
+ * batch start in the middle of a byte. */
+static void int4_activations_fully_connected(const bool int4_weights)
+{
+    int8_t input[INT4_ACT_INPUT_SIZE];
+    int8_t packed_input[(INT4_ACT_INPUT_SIZE + 1) / 2];
+    int8_t weights[INT4_ACT_ACCUM_DEPTH * INT4_ACT_OUT_CH];
+    int8_t packed_weights[(INT4_ACT_ACCUM_DEPTH * INT4_ACT_OUT_CH + 1) / 2];
+    int32_t bias[INT4_ACT_OUT_CH];
+    int8_t output_ref[INT4_ACT_DST_SIZE];
+    int8_t packed_output_ref[(INT4_ACT_DST_SIZE + 1) / 2];
+    int8_t packed_output[(INT4_ACT_DST_SIZE + 1) / 2];
+
+    srand(int4_weights ? 1 : 2);
+    for (int i = 0; i < INT4_ACT_INPUT_SIZE; i++)
+    {
+        input[i] = (int8_t)(rand() % 16 - 8);
+    }
+    for (int i = 0; i < INT4_ACT_ACCUM_DEPTH * INT4_ACT_OUT_CH; i++)
+    {
+        weights[i] = int4_weights ? (int8_t)(rand() % 16 - 8) : (int8_t)(rand() % 256 - 128);
+    }
+    for (int i = 0; i < INT4_ACT_OUT_CH; i++)
+    {
+        bias[i] = rand() % 200 - 100;
+    }
+    arm_nn_pack_s4(input, INT4_ACT_INPUT_SIZE, packed_input, 0);
+    arm_nn_pack_s4(weights, INT4_ACT_ACCUM_DEPTH * INT4_ACT_OUT_CH, packed_weights, 0);
+
+    cmsis_nn_context ctx;
+    cmsis_nn_fc_params fc_params;
+    cmsis_nn_per_tensor_quant_params quant_params;
+    cmsis_nn_dims input_dims = {INT4_ACT_BATCHES, 1, 1, INT4_ACT_ACCUM_DEPTH};
+    cmsis_nn_dims filter_dims = {INT4_ACT_ACCUM_DEPTH, 1, 1, INT4_ACT_OUT_CH};
+    cmsis_nn_dims bias_dims = {1, 1, 1, INT4_ACT_OUT_CH};
+    cmsis_nn_dims output_dims = {INT4_ACT_BATCHES, 1, 1, INT4_ACT_OUT_CH};
+
+    fc_params.input_offset = 3;
+    fc_params.filter_offset = 0;
+    fc_params.output_offset = -2;
+    fc_params.activation.min = -8;
+    fc_params.activation.max = 7;
+    quant_params.multiplier = 1374389535;
+    quant_params.shift = int4_weights ? -4 : -8;
+
+    /* Reference on unpacked activations */
+    int32_t buf_size = int4_weights ? 0 : arm_fully_connected_s8_get_buffer_size(&filter_dims);
+    ctx.buf = malloc(buf_size);
+    ctx.size = buf_size;
+    arm_cmsis_nn_status result;
+    if (int4_weights)
+    {
+        result = arm_fully_connected_s4(&ctx,
+                                        &fc_params,
+                                        &quant_params,
+                                        &input_dims,
+                                        input,
+                                        &filter_dims,
+                                        packed_weights,
+                                        &bias_dims,
+                                        bias,
+                                        &output_dims,
+                                        output_ref);
+    }
+    else
+    {
+        if (buf_size > 0)
+        {
+            arm_vector_sum_s8(ctx.buf,
+                              INT4_ACT_ACCUM_DEPTH,
+                              INT4_ACT_OUT_CH,
+                              weights,
+                              fc_params.input_offset,
+                              fc_params.filter_offset,
+                              bias);
+        }
+        result = arm_fully_connected_s8(&ctx,
+                                        &fc_params,
+                                        &quant_params,
+                                        &input_dims,
+                                        input,
+                                        &filter_dims,
+                                        weights,
+                                        &bias_dims,
+                                        bias,
+                                        &output_dims,
+                                        output_ref);
+    }
+    free(ctx.buf);
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+    arm_nn_pack_s4(output_ref, INT4_ACT_DST_SIZE, packed_output_ref, 0);
+
+    buf_size = int4_weights ? arm_fully_connected_s4_s4_get_buffer_size(&filter_dims)
+                            : arm_fully_connected_s4_s8_get_buffer_size(&filter_dims);
+    ctx.buf = malloc(buf_size);
+    ctx.size = buf_size;
+    memset(packed_output, 0, sizeof(packed_output));
+    if (int4_weights)
+    {
+        result = arm_fully_connected_s4_s4(&ctx,
+                                           &fc_params,
+                                           &quant_params,
+                                           &input_dims,
+                                           packed_input,
+                                           &filter_dims,
+                                           packed_weights,
+                                           &bias_dims,
+                                           bias,
+                                           &output_dims,
+                                           packed_output);
+    }
+    else
+    {
+        result = arm_fully_connected_s4_s8(&ctx,
+                                           &fc_params,
+                                           &quant_params,
+                                           &input_dims,
+                                           packed_input,
+                                           &filter_dims,
+                                           weights,
+                                           &bias_dims,
+                                           bias,
+                                           &output_dims,
+                                           packed_output);
+    }
+    if (ctx.buf)
+    {
+        // The caller is responsible to clear the scratch buffers for security reasons if applicable.
+        memset(ctx.buf, 0, buf_size);
+        free(ctx.buf);
+    }
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+    TEST_ASSERT_TRUE(validate(packed_output, packed_output_ref, sizeof(packed_output)));
+
+    ctx.buf = NULL;
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_ARG_ERROR,
+                      arm_fully_connected_s4_s4(&ctx,
+                                                &fc_params,
+                                                &quant_params,
+                                                &input_dims,
+                                                packed_input,
+                                                &filter_dims,
+                                                packed_weights,
+                                                &bias_dims,
+                                                bias,
+                                                &output_dims,
+                                                packed_output));
+}
+
+void int4_activations_arm_fully_connected_s4_s4(void) { int4_activations_fully_connected(true); }
+
+void int4_activations_arm_fully_connected_s4_s8(void) { int4_activations_fully_connected(false); }
@@ -63,3 +63,12 @@ void test_fully_connected_out_activation_arm_fully_connected_s8(void)
 }
 
 void test_fc_per_fc_per_ch_arm_fully_connected_s8(void) { fc_per_ch_arm_fully_connected_s8(); }
+
+void test_fully_connected_arm_fully_connected_packed_s8(void) { fully_connected_arm_fully_connected_packed_s8(); }
+
+void test_fully_connected_null_bias_0_arm_fully_connected_packed_s8(void)
+{
+    fully_connected_null_bias_0_arm_fully_connected_packed_s8();
+}
+
+void test_fc_per_ch_arm_fully_connected_packed_s8(void) { fc_per_ch_arm_fully_connected_packed_s8(); }
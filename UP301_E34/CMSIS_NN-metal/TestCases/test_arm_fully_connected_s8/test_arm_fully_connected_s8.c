@@ -554,3 +554,116 @@ void fc_per_ch_arm_fully_connected_s8(void)
     TEST_ASSERT_EQUAL(expected, result);
     TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
 }
+
+static void fully_connected_packed_s8(const cmsis_nn_fc_params *fc_params,
+                                      const cmsis_nn_quant_params *quant_params,
+                                      const int32_t batches,
+                                      const int32_t accumulation_depth,
+                                      const int32_t output_depth,
+                                      const int8_t *input_data,
+                                      const int8_t *kernel_data,
+                                      const int32_t *bias_data,
+                                      const int8_t *output_ref)
+{
+    const int32_t output_ref_size = batches * output_depth;
+    int8_t *output = malloc(output_ref_size);
+
+    cmsis_nn_dims input_dims = {batches, 1, 1, accumulation_depth};
+    cmsis_nn_dims filter_dims = {accumulation_depth, 1, 1, output_depth};
+    cmsis_nn_dims output_dims = {batches, 1, 1, output_depth};
+
+    TEST_ASSERT_FALSE(arm_fully_connected_s8_is_packed(&filter_dims, kernel_data));
+
+    const int32_t packed_size = arm_fully_connected_packed_s8_get_weights_size(&filter_dims);
+    int32_t *packed_buf = malloc(packed_size);
+    int8_t *packed_data = (int8_t *)packed_buf;
+
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS,
+                      arm_fully_connected_pack_weights_s8(fc_params, &filter_dims, kernel_data, bias_data, packed_data));
+    TEST_ASSERT_TRUE(arm_fully_connected_s8_is_packed(&filter_dims, packed_data));
+
+    arm_cmsis_nn_status result = arm_fully_connected_packed_s8(
+        fc_params, quant_params, &input_dims, input_data, &filter_dims, packed_data, &output_dims, output);
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+    TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
+
+    // The kernel sums depend on the input offset, so weights packed for another offset are rejected
+    cmsis_nn_fc_params other_params = *fc_params;
+    other_params.input_offset = fc_params->input_offset - 1;
+    result = arm_fully_connected_packed_s8(
+        &other_params, quant_params, &input_dims, input_data, &filter_dims, packed_data, &output_dims, output);
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_ARG_ERROR, result);
+
+    free(packed_buf);
+    free(output);
+}
+
+void fully_connected_arm_fully_connected_packed_s8(void)
+{
+    cmsis_nn_fc_params fc_params;
+    fc_params.input_offset = FULLY_CONNECTED_INPUT_OFFSET;
+    fc_params.filter_offset = 0;
+    fc_params.output_offset = FULLY_CONNECTED_OUTPUT_OFFSET;
+    fc_params.activation.min = FULLY_CONNECTED_OUT_ACTIVATION_MIN;
+    fc_params.activation.max = FULLY_CONNECTED_OUT_ACTIVATION_MAX;
+
+    int32_t multiplier = FULLY_CONNECTED_OUTPUT_MULTIPLIER;
+    int32_t shift = FULLY_CONNECTED_OUTPUT_SHIFT;
+    cmsis_nn_quant_params quant_params = {&multiplier, &shift, 0};
+
+    fully_connected_packed_s8(&fc_params,
+                              &quant_params,
+                              FULLY_CONNECTED_INPUT_BATCHES,
+                              FULLY_CONNECTED_ACCUMULATION_DEPTH,
+                              FULLY_CONNECTED_OUT_CH,
+                              fully_connected_input,
+                              fully_connected_weights,
+                              fully_connected_biases,
+                              fully_connected_output_ref);
+}
+
+void fully_connected_null_bias_0_arm_fully_connected_packed_s8(void)
+{
+    cmsis_nn_fc_params fc_params;
+    fc_params.input_offset = FULLY_CONNECTED_NULL_BIAS_0_INPUT_OFFSET;
+    fc_params.filter_offset = 0;
+    fc_params.output_offset = FULLY_CONNECTED_NULL_BIAS_0_OUTPUT_OFFSET;
+    fc_params.activation.min = FULLY_CONNECTED_NULL_BIAS_0_OUT_ACTIVATION_MIN;
+    fc_params.activation.max = FULLY_CONNECTED_NULL_BIAS_0_OUT_ACTIVATION_MAX;
+
+    int32_t multiplier = FULLY_CONNECTED_NULL_BIAS_0_OUTPUT_MULTIPLIER;
+    int32_t shift = FULLY_CONNECTED_NULL_BIAS_0_OUTPUT_SHIFT;
+    cmsis_nn_quant_params quant_params = {&multiplier, &shift, 0};
+
+    fully_connected_packed_s8(&fc_params,
+                              &quant_params,
+                              FULLY_CONNECTED_NULL_BIAS_0_INPUT_BATCHES,
+                              FULLY_CONNECTED_NULL_BIAS_0_ACCUMULATION_DEPTH,
+                              FULLY_CONNECTED_NULL_BIAS_0_OUT_CH,
+                              fully_connected_null_bias_0_input,
+                              fully_connected_null_bias_0_weights,
+                              NULL,
+                              fully_connected_null_bias_0_output_ref);
+}
+
+void fc_per_ch_arm_fully_connected_packed_s8(void)
+{
+    cmsis_nn_fc_params fc_params;
+    fc_params.input_offset = FC_PER_CH_INPUT_OFFSET;
+    fc_params.filter_offset = 0;
+    fc_params.output_offset = FC_PER_CH_OUTPUT_OFFSET;
+    fc_params.activation.min = FC_PER_CH_OUT_ACTIVATION_MIN;
+    fc_params.activation.max = FC_PER_CH_OUT_ACTIVATION_MAX;
+
+    cmsis_nn_quant_params quant_params = {(int32_t *)fc_per_ch_output_mult, (int32_t *)fc_per_ch_output_shift, 1};
+
+    fully_connected_packed_s8(&fc_params,
+                              &quant_params,
+                              FC_PER_CH_INPUT_BATCHES,
+                              FC_PER_CH_ACCUMULATION_DEPTH,
+                              FC_PER_CH_OUT_CH,
+                              fc_per_ch_input,
+                              fc_per_ch_weights,
+                              fc_per_ch_biases,
+                              fc_per_ch_output_ref);
+}
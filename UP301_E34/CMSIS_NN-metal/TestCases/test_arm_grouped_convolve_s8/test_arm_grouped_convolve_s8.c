@@ -97,6 +97,23 @@ void grouped_conv_arm_grouped_convolve_1_s8(void)
     TEST_ASSERT_EQUAL(expected, result);
     TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
     memset(output, 0, sizeof(output));
+
+    ctx.buf = NULL;
+    ctx.size = 0;
+
+    result = arm_convolve_implicit_s8(&ctx,
+                                      &conv_params,
+                                      &quant_params,
+                                      &input_dims,
+                                      input_data,
+                                      &filter_dims,
+                                      kernel_data,
+                                      &bias_dims,
+                                      bias_data,
+                                      &output_dims,
+                                      output);
+    TEST_ASSERT_EQUAL(expected, result);
+    TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
 }
 
 void grouped_conv_arm_grouped_convolve_2_s8(void)
@@ -241,6 +258,23 @@ void grouped_conv_arm_grouped_convolve_3_s8(void)
     TEST_ASSERT_EQUAL(expected, result);
     TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
     memset(output, 0, sizeof(output));
+
+    ctx.buf = NULL;
+    ctx.size = 0;
+
+    result = arm_convolve_implicit_s8(&ctx,
+                                      &conv_params,
+                                      &quant_params,
+                                      &input_dims,
+                                      input_data,
+                                      &filter_dims,
+                                      kernel_data,
+                                      &bias_dims,
+                                      bias_data,
+                                      &output_dims,
+                                      output);
+    TEST_ASSERT_EQUAL(expected, result);
+    TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
 }
 
 void grouped_conv_arm_grouped_convolve_4_s8(void)
@@ -33,6 +33,41 @@ int16_t buffer1[LARGEST_BUFFER_SIZE];
 int16_t buffer2[LARGEST_BUFFER_SIZE];
 int16_t buffer3[LARGEST_BUFFER_SIZE];
 
+// Runs the LSTM again with the gate weights interleaved for the fused gate kernel. The output must not change.
+static void validate_fused_gates(const int16_t *input,
+                                 cmsis_nn_lstm_params params,
+                                 cmsis_nn_lstm_context *buffers,
+                                 const int16_t *output_ref,
+                                 const int32_t output_ref_size)
+{
+    const int32_t gate_rows = 4 * params.hidden_size;
+    int8_t *input_weights = malloc(gate_rows * params.input_size);
+    int8_t *hidden_weights = malloc(gate_rows * params.hidden_size);
+    int64_t *input_effective_bias = malloc(gate_rows * sizeof(int64_t));
+    int64_t *hidden_effective_bias = malloc(gate_rows * sizeof(int64_t));
+    int16_t *output = calloc(output_ref_size, sizeof(int16_t));
+    cmsis_nn_lstm_fused_gates fused_gates;
+
+    const arm_cmsis_nn_status interleave_result = arm_lstm_interleave_gates_s16(&params,
+                                                                                input_weights,
+                                                                                input_effective_bias,
+                                                                                hidden_weights,
+                                                                                hidden_effective_bias,
+                                                                                &fused_gates);
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, interleave_result);
+    params.fused_gates = &fused_gates;
+
+    const arm_cmsis_nn_status result = arm_lstm_unidirectional_s16(input, output, &params, buffers);
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+    TEST_ASSERT_TRUE(validate_s16(output, output_ref, output_ref_size));
+
+    free(input_weights);
+    free(hidden_weights);
+    free(input_effective_bias);
+    free(hidden_effective_bias);
+    free(output);
+}
+
 void lstm_1_s16(void)
 {
     int16_t output[LSTM_1_S16_BATCH_SIZE * LSTM_1_S16_TIME_STEPS * LSTM_1_S16_HIDDEN_SIZE] = {0};
@@ -178,6 +213,8 @@ void lstm_1_s16(void)
 
     TEST_ASSERT_EQUAL(expected, result);
     TEST_ASSERT_TRUE(validate_s16(output, output_ref, output_ref_size));
+
+    validate_fused_gates(lstm_1_s16_input_tensor, params, &buffers, output_ref, output_ref_size);
 }
 void lstm_2_s16(void)
 {
@@ -324,6 +361,8 @@ void lstm_2_s16(void)
 
     TEST_ASSERT_EQUAL(expected, result);
     TEST_ASSERT_TRUE(validate_s16(output, output_ref, output_ref_size));
+
+    validate_fused_gates(lstm_2_s16_input_tensor, params, &buffers, output_ref, output_ref_size);
 }
 void lstm_one_time_step_s16(void)
 {
@@ -473,4 +512,6 @@ void lstm_one_time_step_s16(void)
 
     TEST_ASSERT_EQUAL(expected, result);
     TEST_ASSERT_TRUE(validate_s16(output, output_ref, output_ref_size));
+
+    validate_fused_gates(lstm_one_time_step_s16_input_tensor, params, &buffers, output_ref, output_ref_size);
 }
\ No newline at end of file
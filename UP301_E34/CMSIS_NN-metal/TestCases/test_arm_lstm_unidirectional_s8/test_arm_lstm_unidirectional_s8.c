@@ -34,6 +34,41 @@ int8_t buffer1[LARGEST_BUFFER_SIZE];
 int8_t buffer2[LARGEST_BUFFER_SIZE];
 int8_t buffer3[LARGEST_BUFFER_SIZE];
 
+// Runs the LSTM again with the gate weights interleaved for the fused gate kernel. The output must not change.
+static void validate_fused_gates(const int8_t *input,
+                                 cmsis_nn_lstm_params params,
+                                 cmsis_nn_lstm_context *buffers,
+                                 const int8_t *output_ref,
+                                 const int32_t output_ref_size)
+{
+    const int32_t gate_rows = 4 * params.hidden_size;
+    int8_t *input_weights = malloc(gate_rows * params.input_size);
+    int8_t *hidden_weights = malloc(gate_rows * params.hidden_size);
+    int32_t *input_effective_bias = malloc(gate_rows * sizeof(int32_t));
+    int32_t *hidden_effective_bias = malloc(gate_rows * sizeof(int32_t));
+    int8_t *output = calloc(output_ref_size, sizeof(int8_t));
+    cmsis_nn_lstm_fused_gates fused_gates;
+
+    const arm_cmsis_nn_status interleave_result = arm_lstm_interleave_gates_s8(&params,
+                                                                               input_weights,
+                                                                               input_effective_bias,
+                                                                               hidden_weights,
+                                                                               hidden_effective_bias,
+                                                                               &fused_gates);
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, interleave_result);
+    params.fused_gates = &fused_gates;
+
+    const arm_cmsis_nn_status result = arm_lstm_unidirectional_s8(input, output, &params, buffers);
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+    TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
+
+    free(input_weights);
+    free(hidden_weights);
+    free(input_effective_bias);
+    free(hidden_effective_bias);
+    free(output);
+}
+
 void lstm_1(void)
 {
     int8_t output[LSTM_1_BATCH_SIZE * LSTM_1_TIME_STEPS * LSTM_1_HIDDEN_SIZE] = {0};
@@ -187,6 +222,8 @@ void lstm_1(void)
 
     TEST_ASSERT_EQUAL(expected, result);
     TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
+
+    validate_fused_gates(lstm_1_input_tensor, params, &buffers, output_ref, output_ref_size);
 }
 void lstm_2(void)
 {
@@ -341,6 +378,8 @@ void lstm_2(void)
 
     TEST_ASSERT_EQUAL(expected, result);
     TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
+
+    validate_fused_gates(lstm_2_input_tensor, params, &buffers, output_ref, output_ref_size);
 }
 void lstm_one_time_step(void)
 {
@@ -496,4 +535,6 @@ void lstm_one_time_step(void)
 
     TEST_ASSERT_EQUAL(expected, result);
     TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
+
+    validate_fused_gates(lstm_one_time_step_input_tensor, params, &buffers, output_ref, output_ref_size);
 }
@@ -60,4 +60,12 @@ void test_maxpooling_6_arm_max_pool_s8(void) { maxpooling_6_arm_max_pool_s8(); }
 
 void test_maxpooling_7_arm_max_pool_s8(void) { maxpooling_7_arm_max_pool_s8(); }
 
+void test_maxpooling_sliding_arm_max_pool_s8(void) { maxpooling_sliding_arm_max_pool_s8(); }
+
+void test_maxpooling_1_sliding_arm_max_pool_s8(void) { maxpooling_1_sliding_arm_max_pool_s8(); }
+
+void test_maxpooling_2_sliding_arm_max_pool_s8(void) { maxpooling_2_sliding_arm_max_pool_s8(); }
+
+void test_maxpooling_6_sliding_arm_max_pool_s8(void) { maxpooling_6_sliding_arm_max_pool_s8(); }
+
 void test_maxpooling_param_fail_arm_max_pool_s8(void) { maxpooling_param_fail_arm_max_pool_s8(); }
@@ -16,6 +16,8 @@
  * limitations under the License.
  */
 
+#include <stdlib.h>
+
 #include "unity.h"
 #include <arm_nnfunctions.h>
 
@@ -36,7 +38,7 @@ void maxpooling_arm_max_pool_s8(void)
     const arm_cmsis_nn_status expected = ARM_CMSIS_NN_SUCCESS;
     int8_t output[MAXPOOLING_OUTPUT_W * MAXPOOLING_OUTPUT_H * MAXPOOLING_INPUT_C * MAXPOOLING_BATCH_SIZE] = {0};
 
-    cmsis_nn_context ctx;
+    cmsis_nn_context ctx = {};
     cmsis_nn_pool_params pool_params;
     cmsis_nn_dims input_dims;
     cmsis_nn_dims filter_dims;
@@ -80,7 +82,7 @@ void maxpooling_1_arm_max_pool_s8(void)
     const arm_cmsis_nn_status expected = ARM_CMSIS_NN_SUCCESS;
     int8_t output[MAXPOOLING_1_OUTPUT_W * MAXPOOLING_1_OUTPUT_H * MAXPOOLING_1_INPUT_C * MAXPOOLING_1_BATCH_SIZE] = {0};
 
-    cmsis_nn_context ctx;
+    cmsis_nn_context ctx = {};
     cmsis_nn_pool_params pool_params;
     cmsis_nn_dims input_dims;
     cmsis_nn_dims filter_dims;
@@ -124,7 +126,7 @@ void maxpooling_2_arm_max_pool_s8(void)
     const arm_cmsis_nn_status expected = ARM_CMSIS_NN_SUCCESS;
     int8_t output[MAXPOOLING_2_OUTPUT_W * MAXPOOLING_2_OUTPUT_H * MAXPOOLING_2_INPUT_C * MAXPOOLING_2_BATCH_SIZE] = {0};
 
-    cmsis_nn_context ctx;
+    cmsis_nn_context ctx = {};
     cmsis_nn_pool_params pool_params;
     cmsis_nn_dims input_dims;
     cmsis_nn_dims filter_dims;
@@ -168,7 +170,7 @@ void maxpooling_3_arm_max_pool_s8(void)
     const arm_cmsis_nn_status expected = ARM_CMSIS_NN_SUCCESS;
     int8_t output[MAXPOOLING_3_OUTPUT_W * MAXPOOLING_3_OUTPUT_H * MAXPOOLING_3_INPUT_C * MAXPOOLING_3_BATCH_SIZE] = {0};
 
-    cmsis_nn_context ctx;
+    cmsis_nn_context ctx = {};
     cmsis_nn_pool_params pool_params;
     cmsis_nn_dims input_dims;
     cmsis_nn_dims filter_dims;
@@ -212,7 +214,7 @@ void maxpooling_4_arm_max_pool_s8(void)
     const arm_cmsis_nn_status expected = ARM_CMSIS_NN_SUCCESS;
     int8_t output[MAXPOOLING_4_OUTPUT_W * MAXPOOLING_4_OUTPUT_H * MAXPOOLING_4_INPUT_C * MAXPOOLING_4_BATCH_SIZE] = {0};
 
-    cmsis_nn_context ctx;
+    cmsis_nn_context ctx = {};
     cmsis_nn_pool_params pool_params;
     cmsis_nn_dims input_dims;
     cmsis_nn_dims filter_dims;
@@ -256,7 +258,7 @@ void maxpooling_5_arm_max_pool_s8(void)
     const arm_cmsis_nn_status expected = ARM_CMSIS_NN_SUCCESS;
     int8_t output[MAXPOOLING_5_OUTPUT_W * MAXPOOLING_5_OUTPUT_H * MAXPOOLING_5_INPUT_C * MAXPOOLING_5_BATCH_SIZE] = {0};
 
-    cmsis_nn_context ctx;
+    cmsis_nn_context ctx = {};
     cmsis_nn_pool_params pool_params;
     cmsis_nn_dims input_dims;
     cmsis_nn_dims filter_dims;
@@ -300,7 +302,7 @@ void maxpooling_6_arm_max_pool_s8(void)
     const arm_cmsis_nn_status expected = ARM_CMSIS_NN_SUCCESS;
     int8_t output[MAXPOOLING_6_OUTPUT_W * MAXPOOLING_6_OUTPUT_H * MAXPOOLING_6_INPUT_C * MAXPOOLING_6_BATCH_SIZE] = {0};
 
-    cmsis_nn_context ctx;
+    cmsis_nn_context ctx = {};
     cmsis_nn_pool_params pool_params;
     cmsis_nn_dims input_dims;
     cmsis_nn_dims filter_dims;
@@ -344,7 +346,7 @@ void maxpooling_7_arm_max_pool_s8(void)
     const arm_cmsis_nn_status expected = ARM_CMSIS_NN_SUCCESS;
     int8_t output[MAXPOOLING_7_OUTPUT_W * MAXPOOLING_7_OUTPUT_H * MAXPOOLING_7_INPUT_C * MAXPOOLING_7_BATCH_SIZE] = {0};
 
-    cmsis_nn_context ctx;
+    cmsis_nn_context ctx = {};
     cmsis_nn_pool_params pool_params;
     cmsis_nn_dims input_dims;
     cmsis_nn_dims filter_dims;
@@ -383,6 +385,202 @@ void maxpooling_7_arm_max_pool_s8(void)
     }
 }
 
+void maxpooling_sliding_arm_max_pool_s8(void)
+{
+    const arm_cmsis_nn_status expected = ARM_CMSIS_NN_SUCCESS;
+    int8_t output[MAXPOOLING_OUTPUT_W * MAXPOOLING_OUTPUT_H * MAXPOOLING_INPUT_C * MAXPOOLING_BATCH_SIZE] = {0};
+
+    cmsis_nn_context ctx;
+    cmsis_nn_pool_params pool_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims output_dims;
+
+    const int8_t *input_data = maxpooling_input_tensor;
+
+    input_dims.n = MAXPOOLING_BATCH_SIZE;
+    input_dims.w = MAXPOOLING_INPUT_W;
+    input_dims.h = MAXPOOLING_INPUT_H;
+    input_dims.c = MAXPOOLING_INPUT_C;
+    filter_dims.w = MAXPOOLING_FILTER_W;
+    filter_dims.h = MAXPOOLING_FILTER_H;
+    output_dims.w = MAXPOOLING_OUTPUT_W;
+    output_dims.h = MAXPOOLING_OUTPUT_H;
+    output_dims.c = MAXPOOLING_INPUT_C;
+
+    pool_params.padding.w = MAXPOOLING_PADDING_W;
+    pool_params.padding.h = MAXPOOLING_PADDING_H;
+    pool_params.stride.w = MAXPOOLING_STRIDE_W;
+    pool_params.stride.h = MAXPOOLING_STRIDE_H;
+
+    pool_params.activation.min = MAXPOOLING_ACTIVATION_MIN;
+    pool_params.activation.max = MAXPOOLING_ACTIVATION_MAX;
+
+    ctx.size = arm_max_pool_sliding_s8_get_buffer_size(&input_dims, &filter_dims, &output_dims);
+    ctx.buf = malloc(ctx.size);
+
+    arm_cmsis_nn_status result =
+        arm_max_pool_sliding_s8(&ctx, &pool_params, &input_dims, input_data, &filter_dims, &output_dims, output);
+
+    if (ctx.buf)
+    {
+        memset(ctx.buf, 0, ctx.size);
+        free(ctx.buf);
+    }
+    TEST_ASSERT_EQUAL(expected, result);
+    TEST_ASSERT_TRUE(
+        validate(output,
+                 maxpooling_output,
+                 MAXPOOLING_OUTPUT_W * MAXPOOLING_OUTPUT_H * MAXPOOLING_INPUT_C * MAXPOOLING_BATCH_SIZE));
+}
+
+void maxpooling_1_sliding_arm_max_pool_s8(void)
+{
+    const arm_cmsis_nn_status expected = ARM_CMSIS_NN_SUCCESS;
+    int8_t output[MAXPOOLING_1_OUTPUT_W * MAXPOOLING_1_OUTPUT_H * MAXPOOLING_1_INPUT_C * MAXPOOLING_1_BATCH_SIZE] = {0};
+
+    cmsis_nn_context ctx;
+    cmsis_nn_pool_params pool_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims output_dims;
+
+    const int8_t *input_data = maxpooling_1_input_tensor;
+
+    input_dims.n = MAXPOOLING_1_BATCH_SIZE;
+    input_dims.w = MAXPOOLING_1_INPUT_W;
+    input_dims.h = MAXPOOLING_1_INPUT_H;
+    input_dims.c = MAXPOOLING_1_INPUT_C;
+    filter_dims.w = MAXPOOLING_1_FILTER_W;
+    filter_dims.h = MAXPOOLING_1_FILTER_H;
+    output_dims.w = MAXPOOLING_1_OUTPUT_W;
+    output_dims.h = MAXPOOLING_1_OUTPUT_H;
+    output_dims.c = MAXPOOLING_1_INPUT_C;
+
+    pool_params.padding.w = MAXPOOLING_1_PADDING_W;
+    pool_params.padding.h = MAXPOOLING_1_PADDING_H;
+    pool_params.stride.w = MAXPOOLING_1_STRIDE_W;
+    pool_params.stride.h = MAXPOOLING_1_STRIDE_H;
+
+    pool_params.activation.min = MAXPOOLING_1_ACTIVATION_MIN;
+    pool_params.activation.max = MAXPOOLING_1_ACTIVATION_MAX;
+
+    ctx.size = arm_max_pool_sliding_s8_get_buffer_size(&input_dims, &filter_dims, &output_dims);
+    ctx.buf = malloc(ctx.size);
+
+    arm_cmsis_nn_status result =
+        arm_max_pool_s8(&ctx, &pool_params, &input_dims, input_data, &filter_dims, &output_dims, output);
+
+    if (ctx.buf)
+    {
+        memset(ctx.buf, 0, ctx.size);
+        free(ctx.buf);
+    }
+    TEST_ASSERT_EQUAL(expected, result);
+    TEST_ASSERT_TRUE(
+        validate(output,
+                 maxpooling_1_output,
+                 MAXPOOLING_1_OUTPUT_W * MAXPOOLING_1_OUTPUT_H * MAXPOOLING_1_INPUT_C * MAXPOOLING_1_BATCH_SIZE));
+}
+
+void maxpooling_2_sliding_arm_max_pool_s8(void)
+{
+    const arm_cmsis_nn_status expected = ARM_CMSIS_NN_SUCCESS;
+    int8_t output[MAXPOOLING_2_OUTPUT_W * MAXPOOLING_2_OUTPUT_H * MAXPOOLING_2_INPUT_C * MAXPOOLING_2_BATCH_SIZE] = {0};
+
+    cmsis_nn_context ctx;
+    cmsis_nn_pool_params pool_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims output_dims;
+
+    const int8_t *input_data = maxpooling_2_input_tensor;
+
+    input_dims.n = MAXPOOLING_2_BATCH_SIZE;
+    input_dims.w = MAXPOOLING_2_INPUT_W;
+    input_dims.h = MAXPOOLING_2_INPUT_H;
+    input_dims.c = MAXPOOLING_2_INPUT_C;
+    filter_dims.w = MAXPOOLING_2_FILTER_W;
+    filter_dims.h = MAXPOOLING_2_FILTER_H;
+    output_dims.w = MAXPOOLING_2_OUTPUT_W;
+    output_dims.h = MAXPOOLING_2_OUTPUT_H;
+    output_dims.c = MAXPOOLING_2_INPUT_C;
+
+    pool_params.padding.w = MAXPOOLING_2_PADDING_W;
+    pool_params.padding.h = MAXPOOLING_2_PADDING_H;
+    pool_params.stride.w = MAXPOOLING_2_STRIDE_W;
+    pool_params.stride.h = MAXPOOLING_2_STRIDE_H;
+
+    pool_params.activation.min = MAXPOOLING_2_ACTIVATION_MIN;
+    pool_params.activation.max = MAXPOOLING_2_ACTIVATION_MAX;
+
+    ctx.size = arm_max_pool_sliding_s8_get_buffer_size(&input_dims, &filter_dims, &output_dims);
+    ctx.buf = malloc(ctx.size);
+
+    arm_cmsis_nn_status result =
+        arm_max_pool_sliding_s8(&ctx, &pool_params, &input_dims, input_data, &filter_dims, &output_dims, output);
+
+    if (ctx.buf)
+    {
+        memset(ctx.buf, 0, ctx.size);
+        free(ctx.buf);
+    }
+    TEST_ASSERT_EQUAL(expected, result);
+    TEST_ASSERT_TRUE(
+        validate(output,
+                 maxpooling_2_output,
+                 MAXPOOLING_2_OUTPUT_W * MAXPOOLING_2_OUTPUT_H * MAXPOOLING_2_INPUT_C * MAXPOOLING_2_BATCH_SIZE));
+}
+
+void maxpooling_6_sliding_arm_max_pool_s8(void)
+{
+    const arm_cmsis_nn_status expected = ARM_CMSIS_NN_SUCCESS;
+    int8_t output[MAXPOOLING_6_OUTPUT_W * MAXPOOLING_6_OUTPUT_H * MAXPOOLING_6_INPUT_C * MAXPOOLING_6_BATCH_SIZE] = {0};
+
+    cmsis_nn_context ctx;
+    cmsis_nn_pool_params pool_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims output_dims;
+
+    const int8_t *input_data = maxpooling_6_input_tensor;
+
+    input_dims.n = MAXPOOLING_6_BATCH_SIZE;
+    input_dims.w = MAXPOOLING_6_INPUT_W;
+    input_dims.h = MAXPOOLING_6_INPUT_H;
+    input_dims.c = MAXPOOLING_6_INPUT_C;
+    filter_dims.w = MAXPOOLING_6_FILTER_W;
+    filter_dims.h = MAXPOOLING_6_FILTER_H;
+    output_dims.w = MAXPOOLING_6_OUTPUT_W;
+    output_dims.h = MAXPOOLING_6_OUTPUT_H;
+    output_dims.c = MAXPOOLING_6_INPUT_C;
+
+    pool_params.padding.w = MAXPOOLING_6_PADDING_W;
+    pool_params.padding.h = MAXPOOLING_6_PADDING_H;
+    pool_params.stride.w = MAXPOOLING_6_STRIDE_W;
+    pool_params.stride.h = MAXPOOLING_6_STRIDE_H;
+
+    pool_params.activation.min = MAXPOOLING_6_ACTIVATION_MIN;
+    pool_params.activation.max = MAXPOOLING_6_ACTIVATION_MAX;
+
+    ctx.size = arm_max_pool_sliding_s8_get_buffer_size(&input_dims, &filter_dims, &output_dims);
+    ctx.buf = malloc(ctx.size);
+
+    arm_cmsis_nn_status result =
+        arm_max_pool_sliding_s8(&ctx, &pool_params, &input_dims, input_data, &filter_dims, &output_dims, output);
+
+    if (ctx.buf)
+    {
+        memset(ctx.buf, 0, ctx.size);
+        free(ctx.buf);
+    }
+    TEST_ASSERT_EQUAL(expected, result);
+    TEST_ASSERT_TRUE(
+        validate(output,
+                 maxpooling_6_output,
+                 MAXPOOLING_6_OUTPUT_W * MAXPOOLING_6_OUTPUT_H * MAXPOOLING_6_INPUT_C * MAXPOOLING_6_BATCH_SIZE));
+}
+
 void maxpooling_param_fail_arm_max_pool_s8(void)
 {
     const arm_cmsis_nn_status expected = ARM_CMSIS_NN_ARG_ERROR;
@@ -0,0 +1,533 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <arm_nnfunctions.h>
+#include <unity.h>
+
+#include "../TestData/avgpooling/test_data.h"
+#include "../TestData/depthwise_mult_batches/test_data.h"
+#include "../TestData/fully_connected/test_data.h"
+#include "../TestData/maxpooling_6/test_data.h"
+#include "../TestData/stride2pad1/test_data.h"
+#include "../Utils/cycle_count.h"
+#include "../Utils/thread_scheduler.h"
+#include "../Utils/utils.h"
+#include "../Utils/validate.h"
+
+#define MAX_TEST_WORKERS (4)
+
+static cmsis_nn_context worker_ctx[CMSIS_NN_MAX_WORKERS];
+
+/* Scheduler with one buffer of buf_size bytes per worker. With threaded set the slices run concurrently, if the host
+ * has threads; otherwise one after the other. */
+static cmsis_nn_scheduler make_scheduler(const int32_t num_workers, const int32_t buf_size, const bool threaded)
+{
+    cmsis_nn_scheduler scheduler;
+    for (int32_t i = 0; i < num_workers; i++)
+    {
+        worker_ctx[i].buf = buf_size > 0 ? malloc(buf_size) : NULL;
+        worker_ctx[i].size = buf_size;
+    }
+    scheduler.num_workers = num_workers;
+    scheduler.worker_ctx = worker_ctx;
+    scheduler.platform = NULL;
+    scheduler.run = NULL;
+#if defined(THREAD_SCHEDULER_AVAILABLE)
+    if (threaded)
+    {
+        scheduler.run = thread_scheduler_run;
+    }
+#else
+    (void)threaded;
+#endif
+    return scheduler;
+}
+
+static void free_scheduler(const cmsis_nn_scheduler *scheduler)
+{
+    for (int32_t i = 0; i < scheduler->num_workers; i++)
+    {
+        if (worker_ctx[i].buf)
+        {
+            memset(worker_ctx[i].buf, 0, worker_ctx[i].size);
+            free(worker_ctx[i].buf);
+        }
+    }
+}
+
+void stride2pad1_arm_nn_parallel_s8(void)
+{
+    cmsis_nn_conv_params conv_params;
+    cmsis_nn_per_channel_quant_params quant_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims bias_dims;
+    cmsis_nn_dims output_dims;
+
+    input_dims.n = STRIDE2PAD1_INPUT_BATCHES;
+    input_dims.w = STRIDE2PAD1_INPUT_W;
+    input_dims.h = STRIDE2PAD1_INPUT_H;
+    input_dims.c = STRIDE2PAD1_IN_CH;
+    filter_dims.n = STRIDE2PAD1_OUT_CH;
+    filter_dims.w = STRIDE2PAD1_FILTER_X;
+    filter_dims.h = STRIDE2PAD1_FILTER_Y;
+    filter_dims.c = STRIDE2PAD1_IN_CH;
+    output_dims.n = STRIDE2PAD1_INPUT_BATCHES;
+    output_dims.w = STRIDE2PAD1_OUTPUT_W;
+    output_dims.h = STRIDE2PAD1_OUTPUT_H;
+    output_dims.c = STRIDE2PAD1_OUT_CH;
+
+    conv_params.padding.w = STRIDE2PAD1_PAD_X;
+    conv_params.padding.h = STRIDE2PAD1_PAD_Y;
+    conv_params.stride.w = STRIDE2PAD1_STRIDE_X;
+    conv_params.stride.h = STRIDE2PAD1_STRIDE_Y;
+    conv_params.dilation.w = STRIDE2PAD1_DILATION_X;
+    conv_params.dilation.h = STRIDE2PAD1_DILATION_Y;
+
+    conv_params.input_offset = STRIDE2PAD1_INPUT_OFFSET;
+    conv_params.output_offset = STRIDE2PAD1_OUTPUT_OFFSET;
+    conv_params.activation.min = STRIDE2PAD1_OUT_ACTIVATION_MIN;
+    conv_params.activation.max = STRIDE2PAD1_OUT_ACTIVATION_MAX;
+    quant_params.multiplier = (int32_t *)stride2pad1_output_mult;
+    quant_params.shift = (int32_t *)stride2pad1_output_shift;
+
+    const int32_t buf_size =
+        arm_convolve_wrapper_s8_slice_get_buffer_size(&conv_params, &input_dims, &filter_dims, &output_dims);
+
+    for (int32_t num_workers = 1; num_workers <= MAX_TEST_WORKERS; num_workers++)
+    {
+        for (int32_t threaded = 0; threaded <= 1; threaded++)
+        {
+            int8_t output[STRIDE2PAD1_DST_SIZE] = {0};
+            const cmsis_nn_scheduler scheduler = make_scheduler(num_workers, buf_size, threaded);
+
+            const arm_cmsis_nn_status result = arm_convolve_wrapper_s8_parallel(&scheduler,
+                                                                                &conv_params,
+                                                                                &quant_params,
+                                                                                &input_dims,
+                                                                                stride2pad1_input,
+                                                                                &filter_dims,
+                                                                                stride2pad1_weights,
+                                                                                &bias_dims,
+                                                                                stride2pad1_biases,
+                                                                                &output_dims,
+                                                                                output);
+            free_scheduler(&scheduler);
+            TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+            TEST_ASSERT_TRUE(validate(output, stride2pad1_output_ref, STRIDE2PAD1_DST_SIZE));
+        }
+    }
+}
+
+void depthwise_mult_batches_arm_nn_parallel_s8(void)
+{
+    cmsis_nn_dw_conv_params dw_conv_params;
+    cmsis_nn_per_channel_quant_params quant_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims bias_dims = {0};
+    cmsis_nn_dims output_dims;
+
+    const int32_t *bias_data = get_bias_address(depthwise_mult_batches_biases, DEPTHWISE_MULT_BATCHES_OUT_CH);
+
+    input_dims.n = DEPTHWISE_MULT_BATCHES_INPUT_BATCHES;
+    input_dims.w = DEPTHWISE_MULT_BATCHES_INPUT_W;
+    input_dims.h = DEPTHWISE_MULT_BATCHES_INPUT_H;
+    input_dims.c = DEPTHWISE_MULT_BATCHES_IN_CH;
+    filter_dims.w = DEPTHWISE_MULT_BATCHES_FILTER_X;
+    filter_dims.h = DEPTHWISE_MULT_BATCHES_FILTER_Y;
+    output_dims.n = DEPTHWISE_MULT_BATCHES_INPUT_BATCHES;
+    output_dims.w = DEPTHWISE_MULT_BATCHES_OUTPUT_W;
+    output_dims.h = DEPTHWISE_MULT_BATCHES_OUTPUT_H;
+    output_dims.c = DEPTHWISE_MULT_BATCHES_OUT_CH;
+
+    dw_conv_params.padding.w = DEPTHWISE_MULT_BATCHES_PAD_X;
+    dw_conv_params.padding.h = DEPTHWISE_MULT_BATCHES_PAD_Y;
+    dw_conv_params.stride.w = DEPTHWISE_MULT_BATCHES_STRIDE_X;
+    dw_conv_params.stride.h = DEPTHWISE_MULT_BATCHES_STRIDE_Y;
+    dw_conv_params.dilation.w = DEPTHWISE_MULT_BATCHES_DILATION_X;
+    dw_conv_params.dilation.h = DEPTHWISE_MULT_BATCHES_DILATION_Y;
+
+    dw_conv_params.ch_mult = DEPTHWISE_MULT_BATCHES_CH_MULT;
+
+    dw_conv_params.input_offset = DEPTHWISE_MULT_BATCHES_INPUT_OFFSET;
+    dw_conv_params.output_offset = DEPTHWISE_MULT_BATCHES_OUTPUT_OFFSET;
+    dw_conv_params.activation.min = DEPTHWISE_MULT_BATCHES_OUT_ACTIVATION_MIN;
+    dw_conv_params.activation.max = DEPTHWISE_MULT_BATCHES_OUT_ACTIVATION_MAX;
+    quant_params.multiplier = (int32_t *)depthwise_mult_batches_output_mult;
+    quant_params.shift = (int32_t *)depthwise_mult_batches_output_shift;
+
+    const int32_t buf_size =
+        arm_depthwise_conv_wrapper_s8_slice_get_buffer_size(&dw_conv_params, &input_dims, &filter_dims, &output_dims);
+
+    for (int32_t num_workers = 1; num_workers <= MAX_TEST_WORKERS; num_workers++)
+    {
+        for (int32_t threaded = 0; threaded <= 1; threaded++)
+        {
+            int8_t output[DEPTHWISE_MULT_BATCHES_DST_SIZE] = {0};
+            const cmsis_nn_scheduler scheduler = make_scheduler(num_workers, buf_size, threaded);
+
+            const arm_cmsis_nn_status result = arm_depthwise_conv_wrapper_s8_parallel(&scheduler,
+                                                                                      &dw_conv_params,
+                                                                                      &quant_params,
+                                                                                      &input_dims,
+                                                                                      depthwise_mult_batches_input,
+                                                                                      &filter_dims,
+                                                                                      depthwise_mult_batches_weights,
+                                                                                      &bias_dims,
+                                                                                      bias_data,
+                                                                                      &output_dims,
+                                                                                      output);
+            free_scheduler(&scheduler);
+            TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+            TEST_ASSERT_TRUE(
+                validate(output, depthwise_mult_batches_output_ref, DEPTHWISE_MULT_BATCHES_DST_SIZE));
+        }
+    }
+}
+
+void fully_connected_arm_nn_parallel_s8(void)
+{
+    cmsis_nn_context ctx;
+    cmsis_nn_fc_params fc_params;
+    cmsis_nn_per_tensor_quant_params quant_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims bias_dims;
+    cmsis_nn_dims output_dims;
+
+    input_dims.n = FULLY_CONNECTED_INPUT_BATCHES;
+    input_dims.w = FULLY_CONNECTED_INPUT_W;
+    input_dims.h = FULLY_CONNECTED_INPUT_H;
+    input_dims.c = FULLY_CONNECTED_IN_CH;
+    filter_dims.n = FULLY_CONNECTED_ACCUMULATION_DEPTH;
+    filter_dims.c = FULLY_CONNECTED_OUT_CH;
+    output_dims.n = FULLY_CONNECTED_INPUT_BATCHES;
+    output_dims.c = FULLY_CONNECTED_OUT_CH;
+
+    fc_params.input_offset = FULLY_CONNECTED_INPUT_OFFSET;
+    fc_params.filter_offset = 0;
+    fc_params.output_offset = FULLY_CONNECTED_OUTPUT_OFFSET;
+    fc_params.activation.min = FULLY_CONNECTED_OUT_ACTIVATION_MIN;
+    fc_params.activation.max = FULLY_CONNECTED_OUT_ACTIVATION_MAX;
+
+    quant_params.multiplier = FULLY_CONNECTED_OUTPUT_MULTIPLIER;
+    quant_params.shift = FULLY_CONNECTED_OUTPUT_SHIFT;
+
+    const int32_t buf_size = arm_fully_connected_s8_get_buffer_size(&filter_dims);
+    ctx.buf = malloc(buf_size);
+    ctx.size = buf_size;
+
+#if defined(ARM_MATH_MVEI)
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS,
+                      arm_vector_sum_s8(ctx.buf,
+                                        filter_dims.n,
+                                        output_dims.c,
+                                        fully_connected_weights,
+                                        fc_params.input_offset,
+                                        fc_params.filter_offset,
+                                        fully_connected_biases));
+#endif
+
+    for (int32_t num_workers = 1; num_workers <= MAX_TEST_WORKERS; num_workers++)
+    {
+        for (int32_t threaded = 0; threaded <= 1; threaded++)
+        {
+            int8_t output[FULLY_CONNECTED_DST_SIZE] = {0};
+            const cmsis_nn_scheduler scheduler = make_scheduler(num_workers, 0, threaded);
+
+            const arm_cmsis_nn_status result = arm_fully_connected_s8_parallel(&scheduler,
+                                                                               &ctx,
+                                                                               &fc_params,
+                                                                               &quant_params,
+                                                                               &input_dims,
+                                                                               fully_connected_input,
+                                                                               &filter_dims,
+                                                                               fully_connected_weights,
+                                                                               &bias_dims,
+                                                                               fully_connected_biases,
+                                                                               &output_dims,
+                                                                               output);
+            free_scheduler(&scheduler);
+            TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+            TEST_ASSERT_TRUE(validate(output, fully_connected_output_ref, FULLY_CONNECTED_DST_SIZE));
+        }
+    }
+
+    if (ctx.buf)
+    {
+        memset(ctx.buf, 0, buf_size);
+        free(ctx.buf);
+    }
+}
+
+void avgpooling_arm_nn_parallel_s8(void)
+{
+    enum
+    {
+        OUTPUT_SIZE = AVGPOOLING_OUTPUT_W * AVGPOOLING_OUTPUT_H * AVGPOOLING_BATCH_SIZE * AVGPOOLING_OUTPUT_C
+    };
+
+    cmsis_nn_pool_params pool_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims output_dims;
+
+    input_dims.n = AVGPOOLING_BATCH_SIZE;
+    input_dims.w = AVGPOOLING_INPUT_W;
+    input_dims.h = AVGPOOLING_INPUT_H;
+    input_dims.c = AVGPOOLING_INPUT_C;
+    filter_dims.w = AVGPOOLING_FILTER_W;
+    filter_dims.h = AVGPOOLING_FILTER_H;
+    output_dims.w = AVGPOOLING_OUTPUT_W;
+    output_dims.h = AVGPOOLING_OUTPUT_H;
+    output_dims.c = AVGPOOLING_OUTPUT_C;
+
+    pool_params.padding.w = AVGPOOLING_PADDING_W;
+    pool_params.padding.h = AVGPOOLING_PADDING_H;
+    pool_params.stride.w = AVGPOOLING_STRIDE_W;
+    pool_params.stride.h = AVGPOOLING_STRIDE_H;
+
+    pool_params.activation.min = AVGPOOLING_ACTIVATION_MIN;
+    pool_params.activation.max = AVGPOOLING_ACTIVATION_MAX;
+
+    const int32_t buf_size = arm_avgpool_s8_get_buffer_size(AVGPOOLING_OUTPUT_W, AVGPOOLING_INPUT_C);
+
+    for (int32_t num_workers = 1; num_workers <= MAX_TEST_WORKERS; num_workers++)
+    {
+        for (int32_t threaded = 0; threaded <= 1; threaded++)
+        {
+            int8_t output[OUTPUT_SIZE] = {0};
+            const cmsis_nn_scheduler scheduler = make_scheduler(num_workers, buf_size, threaded);
+
+            const arm_cmsis_nn_status result = arm_avgpool_s8_parallel(
+                &scheduler, &pool_params, &input_dims, avgpooling_input_tensor, &filter_dims, &output_dims, output);
+            free_scheduler(&scheduler);
+            TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+            TEST_ASSERT_TRUE(validate(output, avgpooling_output, OUTPUT_SIZE));
+        }
+    }
+}
+
+void maxpooling_6_arm_nn_parallel_s8(void)
+{
+    enum
+    {
+        OUTPUT_SIZE = MAXPOOLING_6_OUTPUT_W * MAXPOOLING_6_OUTPUT_H * MAXPOOLING_6_INPUT_C * MAXPOOLING_6_BATCH_SIZE
+    };
+
+    cmsis_nn_pool_params pool_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims output_dims;
+
+    input_dims.n = MAXPOOLING_6_BATCH_SIZE;
+    input_dims.w = MAXPOOLING_6_INPUT_W;
+    input_dims.h = MAXPOOLING_6_INPUT_H;
+    input_dims.c = MAXPOOLING_6_INPUT_C;
+    filter_dims.w = MAXPOOLING_6_FILTER_W;
+    filter_dims.h = MAXPOOLING_6_FILTER_H;
+    output_dims.w = MAXPOOLING_6_OUTPUT_W;
+    output_dims.h = MAXPOOLING_6_OUTPUT_H;
+    output_dims.c = MAXPOOLING_6_INPUT_C;
+
+    pool_params.padding.w = MAXPOOLING_6_PADDING_W;
+    pool_params.padding.h = MAXPOOLING_6_PADDING_H;
+    pool_params.stride.w = MAXPOOLING_6_STRIDE_W;
+    pool_params.stride.h = MAXPOOLING_6_STRIDE_H;
+
+    pool_params.activation.min = MAXPOOLING_6_ACTIVATION_MIN;
+    pool_params.activation.max = MAXPOOLING_6_ACTIVATION_MAX;
+
+    for (int32_t num_workers = 1; num_workers <= MAX_TEST_WORKERS; num_workers++)
+    {
+        for (int32_t threaded = 0; threaded <= 1; threaded++)
+        {
+            int8_t output[OUTPUT_SIZE] = {0};
+            const cmsis_nn_scheduler scheduler = make_scheduler(num_workers, 0, threaded);
+
+            const arm_cmsis_nn_status result = arm_max_pool_s8_parallel(
+                &scheduler, &pool_params, &input_dims, maxpooling_6_input_tensor, &filter_dims, &output_dims, output);
+            free_scheduler(&scheduler);
+            TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+            TEST_ASSERT_TRUE(validate(output, maxpooling_6_output, OUTPUT_SIZE));
+        }
+    }
+}
+
+void param_fail_arm_nn_parallel_s8(void)
+{
+    cmsis_nn_context ctx = {NULL, 0};
+    cmsis_nn_pool_params pool_params = {{1, 1}, {0, 0}, {-128, 127}};
+    cmsis_nn_dims input_dims = {1, 4, 4, 1};
+    cmsis_nn_dims filter_dims = {1, 1, 1, 1};
+    cmsis_nn_dims output_dims = {1, 4, 4, 1};
+    int8_t input[16] = {0};
+    int8_t output[16] = {0};
+
+    const cmsis_nn_slice past_end = {2, 5};
+    TEST_ASSERT_EQUAL(
+        ARM_CMSIS_NN_ARG_ERROR,
+        arm_max_pool_s8_slice(&ctx, &pool_params, &input_dims, input, &filter_dims, &output_dims, output, &past_end));
+    const cmsis_nn_slice reversed = {3, 1};
+    TEST_ASSERT_EQUAL(
+        ARM_CMSIS_NN_ARG_ERROR,
+        arm_max_pool_s8_slice(&ctx, &pool_params, &input_dims, input, &filter_dims, &output_dims, output, &reversed));
+
+    cmsis_nn_scheduler scheduler = make_scheduler(1, 0, false);
+    scheduler.num_workers = CMSIS_NN_MAX_WORKERS + 1;
+    TEST_ASSERT_EQUAL(
+        ARM_CMSIS_NN_ARG_ERROR,
+        arm_max_pool_s8_parallel(&scheduler, &pool_params, &input_dims, input, &filter_dims, &output_dims, output));
+    scheduler.num_workers = 0;
+    TEST_ASSERT_EQUAL(
+        ARM_CMSIS_NN_ARG_ERROR,
+        arm_max_pool_s8_parallel(&scheduler, &pool_params, &input_dims, input, &filter_dims, &output_dims, output));
+}
+
+/*
+ * Times arm_convolve_wrapper_s8_parallel() on a 3x3 layer with 1, 2 and 4 threads and prints the speedup over one
+ * worker. The output of every run must match the single-threaded wrapper.
+ */
+void benchmark_arm_nn_parallel_s8(void)
+{
+    enum
+    {
+        IN_W = 48,
+        IN_H = 48,
+        IN_CH = 16,
+        OUT_CH = 32,
+        OUTPUT_SIZE = IN_W * IN_H * OUT_CH
+    };
+
+    cmsis_nn_context ctx;
+    cmsis_nn_conv_params conv_params;
+    cmsis_nn_per_channel_quant_params quant_params;
+    cmsis_nn_dims input_dims = {1, IN_H, IN_W, IN_CH};
+    cmsis_nn_dims filter_dims = {OUT_CH, 3, 3, IN_CH};
+    cmsis_nn_dims bias_dims = {1, 1, 1, OUT_CH};
+    cmsis_nn_dims output_dims = {1, IN_H, IN_W, OUT_CH};
+
+    int8_t *input = malloc(IN_W * IN_H * IN_CH);
+    int8_t *filter = malloc(OUT_CH * 9 * IN_CH);
+    int8_t *output_ref = malloc(OUTPUT_SIZE);
+    int8_t *output = malloc(OUTPUT_SIZE);
+    int32_t bias[OUT_CH];
+    int32_t multiplier[OUT_CH];
+    int32_t shift[OUT_CH];
+
+    srand(1);
+    for (int i = 0; i < IN_W * IN_H * IN_CH; i++)
+    {
+        input[i] = (int8_t)(rand() % 256 - 128);
+    }
+    for (int i = 0; i < OUT_CH * 9 * IN_CH; i++)
+    {
+        filter[i] = (int8_t)(rand() % 256 - 128);
+    }
+    for (int i = 0; i < OUT_CH; i++)
+    {
+        bias[i] = rand() % 20000 - 10000;
+        multiplier[i] = 0x40000000 + rand() % 0x3FFFFFFF;
+        shift[i] = -10 - rand() % 4;
+    }
+
+    conv_params.padding.w = 1;
+    conv_params.padding.h = 1;
+    conv_params.stride.w = 1;
+    conv_params.stride.h = 1;
+    conv_params.dilation.w = 1;
+    conv_params.dilation.h = 1;
+    conv_params.input_offset = 3;
+    conv_params.output_offset = -7;
+    conv_params.activation.min = -128;
+    conv_params.activation.max = 127;
+    quant_params.multiplier = multiplier;
+    quant_params.shift = shift;
+
+    const int32_t buf_size =
+        arm_convolve_wrapper_s8_slice_get_buffer_size(&conv_params, &input_dims, &filter_dims, &output_dims);
+    ctx.buf = malloc(buf_size);
+    ctx.size = buf_size;
+
+    const uint32_t start = get_cycle_count();
+    arm_cmsis_nn_status result = arm_convolve_wrapper_s8(&ctx,
+                                                         &conv_params,
+                                                         &quant_params,
+                                                         &input_dims,
+                                                         input,
+                                                         &filter_dims,
+                                                         filter,
+                                                         &bias_dims,
+                                                         bias,
+                                                         &output_dims,
+                                                         output_ref);
+    const uint32_t serial_cycles = get_cycle_count() - start;
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+    printf("3x3 conv %dx%dx%d -> %d: %u cycles on one core\n", IN_W, IN_H, IN_CH, OUT_CH, (unsigned)serial_cycles);
+
+#if defined(THREAD_SCHEDULER_AVAILABLE)
+    uint64_t single_us = 0;
+    for (int32_t num_workers = 1; num_workers <= MAX_TEST_WORKERS; num_workers *= 2)
+    {
+        const cmsis_nn_scheduler scheduler = make_scheduler(num_workers, buf_size, true);
+        memset(output, 0, OUTPUT_SIZE);
+
+        const uint64_t start_us = thread_scheduler_time_us();
+        result = arm_convolve_wrapper_s8_parallel(&scheduler,
+                                                  &conv_params,
+                                                  &quant_params,
+                                                  &input_dims,
+                                                  input,
+                                                  &filter_dims,
+                                                  filter,
+                                                  &bias_dims,
+                                                  bias,
+                                                  &output_dims,
+                                                  output);
+        const uint64_t elapsed_us = thread_scheduler_time_us() - start_us;
+        free_scheduler(&scheduler);
+        TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+        TEST_ASSERT_TRUE(validate(output, output_ref, OUTPUT_SIZE));
+
+        if (num_workers == 1)
+        {
+            single_us = elapsed_us;
+        }
+        printf("  %d worker(s): %llu us, speedup %.2f\n",
+               (int)num_workers,
+               (unsigned long long)elapsed_us,
+               elapsed_us > 0 ? (double)single_us / elapsed_us : 0.0);
+    }
+#endif
+
+    if (ctx.buf)
+    {
+        memset(ctx.buf, 0, buf_size);
+        free(ctx.buf);
+    }
+    free(input);
+    free(filter);
+    free(output_ref);
+    free(output);
+}
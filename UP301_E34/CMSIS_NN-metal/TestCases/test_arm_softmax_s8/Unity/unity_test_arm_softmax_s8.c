@@ -47,3 +47,11 @@ void tearDown(void) {}
 void test_softmax_arm_softmax_s8(void) { softmax_arm_softmax_s8(); }
 
 void test_softmax1_arm_softmax_s8(void) { softmax_invalid_diff_min_arm_softmax_s8(); }
+
+void test_softmax_lut_arm_softmax_s8(void) { softmax_lut_arm_softmax_s8(); }
+
+void test_softmax_lut_long_row_arm_softmax_s8(void) { softmax_lut_long_row_arm_softmax_s8(); }
+
+void test_softmax_top_k_arm_softmax_s8(void) { softmax_top_k_arm_softmax_s8(); }
+
+void test_softmax_top_k_invalid_k_arm_softmax_s8(void) { softmax_top_k_invalid_k_arm_softmax_s8(); }
@@ -64,3 +64,140 @@ void softmax_invalid_diff_min_arm_softmax_s8(void)
     }
     free(softmax_expect_invalid_output);
 }
+
+void softmax_lut_arm_softmax_s8(void)
+{
+    const int32_t num_rows = SOFTMAX_NUM_ROWS;
+    const int32_t row_size = SOFTMAX_ROW_SIZE;
+    const int8_t *input_data = softmax_input;
+    int32_t exp_lut[SOFTMAX_S8_EXP_LUT_SIZE];
+    int8_t output[SOFTMAX_DST_SIZE];
+
+    arm_cmsis_nn_status result =
+        arm_softmax_s8_exp_lut_init(SOFTMAX_INPUT_MULT, SOFTMAX_INPUT_LEFT_SHIFT, SOFTMAX_DIFF_MIN, exp_lut);
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+
+    for (int i = 0; i < REPEAT_NUM; i++)
+    {
+        arm_softmax_lut_s8(input_data, num_rows, row_size, exp_lut, output);
+        TEST_ASSERT_TRUE(validate(output, softmax_output_ref, SOFTMAX_DST_SIZE));
+    }
+}
+
+void softmax_lut_long_row_arm_softmax_s8(void)
+{
+    const int32_t num_rows = 3;
+    const int32_t row_sizes[2] = {40, 700};
+    const int32_t size = num_rows * row_sizes[1];
+    const int32_t diff_mins[2] = {SOFTMAX_DIFF_MIN, 0x7FFFFFFF};
+    int32_t exp_lut[SOFTMAX_S8_EXP_LUT_SIZE];
+
+    int8_t *input_data = malloc(size);
+    int8_t *output = malloc(size);
+    int8_t *output_ref = malloc(size);
+
+    srand(1);
+    for (int i = 0; i < size; i++)
+    {
+        input_data[i] = (int8_t)(rand() % 256 - 128);
+    }
+
+    for (int i = 0; i < 2; i++)
+    {
+        arm_softmax_s8_exp_lut_init(SOFTMAX_INPUT_MULT, SOFTMAX_INPUT_LEFT_SHIFT, diff_mins[i], exp_lut);
+
+        /* Rows both shorter and longer than the exponent table */
+        for (int j = 0; j < 2; j++)
+        {
+            arm_softmax_s8(input_data,
+                           num_rows,
+                           row_sizes[j],
+                           SOFTMAX_INPUT_MULT,
+                           SOFTMAX_INPUT_LEFT_SHIFT,
+                           diff_mins[i],
+                           output_ref);
+            arm_softmax_lut_s8(input_data, num_rows, row_sizes[j], exp_lut, output);
+            TEST_ASSERT_TRUE(validate(output, output_ref, num_rows * row_sizes[j]));
+        }
+    }
+
+    free(input_data);
+    free(output);
+    free(output_ref);
+}
+
+void softmax_top_k_arm_softmax_s8(void)
+{
+    const int32_t num_rows = 4;
+    const int32_t row_size = 300;
+    const int32_t k = 5;
+    int32_t exp_lut[SOFTMAX_S8_EXP_LUT_SIZE];
+    int8_t input_data[4 * 300];
+    int8_t output_ref[4 * 300];
+    int8_t scores[4 * 5];
+    int32_t indices[4 * 5];
+
+    /* Few distinct values so that equal inputs are common */
+    srand(2);
+    for (int i = 0; i < num_rows * row_size; i++)
+    {
+        input_data[i] = (int8_t)(rand() % 16 * 16 - 128);
+    }
+
+    arm_softmax_s8_exp_lut_init(SOFTMAX_INPUT_MULT, SOFTMAX_INPUT_LEFT_SHIFT, SOFTMAX_DIFF_MIN, exp_lut);
+    arm_softmax_s8(
+        input_data, num_rows, row_size, SOFTMAX_INPUT_MULT, SOFTMAX_INPUT_LEFT_SHIFT, SOFTMAX_DIFF_MIN, output_ref);
+
+    arm_cmsis_nn_status result = arm_softmax_top_k_s8(input_data, num_rows, row_size, exp_lut, k, scores, indices);
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+
+    for (int32_t row = 0; row < num_rows; row++)
+    {
+        const int8_t *in = input_data + row * row_size;
+        int32_t larger = 0;
+        for (int32_t i = 0; i < k; i++)
+        {
+            const int32_t idx = indices[row * k + i];
+            TEST_ASSERT_TRUE(idx >= 0 && idx < row_size);
+            TEST_ASSERT_EQUAL(output_ref[row * row_size + idx], scores[row * k + i]);
+            if (i > 0)
+            {
+                const int32_t prev = indices[row * k + i - 1];
+                TEST_ASSERT_TRUE(in[prev] > in[idx] || (in[prev] == in[idx] && prev < idx));
+            }
+        }
+
+        /* No element left out may be larger than the last one selected */
+        const int32_t last = indices[row * k + k - 1];
+        for (int32_t col = 0; col < row_size; col++)
+        {
+            larger += in[col] > in[last];
+        }
+        TEST_ASSERT_TRUE(larger < k);
+    }
+}
+
+void softmax_top_k_invalid_k_arm_softmax_s8(void)
+{
+    const int32_t num_rows = SOFTMAX_NUM_ROWS;
+    const int32_t row_size = SOFTMAX_ROW_SIZE;
+    int32_t exp_lut[SOFTMAX_S8_EXP_LUT_SIZE];
+    int8_t scores[SOFTMAX_DST_SIZE + SOFTMAX_NUM_ROWS];
+    int32_t indices[SOFTMAX_DST_SIZE + SOFTMAX_NUM_ROWS];
+
+    arm_softmax_s8_exp_lut_init(SOFTMAX_INPUT_MULT, SOFTMAX_INPUT_LEFT_SHIFT, SOFTMAX_DIFF_MIN, exp_lut);
+
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_ARG_ERROR,
+                      arm_softmax_top_k_s8(softmax_input, num_rows, row_size, exp_lut, 0, scores, indices));
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_ARG_ERROR,
+                      arm_softmax_top_k_s8(softmax_input, num_rows, row_size, exp_lut, row_size + 1, scores, indices));
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_ARG_ERROR, arm_softmax_s8_exp_lut_init(SOFTMAX_INPUT_MULT, 32, 0, exp_lut));
+
+    /* k equal to the row size sorts the whole row */
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS,
+                      arm_softmax_top_k_s8(softmax_input, num_rows, row_size, exp_lut, row_size, scores, indices));
+    TEST_ASSERT_EQUAL(0, indices[0]);
+    TEST_ASSERT_EQUAL(softmax_output_ref[0], scores[0]);
+    TEST_ASSERT_EQUAL(2, indices[row_size]);
+    TEST_ASSERT_EQUAL(softmax_output_ref[7], scores[row_size]);
+}
@@ -54,3 +54,11 @@ void test_transpose_ncwh_arm_transpose_s8(void) { transpose_ncwh_arm_transpose_s
 void test_transpose_nwhc_arm_transpose_s8(void) { transpose_nwhc_arm_transpose_s8(); }
 void test_transpose_3dim_arm_transpose_s8(void) { transpose_3dim_arm_transpose_s8(); }
 void test_transpose_3dim2_arm_transpose_s8(void) { transpose_3dim2_arm_transpose_s8(); }
+void test_transpose_default_arm_transpose_tiled_s8(void) { transpose_default_arm_transpose_tiled_s8(); }
+void test_transpose_chwn_arm_transpose_tiled_s8(void) { transpose_chwn_arm_transpose_tiled_s8(); }
+void test_transpose_matrix_arm_transpose_tiled_s8(void) { transpose_matrix_arm_transpose_tiled_s8(); }
+void test_transpose_3dim_arm_transpose_tiled_s8(void) { transpose_3dim_arm_transpose_tiled_s8(); }
+void test_transpose_5dim_arm_transpose_tiled_s8(void) { transpose_5dim_arm_transpose_tiled_s8(); }
+void test_transpose_5dim_merged_arm_transpose_tiled_s8(void) { transpose_5dim_merged_arm_transpose_tiled_s8(); }
+void test_transpose_5dim_rows_arm_transpose_tiled_s8(void) { transpose_5dim_rows_arm_transpose_tiled_s8(); }
+void test_transpose_invalid_perm_arm_transpose_tiled_s8(void) { transpose_invalid_perm_arm_transpose_tiled_s8(); }
@@ -252,3 +252,166 @@ void transpose_3dim2_arm_transpose_s8(void)
     TEST_ASSERT_EQUAL(expected, result);
     TEST_ASSERT_TRUE(validate(output_data, output_ref, output_ref_size));
 }
+
+static void transpose_tiled_s8(const int8_t *input_data,
+                               const int8_t *output_ref,
+                               const int32_t output_ref_size,
+                               const cmsis_nn_dims *input_dims,
+                               const uint32_t *perm,
+                               const int32_t num_dims)
+{
+    static int8_t output_data[TRANSPOSE_CHWN_SIZE];
+    const int32_t input_shape[4] = {input_dims->n, input_dims->h, input_dims->w, input_dims->c};
+    const cmsis_nn_transpose_params transpose_params = {num_dims, perm};
+
+    TEST_ASSERT_TRUE(output_ref_size <= TRANSPOSE_CHWN_SIZE);
+
+    arm_cmsis_nn_status result = arm_transpose_tiled_s8(input_data, output_data, input_shape, &transpose_params);
+
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+    TEST_ASSERT_TRUE(validate(output_data, output_ref, output_ref_size));
+}
+
+void transpose_default_arm_transpose_tiled_s8(void)
+{
+    const cmsis_nn_dims input_dims = TRANSPOSE_DEFAULT_IN_DIM;
+    const uint32_t perm[TRANSPOSE_DEFAULT_PERM_SIZE] = TRANSPOSE_DEFAULT_PERM;
+
+    transpose_tiled_s8(transpose_default_input_tensor,
+                       transpose_default_output,
+                       TRANSPOSE_DEFAULT_SIZE,
+                       &input_dims,
+                       perm,
+                       TRANSPOSE_DEFAULT_PERM_SIZE);
+}
+
+void transpose_chwn_arm_transpose_tiled_s8(void)
+{
+    const cmsis_nn_dims input_dims = TRANSPOSE_CHWN_IN_DIM;
+    const uint32_t perm[TRANSPOSE_CHWN_PERM_SIZE] = TRANSPOSE_CHWN_PERM;
+
+    transpose_tiled_s8(transpose_chwn_input_tensor,
+                       transpose_chwn_output,
+                       TRANSPOSE_CHWN_SIZE,
+                       &input_dims,
+                       perm,
+                       TRANSPOSE_CHWN_PERM_SIZE);
+}
+
+void transpose_matrix_arm_transpose_tiled_s8(void)
+{
+    const cmsis_nn_dims input_dims = TRANSPOSE_MATRIX_IN_DIM;
+    const uint32_t perm[TRANSPOSE_MATRIX_PERM_SIZE] = TRANSPOSE_MATRIX_PERM;
+
+    transpose_tiled_s8(transpose_matrix_input_tensor,
+                       transpose_matrix_output,
+                       TRANSPOSE_MATRIX_SIZE,
+                       &input_dims,
+                       perm,
+                       TRANSPOSE_MATRIX_PERM_SIZE);
+}
+
+void transpose_3dim_arm_transpose_tiled_s8(void)
+{
+    const cmsis_nn_dims input_dims = TRANSPOSE_3DIM_IN_DIM;
+    const uint32_t perm[TRANSPOSE_3DIM_PERM_SIZE] = TRANSPOSE_3DIM_PERM;
+
+    transpose_tiled_s8(transpose_3dim_input_tensor,
+                       transpose_3dim_output,
+                       TRANSPOSE_3DIM_SIZE,
+                       &input_dims,
+                       perm,
+                       TRANSPOSE_3DIM_PERM_SIZE);
+}
+
+/* Reference permutation of a 5D tensor, one element at a time */
+static void transpose_5dim_ref_s8(const int8_t *input, int8_t *output, const int32_t *shape, const uint32_t *perm)
+{
+    int32_t in_strides[5];
+    in_strides[4] = 1;
+    for (int32_t i = 3; i >= 0; i--)
+    {
+        in_strides[i] = in_strides[i + 1] * shape[i + 1];
+    }
+
+    int32_t idx[5];
+    for (idx[0] = 0; idx[0] < shape[perm[0]]; idx[0]++)
+    {
+        for (idx[1] = 0; idx[1] < shape[perm[1]]; idx[1]++)
+        {
+            for (idx[2] = 0; idx[2] < shape[perm[2]]; idx[2]++)
+            {
+                for (idx[3] = 0; idx[3] < shape[perm[3]]; idx[3]++)
+                {
+                    for (idx[4] = 0; idx[4] < shape[perm[4]]; idx[4]++)
+                    {
+                        int32_t offset = 0;
+                        for (int32_t i = 0; i < 5; i++)
+                        {
+                            offset += idx[i] * in_strides[perm[i]];
+                        }
+                        *output++ = input[offset];
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void transpose_5dim_tiled_s8(const int32_t *shape, const uint32_t *perm)
+{
+    static int8_t input_data[2048];
+    static int8_t output_data[2048];
+    static int8_t output_ref[2048];
+    const int32_t size = shape[0] * shape[1] * shape[2] * shape[3] * shape[4];
+    const cmsis_nn_transpose_params transpose_params = {5, perm};
+
+    TEST_ASSERT_TRUE(size <= 2048);
+    for (int32_t i = 0; i < size; i++)
+    {
+        input_data[i] = (int8_t)(i * 7 + 3);
+    }
+    transpose_5dim_ref_s8(input_data, output_ref, shape, perm);
+
+    arm_cmsis_nn_status result = arm_transpose_tiled_s8(input_data, output_data, shape, &transpose_params);
+
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_SUCCESS, result);
+    TEST_ASSERT_TRUE(validate(output_data, output_ref, size));
+}
+
+void transpose_5dim_arm_transpose_tiled_s8(void)
+{
+    const int32_t shape[5] = {2, 3, 5, 9, 7};
+    const uint32_t perm[5] = {4, 1, 3, 0, 2};
+
+    transpose_5dim_tiled_s8(shape, perm);
+}
+
+void transpose_5dim_merged_arm_transpose_tiled_s8(void)
+{
+    const int32_t shape[5] = {1, 17, 1, 13, 4};
+    const uint32_t perm[5] = {0, 3, 2, 4, 1};
+
+    transpose_5dim_tiled_s8(shape, perm);
+}
+
+void transpose_5dim_rows_arm_transpose_tiled_s8(void)
+{
+    const int32_t shape[5] = {2, 3, 4, 5, 6};
+    const uint32_t perm[5] = {3, 2, 1, 0, 4};
+
+    transpose_5dim_tiled_s8(shape, perm);
+}
+
+void transpose_invalid_perm_arm_transpose_tiled_s8(void)
+{
+    int8_t output_data[8];
+    const int8_t input_data[8] = {0};
+    const int32_t shape[3] = {2, 2, 2};
+    const uint32_t perm[3] = {0, 2, 2};
+    const cmsis_nn_transpose_params transpose_params = {3, perm};
+
+    arm_cmsis_nn_status result = arm_transpose_tiled_s8(input_data, output_data, shape, &transpose_params);
+
+    TEST_ASSERT_EQUAL(ARM_CMSIS_NN_ARG_ERROR, result);
+}
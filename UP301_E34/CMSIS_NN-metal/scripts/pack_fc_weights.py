@@ -0,0 +1,207 @@
+#!/usr/bin/env python3
+#
+# SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+"""Pack the int8 FULLY_CONNECTED weights of a .tflite model for arm_fully_connected_packed_s8.
+
+Every eligible filter buffer is replaced by the layout of arm_fully_connected_pack_weights_s8: a header, the kernel
+sums with the bias and input offset folded in, and the weight panels. The cmsis_nn TFLM kernel detects the header in
+Prepare. The indices of the rewritten buffers are listed in the model metadata entry CMSIS_NN_PACKED_WEIGHTS as
+little endian int32.
+
+A layer is skipped, and keeps its original weights, when any of these hold:
+  - input or filter is not int8, or the filter is not a constant 2D tensor
+  - the filter has a non-zero zero point or a non-default weights format
+  - the filter buffer is shared with another tensor
+  - the filter has fewer elements than the packed header
+
+Packed models only run with the cmsis_nn kernels.
+
+    pack_fc_weights.py model.tflite packed.tflite
+
+Needs the tensorflow Python package to read and write the model.
+"""
+
+import argparse
+import struct
+import sys
+
+# Keep in sync with arm_nnfunctions.h
+FC_PACKED_S8_PANEL_ROWS = 4
+FC_PACKED_S8_PANEL_COLS = 4
+CMSIS_NN_PACKED_WEIGHTS_MAGIC = 0x504E4E43
+CMSIS_NN_PACKED_WEIGHTS_VERSION = 1
+HEADER_FORMAT = "<6i"
+METADATA_NAME = "CMSIS_NN_PACKED_WEIGHTS"
+
+
+def packed_size(rows, cols):
+    """Same as arm_fully_connected_packed_s8_get_weights_size."""
+    padded_rows = -(-rows // FC_PACKED_S8_PANEL_ROWS) * FC_PACKED_S8_PANEL_ROWS
+    padded_cols = -(-cols // FC_PACKED_S8_PANEL_COLS) * FC_PACKED_S8_PANEL_COLS
+    return struct.calcsize(HEADER_FORMAT) + 4 * rows + padded_rows * padded_cols
+
+
+def pack_weights(weights, rows, cols, bias, input_offset):
+    """Same as arm_fully_connected_pack_weights_s8.
+
+    weights is a sequence of rows * cols int8 values in [rows, cols] order, bias a sequence of rows int32 values or
+    None. Returns the packed bytes.
+    """
+    out = bytearray(struct.pack(HEADER_FORMAT, CMSIS_NN_PACKED_WEIGHTS_MAGIC, CMSIS_NN_PACKED_WEIGHTS_VERSION, rows,
+                                cols, input_offset, FC_PACKED_S8_PANEL_ROWS))
+
+    for r in range(rows):
+        kernel_sum = input_offset * sum(weights[r * cols:(r + 1) * cols])
+        if bias is not None:
+            kernel_sum += bias[r]
+        if not -2**31 <= kernel_sum < 2**31:
+            raise ValueError(f"kernel sum of row {r} does not fit in int32")
+        out += struct.pack("<i", kernel_sum)
+
+    for i_row in range(0, rows, FC_PACKED_S8_PANEL_ROWS):
+        for i_col in range(0, cols, FC_PACKED_S8_PANEL_COLS):
+            for r in range(i_row, i_row + FC_PACKED_S8_PANEL_ROWS):
+                for c in range(i_col, i_col + FC_PACKED_S8_PANEL_COLS):
+                    value = weights[r * cols + c] if r < rows and c < cols else 0
+                    out.append(value & 0xFF)
+
+    assert len(out) == packed_size(rows, cols)
+    return bytes(out)
+
+
+def to_int8(data):
+    return [b - 256 if b > 127 else b for b in bytes(data)]
+
+
+def to_int32(data):
+    raw = bytes(data)
+    return list(struct.unpack(f"<{len(raw) // 4}i", raw))
+
+
+def pack_model(model, schema_fb, log):
+    """Rewrites the eligible filter buffers of model in place and returns their buffer indices."""
+    buffer_users = {}
+    for subgraph in model.subgraphs:
+        for tensor in subgraph.tensors:
+            buffer_users[tensor.buffer] = buffer_users.get(tensor.buffer, 0) + 1
+
+    def has_data(index):
+        buffer = model.buffers[index]
+        return index > 0 and buffer.data is not None and len(buffer.data) > 0
+
+    packed = []
+    for i_subgraph, subgraph in enumerate(model.subgraphs):
+        for i_op, op in enumerate(subgraph.operators):
+            opcode = model.operatorCodes[op.opcodeIndex]
+            if max(opcode.builtinCode, opcode.deprecatedBuiltinCode) != schema_fb.BuiltinOperator.FULLY_CONNECTED:
+                continue
+
+            name = f"subgraph {i_subgraph} operator {i_op}"
+            inputs = list(op.inputs)
+            input_tensor = subgraph.tensors[inputs[0]]
+            filter_tensor = subgraph.tensors[inputs[1]]
+            bias_index = inputs[2] if len(inputs) > 2 else -1
+            bias_tensor = subgraph.tensors[bias_index] if bias_index >= 0 else None
+            options = op.builtinOptions
+
+            def skip(reason):
+                log(f"{name}: skipped, {reason}")
+
+            if input_tensor.type != schema_fb.TensorType.INT8 or filter_tensor.type != schema_fb.TensorType.INT8:
+                skip("not int8")
+                continue
+            if filter_tensor.shape is None or len(filter_tensor.shape) != 2 or not has_data(filter_tensor.buffer):
+                skip("filter is not a constant 2D tensor")
+                continue
+            if options is not None and options.weightsFormat != schema_fb.FullyConnectedOptionsWeightsFormat.DEFAULT:
+                skip("weights format is not DEFAULT")
+                continue
+            filter_quant = filter_tensor.quantization
+            if filter_quant is not None and filter_quant.zeroPoint is not None and any(filter_quant.zeroPoint):
+                skip("filter zero point is not 0")
+                continue
+            if buffer_users[filter_tensor.buffer] > 1:
+                skip("filter buffer is shared")
+                continue
+            if bias_tensor is not None and (bias_tensor.type != schema_fb.TensorType.INT32
+                                            or not has_data(bias_tensor.buffer)):
+                skip("bias is not a constant int32 tensor")
+                continue
+
+            rows, cols = int(filter_tensor.shape[0]), int(filter_tensor.shape[1])
+            if rows * cols < struct.calcsize(HEADER_FORMAT):
+                skip("filter is smaller than the packed header")
+                continue
+
+            input_quant = input_tensor.quantization
+            input_zero_point = int(input_quant.zeroPoint[0]) if input_quant and input_quant.zeroPoint is not None else 0
+            weights = to_int8(model.buffers[filter_tensor.buffer].data)
+            bias = to_int32(model.buffers[bias_tensor.buffer].data) if bias_tensor is not None else None
+
+            data = pack_weights(weights, rows, cols, bias, -input_zero_point)
+            model.buffers[filter_tensor.buffer].data = bytearray(data)
+            packed.append(filter_tensor.buffer)
+            log(f"{name}: packed {rows}x{cols} filter in buffer {filter_tensor.buffer}")
+
+    return packed
+
+
+def add_metadata(model, schema_fb, packed):
+    buffer = schema_fb.BufferT()
+    buffer.data = bytearray(struct.pack(f"<{len(packed)}i", *packed))
+    model.buffers.append(buffer)
+
+    metadata = schema_fb.MetadataT()
+    metadata.name = METADATA_NAME
+    metadata.buffer = len(model.buffers) - 1
+    if model.metadata is None:
+        model.metadata = []
+    model.metadata = [m for m in model.metadata if m.name not in (METADATA_NAME, METADATA_NAME.encode())]
+    model.metadata.append(metadata)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="int8 .tflite model")
+    parser.add_argument("output", help="model with packed fully connected weights")
+    parser.add_argument("--quiet", action="store_true", help="only report errors")
+    args = parser.parse_args()
+
+    from tensorflow.lite.python import schema_py_generated as schema_fb
+    from tensorflow.lite.tools import flatbuffer_utils
+
+    def log(message):
+        if not args.quiet:
+            print(message)
+
+    model = flatbuffer_utils.read_model(args.input)
+    for metadata in model.metadata or []:
+        if metadata.name in (METADATA_NAME, METADATA_NAME.encode()):
+            print(f"{args.input} is already packed", file=sys.stderr)
+            return 1
+
+    packed = pack_model(model, schema_fb, log)
+    if packed:
+        add_metadata(model, schema_fb, packed)
+    flatbuffer_utils.write_model(model, args.output)
+    log(f"{len(packed)} fully connected filter(s) packed")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
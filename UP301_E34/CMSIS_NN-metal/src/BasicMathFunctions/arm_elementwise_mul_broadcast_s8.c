@@ -0,0 +1,152 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_elementwise_mul_broadcast_s8
+ * Description:  Broadcasting elementwise multiplication
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target :  Arm(R) M-Profile Architecture, RISC-V
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/* Multiplies every element of vect by the offset scalar operand scalar_term */
+static void mul_scalar_s8(const int32_t scalar_term,
+                          const int8_t *vect,
+                          const int32_t vect_offset,
+                          int8_t *output,
+                          const int32_t out_offset,
+                          const int32_t out_mult,
+                          const int32_t out_shift,
+                          const int32_t out_activation_min,
+                          const int32_t out_activation_max,
+                          const int32_t block_size)
+{
+    for (int32_t i = 0; i < block_size; i++)
+    {
+        int32_t mul_res = scalar_term * (vect[i] + vect_offset);
+        mul_res = arm_nn_requantize(mul_res, out_mult, out_shift) + out_offset;
+        mul_res = MAX(mul_res, out_activation_min);
+        mul_res = MIN(mul_res, out_activation_max);
+        output[i] = (int8_t)mul_res;
+    }
+}
+
+/**
+ *  @ingroup Public
+ */
+
+/**
+ * @addtogroup groupElementwise
+ * @{
+ */
+
+/*
+ * s8 elementwise multiplication with broadcast
+ *
+ * Refer header file for details.
+ *
+ */
+arm_cmsis_nn_status arm_elementwise_mul_broadcast_s8(const int8_t *input_1_vect,
+                                                     const cmsis_nn_dims *input_1_dims,
+                                                     const int8_t *input_2_vect,
+                                                     const cmsis_nn_dims *input_2_dims,
+                                                     const int32_t input_1_offset,
+                                                     const int32_t input_2_offset,
+                                                     int8_t *output,
+                                                     const cmsis_nn_dims *output_dims,
+                                                     const int32_t out_offset,
+                                                     const int32_t out_mult,
+                                                     const int32_t out_shift,
+                                                     const int32_t out_activation_min,
+                                                     const int32_t out_activation_max)
+{
+    cmsis_nn_broadcast bc;
+    if (arm_nn_broadcast_init(input_1_dims, input_2_dims, output_dims, &bc) != ARM_CMSIS_NN_SUCCESS)
+    {
+        return ARM_CMSIS_NN_ARG_ERROR;
+    }
+
+    for (int32_t i_0 = 0; i_0 < bc.outer_size[0]; i_0++)
+    {
+        for (int32_t i_1 = 0; i_1 < bc.outer_size[1]; i_1++)
+        {
+            for (int32_t i_2 = 0; i_2 < bc.outer_size[2]; i_2++)
+            {
+                const int8_t *in_1 = input_1_vect + i_0 * bc.outer_stride_1[0] + i_1 * bc.outer_stride_1[1] +
+                    i_2 * bc.outer_stride_1[2];
+                const int8_t *in_2 = input_2_vect + i_0 * bc.outer_stride_2[0] + i_1 * bc.outer_stride_2[1] +
+                    i_2 * bc.outer_stride_2[2];
+
+                if (bc.inner_stride_1 == bc.inner_stride_2)
+                {
+                    arm_elementwise_mul_s8(in_1,
+                                           in_2,
+                                           input_1_offset,
+                                           input_2_offset,
+                                           output,
+                                           out_offset,
+                                           out_mult,
+                                           out_shift,
+                                           out_activation_min,
+                                           out_activation_max,
+                                           bc.inner_size);
+                }
+                else if (bc.inner_stride_1 == 0)
+                {
+                    mul_scalar_s8(*in_1 + input_1_offset,
+                                  in_2,
+                                  input_2_offset,
+                                  output,
+                                  out_offset,
+                                  out_mult,
+                                  out_shift,
+                                  out_activation_min,
+                                  out_activation_max,
+                                  bc.inner_size);
+                }
+                else
+                {
+                    mul_scalar_s8(*in_2 + input_2_offset,
+                                  in_1,
+                                  input_1_offset,
+                                  output,
+                                  out_offset,
+                                  out_mult,
+                                  out_shift,
+                                  out_activation_min,
+                                  out_activation_max,
+                                  bc.inner_size);
+                }
+                output += bc.inner_size;
+            }
+        }
+    }
+
+    return ARM_CMSIS_NN_SUCCESS;
+}
+
+/**
+ * @} end of Doxygen group
+ */
@@ -119,9 +119,9 @@ int32_t arm_convolve_wrapper_s4_get_buffer_size(const cmsis_nn_conv_params *conv
 #if defined(ARM_MATH_MVEI)
     return arm_convolve_wrapper_s8_get_buffer_size_mve(conv_params, input_dims, filter_dims, output_dims);
 #else
-    (void)output_dims;
-    if ((conv_params->padding.w == 0) && (conv_params->padding.h == 0) && (filter_dims->w == 1) &&
-        (filter_dims->h == 1) && (conv_params->dilation.w == 1 && conv_params->dilation.h == 1))
+    if ((filter_dims->w == 1) && (filter_dims->h == 1) &&
+        (conv_params->dilation.w == 1 && conv_params->dilation.h == 1) &&
+        arm_nn_conv_is_unpadded(conv_params, input_dims, filter_dims, output_dims))
     {
         if ((conv_params->stride.w == 1) && (conv_params->stride.h == 1))
         {
@@ -145,9 +145,9 @@ int32_t arm_convolve_wrapper_s4_get_buffer_size_mve(const cmsis_nn_conv_params *
                                                     const cmsis_nn_dims *output_dims)
 
 {
-    (void)output_dims;
-    if ((conv_params->padding.w == 0) && (conv_params->padding.h == 0) && (filter_dims->w == 1) &&
-        (filter_dims->h == 1) && (conv_params->dilation.w == 1 && conv_params->dilation.h == 1))
+    if ((filter_dims->w == 1) && (filter_dims->h == 1) &&
+        (conv_params->dilation.w == 1 && conv_params->dilation.h == 1) &&
+        arm_nn_conv_is_unpadded(conv_params, input_dims, filter_dims, output_dims))
     {
         if ((conv_params->stride.w == 1) && (conv_params->stride.h == 1))
         {
@@ -159,7 +159,8 @@ int32_t arm_convolve_wrapper_s4_get_buffer_size_mve(const cmsis_nn_conv_params *
         }
     }
     else if ((input_dims->h == 1) && (conv_params->dilation.w == 1) && (filter_dims->h == 1) &&
-             (conv_params->stride.w * input_dims->c % 4 == 0))
+             (conv_params->stride.w * input_dims->c % 4 == 0) &&
+             arm_nn_conv_padding_is_balanced_x(conv_params, input_dims, filter_dims, output_dims))
     {
         return arm_convolve_1_x_n_s4_get_buffer_size_mve(conv_params, input_dims, filter_dims, output_dims);
     }
@@ -176,6 +177,25 @@ int32_t arm_convolve_wrapper_s4_get_buffer_size_dsp(const cmsis_nn_conv_params *
 {
     return arm_convolve_wrapper_s4_get_buffer_size(conv_params, input_dims, filter_dims, output_dims);
 }
+
+int32_t arm_convolve_s4_s4_get_buffer_size(const cmsis_nn_dims *input_dims,
+                                           const cmsis_nn_dims *filter_dims,
+                                           const cmsis_nn_dims *output_dims)
+{
+    const int32_t rhs_cols = filter_dims->w * filter_dims->h * input_dims->c;
+    const int32_t aligned_rhs_cols = (rhs_cols + 15) & ~15;
+
+    // 4 -> number of unpacked im2col columns and of int8 output rows packed per GEMM
+    return 4 * aligned_rhs_cols + 4 * output_dims->c;
+}
+
+int32_t arm_convolve_s4_s8_get_buffer_size(const cmsis_nn_dims *input_dims,
+                                           const cmsis_nn_dims *filter_dims,
+                                           const cmsis_nn_dims *output_dims)
+{
+    return arm_convolve_s4_s4_get_buffer_size(input_dims, filter_dims, output_dims);
+}
+
 /**
  * @} end of GetBufferSizeNNConv group
  */
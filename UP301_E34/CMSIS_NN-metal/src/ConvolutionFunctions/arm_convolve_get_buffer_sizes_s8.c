@@ -146,9 +146,9 @@ int32_t arm_convolve_wrapper_s8_get_buffer_size(const cmsis_nn_conv_params *conv
 #elif defined(ARM_MATH_DSP)
     return arm_convolve_wrapper_s8_get_buffer_size_dsp(conv_params, input_dims, filter_dims, output_dims);
 #else
-    (void)output_dims;
-    if ((conv_params->padding.w == 0) && (conv_params->padding.h == 0) && (filter_dims->w == 1) &&
-        (filter_dims->h == 1) && (conv_params->dilation.w == 1 && conv_params->dilation.h == 1))
+    if ((filter_dims->w == 1) && (filter_dims->h == 1) &&
+        (conv_params->dilation.w == 1 && conv_params->dilation.h == 1) &&
+        arm_nn_conv_is_unpadded(conv_params, input_dims, filter_dims, output_dims))
     {
         if ((conv_params->stride.w == 1) && (conv_params->stride.h == 1))
         {
@@ -160,7 +160,8 @@ int32_t arm_convolve_wrapper_s8_get_buffer_size(const cmsis_nn_conv_params *conv
         }
     }
     else if ((input_dims->h == 1) && (conv_params->dilation.w == 1) && (filter_dims->h == 1) &&
-             (conv_params->stride.w * input_dims->c % 4 == 0))
+             (conv_params->stride.w * input_dims->c % 4 == 0) &&
+             arm_nn_conv_padding_is_balanced_x(conv_params, input_dims, filter_dims, output_dims))
     {
         return arm_convolve_1_x_n_s8_get_buffer_size(conv_params, input_dims, filter_dims, output_dims);
     }
@@ -176,9 +177,9 @@ int32_t arm_convolve_wrapper_s8_get_buffer_size_mve(const cmsis_nn_conv_params *
                                                     const cmsis_nn_dims *filter_dims,
                                                     const cmsis_nn_dims *output_dims)
 {
-    (void)output_dims;
-    if ((conv_params->padding.w == 0) && (conv_params->padding.h == 0) && (filter_dims->w == 1) &&
-        (filter_dims->h == 1) && (conv_params->dilation.w == 1 && conv_params->dilation.h == 1))
+    if ((filter_dims->w == 1) && (filter_dims->h == 1) &&
+        (conv_params->dilation.w == 1 && conv_params->dilation.h == 1) &&
+        arm_nn_conv_is_unpadded(conv_params, input_dims, filter_dims, output_dims))
     {
         if ((conv_params->stride.w == 1) && (conv_params->stride.h == 1))
         {
@@ -190,7 +191,8 @@ int32_t arm_convolve_wrapper_s8_get_buffer_size_mve(const cmsis_nn_conv_params *
         }
     }
     else if ((input_dims->h == 1) && (conv_params->dilation.w == 1) && (filter_dims->h == 1) &&
-             (conv_params->stride.w * input_dims->c % 4 == 0))
+             (conv_params->stride.w * input_dims->c % 4 == 0) &&
+             arm_nn_conv_padding_is_balanced_x(conv_params, input_dims, filter_dims, output_dims))
     {
         return arm_convolve_1_x_n_s8_get_buffer_size_mve(conv_params, input_dims, filter_dims, output_dims);
     }
@@ -205,9 +207,9 @@ int32_t arm_convolve_wrapper_s8_get_buffer_size_dsp(const cmsis_nn_conv_params *
                                                     const cmsis_nn_dims *filter_dims,
                                                     const cmsis_nn_dims *output_dims)
 {
-    (void)output_dims;
-    if ((conv_params->padding.w == 0) && (conv_params->padding.h == 0) && (filter_dims->w == 1) &&
-        (filter_dims->h == 1) && (conv_params->dilation.w == 1 && conv_params->dilation.h == 1))
+    if ((filter_dims->w == 1) && (filter_dims->h == 1) &&
+        (conv_params->dilation.w == 1 && conv_params->dilation.h == 1) &&
+        arm_nn_conv_is_unpadded(conv_params, input_dims, filter_dims, output_dims))
     {
         if ((conv_params->stride.w == 1) && (conv_params->stride.h == 1))
         {
@@ -219,7 +221,8 @@ int32_t arm_convolve_wrapper_s8_get_buffer_size_dsp(const cmsis_nn_conv_params *
         }
     }
     else if ((input_dims->h == 1) && (conv_params->dilation.w == 1) && (filter_dims->h == 1) &&
-             (conv_params->stride.w * input_dims->c % 4 == 0))
+             (conv_params->stride.w * input_dims->c % 4 == 0) &&
+             arm_nn_conv_padding_is_balanced_x(conv_params, input_dims, filter_dims, output_dims))
     {
         return arm_convolve_1_x_n_s8_get_buffer_size(conv_params, input_dims, filter_dims, output_dims);
     }
@@ -0,0 +1,245 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_convolve_implicit_s8.c
+ * Description:  s8 convolution without an im2col buffer (implicit GEMM)
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target :  Arm(R) M-Profile Architecture, RISC-V
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup Public
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+static int8_t requantize_clamp_s8(const int32_t acc,
+                                  const int32_t multiplier,
+                                  const int32_t shift,
+                                  const int32_t out_offset,
+                                  const int32_t activation_min,
+                                  const int32_t activation_max)
+{
+    int32_t result = arm_nn_requantize(acc, multiplier, shift) + out_offset;
+    result = MAX(result, activation_min);
+    result = MIN(result, activation_max);
+    return (int8_t)result;
+}
+
+/*
+ * s8 convolution reading the input tensor in place.
+ *
+ * Refer header file for details. Padded positions contribute zero after the input offset is applied, so instead of
+ * materialising them the kernel window is clamped to the valid input rows and columns once per output pixel. Four
+ * output channels are accumulated per pass over the window to reuse every input load.
+ *
+ */
+arm_cmsis_nn_status arm_convolve_implicit_s8(const cmsis_nn_context *ctx,
+                                             const cmsis_nn_conv_params *conv_params,
+                                             const cmsis_nn_per_channel_quant_params *quant_params,
+                                             const cmsis_nn_dims *input_dims,
+                                             const int8_t *input_data,
+                                             const cmsis_nn_dims *filter_dims,
+                                             const int8_t *filter_data,
+                                             const cmsis_nn_dims *bias_dims,
+                                             const int32_t *bias_data,
+                                             const cmsis_nn_dims *output_dims,
+                                             int8_t *output_data)
+{
+    (void)ctx;
+    (void)bias_dims;
+
+    const int32_t input_batches = input_dims->n;
+    const int32_t input_x = input_dims->w;
+    const int32_t input_y = input_dims->h;
+    const int32_t input_ch = input_dims->c;
+    const int32_t kernel_x = filter_dims->w;
+    const int32_t kernel_y = filter_dims->h;
+    const int32_t kernel_ch = filter_dims->c;
+    const int32_t output_x = output_dims->w;
+    const int32_t output_y = output_dims->h;
+    const int32_t output_ch = output_dims->c;
+
+    const int32_t pad_x = conv_params->padding.w;
+    const int32_t pad_y = conv_params->padding.h;
+    const int32_t stride_x = conv_params->stride.w;
+    const int32_t stride_y = conv_params->stride.h;
+    const int32_t dilation_x = conv_params->dilation.w;
+    const int32_t dilation_y = conv_params->dilation.h;
+    const int32_t input_offset = conv_params->input_offset;
+    const int32_t out_offset = conv_params->output_offset;
+    const int32_t out_activation_min = conv_params->activation.min;
+    const int32_t out_activation_max = conv_params->activation.max;
+
+    const int32_t *output_mult = quant_params->multiplier;
+    const int32_t *output_shift = quant_params->shift;
+
+    if (kernel_ch <= 0 || input_ch % kernel_ch != 0)
+    {
+        return ARM_CMSIS_NN_ARG_ERROR;
+    }
+
+    const int32_t groups = input_ch / kernel_ch;
+    const int32_t rhs_cols = kernel_x * kernel_y * kernel_ch;
+
+    if (output_ch % groups != 0)
+    {
+        return ARM_CMSIS_NN_ARG_ERROR;
+    }
+    const int32_t output_ch_per_group = output_ch / groups;
+
+    for (int32_t i_batch = 0; i_batch < input_batches; i_batch++)
+    {
+        for (int32_t i_out_y = 0; i_out_y < output_y; i_out_y++)
+        {
+            const int32_t base_idx_y = stride_y * i_out_y - pad_y;
+            const int32_t ker_y_start = base_idx_y < 0 ? (dilation_y - 1 - base_idx_y) / dilation_y : 0;
+            const int32_t ker_y_end = MIN(kernel_y, (input_y - base_idx_y + dilation_y - 1) / dilation_y);
+
+            for (int32_t i_out_x = 0; i_out_x < output_x; i_out_x++)
+            {
+                const int32_t base_idx_x = stride_x * i_out_x - pad_x;
+                const int32_t ker_x_start = base_idx_x < 0 ? (dilation_x - 1 - base_idx_x) / dilation_x : 0;
+                const int32_t ker_x_end = MIN(kernel_x, (input_x - base_idx_x + dilation_x - 1) / dilation_x);
+
+                for (int32_t i_group = 0; i_group < groups; i_group++)
+                {
+                    const int32_t ch_base = i_group * output_ch_per_group;
+                    const int8_t *input_base = input_data + i_group * kernel_ch;
+                    const int8_t *filter_base = filter_data + ch_base * rhs_cols;
+
+                    int32_t i_out_ch = 0;
+                    for (; i_out_ch <= output_ch_per_group - 4; i_out_ch += 4)
+                    {
+                        const int32_t out_ch = ch_base + i_out_ch;
+                        int32_t acc_0 = 0;
+                        int32_t acc_1 = 0;
+                        int32_t acc_2 = 0;
+                        int32_t acc_3 = 0;
+                        if (bias_data)
+                        {
+                            acc_0 = bias_data[out_ch];
+                            acc_1 = bias_data[out_ch + 1];
+                            acc_2 = bias_data[out_ch + 2];
+                            acc_3 = bias_data[out_ch + 3];
+                        }
+
+                        const int8_t *ker_0 = filter_base + i_out_ch * rhs_cols;
+                        for (int32_t i_ker_y = ker_y_start; i_ker_y < ker_y_end; i_ker_y++)
+                        {
+                            const int32_t k_y = base_idx_y + dilation_y * i_ker_y;
+                            for (int32_t i_ker_x = ker_x_start; i_ker_x < ker_x_end; i_ker_x++)
+                            {
+                                const int32_t k_x = base_idx_x + dilation_x * i_ker_x;
+                                const int8_t *ip = input_base + (k_y * input_x + k_x) * input_ch;
+                                const int8_t *ker = ker_0 + (i_ker_y * kernel_x + i_ker_x) * kernel_ch;
+
+                                for (int32_t i_ch = 0; i_ch < kernel_ch; i_ch++)
+                                {
+                                    const int32_t in = ip[i_ch] + input_offset;
+                                    acc_0 += in * ker[i_ch];
+                                    acc_1 += in * ker[i_ch + rhs_cols];
+                                    acc_2 += in * ker[i_ch + 2 * rhs_cols];
+                                    acc_3 += in * ker[i_ch + 3 * rhs_cols];
+                                }
+                            }
+                        }
+
+                        int8_t *out = output_data + out_ch;
+                        out[0] = requantize_clamp_s8(acc_0,
+                                                     output_mult[out_ch],
+                                                     output_shift[out_ch],
+                                                     out_offset,
+                                                     out_activation_min,
+                                                     out_activation_max);
+                        out[1] = requantize_clamp_s8(acc_1,
+                                                     output_mult[out_ch + 1],
+                                                     output_shift[out_ch + 1],
+                                                     out_offset,
+                                                     out_activation_min,
+                                                     out_activation_max);
+                        out[2] = requantize_clamp_s8(acc_2,
+                                                     output_mult[out_ch + 2],
+                                                     output_shift[out_ch + 2],
+                                                     out_offset,
+                                                     out_activation_min,
+                                                     out_activation_max);
+                        out[3] = requantize_clamp_s8(acc_3,
+                                                     output_mult[out_ch + 3],
+                                                     output_shift[out_ch + 3],
+                                                     out_offset,
+                                                     out_activation_min,
+                                                     out_activation_max);
+                    }
+
+                    for (; i_out_ch < output_ch_per_group; i_out_ch++)
+                    {
+                        const int32_t out_ch = ch_base + i_out_ch;
+                        int32_t acc = bias_data ? bias_data[out_ch] : 0;
+
+                        const int8_t *ker_0 = filter_base + i_out_ch * rhs_cols;
+                        for (int32_t i_ker_y = ker_y_start; i_ker_y < ker_y_end; i_ker_y++)
+                        {
+                            const int32_t k_y = base_idx_y + dilation_y * i_ker_y;
+                            for (int32_t i_ker_x = ker_x_start; i_ker_x < ker_x_end; i_ker_x++)
+                            {
+                                const int32_t k_x = base_idx_x + dilation_x * i_ker_x;
+                                const int8_t *ip = input_base + (k_y * input_x + k_x) * input_ch;
+                                const int8_t *ker = ker_0 + (i_ker_y * kernel_x + i_ker_x) * kernel_ch;
+
+                                for (int32_t i_ch = 0; i_ch < kernel_ch; i_ch++)
+                                {
+                                    acc += (ip[i_ch] + input_offset) * ker[i_ch];
+                                }
+                            }
+                        }
+
+                        output_data[out_ch] = requantize_clamp_s8(acc,
+                                                                  output_mult[out_ch],
+                                                                  output_shift[out_ch],
+                                                                  out_offset,
+                                                                  out_activation_min,
+                                                                  out_activation_max);
+                    }
+                }
+                output_data += output_ch;
+            }
+        }
+        /* Advance to the next batch */
+        input_data += input_x * input_y * input_ch;
+    }
+
+    /* Return to application */
+    return ARM_CMSIS_NN_SUCCESS;
+}
+
+/**
+ * @} end of NNConv group
+ */
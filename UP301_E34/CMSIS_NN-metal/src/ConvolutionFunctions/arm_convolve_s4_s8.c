@@ -0,0 +1,185 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_convolve_s4_s8.c
+ * Description:  Convolution with packed int4 activations and int8 weights
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target :  Arm(R) M-Profile Architecture, RISC-V
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup Public
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/*
+ * Basic convolution function with packed int4 activations and int8 weights.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_cmsis_nn_status arm_convolve_s4_s8(const cmsis_nn_context *ctx,
+                                       const cmsis_nn_conv_params *conv_params,
+                                       const cmsis_nn_per_channel_quant_params *quant_params,
+                                       const cmsis_nn_dims *input_dims,
+                                       const int8_t *input_data,
+                                       const cmsis_nn_dims *filter_dims,
+                                       const int8_t *filter_data,
+                                       const cmsis_nn_dims *bias_dims,
+                                       const int32_t *bias_data,
+                                       const cmsis_nn_dims *output_dims,
+                                       int8_t *output_data)
+{
+    (void)bias_dims;
+
+    if (ctx->buf == NULL)
+    {
+        return ARM_CMSIS_NN_ARG_ERROR;
+    }
+
+    const int32_t input_batches = input_dims->n;
+    const int32_t input_x = input_dims->w;
+    const int32_t input_y = input_dims->h;
+    const int32_t input_ch = input_dims->c;
+    const int32_t kernel_x = filter_dims->w;
+    const int32_t kernel_y = filter_dims->h;
+    const int32_t output_x = output_dims->w;
+    const int32_t output_y = output_dims->h;
+    const int32_t output_ch = output_dims->c;
+
+    const int32_t pad_x = conv_params->padding.w;
+    const int32_t pad_y = conv_params->padding.h;
+    const int32_t stride_x = conv_params->stride.w;
+    const int32_t stride_y = conv_params->stride.h;
+    const int32_t dilation_x = conv_params->dilation.w;
+    const int32_t dilation_y = conv_params->dilation.h;
+    const int32_t out_offset = conv_params->output_offset;
+    const int32_t out_activation_min = conv_params->activation.min;
+    const int32_t out_activation_max = conv_params->activation.max;
+    const int32_t input_offset = conv_params->input_offset;
+    const int32_t rhs_cols = kernel_x * kernel_y * input_ch;
+    const int32_t aligned_rhs_cols = (rhs_cols + 15) & ~15;
+
+    int32_t *output_mult = quant_params->multiplier;
+    int32_t *output_shift = quant_params->shift;
+
+    /* Up to four unpacked im2col columns followed by their int8 results, which are packed into the output */
+    int8_t *im2col = (int8_t *)ctx->buf;
+    int8_t *out_buf = im2col + 4 * aligned_rhs_cols;
+    int32_t out_pos = 0;
+
+    for (int32_t i_batch = 0; i_batch < input_batches; i_batch++)
+    {
+        const int32_t input_pos = i_batch * input_x * input_y * input_ch;
+        int32_t lhs_rows = 0;
+
+        for (int32_t i_out_y = 0; i_out_y < output_y; i_out_y++)
+        {
+            for (int32_t i_out_x = 0; i_out_x < output_x; i_out_x++)
+            {
+                const int32_t base_idx_x = stride_x * i_out_x - pad_x;
+                const int32_t base_idx_y = stride_y * i_out_y - pad_y;
+                int8_t *im2col_buf = im2col + lhs_rows * aligned_rhs_cols;
+
+                for (int32_t i_ker_y = 0; i_ker_y < kernel_y; i_ker_y++)
+                {
+                    for (int32_t i_ker_x = 0; i_ker_x < kernel_x; i_ker_x++)
+                    {
+                        const int32_t k_y = base_idx_y + dilation_y * i_ker_y;
+                        const int32_t k_x = base_idx_x + dilation_x * i_ker_x;
+
+                        if (k_y < 0 || k_y >= input_y || k_x < 0 || k_x >= input_x)
+                        {
+                            arm_memset_s8(im2col_buf, (int8_t)-input_offset, sizeof(int8_t) * input_ch);
+                        }
+                        else
+                        {
+                            arm_nn_unpack_s4(
+                                input_data, input_pos + (k_y * input_x + k_x) * input_ch, input_ch, im2col_buf);
+                        }
+                        im2col_buf += input_ch;
+                    }
+                }
+                lhs_rows++;
+
+                if (lhs_rows == 4)
+                {
+                    arm_nn_mat_mult_nt_t_s8(im2col,
+                                            filter_data,
+                                            bias_data,
+                                            out_buf,
+                                            output_mult,
+                                            output_shift,
+                                            lhs_rows,
+                                            output_ch,
+                                            rhs_cols,
+                                            input_offset,
+                                            out_offset,
+                                            out_activation_min,
+                                            out_activation_max,
+                                            output_ch,
+                                            aligned_rhs_cols);
+                    arm_nn_pack_s4(out_buf, lhs_rows * output_ch, output_data, out_pos);
+                    out_pos += lhs_rows * output_ch;
+                    lhs_rows = 0;
+                }
+            }
+        }
+
+        /* Handle left over columns */
+        if (lhs_rows != 0)
+        {
+            arm_nn_mat_mult_nt_t_s8(im2col,
+                                    filter_data,
+                                    bias_data,
+                                    out_buf,
+                                    output_mult,
+                                    output_shift,
+                                    lhs_rows,
+                                    output_ch,
+                                    rhs_cols,
+                                    input_offset,
+                                    out_offset,
+                                    out_activation_min,
+                                    out_activation_max,
+                                    output_ch,
+                                    aligned_rhs_cols);
+            arm_nn_pack_s4(out_buf, lhs_rows * output_ch, output_data, out_pos);
+            out_pos += lhs_rows * output_ch;
+        }
+    }
+
+    return ARM_CMSIS_NN_SUCCESS;
+}
+
+/**
+ * @} end of NNConv group
+ */
@@ -0,0 +1,296 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_convolve_winograd_s8.c
+ * Description:  s8 3x3 stride 1 convolution in the Winograd F(2x2, 3x3) domain
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target :  Arm(R) M-Profile Architecture, RISC-V
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup Public
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/*
+ * The filter is transformed with G' = 2 * G, G' = [2 0 0; 1 1 1; 1 -1 1; 0 0 2], so U' = G' g G'^T = 4 * U is an
+ * integer. The input transform B^T d B and the output transform A^T M A are integer by construction, so the output
+ * tile is exactly 4 times the direct convolution and is divided back without rounding. All intermediate values are
+ * integers, which makes the result bit-exact against arm_convolve_s8.
+ *
+ * Ranges: |U'| <= 9 * 128 = 1152 and |V| <= 4 * 255 = 1020 fit int16. The channel sum of U' * V is below
+ * 2^31 for up to WINOGRAD_MAX_INPUT_CH channels. The output transform is done modulo 2^32: only its final value,
+ * 4 * (9 * C_IN * 128 * 255) at most, has to fit int32.
+ */
+#define WINOGRAD_MAX_INPUT_CH (1024)
+#define WINOGRAD_TILE_ELEMENTS (16)
+
+int32_t arm_convolve_winograd_s8_get_filter_size(const cmsis_nn_conv_params *conv_params,
+                                                 const cmsis_nn_dims *input_dims,
+                                                 const cmsis_nn_dims *filter_dims,
+                                                 const cmsis_nn_dims *output_dims)
+{
+    if (filter_dims->w != 3 || filter_dims->h != 3 || conv_params->stride.w != 1 || conv_params->stride.h != 1 ||
+        conv_params->dilation.w != 1 || conv_params->dilation.h != 1 || input_dims->c != filter_dims->c ||
+        input_dims->c > WINOGRAD_MAX_INPUT_CH)
+    {
+        return 0;
+    }
+    return WINOGRAD_TILE_ELEMENTS * input_dims->c * output_dims->c * (int32_t)sizeof(int16_t);
+}
+
+int32_t arm_convolve_winograd_s8_get_buffer_size(const cmsis_nn_dims *input_dims)
+{
+    return WINOGRAD_TILE_ELEMENTS * input_dims->c * (int32_t)sizeof(int16_t);
+}
+
+arm_cmsis_nn_status arm_convolve_winograd_s8_transform_filter(const cmsis_nn_dims *filter_dims,
+                                                              const cmsis_nn_dims *output_dims,
+                                                              const int8_t *filter_data,
+                                                              int16_t *winograd_filter_data)
+{
+    if (filter_dims->w != 3 || filter_dims->h != 3)
+    {
+        return ARM_CMSIS_NN_ARG_ERROR;
+    }
+    const int32_t input_ch = filter_dims->c;
+
+    for (int32_t out_c = 0; out_c < output_dims->c; out_c++)
+    {
+        const int8_t *g = filter_data + out_c * 9 * input_ch;
+        for (int32_t in_c = 0; in_c < input_ch; in_c++)
+        {
+            int32_t tmp[4][3];
+            for (int32_t j = 0; j < 3; j++)
+            {
+                const int32_t g0 = g[(0 * 3 + j) * input_ch + in_c];
+                const int32_t g1 = g[(1 * 3 + j) * input_ch + in_c];
+                const int32_t g2 = g[(2 * 3 + j) * input_ch + in_c];
+                tmp[0][j] = 2 * g0;
+                tmp[1][j] = g0 + g1 + g2;
+                tmp[2][j] = g0 - g1 + g2;
+                tmp[3][j] = 2 * g2;
+            }
+            int16_t *u = winograd_filter_data;
+            for (int32_t i = 0; i < 4; i++)
+            {
+                u[i * 4 + 0] = (int16_t)(2 * tmp[i][0]);
+                u[i * 4 + 1] = (int16_t)(tmp[i][0] + tmp[i][1] + tmp[i][2]);
+                u[i * 4 + 2] = (int16_t)(tmp[i][0] - tmp[i][1] + tmp[i][2]);
+                u[i * 4 + 3] = (int16_t)(2 * tmp[i][2]);
+            }
+            winograd_filter_data += WINOGRAD_TILE_ELEMENTS;
+        }
+    }
+    return ARM_CMSIS_NN_SUCCESS;
+}
+
+/*
+ * Loads the 4x4 input tile of one channel with the input offset applied. Positions in the padding read as zero,
+ * which is what the offset input value of a padded element is.
+ */
+static void load_tile(const int8_t *input,
+                      const int32_t input_x,
+                      const int32_t input_y,
+                      const int32_t input_ch,
+                      const int32_t base_x,
+                      const int32_t base_y,
+                      const int32_t input_offset,
+                      int32_t *d)
+{
+    if (base_x >= 0 && base_y >= 0 && base_x + 4 <= input_x && base_y + 4 <= input_y)
+    {
+        const int8_t *src = input + (base_y * input_x + base_x) * input_ch;
+        for (int32_t i = 0; i < 4; i++)
+        {
+            d[i * 4 + 0] = src[0] + input_offset;
+            d[i * 4 + 1] = src[input_ch] + input_offset;
+            d[i * 4 + 2] = src[2 * input_ch] + input_offset;
+            d[i * 4 + 3] = src[3 * input_ch] + input_offset;
+            src += input_x * input_ch;
+        }
+        return;
+    }
+
+    for (int32_t i = 0; i < 4; i++)
+    {
+        const int32_t y = base_y + i;
+        for (int32_t j = 0; j < 4; j++)
+        {
+            const int32_t x = base_x + j;
+            if (y < 0 || y >= input_y || x < 0 || x >= input_x)
+            {
+                d[i * 4 + j] = 0;
+            }
+            else
+            {
+                d[i * 4 + j] = input[(y * input_x + x) * input_ch] + input_offset;
+            }
+        }
+    }
+}
+
+/*
+ * s8 Winograd F(2x2, 3x3) convolution
+ *
+ * Refer header file for details.
+ *
+ */
+arm_cmsis_nn_status arm_convolve_winograd_s8(const cmsis_nn_context *ctx,
+                                             const cmsis_nn_conv_params *conv_params,
+                                             const cmsis_nn_per_channel_quant_params *quant_params,
+                                             const cmsis_nn_dims *input_dims,
+                                             const int8_t *input_data,
+                                             const cmsis_nn_dims *filter_dims,
+                                             const int16_t *winograd_filter_data,
+                                             const cmsis_nn_dims *bias_dims,
+                                             const int32_t *bias_data,
+                                             const cmsis_nn_dims *output_dims,
+                                             int8_t *output_data)
+{
+    (void)bias_dims;
+
+    if (ctx->buf == NULL ||
+        arm_convolve_winograd_s8_get_filter_size(conv_params, input_dims, filter_dims, output_dims) == 0)
+    {
+        return ARM_CMSIS_NN_ARG_ERROR;
+    }
+
+    int16_t *v_buf = (int16_t *)ctx->buf;
+
+    const int32_t input_batches = input_dims->n;
+    const int32_t input_x = input_dims->w;
+    const int32_t input_y = input_dims->h;
+    const int32_t input_ch = input_dims->c;
+    const int32_t output_x = output_dims->w;
+    const int32_t output_y = output_dims->h;
+    const int32_t output_ch = output_dims->c;
+    const int32_t pad_x = conv_params->padding.w;
+    const int32_t pad_y = conv_params->padding.h;
+    const int32_t input_offset = conv_params->input_offset;
+    const int32_t out_offset = conv_params->output_offset;
+    const int32_t out_activation_min = conv_params->activation.min;
+    const int32_t out_activation_max = conv_params->activation.max;
+    const int32_t *output_mult = quant_params->multiplier;
+    const int32_t *output_shift = quant_params->shift;
+
+    for (int32_t i_batch = 0; i_batch < input_batches; i_batch++)
+    {
+        for (int32_t out_y = 0; out_y < output_y; out_y += 2)
+        {
+            for (int32_t out_x = 0; out_x < output_x; out_x += 2)
+            {
+                // Input transform V = B^T d B for every input channel of this tile
+                int16_t *v = v_buf;
+                for (int32_t in_c = 0; in_c < input_ch; in_c++)
+                {
+                    int32_t d[WINOGRAD_TILE_ELEMENTS];
+                    load_tile(input_data + in_c, input_x, input_y, input_ch, out_x - pad_x, out_y - pad_y,
+                              input_offset, d);
+
+                    int32_t t[WINOGRAD_TILE_ELEMENTS];
+                    for (int32_t j = 0; j < 4; j++)
+                    {
+                        t[0 * 4 + j] = d[0 * 4 + j] - d[2 * 4 + j];
+                        t[1 * 4 + j] = d[1 * 4 + j] + d[2 * 4 + j];
+                        t[2 * 4 + j] = d[2 * 4 + j] - d[1 * 4 + j];
+                        t[3 * 4 + j] = d[1 * 4 + j] - d[3 * 4 + j];
+                    }
+                    for (int32_t i = 0; i < 4; i++)
+                    {
+                        v[i * 4 + 0] = (int16_t)(t[i * 4 + 0] - t[i * 4 + 2]);
+                        v[i * 4 + 1] = (int16_t)(t[i * 4 + 1] + t[i * 4 + 2]);
+                        v[i * 4 + 2] = (int16_t)(t[i * 4 + 2] - t[i * 4 + 1]);
+                        v[i * 4 + 3] = (int16_t)(t[i * 4 + 1] - t[i * 4 + 3]);
+                    }
+                    v += WINOGRAD_TILE_ELEMENTS;
+                }
+
+                const int32_t valid_x = MIN(2, output_x - out_x);
+                const int32_t valid_y = MIN(2, output_y - out_y);
+                int8_t *out = output_data + (out_y * output_x + out_x) * output_ch;
+                const int16_t *u = winograd_filter_data;
+
+                for (int32_t out_c = 0; out_c < output_ch; out_c++)
+                {
+                    // Element-wise product summed over the input channels
+                    int32_t m[WINOGRAD_TILE_ELEMENTS] = {0};
+                    v = v_buf;
+                    for (int32_t in_c = 0; in_c < input_ch; in_c++)
+                    {
+                        for (int32_t e = 0; e < WINOGRAD_TILE_ELEMENTS; e++)
+                        {
+                            m[e] += u[e] * v[e];
+                        }
+                        u += WINOGRAD_TILE_ELEMENTS;
+                        v += WINOGRAD_TILE_ELEMENTS;
+                    }
+
+                    // Output transform Y = A^T M A, computed modulo 2^32
+                    uint32_t r[2][4];
+                    for (int32_t j = 0; j < 4; j++)
+                    {
+                        r[0][j] = (uint32_t)m[0 * 4 + j] + (uint32_t)m[1 * 4 + j] + (uint32_t)m[2 * 4 + j];
+                        r[1][j] = (uint32_t)m[1 * 4 + j] - (uint32_t)m[2 * 4 + j] - (uint32_t)m[3 * 4 + j];
+                    }
+                    int32_t y[4];
+                    for (int32_t i = 0; i < 2; i++)
+                    {
+                        y[i * 2 + 0] = (int32_t)(r[i][0] + r[i][1] + r[i][2]);
+                        y[i * 2 + 1] = (int32_t)(r[i][1] - r[i][2] - r[i][3]);
+                    }
+
+                    const int32_t bias = bias_data ? bias_data[out_c] : 0;
+                    for (int32_t i = 0; i < valid_y; i++)
+                    {
+                        for (int32_t j = 0; j < valid_x; j++)
+                        {
+                            int32_t acc = (y[i * 2 + j] >> 2) + bias;
+                            acc = arm_nn_requantize(acc, output_mult[out_c], output_shift[out_c]);
+                            acc += out_offset;
+                            acc = MAX(acc, out_activation_min);
+                            acc = MIN(acc, out_activation_max);
+                            out[(i * output_x + j) * output_ch + out_c] = (int8_t)acc;
+                        }
+                    }
+                }
+            }
+        }
+        input_data += input_x * input_y * input_ch;
+        output_data += output_x * output_y * output_ch;
+    }
+
+    return ARM_CMSIS_NN_SUCCESS;
+}
+
+/**
+ * @} end of NNConv group
+ */
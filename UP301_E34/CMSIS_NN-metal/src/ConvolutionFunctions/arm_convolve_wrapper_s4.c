@@ -30,6 +30,7 @@
  * -------------------------------------------------------------------- */
 
 #include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
 
 /**
  *  @ingroup Public
@@ -59,8 +60,9 @@ arm_cmsis_nn_status arm_convolve_wrapper_s4(const cmsis_nn_context *ctx,
                                             const cmsis_nn_dims *output_dims,
                                             int8_t *output_data)
 {
-    if ((conv_params->padding.w == 0) && (conv_params->padding.h == 0) && (filter_dims->w == 1) &&
-        (filter_dims->h == 1) && (conv_params->dilation.w == 1 && conv_params->dilation.h == 1))
+    if ((filter_dims->w == 1) && (filter_dims->h == 1) &&
+        (conv_params->dilation.w == 1 && conv_params->dilation.h == 1) &&
+        arm_nn_conv_is_unpadded(conv_params, input_dims, filter_dims, output_dims))
     {
         if ((conv_params->stride.w == 1) && (conv_params->stride.h == 1))
         {
@@ -92,7 +94,8 @@ arm_cmsis_nn_status arm_convolve_wrapper_s4(const cmsis_nn_context *ctx,
         }
     }
     else if ((input_dims->h == 1) && conv_params->dilation.w == 1 && (filter_dims->h == 1) &&
-             ((conv_params->stride.w * input_dims->c) % 4 == 0) && (input_dims->c == filter_dims->c))
+             ((conv_params->stride.w * input_dims->c) % 4 == 0) && (input_dims->c == filter_dims->c) &&
+             arm_nn_conv_padding_is_balanced_x(conv_params, input_dims, filter_dims, output_dims))
     {
         return arm_convolve_1_x_n_s4(ctx,
                                      conv_params,
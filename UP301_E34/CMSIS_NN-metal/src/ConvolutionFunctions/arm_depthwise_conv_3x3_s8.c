@@ -86,8 +86,9 @@ arm_cmsis_nn_status arm_depthwise_conv_3x3_s8(const cmsis_nn_context *ctx,
     {
         return ARM_CMSIS_NN_ARG_ERROR;
     }
-    /* Check input constraints pad_x <= 1 */
-    if (pad_x > 1 || filter_dims->w != 3 || filter_dims->h != 3)
+    /* Check input constraints pad_x <= 1, on both sides since only two columns of a row are read unchecked */
+    if (pad_x > 1 || filter_dims->w != 3 || filter_dims->h != 3 ||
+        arm_nn_dw_conv_padding_right(dw_conv_params, input_dims, filter_dims, output_dims) > 1)
     {
         return ARM_CMSIS_NN_ARG_ERROR;
     }
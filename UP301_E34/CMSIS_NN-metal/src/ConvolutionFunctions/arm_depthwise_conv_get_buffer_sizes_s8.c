@@ -85,6 +85,18 @@ int32_t arm_depthwise_conv_s8_opt_get_buffer_size(const cmsis_nn_dims *input_dim
 #endif
 }
 
+int32_t arm_depthwise_conv_row_reuse_s8_get_buffer_size(const cmsis_nn_dw_conv_params *dw_conv_params,
+                                                        const cmsis_nn_dims *input_dims,
+                                                        const cmsis_nn_dims *filter_dims,
+                                                        const cmsis_nn_dims *output_dims)
+{
+    const int32_t ch_block = MIN(CH_IN_BLOCK_ROW_REUSE, input_dims->c);
+    const int32_t line_w = (output_dims->w - 1) * dw_conv_params->stride.w + filter_dims->w;
+
+    /* Line buffer of kernel height rows, followed by the weights of one channel block */
+    return (ch_block * filter_dims->h * (line_w + filter_dims->w)) * (int32_t)sizeof(int8_t);
+}
+
 int32_t arm_depthwise_conv_wrapper_s8_get_buffer_size(const cmsis_nn_dw_conv_params *dw_conv_params,
                                                       const cmsis_nn_dims *input_dims,
                                                       const cmsis_nn_dims *filter_dims,
@@ -99,12 +111,20 @@ int32_t arm_depthwise_conv_wrapper_s8_get_buffer_size(const cmsis_nn_dw_conv_par
     }
 #endif
 
+#if defined(ARM_MATH_RISCV) && !defined(ARM_MATH_DSP) && !defined(ARM_MATH_MVEI)
+    if (input_dims->c == output_dims->c && dw_conv_params->dilation.w == 1 && dw_conv_params->dilation.h == 1)
+    {
+        return arm_depthwise_conv_row_reuse_s8_get_buffer_size(dw_conv_params, input_dims, filter_dims, output_dims);
+    }
+#endif
+
     if (input_dims->c == output_dims->c && input_dims->n == 1 && dw_conv_params->dilation.w == 1 &&
         dw_conv_params->dilation.h == 1)
     {
 #if !defined(ARM_MATH_MVEI)
         if (filter_dims->w == 3 && filter_dims->h == 3 && dw_conv_params->padding.h <= 1 &&
-            dw_conv_params->padding.w <= 1)
+            dw_conv_params->padding.w <= 1 &&
+            arm_nn_dw_conv_padding_right(dw_conv_params, input_dims, filter_dims, output_dims) <= 1)
         {
             return size;
         }
@@ -126,7 +146,8 @@ int32_t arm_depthwise_conv_wrapper_s8_get_buffer_size_dsp(const cmsis_nn_dw_conv
         dw_conv_params->dilation.h == 1)
     {
         if (filter_dims->w == 3 && filter_dims->h == 3 && dw_conv_params->padding.h <= 1 &&
-            dw_conv_params->padding.w <= 1)
+            dw_conv_params->padding.w <= 1 &&
+            arm_nn_dw_conv_padding_right(dw_conv_params, input_dims, filter_dims, output_dims) <= 1)
         {
             return size;
         }
@@ -0,0 +1,441 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_depthwise_conv_row_reuse_s8.c
+ * Description:  s8 depthwise convolution with a rolling line buffer of
+ *               input rows for channel multiplier of 1.
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target :  Arm(R) M-Profile Architecture, RISC-V
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+static inline void store_s8(int32_t acc,
+                            const int32_t multiplier,
+                            const int32_t shift,
+                            const int32_t out_offset,
+                            const int32_t act_min,
+                            const int32_t act_max,
+                            int8_t *out)
+{
+    acc = arm_nn_requantize(acc, multiplier, shift) + out_offset;
+    acc = MAX(acc, act_min);
+    acc = MIN(acc, act_max);
+    *out = (int8_t)acc;
+}
+
+/*
+ * 3x3 kernel, stride 1 or 2. The window of three columns of the three rows stays in registers while sliding along
+ * the row, so every output only loads the stride columns that enter the window.
+ */
+static void dw_row_3x3_s8(const int8_t *row_0,
+                          const int8_t *row_1,
+                          const int8_t *row_2,
+                          const int8_t *weights,
+                          const int32_t acc_init,
+                          const int32_t stride,
+                          const int32_t output_x,
+                          const int32_t multiplier,
+                          const int32_t shift,
+                          const int32_t out_offset,
+                          const int32_t act_min,
+                          const int32_t act_max,
+                          int8_t *out,
+                          const int32_t out_stride)
+{
+    const int32_t w_00 = weights[0], w_01 = weights[1], w_02 = weights[2];
+    const int32_t w_10 = weights[3], w_11 = weights[4], w_12 = weights[5];
+    const int32_t w_20 = weights[6], w_21 = weights[7], w_22 = weights[8];
+
+    int32_t a_0 = row_0[0], a_1 = row_0[1];
+    int32_t b_0 = row_1[0], b_1 = row_1[1];
+    int32_t c_0 = row_2[0], c_1 = row_2[1];
+
+    for (int32_t x = 0; x < output_x; x++)
+    {
+        const int32_t col = x * stride + 2;
+        const int32_t a_2 = row_0[col];
+        const int32_t b_2 = row_1[col];
+        const int32_t c_2 = row_2[col];
+
+        int32_t acc = acc_init;
+        acc += a_0 * w_00 + a_1 * w_01 + a_2 * w_02;
+        acc += b_0 * w_10 + b_1 * w_11 + b_2 * w_12;
+        acc += c_0 * w_20 + c_1 * w_21 + c_2 * w_22;
+        store_s8(acc, multiplier, shift, out_offset, act_min, act_max, out);
+        out += out_stride;
+
+        if (stride == 1)
+        {
+            a_0 = a_1;
+            b_0 = b_1;
+            c_0 = c_1;
+            a_1 = a_2;
+            b_1 = b_2;
+            c_1 = c_2;
+        }
+        else if (x + 1 < output_x)
+        {
+            a_0 = a_2;
+            b_0 = b_2;
+            c_0 = c_2;
+            a_1 = row_0[col + 1];
+            b_1 = row_1[col + 1];
+            c_1 = row_2[col + 1];
+        }
+    }
+}
+
+/*
+ * 5x5 kernel, stride 1. Four outputs are computed together so that each loaded input column is used by up to four
+ * accumulators and each weight by four outputs.
+ */
+static void dw_row_5x5_s8(const int8_t *const *rows,
+                          const int8_t *weights,
+                          const int32_t acc_init,
+                          const int32_t output_x,
+                          const int32_t multiplier,
+                          const int32_t shift,
+                          const int32_t out_offset,
+                          const int32_t act_min,
+                          const int32_t act_max,
+                          int8_t *out,
+                          const int32_t out_stride)
+{
+    int32_t x = 0;
+    for (; x <= output_x - 4; x += 4)
+    {
+        int32_t acc_0 = acc_init;
+        int32_t acc_1 = acc_init;
+        int32_t acc_2 = acc_init;
+        int32_t acc_3 = acc_init;
+
+        for (int32_t i = 0; i < 5; i++)
+        {
+            const int8_t *in = rows[i] + x;
+            const int8_t *w = weights + i * 5;
+            const int32_t in_0 = in[0], in_1 = in[1], in_2 = in[2], in_3 = in[3];
+            const int32_t in_4 = in[4], in_5 = in[5], in_6 = in[6], in_7 = in[7];
+            const int32_t w_0 = w[0], w_1 = w[1], w_2 = w[2], w_3 = w[3], w_4 = w[4];
+
+            acc_0 += in_0 * w_0 + in_1 * w_1 + in_2 * w_2 + in_3 * w_3 + in_4 * w_4;
+            acc_1 += in_1 * w_0 + in_2 * w_1 + in_3 * w_2 + in_4 * w_3 + in_5 * w_4;
+            acc_2 += in_2 * w_0 + in_3 * w_1 + in_4 * w_2 + in_5 * w_3 + in_6 * w_4;
+            acc_3 += in_3 * w_0 + in_4 * w_1 + in_5 * w_2 + in_6 * w_3 + in_7 * w_4;
+        }
+
+        store_s8(acc_0, multiplier, shift, out_offset, act_min, act_max, out);
+        store_s8(acc_1, multiplier, shift, out_offset, act_min, act_max, out + out_stride);
+        store_s8(acc_2, multiplier, shift, out_offset, act_min, act_max, out + 2 * out_stride);
+        store_s8(acc_3, multiplier, shift, out_offset, act_min, act_max, out + 3 * out_stride);
+        out += 4 * out_stride;
+    }
+
+    for (; x < output_x; x++)
+    {
+        int32_t acc = acc_init;
+        for (int32_t i = 0; i < 5; i++)
+        {
+            const int8_t *in = rows[i] + x;
+            const int8_t *w = weights + i * 5;
+            acc += in[0] * w[0] + in[1] * w[1] + in[2] * w[2] + in[3] * w[3] + in[4] * w[4];
+        }
+        store_s8(acc, multiplier, shift, out_offset, act_min, act_max, out);
+        out += out_stride;
+    }
+}
+
+/* Any kernel size and stride */
+static void dw_row_generic_s8(const int8_t *lines,
+                              const int32_t first_slot,
+                              const int32_t slot_stride,
+                              const int8_t *weights,
+                              const int32_t acc_init,
+                              const int32_t kernel_x,
+                              const int32_t kernel_y,
+                              const int32_t stride,
+                              const int32_t output_x,
+                              const int32_t multiplier,
+                              const int32_t shift,
+                              const int32_t out_offset,
+                              const int32_t act_min,
+                              const int32_t act_max,
+                              int8_t *out,
+                              const int32_t out_stride)
+{
+    for (int32_t x = 0; x < output_x; x++)
+    {
+        int32_t acc = acc_init;
+        const int8_t *w = weights;
+        int32_t slot = first_slot;
+
+        for (int32_t i = 0; i < kernel_y; i++)
+        {
+            const int8_t *in = lines + slot * slot_stride + x * stride;
+            for (int32_t j = 0; j < kernel_x; j++)
+            {
+                acc += in[j] * w[j];
+            }
+            w += kernel_x;
+            slot = slot + 1 == kernel_y ? 0 : slot + 1;
+        }
+        store_s8(acc, multiplier, shift, out_offset, act_min, act_max, out);
+        out += out_stride;
+    }
+}
+
+/*
+ * Copies input row in_y of the channels [0, num_ch) of the current block into one line buffer slot. The slot holds
+ * one line of line_w columns per channel, left padding included. Columns outside the input hold the input zero point,
+ * so that they add nothing once the input offset is applied and the kernels need no bounds checks.
+ */
+static void fill_line_s8(const int8_t *input,
+                         const int32_t in_y,
+                         const int32_t input_x,
+                         const int32_t input_y,
+                         const int32_t input_ch,
+                         const int32_t num_ch,
+                         const int32_t pad_x,
+                         const int32_t line_w,
+                         const int8_t pad_value,
+                         int8_t *slot)
+{
+    if (in_y < 0 || in_y >= input_y)
+    {
+        arm_memset_s8(slot, pad_value, num_ch * line_w);
+        return;
+    }
+
+    const int32_t start = MIN(pad_x, line_w);
+    const int32_t end = MIN(pad_x + input_x, line_w);
+    for (int32_t ch = 0; ch < num_ch; ch++)
+    {
+        arm_memset_s8(slot + ch * line_w, pad_value, start);
+        arm_memset_s8(slot + ch * line_w + end, pad_value, line_w - end);
+    }
+
+    const int8_t *src = input + (in_y * input_x + start - pad_x) * input_ch;
+    for (int32_t col = start; col < end; col++)
+    {
+        int8_t *dst = slot + col;
+        for (int32_t ch = 0; ch < num_ch; ch++)
+        {
+            *dst = src[ch];
+            dst += line_w;
+        }
+        src += input_ch;
+    }
+}
+
+/**
+ *  @ingroup Public
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/*
+ * s8 depthwise convolution with a rolling line buffer, channel multiplier of 1.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_cmsis_nn_status arm_depthwise_conv_row_reuse_s8(const cmsis_nn_context *ctx,
+                                                    const cmsis_nn_dw_conv_params *dw_conv_params,
+                                                    const cmsis_nn_per_channel_quant_params *quant_params,
+                                                    const cmsis_nn_dims *input_dims,
+                                                    const int8_t *input,
+                                                    const cmsis_nn_dims *filter_dims,
+                                                    const int8_t *kernel,
+                                                    const cmsis_nn_dims *bias_dims,
+                                                    const int32_t *bias,
+                                                    const cmsis_nn_dims *output_dims,
+                                                    int8_t *output)
+{
+    (void)bias_dims;
+
+    const int32_t input_batches = input_dims->n;
+    const int32_t input_x = input_dims->w;
+    const int32_t input_y = input_dims->h;
+    const int32_t input_ch = input_dims->c;
+    const int32_t kernel_x = filter_dims->w;
+    const int32_t kernel_y = filter_dims->h;
+    const int32_t pad_x = dw_conv_params->padding.w;
+    const int32_t pad_y = dw_conv_params->padding.h;
+    const int32_t stride_x = dw_conv_params->stride.w;
+    const int32_t stride_y = dw_conv_params->stride.h;
+    const int32_t output_x = output_dims->w;
+    const int32_t output_y = output_dims->h;
+    const int32_t *output_mult = quant_params->multiplier;
+    const int32_t *output_shift = quant_params->shift;
+    const int32_t input_offset = dw_conv_params->input_offset;
+    const int32_t output_offset = dw_conv_params->output_offset;
+    const int32_t act_min = dw_conv_params->activation.min;
+    const int32_t act_max = dw_conv_params->activation.max;
+
+    if (input_ch != output_dims->c || dw_conv_params->ch_mult != 1 || dw_conv_params->dilation.w != 1 ||
+        dw_conv_params->dilation.h != 1)
+    {
+        return ARM_CMSIS_NN_ARG_ERROR;
+    }
+    if (ctx->buf == NULL)
+    {
+        return ARM_CMSIS_NN_ARG_ERROR;
+    }
+
+    const int32_t ch_block = MIN(CH_IN_BLOCK_ROW_REUSE, input_ch);
+    const int32_t line_w = (output_x - 1) * stride_x + kernel_x;
+    const int32_t slot_size = ch_block * line_w;
+    const int32_t kernel_size = kernel_x * kernel_y;
+    int8_t *lines = (int8_t *)ctx->buf;
+    int8_t *weights = lines + kernel_y * slot_size;
+    const int8_t pad_value = (int8_t)(-input_offset);
+    const bool is_3x3 = kernel_x == 3 && kernel_y == 3 && stride_x <= 2;
+    const bool is_5x5 = kernel_x == 5 && kernel_y == 5 && stride_x == 1;
+
+    for (int32_t batch = 0; batch < input_batches; batch++)
+    {
+        const int8_t *in_batch = input + batch * input_y * input_x * input_ch;
+        int8_t *out_batch = output + batch * output_y * output_x * input_ch;
+
+        for (int32_t ch_start = 0; ch_start < input_ch; ch_start += ch_block)
+        {
+            const int32_t num_ch = MIN(ch_block, input_ch - ch_start);
+            int32_t acc_init[CH_IN_BLOCK_ROW_REUSE];
+
+            /* Gather the weights of the block per channel, and fold bias and input offset into the accumulator */
+            for (int32_t ch = 0; ch < num_ch; ch++)
+            {
+                int32_t sum = 0;
+                for (int32_t i = 0; i < kernel_size; i++)
+                {
+                    const int8_t w = kernel[i * input_ch + ch_start + ch];
+                    weights[ch * kernel_size + i] = w;
+                    sum += w;
+                }
+                acc_init[ch] = (bias ? bias[ch_start + ch] : 0) + input_offset * sum;
+            }
+
+            for (int32_t out_y = 0; out_y < output_y; out_y++)
+            {
+                const int32_t in_y = out_y * stride_y - pad_y;
+
+                /* Rows still in the buffer from the previous output row are kept, only the new ones are loaded */
+                const int32_t first_new = (out_y == 0 || stride_y >= kernel_y) ? in_y : in_y + kernel_y - stride_y;
+                for (int32_t row = first_new; row < in_y + kernel_y; row++)
+                {
+                    fill_line_s8(in_batch + ch_start,
+                                 row,
+                                 input_x,
+                                 input_y,
+                                 input_ch,
+                                 num_ch,
+                                 pad_x,
+                                 line_w,
+                                 pad_value,
+                                 lines + ((row + pad_y) % kernel_y) * slot_size);
+                }
+
+                const int32_t first_slot = (in_y + pad_y) % kernel_y;
+                int8_t *out = out_batch + out_y * output_x * input_ch + ch_start;
+
+                for (int32_t ch = 0; ch < num_ch; ch++)
+                {
+                    const int32_t out_ch = ch_start + ch;
+                    const int8_t *ch_lines = lines + ch * line_w;
+                    const int8_t *ch_weights = weights + ch * kernel_size;
+
+                    if (is_3x3 || is_5x5)
+                    {
+                        const int8_t *rows[5];
+                        for (int32_t i = 0; i < kernel_y; i++)
+                        {
+                            rows[i] = ch_lines + ((first_slot + i) % kernel_y) * slot_size;
+                        }
+
+                        if (is_3x3)
+                        {
+                            dw_row_3x3_s8(rows[0],
+                                          rows[1],
+                                          rows[2],
+                                          ch_weights,
+                                          acc_init[ch],
+                                          stride_x,
+                                          output_x,
+                                          output_mult[out_ch],
+                                          output_shift[out_ch],
+                                          output_offset,
+                                          act_min,
+                                          act_max,
+                                          out + ch,
+                                          input_ch);
+                        }
+                        else
+                        {
+                            dw_row_5x5_s8(rows,
+                                          ch_weights,
+                                          acc_init[ch],
+                                          output_x,
+                                          output_mult[out_ch],
+                                          output_shift[out_ch],
+                                          output_offset,
+                                          act_min,
+                                          act_max,
+                                          out + ch,
+                                          input_ch);
+                        }
+                    }
+                    else
+                    {
+                        dw_row_generic_s8(ch_lines,
+                                          first_slot,
+                                          slot_size,
+                                          ch_weights,
+                                          acc_init[ch],
+                                          kernel_x,
+                                          kernel_y,
+                                          stride_x,
+                                          output_x,
+                                          output_mult[out_ch],
+                                          output_shift[out_ch],
+                                          output_offset,
+                                          act_min,
+                                          act_max,
+                                          out + ch,
+                                          input_ch);
+                    }
+                }
+            }
+        }
+    }
+
+    return ARM_CMSIS_NN_SUCCESS;
+}
+
+/**
+ * @} end of NNConv group
+ */
@@ -123,12 +123,30 @@ arm_cmsis_nn_status arm_depthwise_conv_wrapper_s8(const cmsis_nn_context *ctx,
     }
 #endif
 
+#if defined(ARM_MATH_RISCV) && !defined(ARM_MATH_DSP) && !defined(ARM_MATH_MVEI)
+    if (1 == dw_conv_params->ch_mult && dw_conv_params->dilation.w == 1 && dw_conv_params->dilation.h == 1)
+    {
+        return arm_depthwise_conv_row_reuse_s8(ctx,
+                                               dw_conv_params,
+                                               quant_params,
+                                               input_dims,
+                                               input,
+                                               filter_dims,
+                                               filter,
+                                               bias_dims,
+                                               bias,
+                                               output_dims,
+                                               output);
+    }
+#endif
+
     if (1 == dw_conv_params->ch_mult && input_dims->n == 1 && dw_conv_params->dilation.w == 1 &&
         dw_conv_params->dilation.h == 1)
     {
 #if !defined(ARM_MATH_MVEI)
         if (filter_dims->w == 3 && filter_dims->h == 3 && dw_conv_params->padding.h <= 1 &&
-            dw_conv_params->padding.w <= 1)
+            dw_conv_params->padding.w <= 1 &&
+            arm_nn_dw_conv_padding_right(dw_conv_params, input_dims, filter_dims, output_dims) <= 1)
         {
             status = arm_depthwise_conv_3x3_s8(ctx,
                                                dw_conv_params,
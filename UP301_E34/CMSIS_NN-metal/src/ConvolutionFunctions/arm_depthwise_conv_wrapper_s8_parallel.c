@@ -0,0 +1,201 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_depthwise_conv_wrapper_s8_parallel.c
+ * Description:  Output row slices of s8 depthwise convolution and their dispatch to scheduler workers
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target :  Arm(R) M-Profile Architecture, RISC-V
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup Public
+ */
+
+/**
+ * @addtogroup Parallel
+ * @{
+ */
+
+typedef struct
+{
+    const cmsis_nn_dw_conv_params *dw_conv_params;
+    const cmsis_nn_per_channel_quant_params *quant_params;
+    const cmsis_nn_dims *input_dims;
+    const int8_t *input_data;
+    const cmsis_nn_dims *filter_dims;
+    const int8_t *filter_data;
+    const cmsis_nn_dims *bias_dims;
+    const int32_t *bias_data;
+    const cmsis_nn_dims *output_dims;
+    int8_t *output_data;
+} depthwise_conv_wrapper_s8_args;
+
+static arm_cmsis_nn_status
+depthwise_conv_wrapper_s8_task(const void *args, const cmsis_nn_context *ctx, const cmsis_nn_slice *slice)
+{
+    const depthwise_conv_wrapper_s8_args *a = (const depthwise_conv_wrapper_s8_args *)args;
+    return arm_depthwise_conv_wrapper_s8_slice(ctx,
+                                               a->dw_conv_params,
+                                               a->quant_params,
+                                               a->input_dims,
+                                               a->input_data,
+                                               a->filter_dims,
+                                               a->filter_data,
+                                               a->bias_dims,
+                                               a->bias_data,
+                                               a->output_dims,
+                                               a->output_data,
+                                               slice);
+}
+
+/*
+ * Output rows [rows->start, rows->end) of arm_depthwise_conv_wrapper_s8.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_cmsis_nn_status arm_depthwise_conv_wrapper_s8_slice(const cmsis_nn_context *ctx,
+                                                        const cmsis_nn_dw_conv_params *dw_conv_params,
+                                                        const cmsis_nn_per_channel_quant_params *quant_params,
+                                                        const cmsis_nn_dims *input_dims,
+                                                        const int8_t *input_data,
+                                                        const cmsis_nn_dims *filter_dims,
+                                                        const int8_t *filter_data,
+                                                        const cmsis_nn_dims *bias_dims,
+                                                        const int32_t *bias_data,
+                                                        const cmsis_nn_dims *output_dims,
+                                                        int8_t *output_data,
+                                                        const cmsis_nn_slice *rows)
+{
+    if (rows->start < 0 || rows->end > output_dims->h || rows->start > rows->end)
+    {
+        return ARM_CMSIS_NN_ARG_ERROR;
+    }
+    if (rows->start == rows->end)
+    {
+        return ARM_CMSIS_NN_SUCCESS;
+    }
+
+    cmsis_nn_dw_conv_params slice_params = *dw_conv_params;
+    int32_t input_start;
+    int32_t input_rows;
+    arm_nn_row_slice(rows,
+                     input_dims->h,
+                     filter_dims->h,
+                     dw_conv_params->stride.h,
+                     dw_conv_params->dilation.h,
+                     dw_conv_params->padding.h,
+                     &input_start,
+                     &input_rows,
+                     &slice_params.padding.h);
+
+    const cmsis_nn_dims slice_input_dims = {1, input_rows, input_dims->w, input_dims->c};
+    const cmsis_nn_dims slice_output_dims = {1, rows->end - rows->start, output_dims->w, output_dims->c};
+    const int32_t input_row_size = input_dims->w * input_dims->c;
+    const int32_t output_row_size = output_dims->w * output_dims->c;
+
+    for (int32_t i_batch = 0; i_batch < input_dims->n; i_batch++)
+    {
+        const arm_cmsis_nn_status status =
+            arm_depthwise_conv_wrapper_s8(ctx,
+                                          &slice_params,
+                                          quant_params,
+                                          &slice_input_dims,
+                                          input_data + (i_batch * input_dims->h + input_start) * input_row_size,
+                                          filter_dims,
+                                          filter_data,
+                                          bias_dims,
+                                          bias_data,
+                                          &slice_output_dims,
+                                          output_data + (i_batch * output_dims->h + rows->start) * output_row_size);
+        if (status != ARM_CMSIS_NN_SUCCESS)
+        {
+            return status;
+        }
+    }
+    return ARM_CMSIS_NN_SUCCESS;
+}
+
+/*
+ * Get the buffer size for any slice of arm_depthwise_conv_wrapper_s8.
+ *
+ * Refer header file for details.
+ *
+ */
+int32_t arm_depthwise_conv_wrapper_s8_slice_get_buffer_size(const cmsis_nn_dw_conv_params *dw_conv_params,
+                                                            const cmsis_nn_dims *input_dims,
+                                                            const cmsis_nn_dims *filter_dims,
+                                                            const cmsis_nn_dims *output_dims)
+{
+    // A slice can select another kernel than the full layer, e.g. the 3x3 kernel once the padding is gone.
+    cmsis_nn_dw_conv_params row_params = *dw_conv_params;
+    row_params.padding.h = 0;
+    const cmsis_nn_dims row_input_dims = {1, MIN(filter_dims->h, input_dims->h), input_dims->w, input_dims->c};
+    const cmsis_nn_dims row_output_dims = {1, 1, output_dims->w, output_dims->c};
+
+    const int32_t full_size =
+        arm_depthwise_conv_wrapper_s8_get_buffer_size(dw_conv_params, input_dims, filter_dims, output_dims);
+    const int32_t row_size =
+        arm_depthwise_conv_wrapper_s8_get_buffer_size(&row_params, &row_input_dims, filter_dims, &row_output_dims);
+    return MAX(full_size, row_size);
+}
+
+/*
+ * arm_depthwise_conv_wrapper_s8 split into output row slices over the scheduler workers.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_cmsis_nn_status arm_depthwise_conv_wrapper_s8_parallel(const cmsis_nn_scheduler *scheduler,
+                                                           const cmsis_nn_dw_conv_params *dw_conv_params,
+                                                           const cmsis_nn_per_channel_quant_params *quant_params,
+                                                           const cmsis_nn_dims *input_dims,
+                                                           const int8_t *input_data,
+                                                           const cmsis_nn_dims *filter_dims,
+                                                           const int8_t *filter_data,
+                                                           const cmsis_nn_dims *bias_dims,
+                                                           const int32_t *bias_data,
+                                                           const cmsis_nn_dims *output_dims,
+                                                           int8_t *output_data)
+{
+    const depthwise_conv_wrapper_s8_args args = {dw_conv_params,
+                                                 quant_params,
+                                                 input_dims,
+                                                 input_data,
+                                                 filter_dims,
+                                                 filter_data,
+                                                 bias_dims,
+                                                 bias_data,
+                                                 output_dims,
+                                                 output_data};
+
+    return arm_nn_parallel_run(scheduler, depthwise_conv_wrapper_s8_task, &args, output_dims->h);
+}
+
+/**
+ * @} end of Parallel group
+ */
@@ -0,0 +1,59 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_fully_connected_get_buffer_sizes_s4.c
+ * Description:  Collection of get buffer size functions for fully connected layers with int4 activations.
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target :  Arm(R) M-Profile Architecture, RISC-V
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup FC
+ */
+
+/**
+ * @addtogroup GetBufferSizeFC
+ * @{
+ */
+
+int32_t arm_fully_connected_s4_s4_get_buffer_size(const cmsis_nn_dims *filter_dims)
+{
+    /* One unpacked input row and one output row before packing */
+    return filter_dims->n + filter_dims->c;
+}
+
+int32_t arm_fully_connected_s4_s8_get_buffer_size(const cmsis_nn_dims *filter_dims)
+{
+#if defined(ARM_MATH_MVEI)
+    return filter_dims->c * (int32_t)sizeof(int32_t) + filter_dims->n + filter_dims->c;
+#else
+    return filter_dims->n + filter_dims->c;
+#endif
+}
+
+/**
+ * @} end of GetBufferSizeFC group
+ */
@@ -0,0 +1,152 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_fully_connected_pack_weights_s8.c
+ * Description:  Packs s8 fully connected weights into row panels with precomputed kernel sums
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target :  Arm(R) M-Profile Architecture, RISC-V
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup Public
+ */
+
+/**
+ * @addtogroup FC
+ * @{
+ */
+
+/*
+ * Size of packed s8 fully connected weights
+ *
+ * Refer header file for details.
+ *
+ */
+int32_t arm_fully_connected_packed_s8_get_weights_size(const cmsis_nn_dims *filter_dims)
+{
+    const int32_t rows = filter_dims->c;
+    const int32_t cols = filter_dims->n;
+    const int32_t num_panels = (rows + FC_PACKED_S8_PANEL_ROWS - 1) / FC_PACKED_S8_PANEL_ROWS;
+    const int32_t num_col_blocks = (cols + FC_PACKED_S8_PANEL_COLS - 1) / FC_PACKED_S8_PANEL_COLS;
+    const int32_t padded_rows = num_panels * FC_PACKED_S8_PANEL_ROWS;
+    const int32_t padded_cols = num_col_blocks * FC_PACKED_S8_PANEL_COLS;
+
+    return (int32_t)sizeof(cmsis_nn_packed_weights_header) + rows * (int32_t)sizeof(int32_t) +
+        padded_rows * padded_cols;
+}
+
+/*
+ * Pack s8 fully connected weights
+ *
+ * Refer header file for details.
+ *
+ */
+arm_cmsis_nn_status arm_fully_connected_pack_weights_s8(const cmsis_nn_fc_params *fc_params,
+                                                        const cmsis_nn_dims *filter_dims,
+                                                        const int8_t *filter_data,
+                                                        const int32_t *bias_data,
+                                                        int8_t *packed_data)
+{
+    const int32_t rows = filter_dims->c;
+    const int32_t cols = filter_dims->n;
+
+    if (fc_params->filter_offset != 0 || rows <= 0 || cols <= 0 ||
+        rows * cols < (int32_t)sizeof(cmsis_nn_packed_weights_header))
+    {
+        return ARM_CMSIS_NN_ARG_ERROR;
+    }
+
+    cmsis_nn_packed_weights_header header;
+    header.magic = CMSIS_NN_PACKED_WEIGHTS_MAGIC;
+    header.version = CMSIS_NN_PACKED_WEIGHTS_VERSION;
+    header.rows = rows;
+    header.cols = cols;
+    header.input_offset = fc_params->input_offset;
+    header.panel_rows = FC_PACKED_S8_PANEL_ROWS;
+    memcpy(packed_data, &header, sizeof(header));
+    packed_data += sizeof(header);
+
+    // bias + input_offset * sum(row), so that the kernel only accumulates the raw input
+    for (int32_t i = 0; i < rows; i++)
+    {
+        const int8_t *row = filter_data + i * cols;
+        int32_t sum = 0;
+        for (int32_t j = 0; j < cols; j++)
+        {
+            sum += row[j];
+        }
+        sum *= fc_params->input_offset;
+        if (bias_data)
+        {
+            sum += bias_data[i];
+        }
+        memcpy(packed_data, &sum, sizeof(sum));
+        packed_data += sizeof(sum);
+    }
+
+    // Each panel holds FC_PACKED_S8_PANEL_ROWS rows, interleaved in blocks of FC_PACKED_S8_PANEL_COLS columns so that
+    // the kernel reads it front to back. Rows and columns past the end are zero.
+    for (int32_t i_row = 0; i_row < rows; i_row += FC_PACKED_S8_PANEL_ROWS)
+    {
+        for (int32_t i_col = 0; i_col < cols; i_col += FC_PACKED_S8_PANEL_COLS)
+        {
+            for (int32_t r = i_row; r < i_row + FC_PACKED_S8_PANEL_ROWS; r++)
+            {
+                for (int32_t c = i_col; c < i_col + FC_PACKED_S8_PANEL_COLS; c++)
+                {
+                    *packed_data++ = (r < rows && c < cols) ? filter_data[r * cols + c] : 0;
+                }
+            }
+        }
+    }
+
+    return ARM_CMSIS_NN_SUCCESS;
+}
+
+/*
+ * Check for packed s8 fully connected weights
+ *
+ * Refer header file for details.
+ *
+ */
+bool arm_fully_connected_s8_is_packed(const cmsis_nn_dims *filter_dims, const int8_t *filter_data)
+{
+    if (filter_data == NULL || filter_dims->n * filter_dims->c < (int32_t)sizeof(cmsis_nn_packed_weights_header))
+    {
+        return false;
+    }
+
+    cmsis_nn_packed_weights_header header;
+    memcpy(&header, filter_data, sizeof(header));
+
+    return header.magic == CMSIS_NN_PACKED_WEIGHTS_MAGIC && header.version == CMSIS_NN_PACKED_WEIGHTS_VERSION &&
+        header.rows == filter_dims->c && header.cols == filter_dims->n && header.panel_rows == FC_PACKED_S8_PANEL_ROWS;
+}
+
+/**
+ * @} end of FC group
+ */
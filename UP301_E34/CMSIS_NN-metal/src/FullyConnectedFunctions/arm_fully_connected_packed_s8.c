@@ -0,0 +1,156 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_fully_connected_packed_s8.c
+ * Description:  Fully connected function compatible with TF Lite, using prepacked weight panels
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target :  Arm(R) M-Profile Architecture, RISC-V
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup Public
+ */
+
+/**
+ * @addtogroup FC
+ * @{
+ */
+
+/*
+ * S8 basic fully-connected and matrix multiplication layer function on weights packed by
+ * arm_fully_connected_pack_weights_s8()
+ *
+ * Refer header file for details.
+ *
+ */
+arm_cmsis_nn_status arm_fully_connected_packed_s8(const cmsis_nn_fc_params *fc_params,
+                                                  const cmsis_nn_quant_params *quant_params,
+                                                  const cmsis_nn_dims *input_dims,
+                                                  const int8_t *input_data,
+                                                  const cmsis_nn_dims *filter_dims,
+                                                  const int8_t *packed_data,
+                                                  const cmsis_nn_dims *output_dims,
+                                                  int8_t *output_data)
+{
+    (void)output_dims;
+
+    if (!arm_fully_connected_s8_is_packed(filter_dims, packed_data))
+    {
+        return ARM_CMSIS_NN_ARG_ERROR;
+    }
+
+    cmsis_nn_packed_weights_header header;
+    memcpy(&header, packed_data, sizeof(header));
+    if (header.input_offset != fc_params->input_offset)
+    {
+        return ARM_CMSIS_NN_ARG_ERROR;
+    }
+
+    const int32_t rows = header.rows;
+    const int32_t cols = header.cols;
+    const int32_t col_blocks = cols / FC_PACKED_S8_PANEL_COLS;
+    const int32_t col_tail = cols % FC_PACKED_S8_PANEL_COLS;
+    const int32_t *kernel_sum = (const int32_t *)(packed_data + sizeof(header));
+    const int8_t *panels = packed_data + sizeof(header) + rows * (int32_t)sizeof(int32_t);
+    const int32_t out_offset = fc_params->output_offset;
+    const int32_t out_activation_min = fc_params->activation.min;
+    const int32_t out_activation_max = fc_params->activation.max;
+
+    for (int32_t i_batch = 0; i_batch < input_dims->n; i_batch++)
+    {
+        const int8_t *weights = panels;
+
+        for (int32_t i_row = 0; i_row < rows; i_row += FC_PACKED_S8_PANEL_ROWS)
+        {
+            const int8_t *input = input_data;
+            int32_t acc[FC_PACKED_S8_PANEL_ROWS];
+            for (int32_t r = 0; r < FC_PACKED_S8_PANEL_ROWS; r++)
+            {
+                acc[r] = i_row + r < rows ? kernel_sum[i_row + r] : 0;
+            }
+
+            // One block of the input is loaded once and used for all rows of the panel
+            for (int32_t i_block = 0; i_block < col_blocks; i_block++)
+            {
+#if defined(ARM_MATH_DSP)
+                int32_t in_1, in_2;
+                input = read_and_pad_reordered(input, &in_1, &in_2);
+                for (int32_t r = 0; r < FC_PACKED_S8_PANEL_ROWS; r++)
+                {
+                    int32_t w_1, w_2;
+                    weights = read_and_pad_reordered(weights, &w_1, &w_2);
+                    acc[r] = SMLAD(in_1, w_1, acc[r]);
+                    acc[r] = SMLAD(in_2, w_2, acc[r]);
+                }
+#else
+                const int32_t in_0 = input[0];
+                const int32_t in_1 = input[1];
+                const int32_t in_2 = input[2];
+                const int32_t in_3 = input[3];
+                input += FC_PACKED_S8_PANEL_COLS;
+                for (int32_t r = 0; r < FC_PACKED_S8_PANEL_ROWS; r++)
+                {
+                    acc[r] += in_0 * weights[0] + in_1 * weights[1] + in_2 * weights[2] + in_3 * weights[3];
+                    weights += FC_PACKED_S8_PANEL_COLS;
+                }
+#endif
+            }
+
+            // The padding of the last block is zero in the weights, so only the valid inputs are read
+            if (col_tail)
+            {
+                for (int32_t r = 0; r < FC_PACKED_S8_PANEL_ROWS; r++)
+                {
+                    for (int32_t c = 0; c < col_tail; c++)
+                    {
+                        acc[r] += input[c] * weights[c];
+                    }
+                    weights += FC_PACKED_S8_PANEL_COLS;
+                }
+            }
+
+            for (int32_t r = 0; r < FC_PACKED_S8_PANEL_ROWS && i_row + r < rows; r++)
+            {
+                const int32_t idx = quant_params->is_per_channel ? i_row + r : 0;
+                int32_t res = arm_nn_requantize(acc[r], quant_params->multiplier[idx], quant_params->shift[idx]);
+                res += out_offset;
+                res = MAX(res, out_activation_min);
+                res = MIN(res, out_activation_max);
+                output_data[i_row + r] = (int8_t)res;
+            }
+        }
+
+        input_data += cols;
+        output_data += rows;
+    }
+
+    return ARM_CMSIS_NN_SUCCESS;
+}
+
+/**
+ * @} end of FC group
+ */
@@ -0,0 +1,173 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_fully_connected_parallel_s8.c
+ * Description:  Output channel slices of the s8 fully connected layer and their dispatch to scheduler workers
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target :  Arm(R) M-Profile Architecture, RISC-V
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup Public
+ */
+
+/**
+ * @addtogroup Parallel
+ * @{
+ */
+
+typedef struct
+{
+    const cmsis_nn_context *ctx;
+    const cmsis_nn_fc_params *fc_params;
+    const cmsis_nn_per_tensor_quant_params *quant_params;
+    const cmsis_nn_dims *input_dims;
+    const int8_t *input;
+    const cmsis_nn_dims *filter_dims;
+    const int8_t *kernel;
+    const cmsis_nn_dims *bias_dims;
+    const int32_t *bias;
+    const cmsis_nn_dims *output_dims;
+    int8_t *output;
+} fully_connected_s8_args;
+
+static arm_cmsis_nn_status
+fully_connected_s8_task(const void *args, const cmsis_nn_context *ctx, const cmsis_nn_slice *slice)
+{
+    const fully_connected_s8_args *a = (const fully_connected_s8_args *)args;
+    (void)ctx;
+    return arm_fully_connected_s8_slice(a->ctx,
+                                        a->fc_params,
+                                        a->quant_params,
+                                        a->input_dims,
+                                        a->input,
+                                        a->filter_dims,
+                                        a->kernel,
+                                        a->bias_dims,
+                                        a->bias,
+                                        a->output_dims,
+                                        a->output,
+                                        slice);
+}
+
+/*
+ * Output channels [channels->start, channels->end) of arm_fully_connected_s8.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_cmsis_nn_status arm_fully_connected_s8_slice(const cmsis_nn_context *ctx,
+                                                 const cmsis_nn_fc_params *fc_params,
+                                                 const cmsis_nn_per_tensor_quant_params *quant_params,
+                                                 const cmsis_nn_dims *input_dims,
+                                                 const int8_t *input,
+                                                 const cmsis_nn_dims *filter_dims,
+                                                 const int8_t *kernel,
+                                                 const cmsis_nn_dims *bias_dims,
+                                                 const int32_t *bias,
+                                                 const cmsis_nn_dims *output_dims,
+                                                 int8_t *output,
+                                                 const cmsis_nn_slice *channels)
+{
+    if (channels->start < 0 || channels->end > output_dims->c || channels->start > channels->end)
+    {
+        return ARM_CMSIS_NN_ARG_ERROR;
+    }
+    if (channels->start == channels->end)
+    {
+        return ARM_CMSIS_NN_SUCCESS;
+    }
+
+    // The kernel sums are per output channel, so the slice sees its own part of the shared buffer.
+    cmsis_nn_context slice_ctx = *ctx;
+    if (ctx->buf != NULL)
+    {
+        slice_ctx.buf = (int32_t *)ctx->buf + channels->start;
+    }
+    const cmsis_nn_dims slice_input_dims = {1, input_dims->h, input_dims->w, input_dims->c};
+    const cmsis_nn_dims slice_output_dims = {1, 1, 1, channels->end - channels->start};
+    const int8_t *slice_kernel = kernel + channels->start * filter_dims->n;
+    const int32_t *slice_bias = bias != NULL ? bias + channels->start : NULL;
+
+    for (int32_t i_batch = 0; i_batch < input_dims->n; i_batch++)
+    {
+        const arm_cmsis_nn_status status = arm_fully_connected_s8(&slice_ctx,
+                                                                  fc_params,
+                                                                  quant_params,
+                                                                  &slice_input_dims,
+                                                                  input + i_batch * filter_dims->n,
+                                                                  filter_dims,
+                                                                  slice_kernel,
+                                                                  bias_dims,
+                                                                  slice_bias,
+                                                                  &slice_output_dims,
+                                                                  output + i_batch * output_dims->c + channels->start);
+        if (status != ARM_CMSIS_NN_SUCCESS)
+        {
+            return status;
+        }
+    }
+    return ARM_CMSIS_NN_SUCCESS;
+}
+
+/*
+ * arm_fully_connected_s8 split into output channel slices over the scheduler workers.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_cmsis_nn_status arm_fully_connected_s8_parallel(const cmsis_nn_scheduler *scheduler,
+                                                    const cmsis_nn_context *ctx,
+                                                    const cmsis_nn_fc_params *fc_params,
+                                                    const cmsis_nn_per_tensor_quant_params *quant_params,
+                                                    const cmsis_nn_dims *input_dims,
+                                                    const int8_t *input,
+                                                    const cmsis_nn_dims *filter_dims,
+                                                    const int8_t *kernel,
+                                                    const cmsis_nn_dims *bias_dims,
+                                                    const int32_t *bias,
+                                                    const cmsis_nn_dims *output_dims,
+                                                    int8_t *output)
+{
+    const fully_connected_s8_args args = {ctx,
+                                          fc_params,
+                                          quant_params,
+                                          input_dims,
+                                          input,
+                                          filter_dims,
+                                          kernel,
+                                          bias_dims,
+                                          bias,
+                                          output_dims,
+                                          output};
+
+    return arm_nn_parallel_run(scheduler, fully_connected_s8_task, &args, output_dims->c);
+}
+
+/**
+ * @} end of Parallel group
+ */
@@ -0,0 +1,98 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_fully_connected_s4_s4
+ * Description:  Fully connected function with packed int4 activations and int4 weights
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target :  Arm(R) M-Profile Architecture, RISC-V
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup Public
+ */
+
+/**
+ * @addtogroup FC
+ * @{
+ */
+
+/*
+ * Fully-connected layer function with packed int4 activations and int4 weights.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_cmsis_nn_status arm_fully_connected_s4_s4(const cmsis_nn_context *ctx,
+                                              const cmsis_nn_fc_params *fc_params,
+                                              const cmsis_nn_per_tensor_quant_params *quant_params,
+                                              const cmsis_nn_dims *input_dims,
+                                              const int8_t *input,
+                                              const cmsis_nn_dims *filter_dims,
+                                              const int8_t *kernel,
+                                              const cmsis_nn_dims *bias_dims,
+                                              const int32_t *bias,
+                                              const cmsis_nn_dims *output_dims,
+                                              int8_t *output)
+{
+    (void)bias_dims;
+
+    if (ctx->buf == NULL)
+    {
+        return ARM_CMSIS_NN_ARG_ERROR;
+    }
+
+    const int32_t accum_depth = filter_dims->n;
+    const int32_t output_depth = output_dims->c;
+    int8_t *lhs = (int8_t *)ctx->buf;
+    int8_t *dst = lhs + accum_depth;
+
+    /* Rows are unpacked to int8, multiplied and packed back. A row starts in the middle of a byte when its length
+     * is odd. */
+    for (int32_t i_batch = 0; i_batch < input_dims->n; i_batch++)
+    {
+        arm_nn_unpack_s4(input, i_batch * accum_depth, accum_depth, lhs);
+        arm_nn_vec_mat_mult_t_s4(lhs,
+                                 kernel,
+                                 bias,
+                                 dst,
+                                 fc_params->input_offset,
+                                 fc_params->output_offset,
+                                 quant_params->multiplier,
+                                 quant_params->shift,
+                                 accum_depth,
+                                 output_depth,
+                                 fc_params->activation.min,
+                                 fc_params->activation.max);
+        arm_nn_pack_s4(dst, output_depth, output, i_batch * output_depth);
+    }
+
+    return ARM_CMSIS_NN_SUCCESS;
+}
+
+/**
+ * @} end of FC group
+ */
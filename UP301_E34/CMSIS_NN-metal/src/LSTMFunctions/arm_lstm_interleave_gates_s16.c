@@ -0,0 +1,98 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_lstm_interleave_gates_s16.c
+ * Description:  Interleaved LSTM gate weights for the fused gate kernel, s16 input
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target :  Arm(R) M-Profile Architecture, RISC-V
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+/**
+ * @ingroup Public
+ */
+
+/**
+ * @addtogroup LSTM
+ * @{
+ */
+
+/*
+ * Interleave the gate weights so that row 4 * j + g is gate g of hidden unit j.
+ *
+ * Refer to header file for details.
+ *
+ */
+arm_cmsis_nn_status arm_lstm_interleave_gates_s16(const cmsis_nn_lstm_params *params,
+                                                  int8_t *input_weights,
+                                                  int64_t *input_effective_bias,
+                                                  int8_t *hidden_weights,
+                                                  int64_t *hidden_effective_bias,
+                                                  cmsis_nn_lstm_fused_gates *fused_gates)
+{
+    const cmsis_nn_lstm_gate *gates[4] = {
+        &params->forget_gate, &params->input_gate, &params->cell_gate, &params->output_gate};
+    const int32_t input_size = params->input_size;
+    const int32_t hidden_size = params->hidden_size;
+
+    for (int32_t i_gate = 0; i_gate < 4; i_gate++)
+    {
+        const cmsis_nn_lstm_gate *gate = gates[i_gate];
+        if (gate->input_weights == NULL || gate->input_effective_bias == NULL || gate->hidden_weights == NULL ||
+            gate->hidden_effective_bias == NULL)
+        {
+            return ARM_CMSIS_NN_ARG_ERROR;
+        }
+    }
+
+    for (int32_t i_unit = 0; i_unit < hidden_size; i_unit++)
+    {
+        for (int32_t i_gate = 0; i_gate < 4; i_gate++)
+        {
+            const cmsis_nn_lstm_gate *gate = gates[i_gate];
+            const int32_t row = 4 * i_unit + i_gate;
+
+            arm_memcpy_s8(input_weights + row * input_size,
+                          (const int8_t *)gate->input_weights + i_unit * input_size,
+                          input_size);
+            arm_memcpy_s8(hidden_weights + row * hidden_size,
+                          (const int8_t *)gate->hidden_weights + i_unit * hidden_size,
+                          hidden_size);
+            input_effective_bias[row] = ((const int64_t *)gate->input_effective_bias)[i_unit];
+            hidden_effective_bias[row] = ((const int64_t *)gate->hidden_effective_bias)[i_unit];
+        }
+    }
+
+    fused_gates->input_weights = input_weights;
+    fused_gates->input_effective_bias = input_effective_bias;
+    fused_gates->hidden_weights = hidden_weights;
+    fused_gates->hidden_effective_bias = hidden_effective_bias;
+
+    return ARM_CMSIS_NN_SUCCESS;
+}
+
+/**
+ * @} end of LSTM group
+ */
@@ -0,0 +1,131 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_broadcast.c
+ * Description:  Loop nest of broadcasting elementwise operations
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target :  Arm(R) M-Profile Architecture, RISC-V
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnsupportfunctions.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup supportElementwise Elementwise
+ *
+ * Support functions for broadcasting elementwise operations
+ *
+ * @{
+ */
+
+#define BROADCAST_NONE (0)
+#define BROADCAST_INPUT_1 (1)
+#define BROADCAST_INPUT_2 (2)
+
+/*
+ * Plan the loops of a broadcasting elementwise operation.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_cmsis_nn_status arm_nn_broadcast_init(const cmsis_nn_dims *input_1_dims,
+                                          const cmsis_nn_dims *input_2_dims,
+                                          const cmsis_nn_dims *output_dims,
+                                          cmsis_nn_broadcast *broadcast)
+{
+    const int32_t dims_1[4] = {input_1_dims->n, input_1_dims->h, input_1_dims->w, input_1_dims->c};
+    const int32_t dims_2[4] = {input_2_dims->n, input_2_dims->h, input_2_dims->w, input_2_dims->c};
+    const int32_t dims_out[4] = {output_dims->n, output_dims->h, output_dims->w, output_dims->c};
+
+    /* Merged dimensions, innermost first */
+    int32_t size[4];
+    int32_t stride_1[4];
+    int32_t stride_2[4];
+    int32_t num_dims = 0;
+    int32_t prev_type = -1;
+    int32_t elements_1 = 1;
+    int32_t elements_2 = 1;
+
+    for (int32_t i = 3; i >= 0; i--)
+    {
+        if (dims_out[i] != MAX(dims_1[i], dims_2[i]) || (dims_1[i] != 1 && dims_1[i] != dims_out[i]) ||
+            (dims_2[i] != 1 && dims_2[i] != dims_out[i]))
+        {
+            return ARM_CMSIS_NN_ARG_ERROR;
+        }
+        if (dims_out[i] == 1)
+        {
+            continue;
+        }
+
+        int32_t type = BROADCAST_NONE;
+        if (dims_1[i] != dims_2[i])
+        {
+            type = dims_1[i] == 1 ? BROADCAST_INPUT_1 : BROADCAST_INPUT_2;
+        }
+
+        if (type == prev_type)
+        {
+            size[num_dims - 1] *= dims_out[i];
+        }
+        else
+        {
+            size[num_dims] = dims_out[i];
+            stride_1[num_dims] = type == BROADCAST_INPUT_1 ? 0 : elements_1;
+            stride_2[num_dims] = type == BROADCAST_INPUT_2 ? 0 : elements_2;
+            num_dims++;
+            prev_type = type;
+        }
+        elements_1 *= dims_1[i];
+        elements_2 *= dims_2[i];
+    }
+
+    if (num_dims == 0)
+    {
+        size[0] = 1;
+        stride_1[0] = 1;
+        stride_2[0] = 1;
+        num_dims = 1;
+    }
+
+    broadcast->inner_size = size[0];
+    broadcast->inner_stride_1 = stride_1[0];
+    broadcast->inner_stride_2 = stride_2[0];
+    for (int32_t i = 0; i < 3; i++)
+    {
+        const int32_t dim = 3 - i;
+        broadcast->outer_size[i] = dim < num_dims ? size[dim] : 1;
+        broadcast->outer_stride_1[i] = dim < num_dims ? stride_1[dim] : 0;
+        broadcast->outer_stride_2[i] = dim < num_dims ? stride_2[dim] : 0;
+    }
+
+    return ARM_CMSIS_NN_SUCCESS;
+}
+
+/**
+ * @} end of supportElementwise group
+ */
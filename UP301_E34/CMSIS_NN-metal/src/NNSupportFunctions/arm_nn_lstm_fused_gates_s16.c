@@ -0,0 +1,147 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_lstm_fused_gates_s16.c
+ * Description:  All four LSTM gates in one pass over the input, int16x8_16 version
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target :  Arm(R) M-Profile Architecture, RISC-V
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup supportLSTM
+ * @{
+ */
+
+// Accumulates the dot products of lhs with four consecutive rows of rhs. Blocks of MAX_COL_COUNT columns are summed in
+// 32 bits, which cannot overflow for s16 x s8 products, before they are added to the 64 bit accumulators.
+static void dot_4_rows_s16(const int16_t *lhs, const int8_t *rhs, const int32_t cols, int64_t *acc)
+{
+    const int8_t *rhs_0 = rhs;
+    const int8_t *rhs_1 = rhs_0 + cols;
+    const int8_t *rhs_2 = rhs_1 + cols;
+    const int8_t *rhs_3 = rhs_2 + cols;
+
+    for (int32_t col = 0; col < cols; col += MAX_COL_COUNT)
+    {
+        const int32_t block_end = MIN(col + MAX_COL_COUNT, cols);
+        int32_t acc_0 = 0;
+        int32_t acc_1 = 0;
+        int32_t acc_2 = 0;
+        int32_t acc_3 = 0;
+
+        for (int32_t i = col; i < block_end; i++)
+        {
+            const int32_t lhs_value = lhs[i];
+            acc_0 += lhs_value * rhs_0[i];
+            acc_1 += lhs_value * rhs_1[i];
+            acc_2 += lhs_value * rhs_2[i];
+            acc_3 += lhs_value * rhs_3[i];
+        }
+
+        acc[0] += acc_0;
+        acc[1] += acc_1;
+        acc[2] += acc_2;
+        acc[3] += acc_3;
+    }
+}
+
+/*
+ * Calculates all four LSTM gates of a range of hidden units, int16x8_16 version.
+ * Refer to header file for details
+ */
+arm_cmsis_nn_status arm_nn_lstm_fused_gates_s16(const int16_t *data_in,
+                                                const int16_t *hidden_in,
+                                                const cmsis_nn_lstm_params *params,
+                                                const int32_t unit_start,
+                                                const int32_t num_units,
+                                                int16_t *forget_gate,
+                                                int16_t *input_gate,
+                                                int16_t *cell_gate,
+                                                int16_t *output_gate)
+{
+    const cmsis_nn_lstm_fused_gates *fused = params->fused_gates;
+    const cmsis_nn_lstm_gate *gates[4] = {
+        &params->forget_gate, &params->input_gate, &params->cell_gate, &params->output_gate};
+    int16_t *dst[4] = {forget_gate, input_gate, cell_gate, output_gate};
+
+    const int32_t input_size = params->input_size;
+    const int32_t hidden_size = params->hidden_size;
+    const int8_t *input_weights = fused->input_weights + 4 * unit_start * input_size;
+    const int8_t *hidden_weights = fused->hidden_weights + 4 * unit_start * hidden_size;
+    const int64_t *input_bias = (const int64_t *)fused->input_effective_bias + 4 * unit_start;
+    const int64_t *hidden_bias = (const int64_t *)fused->hidden_effective_bias + 4 * unit_start;
+
+    for (int32_t i_unit = 0; i_unit < num_units; i_unit++)
+    {
+        int64_t acc[4] = {input_bias[0], input_bias[1], input_bias[2], input_bias[3]};
+        int32_t result[4];
+
+        dot_4_rows_s16(data_in, input_weights, input_size, acc);
+        for (int32_t i_gate = 0; i_gate < 4; i_gate++)
+        {
+            result[i_gate] = arm_nn_requantize_s64(
+                acc[i_gate], REDUCE_MULTIPLIER(gates[i_gate]->input_multiplier), gates[i_gate]->input_shift);
+            result[i_gate] = CLAMP(result[i_gate], NN_Q15_MAX, NN_Q15_MIN);
+        }
+
+        if (hidden_in)
+        {
+            int64_t hidden_acc[4] = {hidden_bias[0], hidden_bias[1], hidden_bias[2], hidden_bias[3]};
+            dot_4_rows_s16(hidden_in, hidden_weights, hidden_size, hidden_acc);
+            for (int32_t i_gate = 0; i_gate < 4; i_gate++)
+            {
+                result[i_gate] += arm_nn_requantize_s64(hidden_acc[i_gate],
+                                                        REDUCE_MULTIPLIER(gates[i_gate]->hidden_multiplier),
+                                                        gates[i_gate]->hidden_shift);
+                result[i_gate] = CLAMP(result[i_gate], NN_Q15_MAX, NN_Q15_MIN);
+            }
+        }
+
+        for (int32_t i_gate = 0; i_gate < 4; i_gate++)
+        {
+            dst[i_gate][i_unit] = (int16_t)result[i_gate];
+        }
+
+        input_weights += 4 * input_size;
+        hidden_weights += 4 * hidden_size;
+        input_bias += 4;
+        hidden_bias += 4;
+    }
+
+    for (int32_t i_gate = 0; i_gate < 4; i_gate++)
+    {
+        arm_nn_activation_s16(dst[i_gate], dst[i_gate], num_units, 0, gates[i_gate]->activation_type);
+    }
+
+    return ARM_CMSIS_NN_SUCCESS;
+}
+/**
+ * @} end of supportLSTM group
+ */
@@ -39,6 +39,86 @@
  * @{
  */
 
+// Computes the step a few hidden units at a time: the fused gate kernel produces all four gates of a unit in one pass
+// over the inputs, so the gates of a chunk are kept in the two scratch buffers until the cell and hidden state of the
+// chunk are updated.
+static arm_cmsis_nn_status lstm_step_fused_s16(const int16_t *data_in,
+                                               const int16_t *hidden_in,
+                                               int16_t *hidden_out,
+                                               const cmsis_nn_lstm_params *params,
+                                               cmsis_nn_lstm_context *buffers,
+                                               const int32_t batch_offset,
+                                               const int32_t chunk_units)
+{
+    const int32_t input_size = params->input_size;
+    const int32_t hidden_size = params->hidden_size;
+
+    for (int32_t i_batch = 0; i_batch < params->batch_size; i_batch++)
+    {
+        const int16_t *batch_data_in = data_in + i_batch * input_size * batch_offset;
+        const int16_t *batch_hidden_in = hidden_in ? hidden_in + i_batch * hidden_size * batch_offset : NULL;
+        int16_t *batch_hidden_out = hidden_out + i_batch * hidden_size * batch_offset;
+        int16_t *batch_cell_state = (int16_t *)buffers->cell_state + i_batch * hidden_size;
+
+        for (int32_t unit_start = 0; unit_start < hidden_size; unit_start += chunk_units)
+        {
+            const int32_t num_units = MIN(chunk_units, hidden_size - unit_start);
+            int16_t *forget_gate = buffers->temp1;
+            int16_t *input_gate = forget_gate + num_units;
+            int16_t *cell_gate = buffers->temp2;
+            int16_t *output_gate = cell_gate + num_units;
+            int16_t *hidden_temp = forget_gate;
+            int16_t *cell_state = batch_cell_state + unit_start;
+
+            arm_nn_lstm_fused_gates_s16(batch_data_in,
+                                    batch_hidden_in,
+                                    params,
+                                    unit_start,
+                                    num_units,
+                                    forget_gate,
+                                    input_gate,
+                                    cell_gate,
+                                    output_gate);
+
+            arm_elementwise_mul_s16(forget_gate,
+                                    cell_state,
+                                    0,
+                                    0,
+                                    cell_state,
+                                    0,
+                                    params->forget_to_cell_multiplier,
+                                    params->forget_to_cell_shift,
+                                    NN_Q15_MIN,
+                                    NN_Q15_MAX,
+                                    num_units);
+            arm_elementwise_mul_acc_s16(input_gate,
+                                        cell_gate,
+                                        0,
+                                        0,
+                                        cell_state,
+                                        0,
+                                        params->input_to_cell_multiplier,
+                                        params->input_to_cell_shift,
+                                        -params->cell_clip,
+                                        params->cell_clip,
+                                        num_units);
+
+            arm_nn_activation_s16(cell_state, hidden_temp, num_units, params->cell_scale_power + 12, ARM_TANH);
+            arm_elementwise_mul_s16_batch_offset(output_gate,
+                                                 hidden_temp,
+                                                 batch_hidden_out + unit_start,
+                                                 params->output_offset,
+                                                 params->output_multiplier,
+                                                 params->output_shift,
+                                                 num_units,
+                                                 1,
+                                                 batch_offset);
+        }
+    }
+
+    return ARM_CMSIS_NN_SUCCESS;
+}
+
 /*
  * Calculate the output state tensor of an LSTM step, s16 input/output/weights and s16 internal buffers version.
  * Refer to header file for details.
@@ -50,6 +130,16 @@ arm_cmsis_nn_status arm_nn_lstm_step_s16(const int16_t *data_in,
                                          cmsis_nn_lstm_context *buffers,
                                          const int32_t batch_offset)
 {
+    if (params->fused_gates != NULL)
+    {
+        // Two gates of a chunk share each scratch buffer of hidden_size * batch_size elements.
+        const int32_t chunk_units = MIN(params->hidden_size, params->hidden_size * params->batch_size / 2);
+        if (chunk_units > 0)
+        {
+            return lstm_step_fused_s16(data_in, hidden_in, hidden_out, params, buffers, batch_offset, chunk_units);
+        }
+    }
+
     int16_t *forget_gate = buffers->temp1;
     int16_t *input_gate = buffers->temp1;
     int16_t *cell_gate = buffers->temp2;
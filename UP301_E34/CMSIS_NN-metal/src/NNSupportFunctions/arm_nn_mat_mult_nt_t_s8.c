@@ -39,6 +39,17 @@
  * @{
  */
 
+#if defined(ARM_MATH_RISCV) && !defined(ARM_MATH_MVEI) && !defined(ARM_MATH_DSP)
+static inline int8_t
+requantize_clamp_s8(int32_t acc, int32_t multiplier, int32_t shift, int32_t dst_offset, int32_t act_min, int32_t act_max)
+{
+    acc = arm_nn_requantize(acc, multiplier, shift) + dst_offset;
+    acc = MAX(acc, act_min);
+    acc = MIN(acc, act_max);
+    return (int8_t)acc;
+}
+#endif
+
 /*
  * s8 matrix multiplication with the right-hand-side matrix transposed
  *
@@ -621,6 +632,210 @@ arm_cmsis_nn_status arm_nn_mat_mult_nt_t_s8(const int8_t *lhs,
             dst_ptr += rhs_rows;
         }
     }
+#elif defined(ARM_MATH_RISCV)
+    (void)row_address_offset;
+    /* 4x4 output blocks: four lhs rows against four rhs rows keep 16 accumulators, four rhs values and eight row
+     * pointers in the integer register file, so each loaded byte feeds four multiply-accumulates. */
+    int32_t rhs_rows_idx = 0;
+    for (; rhs_rows_idx <= (rhs_rows - 4); rhs_rows_idx += 4)
+    {
+        const int8_t *rhs_0 = rhs + rhs_rows_idx * rhs_cols;
+        const int8_t *rhs_1 = rhs_0 + rhs_cols;
+        const int8_t *rhs_2 = rhs_1 + rhs_cols;
+        const int8_t *rhs_3 = rhs_2 + rhs_cols;
+
+        int32_t lhs_offset_contribution0 = 0;
+        int32_t lhs_offset_contribution1 = 0;
+        int32_t lhs_offset_contribution2 = 0;
+        int32_t lhs_offset_contribution3 = 0;
+        for (int32_t x = 0; x < rhs_cols; ++x)
+        {
+            lhs_offset_contribution0 += rhs_0[x];
+            lhs_offset_contribution1 += rhs_1[x];
+            lhs_offset_contribution2 += rhs_2[x];
+            lhs_offset_contribution3 += rhs_3[x];
+        }
+        lhs_offset_contribution0 *= lhs_offset;
+        lhs_offset_contribution1 *= lhs_offset;
+        lhs_offset_contribution2 *= lhs_offset;
+        lhs_offset_contribution3 *= lhs_offset;
+        if (bias)
+        {
+            lhs_offset_contribution0 += bias[rhs_rows_idx];
+            lhs_offset_contribution1 += bias[rhs_rows_idx + 1];
+            lhs_offset_contribution2 += bias[rhs_rows_idx + 2];
+            lhs_offset_contribution3 += bias[rhs_rows_idx + 3];
+        }
+
+        const int32_t mult0 = dst_multipliers[rhs_rows_idx];
+        const int32_t mult1 = dst_multipliers[rhs_rows_idx + 1];
+        const int32_t mult2 = dst_multipliers[rhs_rows_idx + 2];
+        const int32_t mult3 = dst_multipliers[rhs_rows_idx + 3];
+        const int32_t shift0 = dst_shifts[rhs_rows_idx];
+        const int32_t shift1 = dst_shifts[rhs_rows_idx + 1];
+        const int32_t shift2 = dst_shifts[rhs_rows_idx + 2];
+        const int32_t shift3 = dst_shifts[rhs_rows_idx + 3];
+
+        const int8_t *lhs_ptr = lhs;
+        int8_t *dst_ptr = dst + rhs_rows_idx;
+
+        int32_t lhs_rows_idx = 0;
+        for (; lhs_rows_idx <= (lhs_rows - 4); lhs_rows_idx += 4)
+        {
+            const int8_t *lhs_0 = lhs_ptr;
+            const int8_t *lhs_1 = lhs_0 + lhs_cols_offset;
+            const int8_t *lhs_2 = lhs_1 + lhs_cols_offset;
+            const int8_t *lhs_3 = lhs_2 + lhs_cols_offset;
+            const int8_t *rhs_ptr_0 = rhs_0;
+            const int8_t *rhs_ptr_1 = rhs_1;
+            const int8_t *rhs_ptr_2 = rhs_2;
+            const int8_t *rhs_ptr_3 = rhs_3;
+
+            int32_t res00 = lhs_offset_contribution0;
+            int32_t res01 = lhs_offset_contribution1;
+            int32_t res02 = lhs_offset_contribution2;
+            int32_t res03 = lhs_offset_contribution3;
+            int32_t res10 = lhs_offset_contribution0;
+            int32_t res11 = lhs_offset_contribution1;
+            int32_t res12 = lhs_offset_contribution2;
+            int32_t res13 = lhs_offset_contribution3;
+            int32_t res20 = lhs_offset_contribution0;
+            int32_t res21 = lhs_offset_contribution1;
+            int32_t res22 = lhs_offset_contribution2;
+            int32_t res23 = lhs_offset_contribution3;
+            int32_t res30 = lhs_offset_contribution0;
+            int32_t res31 = lhs_offset_contribution1;
+            int32_t res32 = lhs_offset_contribution2;
+            int32_t res33 = lhs_offset_contribution3;
+
+            for (int32_t rhs_cols_idx = rhs_cols; rhs_cols_idx != 0; rhs_cols_idx--)
+            {
+                const int32_t rhs_value0 = *rhs_ptr_0++;
+                const int32_t rhs_value1 = *rhs_ptr_1++;
+                const int32_t rhs_value2 = *rhs_ptr_2++;
+                const int32_t rhs_value3 = *rhs_ptr_3++;
+
+                int32_t lhs_value = *lhs_0++;
+                res00 += lhs_value * rhs_value0;
+                res01 += lhs_value * rhs_value1;
+                res02 += lhs_value * rhs_value2;
+                res03 += lhs_value * rhs_value3;
+
+                lhs_value = *lhs_1++;
+                res10 += lhs_value * rhs_value0;
+                res11 += lhs_value * rhs_value1;
+                res12 += lhs_value * rhs_value2;
+                res13 += lhs_value * rhs_value3;
+
+                lhs_value = *lhs_2++;
+                res20 += lhs_value * rhs_value0;
+                res21 += lhs_value * rhs_value1;
+                res22 += lhs_value * rhs_value2;
+                res23 += lhs_value * rhs_value3;
+
+                lhs_value = *lhs_3++;
+                res30 += lhs_value * rhs_value0;
+                res31 += lhs_value * rhs_value1;
+                res32 += lhs_value * rhs_value2;
+                res33 += lhs_value * rhs_value3;
+            }
+
+            dst_ptr[0] = requantize_clamp_s8(res00, mult0, shift0, dst_offset, activation_min, activation_max);
+            dst_ptr[1] = requantize_clamp_s8(res01, mult1, shift1, dst_offset, activation_min, activation_max);
+            dst_ptr[2] = requantize_clamp_s8(res02, mult2, shift2, dst_offset, activation_min, activation_max);
+            dst_ptr[3] = requantize_clamp_s8(res03, mult3, shift3, dst_offset, activation_min, activation_max);
+            dst_ptr += rhs_rows;
+            dst_ptr[0] = requantize_clamp_s8(res10, mult0, shift0, dst_offset, activation_min, activation_max);
+            dst_ptr[1] = requantize_clamp_s8(res11, mult1, shift1, dst_offset, activation_min, activation_max);
+            dst_ptr[2] = requantize_clamp_s8(res12, mult2, shift2, dst_offset, activation_min, activation_max);
+            dst_ptr[3] = requantize_clamp_s8(res13, mult3, shift3, dst_offset, activation_min, activation_max);
+            dst_ptr += rhs_rows;
+            dst_ptr[0] = requantize_clamp_s8(res20, mult0, shift0, dst_offset, activation_min, activation_max);
+            dst_ptr[1] = requantize_clamp_s8(res21, mult1, shift1, dst_offset, activation_min, activation_max);
+            dst_ptr[2] = requantize_clamp_s8(res22, mult2, shift2, dst_offset, activation_min, activation_max);
+            dst_ptr[3] = requantize_clamp_s8(res23, mult3, shift3, dst_offset, activation_min, activation_max);
+            dst_ptr += rhs_rows;
+            dst_ptr[0] = requantize_clamp_s8(res30, mult0, shift0, dst_offset, activation_min, activation_max);
+            dst_ptr[1] = requantize_clamp_s8(res31, mult1, shift1, dst_offset, activation_min, activation_max);
+            dst_ptr[2] = requantize_clamp_s8(res32, mult2, shift2, dst_offset, activation_min, activation_max);
+            dst_ptr[3] = requantize_clamp_s8(res33, mult3, shift3, dst_offset, activation_min, activation_max);
+            dst_ptr += rhs_rows;
+
+            lhs_ptr += 4 * lhs_cols_offset;
+        }
+
+        // Left-over lhs rows, one at a time against the same four rhs rows
+        for (; lhs_rows_idx < lhs_rows; lhs_rows_idx++)
+        {
+            const int8_t *lhs_0 = lhs_ptr;
+            const int8_t *rhs_ptr_0 = rhs_0;
+            const int8_t *rhs_ptr_1 = rhs_1;
+            const int8_t *rhs_ptr_2 = rhs_2;
+            const int8_t *rhs_ptr_3 = rhs_3;
+
+            int32_t res00 = lhs_offset_contribution0;
+            int32_t res01 = lhs_offset_contribution1;
+            int32_t res02 = lhs_offset_contribution2;
+            int32_t res03 = lhs_offset_contribution3;
+
+            for (int32_t rhs_cols_idx = rhs_cols; rhs_cols_idx != 0; rhs_cols_idx--)
+            {
+                const int32_t lhs_value = *lhs_0++;
+                res00 += lhs_value * *rhs_ptr_0++;
+                res01 += lhs_value * *rhs_ptr_1++;
+                res02 += lhs_value * *rhs_ptr_2++;
+                res03 += lhs_value * *rhs_ptr_3++;
+            }
+
+            dst_ptr[0] = requantize_clamp_s8(res00, mult0, shift0, dst_offset, activation_min, activation_max);
+            dst_ptr[1] = requantize_clamp_s8(res01, mult1, shift1, dst_offset, activation_min, activation_max);
+            dst_ptr[2] = requantize_clamp_s8(res02, mult2, shift2, dst_offset, activation_min, activation_max);
+            dst_ptr[3] = requantize_clamp_s8(res03, mult3, shift3, dst_offset, activation_min, activation_max);
+            dst_ptr += rhs_rows;
+
+            lhs_ptr += lhs_cols_offset;
+        }
+    }
+
+    // Left-over rhs rows
+    for (; rhs_rows_idx < rhs_rows; rhs_rows_idx++)
+    {
+        const int8_t *rhs_0 = rhs + rhs_rows_idx * rhs_cols;
+        int32_t lhs_offset_contribution0 = 0;
+        for (int32_t x = 0; x < rhs_cols; ++x)
+        {
+            lhs_offset_contribution0 += rhs_0[x];
+        }
+        lhs_offset_contribution0 *= lhs_offset;
+        if (bias)
+        {
+            lhs_offset_contribution0 += bias[rhs_rows_idx];
+        }
+
+        const int8_t *lhs_ptr = lhs;
+        int8_t *dst_ptr = dst + rhs_rows_idx;
+
+        for (int32_t lhs_rows_idx = 0; lhs_rows_idx < lhs_rows; ++lhs_rows_idx)
+        {
+            const int8_t *lhs_0 = lhs_ptr;
+            const int8_t *rhs_ptr_0 = rhs_0;
+            int32_t res00 = lhs_offset_contribution0;
+
+            for (int32_t rhs_cols_idx = rhs_cols; rhs_cols_idx != 0; rhs_cols_idx--)
+            {
+                res00 += *lhs_0++ * *rhs_ptr_0++;
+            }
+
+            dst_ptr[0] = requantize_clamp_s8(res00,
+                                             dst_multipliers[rhs_rows_idx],
+                                             dst_shifts[rhs_rows_idx],
+                                             dst_offset,
+                                             activation_min,
+                                             activation_max);
+            dst_ptr += rhs_rows;
+            lhs_ptr += lhs_cols_offset;
+        }
+    }
 #else
     (void)row_address_offset;
     for (int32_t rhs_rows_idx = 0; rhs_rows_idx <= (rhs_rows - 2); rhs_rows_idx += 2)
@@ -0,0 +1,71 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_pack_s4.c
+ * Description:  Packs int8 values in the int4 range two per byte
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target :  Arm(R) M-Profile Architecture, RISC-V
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnsupportfunctions.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup supportConversion
+ * @{
+ */
+
+void arm_nn_pack_s4(const int8_t *src, int32_t num_elements, int8_t *dst, const int32_t dst_offset)
+{
+    dst += dst_offset >> 1;
+
+    /* Odd start, only the high nibble of the first byte is written */
+    if ((dst_offset & 1) && num_elements > 0)
+    {
+        *dst = (int8_t)(((uint8_t)*dst & 0x0F) | ((uint8_t)*src++ << 4));
+        dst++;
+        num_elements--;
+    }
+
+    int32_t block_cnt = num_elements >> 1;
+    while (block_cnt > 0)
+    {
+        *dst++ = (int8_t)(((uint8_t)src[0] & 0x0F) | ((uint8_t)src[1] << 4));
+        src += 2;
+        block_cnt--;
+    }
+
+    /* Odd end, only the low nibble of the last byte is written */
+    if (num_elements & 1)
+    {
+        *dst = (int8_t)(((uint8_t)*dst & 0xF0) | ((uint8_t)*src & 0x0F));
+    }
+}
+
+/**
+ * @} end of Doxygen group
+ */
@@ -0,0 +1,115 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_parallel.c
+ * Description:  Splitting of a layer into slices and dispatch to scheduler workers
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target :  Arm(R) M-Profile Architecture, RISC-V
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup Public
+ */
+
+/**
+ * @addtogroup Parallel
+ * @{
+ */
+
+/*
+ * Split [0, total) evenly over the scheduler workers and run the task on each slice.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_cmsis_nn_status
+arm_nn_parallel_run(const cmsis_nn_scheduler *scheduler, cmsis_nn_task task, const void *args, int32_t total)
+{
+    if (scheduler == NULL || task == NULL || scheduler->worker_ctx == NULL || scheduler->num_workers < 1 ||
+        scheduler->num_workers > CMSIS_NN_MAX_WORKERS || total < 0)
+    {
+        return ARM_CMSIS_NN_ARG_ERROR;
+    }
+
+    const int32_t num_slices = MIN(scheduler->num_workers, total);
+    cmsis_nn_slice slices[CMSIS_NN_MAX_WORKERS];
+    for (int32_t i = 0; i < num_slices; i++)
+    {
+        slices[i].start = (total * i) / num_slices;
+        slices[i].end = (total * (i + 1)) / num_slices;
+    }
+
+    if (scheduler->run != NULL)
+    {
+        return scheduler->run(scheduler->platform, task, args, scheduler->worker_ctx, slices, num_slices);
+    }
+
+    for (int32_t i = 0; i < num_slices; i++)
+    {
+        const arm_cmsis_nn_status status = task(args, &scheduler->worker_ctx[i], &slices[i]);
+        if (status != ARM_CMSIS_NN_SUCCESS)
+        {
+            return status;
+        }
+    }
+    return ARM_CMSIS_NN_SUCCESS;
+}
+
+/**
+ * @} end of Parallel group
+ */
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup supportParallel
+ * @{
+ */
+
+void arm_nn_row_slice(const cmsis_nn_slice *rows,
+                      const int32_t input_h,
+                      const int32_t kernel_h,
+                      const int32_t stride_h,
+                      const int32_t dilation_h,
+                      const int32_t pad_h,
+                      int32_t *input_start,
+                      int32_t *input_rows,
+                      int32_t *slice_pad_h)
+{
+    const int32_t first_row = rows->start * stride_h - pad_h;
+    const int32_t last_row = (rows->end - 1) * stride_h - pad_h + (kernel_h - 1) * dilation_h;
+
+    *input_start = MAX(first_row, 0);
+    *slice_pad_h = *input_start - first_row;
+    *input_rows = MAX(MIN(last_row + 1, input_h) - *input_start, 0);
+}
+
+/**
+ * @} end of supportParallel group
+ */
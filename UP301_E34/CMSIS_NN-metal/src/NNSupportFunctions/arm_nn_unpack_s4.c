@@ -0,0 +1,70 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_unpack_s4.c
+ * Description:  Unpacks int4 values stored two per byte to int8
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target :  Arm(R) M-Profile Architecture, RISC-V
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnsupportfunctions.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup supportConversion
+ * @{
+ */
+
+void arm_nn_unpack_s4(const int8_t *src, const int32_t src_offset, int32_t num_elements, int8_t *dst)
+{
+    src += src_offset >> 1;
+
+    /* Odd start, the first element is the high nibble */
+    if ((src_offset & 1) && num_elements > 0)
+    {
+        *dst++ = (int8_t)(*src++ >> 4);
+        num_elements--;
+    }
+
+    int32_t block_cnt = num_elements >> 1;
+    while (block_cnt > 0)
+    {
+        const int8_t in = *src++;
+        *dst++ = (int8_t)((int8_t)(in << 4) >> 4);
+        *dst++ = (int8_t)(in >> 4);
+        block_cnt--;
+    }
+
+    if (num_elements & 1)
+    {
+        *dst = (int8_t)((int8_t)(*src << 4) >> 4);
+    }
+}
+
+/**
+ * @} end of Doxygen group
+ */
@@ -46,6 +46,168 @@
  * @{
  */
 
+#if defined(ARM_MATH_RISCV) && !defined(ARM_MATH_MVEI) && !defined(ARM_MATH_DSP)
+static inline int8_t
+requantize_clamp_s8(int32_t acc, int32_t multiplier, int32_t shift, int32_t dst_offset, int32_t act_min, int32_t act_max)
+{
+    acc = arm_nn_requantize(acc, multiplier, shift) + dst_offset;
+    acc = MAX(acc, act_min);
+    acc = MIN(acc, act_max);
+    return (int8_t)acc;
+}
+
+/*
+ * 8x2 blocked kernel: eight rhs rows per pass and two columns per iteration. The two offset lhs values are loaded
+ * once and reused by all eight rows, and the eight accumulators plus eight row pointers stay in registers.
+ * The rhs offset term is the same for every row, (sum of offset lhs) * rhs_offset, so it is computed once.
+ */
+static void vec_mat_mult_t_s8_riscv(const int8_t *lhs,
+                                    const int8_t *rhs,
+                                    const int32_t *bias,
+                                    int8_t *dst,
+                                    const int32_t lhs_offset,
+                                    const int32_t dst_offset,
+                                    const int32_t dst_multiplier,
+                                    const int32_t dst_shift,
+                                    const int32_t rhs_cols,
+                                    const int32_t rhs_rows,
+                                    const int32_t activation_min,
+                                    const int32_t activation_max,
+                                    const int32_t address_offset,
+                                    const int32_t rhs_offset)
+{
+    int32_t rhs_offset_contribution = 0;
+    if (rhs_offset)
+    {
+        for (int32_t i = 0; i < rhs_cols; i++)
+        {
+            rhs_offset_contribution += lhs[i] + lhs_offset;
+        }
+        rhs_offset_contribution *= rhs_offset;
+    }
+
+    const int32_t col_pairs = rhs_cols >> 1;
+    const int32_t col_tail = rhs_cols & 1;
+
+    int32_t row = 0;
+    for (; row <= (rhs_rows - 8); row += 8)
+    {
+        const int8_t *rhs_ptr_0 = rhs;
+        const int8_t *rhs_ptr_1 = rhs_ptr_0 + rhs_cols;
+        const int8_t *rhs_ptr_2 = rhs_ptr_1 + rhs_cols;
+        const int8_t *rhs_ptr_3 = rhs_ptr_2 + rhs_cols;
+        const int8_t *rhs_ptr_4 = rhs_ptr_3 + rhs_cols;
+        const int8_t *rhs_ptr_5 = rhs_ptr_4 + rhs_cols;
+        const int8_t *rhs_ptr_6 = rhs_ptr_5 + rhs_cols;
+        const int8_t *rhs_ptr_7 = rhs_ptr_6 + rhs_cols;
+        const int8_t *lhs_ptr = lhs;
+
+        int32_t res0 = rhs_offset_contribution;
+        int32_t res1 = rhs_offset_contribution;
+        int32_t res2 = rhs_offset_contribution;
+        int32_t res3 = rhs_offset_contribution;
+        int32_t res4 = rhs_offset_contribution;
+        int32_t res5 = rhs_offset_contribution;
+        int32_t res6 = rhs_offset_contribution;
+        int32_t res7 = rhs_offset_contribution;
+        if (bias)
+        {
+            res0 += bias[row];
+            res1 += bias[row + 1];
+            res2 += bias[row + 2];
+            res3 += bias[row + 3];
+            res4 += bias[row + 4];
+            res5 += bias[row + 5];
+            res6 += bias[row + 6];
+            res7 += bias[row + 7];
+        }
+
+        for (int32_t i = col_pairs; i != 0; i--)
+        {
+            const int32_t lhs_value0 = lhs_ptr[0] + lhs_offset;
+            const int32_t lhs_value1 = lhs_ptr[1] + lhs_offset;
+            lhs_ptr += 2;
+
+            res0 += lhs_value0 * rhs_ptr_0[0] + lhs_value1 * rhs_ptr_0[1];
+            res1 += lhs_value0 * rhs_ptr_1[0] + lhs_value1 * rhs_ptr_1[1];
+            res2 += lhs_value0 * rhs_ptr_2[0] + lhs_value1 * rhs_ptr_2[1];
+            res3 += lhs_value0 * rhs_ptr_3[0] + lhs_value1 * rhs_ptr_3[1];
+            res4 += lhs_value0 * rhs_ptr_4[0] + lhs_value1 * rhs_ptr_4[1];
+            res5 += lhs_value0 * rhs_ptr_5[0] + lhs_value1 * rhs_ptr_5[1];
+            res6 += lhs_value0 * rhs_ptr_6[0] + lhs_value1 * rhs_ptr_6[1];
+            res7 += lhs_value0 * rhs_ptr_7[0] + lhs_value1 * rhs_ptr_7[1];
+            rhs_ptr_0 += 2;
+            rhs_ptr_1 += 2;
+            rhs_ptr_2 += 2;
+            rhs_ptr_3 += 2;
+            rhs_ptr_4 += 2;
+            rhs_ptr_5 += 2;
+            rhs_ptr_6 += 2;
+            rhs_ptr_7 += 2;
+        }
+        if (col_tail)
+        {
+            const int32_t lhs_value0 = lhs_ptr[0] + lhs_offset;
+            res0 += lhs_value0 * rhs_ptr_0[0];
+            res1 += lhs_value0 * rhs_ptr_1[0];
+            res2 += lhs_value0 * rhs_ptr_2[0];
+            res3 += lhs_value0 * rhs_ptr_3[0];
+            res4 += lhs_value0 * rhs_ptr_4[0];
+            res5 += lhs_value0 * rhs_ptr_5[0];
+            res6 += lhs_value0 * rhs_ptr_6[0];
+            res7 += lhs_value0 * rhs_ptr_7[0];
+        }
+
+        dst[0] = requantize_clamp_s8(res0, dst_multiplier, dst_shift, dst_offset, activation_min, activation_max);
+        dst += address_offset;
+        dst[0] = requantize_clamp_s8(res1, dst_multiplier, dst_shift, dst_offset, activation_min, activation_max);
+        dst += address_offset;
+        dst[0] = requantize_clamp_s8(res2, dst_multiplier, dst_shift, dst_offset, activation_min, activation_max);
+        dst += address_offset;
+        dst[0] = requantize_clamp_s8(res3, dst_multiplier, dst_shift, dst_offset, activation_min, activation_max);
+        dst += address_offset;
+        dst[0] = requantize_clamp_s8(res4, dst_multiplier, dst_shift, dst_offset, activation_min, activation_max);
+        dst += address_offset;
+        dst[0] = requantize_clamp_s8(res5, dst_multiplier, dst_shift, dst_offset, activation_min, activation_max);
+        dst += address_offset;
+        dst[0] = requantize_clamp_s8(res6, dst_multiplier, dst_shift, dst_offset, activation_min, activation_max);
+        dst += address_offset;
+        dst[0] = requantize_clamp_s8(res7, dst_multiplier, dst_shift, dst_offset, activation_min, activation_max);
+        dst += address_offset;
+
+        rhs += 8 * rhs_cols;
+    }
+
+    for (; row < rhs_rows; row++)
+    {
+        const int8_t *rhs_ptr_0 = rhs;
+        const int8_t *lhs_ptr = lhs;
+
+        int32_t res0 = rhs_offset_contribution;
+        if (bias)
+        {
+            res0 += bias[row];
+        }
+
+        for (int32_t i = col_pairs; i != 0; i--)
+        {
+            res0 += (lhs_ptr[0] + lhs_offset) * rhs_ptr_0[0] + (lhs_ptr[1] + lhs_offset) * rhs_ptr_0[1];
+            lhs_ptr += 2;
+            rhs_ptr_0 += 2;
+        }
+        if (col_tail)
+        {
+            res0 += (lhs_ptr[0] + lhs_offset) * rhs_ptr_0[0];
+        }
+
+        dst[0] = requantize_clamp_s8(res0, dst_multiplier, dst_shift, dst_offset, activation_min, activation_max);
+        dst += address_offset;
+
+        rhs += rhs_cols;
+    }
+}
+#endif
+
 /*
  * s8 vector(lhs) by matrix (transposed) multiplication
  *
@@ -296,6 +458,23 @@ arm_cmsis_nn_status arm_nn_vec_mat_mult_t_s8(const int8_t *lhs,
             dst += address_offset;
         }
 
+#elif defined(ARM_MATH_RISCV)
+        (void)kernel_sum;
+
+        vec_mat_mult_t_s8_riscv(lhs,
+                                rhs,
+                                bias,
+                                dst,
+                                lhs_offset,
+                                dst_offset,
+                                dst_multiplier,
+                                dst_shift,
+                                rhs_cols,
+                                rhs_rows,
+                                activation_min,
+                                activation_max,
+                                address_offset,
+                                rhs_offset);
 #else
         (void)kernel_sum;
 
@@ -612,6 +791,23 @@ arm_cmsis_nn_status arm_nn_vec_mat_mult_t_s8(const int8_t *lhs,
             dst += address_offset;
         }
 
+#elif defined(ARM_MATH_RISCV)
+        (void)kernel_sum;
+
+        vec_mat_mult_t_s8_riscv(lhs,
+                                rhs,
+                                bias,
+                                dst,
+                                lhs_offset,
+                                dst_offset,
+                                dst_multiplier,
+                                dst_shift,
+                                rhs_cols,
+                                rhs_rows,
+                                activation_min,
+                                activation_max,
+                                address_offset,
+                                0);
 #else
         (void)kernel_sum;
 
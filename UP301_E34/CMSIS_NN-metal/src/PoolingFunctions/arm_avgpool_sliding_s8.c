@@ -0,0 +1,213 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_avgpool_sliding_s8.c
+ * Description:  s8 average pooling with separable running sums
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target :  Arm(R) M-Profile Architecture, RISC-V
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+static void add_row_s8(int32_t *sum, const int8_t *row, const int32_t length)
+{
+    for (int32_t i = 0; i < length; i++)
+    {
+        sum[i] += row[i];
+    }
+}
+
+static void sub_row_s8(int32_t *sum, const int8_t *row, const int32_t length)
+{
+    for (int32_t i = 0; i < length; i++)
+    {
+        sum[i] -= row[i];
+    }
+}
+
+static void add_row_s32(int32_t *sum, const int32_t *row, const int32_t length)
+{
+    for (int32_t i = 0; i < length; i++)
+    {
+        sum[i] += row[i];
+    }
+}
+
+static void sub_row_s32(int32_t *sum, const int32_t *row, const int32_t length)
+{
+    for (int32_t i = 0; i < length; i++)
+    {
+        sum[i] -= row[i];
+    }
+}
+
+/**
+ *  @ingroup Public
+ */
+
+/**
+ * @addtogroup Pooling
+ * @{
+ */
+
+/*
+ * s8 average pooling with a cost per output independent of the window size.
+ *
+ * Refer header file for details. col_sum holds, for every input column, the sum over the input rows of the current
+ * output row's window. It is updated by adding the rows entering and subtracting the rows leaving the window. The
+ * horizontal window sum is then slid along col_sum in the same way.
+ *
+ */
+arm_cmsis_nn_status arm_avgpool_sliding_s8(const cmsis_nn_context *ctx,
+                                           const cmsis_nn_pool_params *pool_params,
+                                           const cmsis_nn_dims *input_dims,
+                                           const int8_t *src,
+                                           const cmsis_nn_dims *filter_dims,
+                                           const cmsis_nn_dims *output_dims,
+                                           int8_t *dst)
+{
+    const int32_t input_y = input_dims->h;
+    const int32_t input_x = input_dims->w;
+    const int32_t output_y = output_dims->h;
+    const int32_t output_x = output_dims->w;
+    const int32_t stride_y = pool_params->stride.h;
+    const int32_t stride_x = pool_params->stride.w;
+    const int32_t kernel_y = filter_dims->h;
+    const int32_t kernel_x = filter_dims->w;
+    const int32_t pad_y = pool_params->padding.h;
+    const int32_t pad_x = pool_params->padding.w;
+    const int32_t act_min = pool_params->activation.min;
+    const int32_t act_max = pool_params->activation.max;
+    const int32_t ch_src = input_dims->c;
+    const int32_t row_size = input_x * ch_src;
+    int32_t batch_cnt = input_dims->n;
+
+    if (batch_cnt < 1 || ctx == NULL || ctx->buf == NULL || stride_x < 1 || stride_y < 1 || output_x < 1 ||
+        output_y < 1)
+    {
+        return ARM_CMSIS_NN_ARG_ERROR;
+    }
+
+    // Every window must cover at least one input element. Windows only move forward, so the first and last suffice.
+    if (pad_x >= kernel_x || pad_y >= kernel_y || (output_x - 1) * stride_x - pad_x >= input_x ||
+        (output_y - 1) * stride_y - pad_y >= input_y)
+    {
+        return ARM_CMSIS_NN_ARG_ERROR;
+    }
+
+    int32_t *col_sum = (int32_t *)ctx->buf;
+    int32_t *sum = col_sum + row_size;
+
+    while (batch_cnt)
+    {
+        /* col_sum holds the sum of input rows [rows_start, rows_end) */
+        int32_t rows_start = 0;
+        int32_t rows_end = 0;
+
+        for (int32_t i_y = 0, idx_y = -pad_y; i_y < output_y; idx_y += stride_y, i_y++)
+        {
+            const int32_t y_start = MAX(0, idx_y);
+            const int32_t y_end = MIN(idx_y + kernel_y, input_y);
+
+            if (y_start >= rows_end)
+            {
+                memset(col_sum, 0, row_size * sizeof(int32_t));
+                rows_start = y_start;
+                rows_end = y_start;
+            }
+            for (; rows_end < y_end; rows_end++)
+            {
+                add_row_s8(col_sum, src + rows_end * row_size, row_size);
+            }
+            for (; rows_start < y_start; rows_start++)
+            {
+                sub_row_s8(col_sum, src + rows_start * row_size, row_size);
+            }
+
+            /* sum holds the sum of col_sum columns [cols_start, cols_end) */
+            int32_t cols_start = 0;
+            int32_t cols_end = 0;
+
+            for (int32_t i_x = 0, idx_x = -pad_x; i_x < output_x; idx_x += stride_x, i_x++)
+            {
+                const int32_t x_start = MAX(0, idx_x);
+                const int32_t x_end = MIN(idx_x + kernel_x, input_x);
+
+                if (x_start >= cols_end)
+                {
+                    memset(sum, 0, ch_src * sizeof(int32_t));
+                    cols_start = x_start;
+                    cols_end = x_start;
+                }
+                for (; cols_end < x_end; cols_end++)
+                {
+                    add_row_s32(sum, col_sum + cols_end * ch_src, ch_src);
+                }
+                for (; cols_start < x_start; cols_start++)
+                {
+                    sub_row_s32(sum, col_sum + cols_start * ch_src, ch_src);
+                }
+
+                const int32_t count = (y_end - y_start) * (x_end - x_start);
+                const int32_t half_count = count / 2;
+
+                for (int32_t i_ch = 0; i_ch < ch_src; i_ch++)
+                {
+                    int32_t result = sum[i_ch] > 0 ? (sum[i_ch] + half_count) : (sum[i_ch] - half_count);
+                    result = result / count;
+                    result = MAX(result, act_min);
+                    result = MIN(result, act_max);
+                    dst[i_ch] = (int8_t)result;
+                }
+                dst += ch_src;
+            }
+        }
+        src += input_y * row_size;
+
+        batch_cnt--;
+    }
+
+    return ARM_CMSIS_NN_SUCCESS;
+}
+
+/*
+ * Get the buffer size of arm_avgpool_sliding_s8.
+ *
+ * Refer header file for details.
+ *
+ */
+int32_t arm_avgpool_sliding_s8_get_buffer_size(const cmsis_nn_dims *input_dims,
+                                               const cmsis_nn_dims *filter_dims,
+                                               const cmsis_nn_dims *output_dims)
+{
+    (void)filter_dims;
+    (void)output_dims;
+
+    return (input_dims->w + 1) * input_dims->c * (int32_t)sizeof(int32_t);
+}
+
+/**
+ * @} end of Pooling group
+ */
@@ -167,7 +167,12 @@ arm_cmsis_nn_status arm_max_pool_s8(const cmsis_nn_context *ctx,
                                     const cmsis_nn_dims *output_dims,
                                     int8_t *dst)
 {
-    (void)ctx;
+    if (ctx != NULL && ctx->buf != NULL && arm_nn_pool_use_sliding_window(pool_params, filter_dims) &&
+        ctx->size >= arm_max_pool_sliding_s8_get_buffer_size(input_dims, filter_dims, output_dims))
+    {
+        return arm_max_pool_sliding_s8(ctx, pool_params, input_dims, src, filter_dims, output_dims, dst);
+    }
+
     const int32_t input_y = input_dims->h;
     const int32_t input_x = input_dims->w;
     const int32_t output_y = output_dims->h;
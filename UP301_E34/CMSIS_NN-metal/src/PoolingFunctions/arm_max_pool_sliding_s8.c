@@ -0,0 +1,289 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_max_pool_sliding_s8.c
+ * Description:  s8 max pooling with the van Herk/Gil-Werman algorithm
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target :  Arm(R) M-Profile Architecture, RISC-V
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+static void max_s8(int8_t *dst, const int8_t *src, const int32_t length)
+{
+    for (int32_t i = 0; i < length; i++)
+    {
+        dst[i] = MAX(dst[i], src[i]);
+    }
+}
+
+static void max_s8_to(int8_t *dst, const int8_t *src_1, const int8_t *src_2, const int32_t length)
+{
+    for (int32_t i = 0; i < length; i++)
+    {
+        dst[i] = MAX(src_1[i], src_2[i]);
+    }
+}
+
+/*
+ * Maximum over each horizontal window of one input row.
+ *
+ * The row is split into blocks of kernel_x columns. A window [x_start, x_end] that is not aligned to a block spans
+ * the tail of one block and the head of the next, so its maximum is that of the block suffix starting at x_start and
+ * the block prefix ending at x_end. Suffixes are computed once per row, prefixes while sliding.
+ */
+static void max_pool_row_s8(const int8_t *row,
+                            int8_t *out,
+                            const int32_t input_x,
+                            const int32_t output_x,
+                            const int32_t ch_src,
+                            const int32_t kernel_x,
+                            const int32_t stride_x,
+                            const int32_t pad_x,
+                            int8_t *suffix,
+                            int8_t *prefix)
+{
+    for (int32_t x = input_x - 1; x >= 0; x--)
+    {
+        if (x == input_x - 1 || (x + 1) % kernel_x == 0)
+        {
+            arm_memcpy_s8(suffix + x * ch_src, row + x * ch_src, ch_src);
+        }
+        else
+        {
+            max_s8_to(suffix + x * ch_src, row + x * ch_src, suffix + (x + 1) * ch_src, ch_src);
+        }
+    }
+
+    /* prefix holds the maximum of columns [last - last % kernel_x, prefix_end] */
+    int32_t prefix_end = -1;
+
+    for (int32_t i_x = 0, idx_x = -pad_x; i_x < output_x; idx_x += stride_x, i_x++)
+    {
+        const int32_t x_start = MAX(0, idx_x);
+        const int32_t last = MIN(idx_x + kernel_x, input_x) - 1;
+        const int32_t block_start = last - last % kernel_x;
+
+        if (prefix_end < block_start)
+        {
+            arm_memcpy_s8(prefix, row + block_start * ch_src, ch_src);
+            prefix_end = block_start;
+        }
+        for (; prefix_end < last; prefix_end++)
+        {
+            max_s8(prefix, row + (prefix_end + 1) * ch_src, ch_src);
+        }
+
+        if (x_start == block_start)
+        {
+            arm_memcpy_s8(out, prefix, ch_src);
+        }
+        else if (x_start > block_start)
+        {
+            /* Window clipped by the end of the row, which is also the end of the block */
+            arm_memcpy_s8(out, suffix + x_start * ch_src, ch_src);
+        }
+        else
+        {
+            max_s8_to(out, suffix + x_start * ch_src, prefix, ch_src);
+        }
+        out += ch_src;
+    }
+}
+
+/**
+ *  @ingroup Public
+ */
+
+/**
+ * @addtogroup Pooling
+ * @{
+ */
+
+/*
+ * s8 max pooling with a cost per output independent of the window size.
+ *
+ * Refer header file for details. The row maxima of max_pool_row_s8() are combined vertically with the same block
+ * suffix/prefix scheme, with blocks of kernel_y rows. Each input row is reduced horizontally at most twice.
+ *
+ */
+arm_cmsis_nn_status arm_max_pool_sliding_s8(const cmsis_nn_context *ctx,
+                                            const cmsis_nn_pool_params *pool_params,
+                                            const cmsis_nn_dims *input_dims,
+                                            const int8_t *src,
+                                            const cmsis_nn_dims *filter_dims,
+                                            const cmsis_nn_dims *output_dims,
+                                            int8_t *dst)
+{
+    const int32_t input_y = input_dims->h;
+    const int32_t input_x = input_dims->w;
+    const int32_t output_y = output_dims->h;
+    const int32_t output_x = output_dims->w;
+    const int32_t stride_y = pool_params->stride.h;
+    const int32_t stride_x = pool_params->stride.w;
+    const int32_t kernel_y = filter_dims->h;
+    const int32_t kernel_x = filter_dims->w;
+    const int32_t pad_y = pool_params->padding.h;
+    const int32_t pad_x = pool_params->padding.w;
+    const int32_t act_min = pool_params->activation.min;
+    const int32_t act_max = pool_params->activation.max;
+    const int32_t ch_src = input_dims->c;
+    const int32_t row_size = input_x * ch_src;
+    const int32_t out_row_size = output_x * ch_src;
+    int32_t batch_cnt = input_dims->n;
+
+    if (batch_cnt < 1 || ctx == NULL || ctx->buf == NULL || stride_x < 1 || stride_y < 1 || output_x < 1 ||
+        output_y < 1)
+    {
+        return ARM_CMSIS_NN_ARG_ERROR;
+    }
+
+    // Every window must cover at least one input element. Windows only move forward, so the first and last suffice.
+    if (pad_x >= kernel_x || pad_y >= kernel_y || (output_x - 1) * stride_x - pad_x >= input_x ||
+        (output_y - 1) * stride_y - pad_y >= input_y)
+    {
+        return ARM_CMSIS_NN_ARG_ERROR;
+    }
+
+    int8_t *row_suffix = (int8_t *)ctx->buf;
+    int8_t *row_prefix = row_suffix + kernel_y * out_row_size;
+    int8_t *row_max = row_prefix + out_row_size;
+    int8_t *col_suffix = row_max + out_row_size;
+    int8_t *col_prefix = col_suffix + row_size;
+
+    while (batch_cnt)
+    {
+        /* row_suffix holds the block starting at input row suffix_block, row_prefix rows [.., prefix_end] */
+        int32_t suffix_block = -1;
+        int32_t prefix_end = -1;
+
+        for (int32_t i_y = 0, idx_y = -pad_y; i_y < output_y; idx_y += stride_y, i_y++)
+        {
+            const int32_t y_start = MAX(0, idx_y);
+            const int32_t last = MIN(idx_y + kernel_y, input_y) - 1;
+            const int32_t block_start = last - last % kernel_y;
+
+            if (prefix_end < block_start)
+            {
+                max_pool_row_s8(src + block_start * row_size,
+                                row_prefix,
+                                input_x,
+                                output_x,
+                                ch_src,
+                                kernel_x,
+                                stride_x,
+                                pad_x,
+                                col_suffix,
+                                col_prefix);
+                prefix_end = block_start;
+            }
+            for (; prefix_end < last; prefix_end++)
+            {
+                max_pool_row_s8(src + (prefix_end + 1) * row_size,
+                                row_max,
+                                input_x,
+                                output_x,
+                                ch_src,
+                                kernel_x,
+                                stride_x,
+                                pad_x,
+                                col_suffix,
+                                col_prefix);
+                max_s8(row_prefix, row_max, out_row_size);
+            }
+
+            if (y_start == block_start)
+            {
+                arm_memcpy_s8(dst, row_prefix, out_row_size);
+            }
+            else
+            {
+                const int32_t start_block = y_start - y_start % kernel_y;
+                if (suffix_block != start_block)
+                {
+                    const int32_t block_end = MIN(start_block + kernel_y, input_y);
+                    for (int32_t y = block_end - 1; y >= start_block; y--)
+                    {
+                        int8_t *suffix = row_suffix + (y - start_block) * out_row_size;
+                        max_pool_row_s8(src + y * row_size,
+                                        suffix,
+                                        input_x,
+                                        output_x,
+                                        ch_src,
+                                        kernel_x,
+                                        stride_x,
+                                        pad_x,
+                                        col_suffix,
+                                        col_prefix);
+                        if (y < block_end - 1)
+                        {
+                            max_s8(suffix, suffix + out_row_size, out_row_size);
+                        }
+                    }
+                    suffix_block = start_block;
+                }
+
+                const int8_t *suffix = row_suffix + (y_start - start_block) * out_row_size;
+                if (start_block == block_start)
+                {
+                    /* Window clipped by the last input row, which is also the end of the block */
+                    arm_memcpy_s8(dst, suffix, out_row_size);
+                }
+                else
+                {
+                    max_s8_to(dst, suffix, row_prefix, out_row_size);
+                }
+            }
+
+            for (int32_t i = 0; i < out_row_size; i++)
+            {
+                dst[i] = (int8_t)MIN(MAX(dst[i], act_min), act_max);
+            }
+            dst += out_row_size;
+        }
+        src += input_y * row_size;
+
+        batch_cnt--;
+    }
+
+    return ARM_CMSIS_NN_SUCCESS;
+}
+
+/*
+ * Get the buffer size of arm_max_pool_sliding_s8.
+ *
+ * Refer header file for details.
+ *
+ */
+int32_t arm_max_pool_sliding_s8_get_buffer_size(const cmsis_nn_dims *input_dims,
+                                                const cmsis_nn_dims *filter_dims,
+                                                const cmsis_nn_dims *output_dims)
+{
+    return (filter_dims->h + 2) * output_dims->w * input_dims->c + (input_dims->w + 1) * input_dims->c;
+}
+
+/**
+ * @} end of Pooling group
+ */
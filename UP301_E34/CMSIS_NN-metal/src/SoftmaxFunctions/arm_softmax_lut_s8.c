@@ -0,0 +1,134 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_softmax_lut_s8.c
+ * Description:  S8 softmax function using a precomputed exponent table
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target :  Arm(R) M-Profile Architecture, RISC-V
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+#define ACCUM_BITS 12
+
+/**
+ *  @ingroup Public
+ */
+
+/**
+ * @addtogroup Softmax
+ * @{
+ */
+
+/*
+ * Fill the exponent table of the table driven s8 softmax functions.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_cmsis_nn_status arm_softmax_s8_exp_lut_init(const int32_t mult,
+                                                const int32_t shift,
+                                                const int32_t diff_min,
+                                                int32_t *exp_lut)
+{
+    if (shift < 0 || shift > 31)
+    {
+        return ARM_CMSIS_NN_ARG_ERROR;
+    }
+
+    const int32_t mask = (1 << shift);
+
+    for (int32_t i = 0; i < SOFTMAX_S8_EXP_LUT_SIZE; i++)
+    {
+        const int32_t diff = -i;
+        exp_lut[i] = diff >= diff_min ? EXP_ON_NEG(MUL_SAT(diff * mask, mult)) : 0;
+    }
+
+    return ARM_CMSIS_NN_SUCCESS;
+}
+
+/*
+ * S8 softmax function using a precomputed exponent table.
+ *
+ * Refer header file for details.
+ *
+ */
+void arm_softmax_lut_s8(const int8_t *input,
+                        const int32_t num_rows,
+                        const int32_t row_size,
+                        const int32_t *exp_lut,
+                        int8_t *output)
+{
+    int8_t out_lut[SOFTMAX_S8_EXP_LUT_SIZE];
+
+    for (int32_t row_idx = 0; row_idx < num_rows; ++row_idx)
+    {
+        int8_t max = *input;
+        for (int32_t col = 1; col < row_size; ++col)
+        {
+            max = MAX(max, input[col]);
+        }
+
+        int32_t sum = 0;
+        for (int32_t col = 0; col < row_size; ++col)
+        {
+            sum += DIV_POW2(exp_lut[max - input[col]], ACCUM_BITS);
+        }
+
+        const int32_t headroom = CLZ(sum);
+        const int32_t shifted_scale = ONE_OVER1((sum > 0 ? sum << headroom : 0) - (1 << 31));
+        const int32_t bits_over_unit = ACCUM_BITS - headroom + 23;
+
+        /* An exponent of 0, including the ones below diff_min, gives NN_Q7_MIN */
+        if (row_size > SOFTMAX_S8_EXP_LUT_SIZE)
+        {
+            for (int32_t i = 0; i < SOFTMAX_S8_EXP_LUT_SIZE; i++)
+            {
+                const int32_t res = DIV_POW2(MUL_SAT(shifted_scale, exp_lut[i]), bits_over_unit) + NN_Q7_MIN;
+                out_lut[i] = (int8_t)CLAMP(res, (int32_t)NN_Q7_MAX, (int32_t)NN_Q7_MIN);
+            }
+            for (int32_t col = 0; col < row_size; ++col)
+            {
+                output[col] = out_lut[max - input[col]];
+            }
+        }
+        else
+        {
+            for (int32_t col = 0; col < row_size; ++col)
+            {
+                const int32_t res =
+                    DIV_POW2(MUL_SAT(shifted_scale, exp_lut[max - input[col]]), bits_over_unit) + NN_Q7_MIN;
+                output[col] = (int8_t)CLAMP(res, (int32_t)NN_Q7_MAX, (int32_t)NN_Q7_MIN);
+            }
+        }
+
+        input += row_size;
+        output += row_size;
+    }
+}
+
+/**
+ * @} end of Softmax group
+ */
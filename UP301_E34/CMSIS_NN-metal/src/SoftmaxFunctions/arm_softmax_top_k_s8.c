@@ -0,0 +1,117 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_softmax_top_k_s8.c
+ * Description:  S8 softmax function returning the k largest probabilities
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target :  Arm(R) M-Profile Architecture, RISC-V
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+#define ACCUM_BITS 12
+
+/**
+ *  @ingroup Public
+ */
+
+/**
+ * @addtogroup Softmax
+ * @{
+ */
+
+/*
+ * S8 softmax function returning the k largest probabilities of every row.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_cmsis_nn_status arm_softmax_top_k_s8(const int8_t *input,
+                                         const int32_t num_rows,
+                                         const int32_t row_size,
+                                         const int32_t *exp_lut,
+                                         const int32_t k,
+                                         int8_t *scores,
+                                         int32_t *indices)
+{
+    if (k < 1 || k > row_size)
+    {
+        return ARM_CMSIS_NN_ARG_ERROR;
+    }
+
+    for (int32_t row_idx = 0; row_idx < num_rows; ++row_idx)
+    {
+        int8_t max = *input;
+        int32_t sum = 0;
+        int32_t count = 0;
+
+        /* Softmax is monotonic, so the k largest inputs are selected by insertion into the sorted indices. A later
+         * element only displaces strictly smaller ones, which keeps equal inputs in column order. */
+        for (int32_t col = 0; col < row_size; ++col)
+        {
+            const int8_t val = input[col];
+            max = MAX(max, val);
+
+            if (count == k && val <= input[indices[k - 1]])
+            {
+                continue;
+            }
+
+            int32_t pos = count < k ? count++ : k - 1;
+            while (pos > 0 && input[indices[pos - 1]] < val)
+            {
+                indices[pos] = indices[pos - 1];
+                pos--;
+            }
+            indices[pos] = col;
+        }
+
+        for (int32_t col = 0; col < row_size; ++col)
+        {
+            sum += DIV_POW2(exp_lut[max - input[col]], ACCUM_BITS);
+        }
+
+        const int32_t headroom = CLZ(sum);
+        const int32_t shifted_scale = ONE_OVER1((sum > 0 ? sum << headroom : 0) - (1 << 31));
+        const int32_t bits_over_unit = ACCUM_BITS - headroom + 23;
+
+        for (int32_t i = 0; i < k; ++i)
+        {
+            const int32_t res =
+                DIV_POW2(MUL_SAT(shifted_scale, exp_lut[max - input[indices[i]]]), bits_over_unit) + NN_Q7_MIN;
+            scores[i] = (int8_t)CLAMP(res, (int32_t)NN_Q7_MAX, (int32_t)NN_Q7_MIN);
+        }
+
+        input += row_size;
+        scores += k;
+        indices += k;
+    }
+
+    return ARM_CMSIS_NN_SUCCESS;
+}
+
+/**
+ * @} end of Softmax group
+ */
@@ -0,0 +1,287 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 UpbeatTech Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_transpose_tiled_s8.c
+ * Description:  Cache blocked N-D transpose for s8 tensors
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target :  Arm(R) M-Profile Architecture, RISC-V
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/* Side of the square tiles the 2D transpose is blocked into. Must be a multiple of 4. */
+#define TRANSPOSE_TILE_SIZE (8)
+
+/*
+ * Transposes a 4x4 block. The four source rows are read as words and the block is rearranged in registers so that
+ * every destination row is written with a single word store.
+ */
+static void transpose_4x4_s8(const int8_t *input, const int32_t in_stride, int8_t *output, const int32_t out_stride)
+{
+    const uint32_t row_0 = (uint32_t)arm_nn_read_s8x4(input);
+    const uint32_t row_1 = (uint32_t)arm_nn_read_s8x4(input + in_stride);
+    const uint32_t row_2 = (uint32_t)arm_nn_read_s8x4(input + 2 * in_stride);
+    const uint32_t row_3 = (uint32_t)arm_nn_read_s8x4(input + 3 * in_stride);
+
+    /* Interleave bytes of row pairs: t_01_even = {r0[0], r1[0], r0[2], r1[2]} etc. */
+    const uint32_t t_01_even = (row_0 & 0x00FF00FFUL) | ((row_1 << 8) & 0xFF00FF00UL);
+    const uint32_t t_01_odd = ((row_0 >> 8) & 0x00FF00FFUL) | (row_1 & 0xFF00FF00UL);
+    const uint32_t t_23_even = (row_2 & 0x00FF00FFUL) | ((row_3 << 8) & 0xFF00FF00UL);
+    const uint32_t t_23_odd = ((row_2 >> 8) & 0x00FF00FFUL) | (row_3 & 0xFF00FF00UL);
+
+    int8_t *out = output;
+    arm_nn_write_s8x4_ia(&out, (int32_t)((t_01_even & 0x0000FFFFUL) | (t_23_even << 16)));
+    out = output + out_stride;
+    arm_nn_write_s8x4_ia(&out, (int32_t)((t_01_odd & 0x0000FFFFUL) | (t_23_odd << 16)));
+    out = output + 2 * out_stride;
+    arm_nn_write_s8x4_ia(&out, (int32_t)((t_01_even >> 16) | (t_23_even & 0xFFFF0000UL)));
+    out = output + 3 * out_stride;
+    arm_nn_write_s8x4_ia(&out, (int32_t)((t_01_odd >> 16) | (t_23_odd & 0xFFFF0000UL)));
+}
+
+/*
+ * Transposes a rows x cols matrix with row pitch in_stride into a cols x rows matrix with row pitch out_stride.
+ * The matrix is processed in square tiles so that both the source rows and the destination rows touched by one tile
+ * stay resident in the data cache.
+ */
+static void transpose_2d_s8(const int8_t *input,
+                            const int32_t in_stride,
+                            int8_t *output,
+                            const int32_t out_stride,
+                            const int32_t rows,
+                            const int32_t cols)
+{
+    for (int32_t row = 0; row < rows; row += TRANSPOSE_TILE_SIZE)
+    {
+        const int32_t tile_rows = MIN(TRANSPOSE_TILE_SIZE, rows - row);
+
+        for (int32_t col = 0; col < cols; col += TRANSPOSE_TILE_SIZE)
+        {
+            const int32_t tile_cols = MIN(TRANSPOSE_TILE_SIZE, cols - col);
+            const int8_t *in_tile = input + row * in_stride + col;
+            int8_t *out_tile = output + col * out_stride + row;
+
+            if (tile_rows == TRANSPOSE_TILE_SIZE && tile_cols == TRANSPOSE_TILE_SIZE)
+            {
+                for (int32_t i = 0; i < TRANSPOSE_TILE_SIZE; i += 4)
+                {
+                    for (int32_t j = 0; j < TRANSPOSE_TILE_SIZE; j += 4)
+                    {
+                        transpose_4x4_s8(
+                            in_tile + i * in_stride + j, in_stride, out_tile + j * out_stride + i, out_stride);
+                    }
+                }
+            }
+            else
+            {
+                for (int32_t j = 0; j < tile_cols; j++)
+                {
+                    const int8_t *in = in_tile + j;
+                    int8_t *out = out_tile + j * out_stride;
+                    for (int32_t i = 0; i < tile_rows; i++)
+                    {
+                        out[i] = *in;
+                        in += in_stride;
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ *  @ingroup Public
+ */
+
+/**
+ * @addtogroup Transpose
+ * @{
+ */
+
+/*
+ * Cache blocked s8 transpose function.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_cmsis_nn_status arm_transpose_tiled_s8(const int8_t *input,
+                                           int8_t *const output,
+                                           const int32_t *const input_shape,
+                                           const cmsis_nn_transpose_params *const transpose_params)
+{
+    const int32_t num_dims = transpose_params->num_dims;
+    const uint32_t *const perm = transpose_params->permutations;
+
+    if (num_dims < 1 || num_dims > TRANSPOSE_TILED_MAX_DIMS)
+    {
+        return ARM_CMSIS_NN_ARG_ERROR;
+    }
+
+    uint32_t used_axes = 0;
+    int32_t total_size = 1;
+    for (int32_t i = 0; i < num_dims; i++)
+    {
+        if (perm[i] >= (uint32_t)num_dims || (used_axes & (1UL << perm[i])) || input_shape[i] < 0)
+        {
+            return ARM_CMSIS_NN_ARG_ERROR;
+        }
+        used_axes |= 1UL << perm[i];
+        total_size *= input_shape[i];
+    }
+
+    /* Drop the unit dimensions, they do not affect the memory order */
+    int32_t axis[TRANSPOSE_TILED_MAX_DIMS];
+    int32_t num_axes = 0;
+    for (int32_t i = 0; i < num_dims; i++)
+    {
+        axis[i] = input_shape[i] > 1 ? num_axes++ : -1;
+    }
+
+    int32_t out_order[TRANSPOSE_TILED_MAX_DIMS];
+    int32_t num_out = 0;
+    for (int32_t i = 0; i < num_dims; i++)
+    {
+        if (axis[perm[i]] >= 0)
+        {
+            out_order[num_out++] = perm[i];
+        }
+    }
+
+    /* An axis that directly follows its input predecessor in the output order is merged into it */
+    int32_t merged[TRANSPOSE_TILED_MAX_DIMS] = {0};
+    for (int32_t i = 1; i < num_out; i++)
+    {
+        if (axis[out_order[i]] == axis[out_order[i - 1]] + 1)
+        {
+            merged[out_order[i]] = 1;
+        }
+    }
+
+    int32_t dims[TRANSPOSE_TILED_MAX_DIMS];
+    int32_t new_axis[TRANSPOSE_TILED_MAX_DIMS];
+    int32_t k = 0;
+    for (int32_t i = 0; i < num_dims; i++)
+    {
+        if (axis[i] < 0)
+        {
+            continue;
+        }
+        if (merged[i])
+        {
+            dims[k - 1] *= input_shape[i];
+        }
+        else
+        {
+            dims[k++] = input_shape[i];
+        }
+        new_axis[i] = k - 1;
+    }
+
+    if (k <= 1 || total_size == 0)
+    {
+        arm_memcpy_s8(output, input, total_size);
+        return ARM_CMSIS_NN_SUCCESS;
+    }
+
+    int32_t new_perm[TRANSPOSE_TILED_MAX_DIMS];
+    int32_t j = 0;
+    for (int32_t i = 0; i < num_out; i++)
+    {
+        if (!merged[out_order[i]])
+        {
+            new_perm[j++] = new_axis[out_order[i]];
+        }
+    }
+
+    int32_t in_strides[TRANSPOSE_TILED_MAX_DIMS];
+    int32_t out_strides[TRANSPOSE_TILED_MAX_DIMS];
+    in_strides[k - 1] = 1;
+    out_strides[k - 1] = 1;
+    for (int32_t i = k - 2; i >= 0; i--)
+    {
+        in_strides[i] = in_strides[i + 1] * dims[i + 1];
+        out_strides[i] = out_strides[i + 1] * dims[new_perm[i + 1]];
+    }
+
+    /* Output position of the innermost input axis */
+    int32_t inner_pos = 0;
+    while (new_perm[inner_pos] != k - 1)
+    {
+        inner_pos++;
+    }
+
+    /* Axes other than the two of the inner 2D transpose, or the inner row copy, are walked in output order */
+    int32_t outer_size[4] = {1, 1, 1, 1};
+    int32_t outer_in_stride[4] = {0, 0, 0, 0};
+    int32_t outer_out_stride[4] = {0, 0, 0, 0};
+    int32_t num_outer = 0;
+    for (int32_t i = 0; i < k - 1; i++)
+    {
+        if (i != inner_pos)
+        {
+            outer_size[num_outer] = dims[new_perm[i]];
+            outer_in_stride[num_outer] = in_strides[new_perm[i]];
+            outer_out_stride[num_outer] = out_strides[i];
+            num_outer++;
+        }
+    }
+
+    const int32_t rows = dims[new_perm[k - 1]];
+    const int32_t row_stride = in_strides[new_perm[k - 1]];
+    const int32_t cols = dims[k - 1];
+    const int32_t col_stride = out_strides[inner_pos];
+
+    for (int32_t i_0 = 0; i_0 < outer_size[0]; i_0++)
+    {
+        for (int32_t i_1 = 0; i_1 < outer_size[1]; i_1++)
+        {
+            for (int32_t i_2 = 0; i_2 < outer_size[2]; i_2++)
+            {
+                for (int32_t i_3 = 0; i_3 < outer_size[3]; i_3++)
+                {
+                    const int8_t *in = input + i_0 * outer_in_stride[0] + i_1 * outer_in_stride[1] +
+                        i_2 * outer_in_stride[2] + i_3 * outer_in_stride[3];
+                    int8_t *out = output + i_0 * outer_out_stride[0] + i_1 * outer_out_stride[1] +
+                        i_2 * outer_out_stride[2] + i_3 * outer_out_stride[3];
+
+                    if (inner_pos == k - 1)
+                    {
+                        arm_memcpy_s8(out, in, cols);
+                    }
+                    else
+                    {
+                        transpose_2d_s8(in, row_stride, out, col_stride, rows, cols);
+                    }
+                }
+            }
+        }
+    }
+
+    return ARM_CMSIS_NN_SUCCESS;
+}
+
+/**
+ * @} end of Transpose group
+ */
@@ -457,6 +457,20 @@ const float64_t * pSrcB,
         q63_t * result);
 
 
+  /**
+   * @brief Dot product of Q15 vectors, with rounded partial sums.
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[in]  blockSize  number of samples in each vector
+   * @param[out] result     output result returned here
+   */
+  void arm_dot_prod_fast_q15(
+  const q15_t * pSrcA,
+  const q15_t * pSrcB,
+        uint32_t blockSize,
+        q63_t * result);
+
+
   /**
    * @brief Dot product of Q31 vectors.
    * @param[in]  pSrcA      points to the first input vector
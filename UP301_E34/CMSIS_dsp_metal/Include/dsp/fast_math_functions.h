@@ -301,6 +301,30 @@ arm_status arm_sqrt_q15(
   q15_t * pOut);
 
 
+/**
+  @brief         Q31 vector square root function.
+  @param[in]     pSrc       points to the input vector in q31
+  @param[out]    pDst       points to the output vector in q31
+  @param[in]     blockSize  number of samples in each vector
+ */
+void arm_vsqrt_q31(
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+
+/**
+  @brief         Q15 vector square root function.
+  @param[in]     pSrc       points to the input vector in q15
+  @param[out]    pDst       points to the output vector in q15
+  @param[in]     blockSize  number of samples in each vector
+ */
+void arm_vsqrt_q15(
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+
 
   /**
    * @} end of SQRT group
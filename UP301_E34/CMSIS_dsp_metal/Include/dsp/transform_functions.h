@@ -1282,6 +1282,52 @@ arm_status arm_mfcc_init_q15(
   );
 #endif
 
+ /**
+   * @brief Instance structure for the streaming Q15 MFCC function.
+   */
+typedef struct
+  {
+     arm_mfcc_instance_q15 mfcc; /**< Tables and FFT instance */
+     int32_t log2Offset; /**< log2 of the Mel energies scaling in Q16 */
+  } arm_mfcc_stream_instance_q15 ;
+
+arm_status arm_mfcc_stream_init_q15(
+  arm_mfcc_stream_instance_q15 * S,
+  uint32_t fftLen,
+  uint32_t nbMelFilters,
+  uint32_t nbDctOutputs,
+  const q15_t *dctCoefs,
+  const uint32_t *filterPos,
+  const uint32_t *filterLengths,
+  const q15_t *filterCoefs,
+  const q15_t *windowCoefs
+  );
+
+/**
+  @brief         Streaming MFCC Q15
+  @param[in]    S       points to the streaming mfcc instance structure
+  @param[in]     pSrc points to the input samples
+  @param[out]     pDst  points to the output MFCC values in q8.7 format
+  @param[inout]     pTmp  points to a temporary buffer of 2*fftLen q15 values
+  @return        error status
+ */
+#if defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE)
+  arm_status arm_mfcc_stream_q15(
+  const arm_mfcc_stream_instance_q15 * S,
+  q15_t *pSrc,
+  q15_t *pDst,
+  q15_t *pTmp,
+  q15_t *pTmp2
+  );
+#else
+  arm_status arm_mfcc_stream_q15(
+  const arm_mfcc_stream_instance_q15 * S,
+  q15_t *pSrc,
+  q15_t *pDst,
+  q15_t *pTmp
+  );
+#endif
+
 #ifdef   __cplusplus
 }
 #endif
@@ -0,0 +1,128 @@
+/******************************************************************************
+ * @file     up301_hw_dsp.h
+ * @brief    Dispatch of CMSIS DSP functions to the UP301 DSP block
+ * @version  v1.0.0
+ * @date     19 October 2026
+ * Target Processor: RISC-V
+ ******************************************************************************/
+/*
+ * Copyright (C) 2026 UpbeatTech Inc. All Rights Reserved
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef UP301_HW_DSP_H_
+#define UP301_HW_DSP_H_
+
+#include "arm_math_types.h"
+#include "arm_math_memory.h"
+
+#include "dsp/none.h"
+#include "dsp/utils.h"
+
+#include "dsp/transform_functions.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/*
+ * When the library is built with UP301_HW_DSP, arm_rfft_q15, arm_rfft_q31,
+ * arm_dot_prod_fast_q15, arm_vsqrt_q15 and arm_vsqrt_q31 call the functions
+ * below once the size reaches the dispatch threshold. They run the
+ * operation on the UDL DSP block (freedom-metal/metal/dsp.h) and return
+ * ARM_MATH_SUCCESS, or return an error without touching the outputs when
+ * the CPU must compute the result:
+ *  - ARM_MATH_LENGTH_ERROR if the size is not supported by the block,
+ *  - ARM_MATH_ARGUMENT_ERROR if a buffer is not 32-bit aligned or if there
+ *    is no DSP device,
+ *  - ARM_MATH_TEST_FAILURE if the DSP reported an error.
+ *
+ * Results are rescaled to the CPU formats. The block computes with its own
+ * rounding and block floating point, so they match the CPU within a few LSB
+ * rather than bit exactly. The block rounds dot products to its q15 output,
+ * so only the opt-in arm_dot_prod_fast_q15 uses it: arm_dot_prod_q15 and
+ * arm_dot_prod_q31 keep their exact CPU result.
+ *
+ * On a host, link freedom-metal/src/up_dsp_model.c and dsp_queue.c built
+ * with UPT_DSP_HOST_MODEL to run the same code against the C model, see
+ * tests/up301_hw_dsp_test.c.
+ */
+
+/* Sizes accepted by the DSP block */
+#define UP301_HW_DSP_MIN_FFT_LEN 32U
+#define UP301_HW_DSP_MAX_FFT_LEN 1024U
+#define UP301_HW_DSP_MAX_POINTS 1024U
+#define UP301_HW_DSP_MAX_DOT_DIM_Q15 512U
+
+/*
+ * Dispatch thresholds: smallest transform length, dot product length and
+ * number of square roots for which the DSP is used.
+ *
+ * benchmarks/up301_hw_dsp_benchmark.c gives them. On a host it measures
+ * the CPU work left around a block that costs nothing (checks, rescaling,
+ * rebuilding the conjugate half), and the defaults are the smallest sizes
+ * from which that work stays under half of the CPU computation, leaving
+ * the other half to the block. This is a lower bound: on the target the
+ * benchmark also times the block, and its crossovers should replace the
+ * defaults on the compiler command line. Host crossovers: rfft 64 to 128
+ * depending on the run, dot product 64, square root 1 (the block path is
+ * a fifth to a third of the CPU time at every length).
+ */
+#ifndef UP301_HW_DSP_RFFT_THRESHOLD
+#define UP301_HW_DSP_RFFT_THRESHOLD 128U
+#endif
+
+#ifndef UP301_HW_DSP_DOT_PROD_THRESHOLD
+#define UP301_HW_DSP_DOT_PROD_THRESHOLD 64U
+#endif
+
+#ifndef UP301_HW_DSP_SQRT_THRESHOLD
+#define UP301_HW_DSP_SQRT_THRESHOLD 1U
+#endif
+
+arm_status up301_hw_rfft_q15(
+  const arm_rfft_instance_q15 * S,
+        q15_t * pSrc,
+        q15_t * pDst);
+
+arm_status up301_hw_rfft_q31(
+  const arm_rfft_instance_q31 * S,
+        q31_t * pSrc,
+        q31_t * pDst);
+
+arm_status up301_hw_dot_prod_q15(
+  const q15_t * pSrcA,
+  const q15_t * pSrcB,
+        uint32_t blockSize,
+        q63_t * result);
+
+arm_status up301_hw_sqrt_q15(
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+arm_status up301_hw_sqrt_q31(
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* ifndef UP301_HW_DSP_H_ */
@@ -0,0 +1,255 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_stream_q15_benchmark.c
+ * Description:  Streaming q15 MFCC against arm_mfcc_q15 and arm_mfcc_f32
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores, RISC-V
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 UpbeatTech Inc. All Rights Reserved
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Time per frame of arm_mfcc_stream_q15, arm_mfcc_q15 and arm_mfcc_f32 on
+ * the same tables (tests/arm_mfcc_test_tables.h), with the largest error
+ * of each q15 version against arm_mfcc_f32. The copy of the frame that
+ * every version needs, since they all modify their input, is timed too.
+ *
+ * Only built on request. On a host, from the CMSIS_dsp_metal directory,
+ * with arm_common_tables.c of CMSIS-DSP, which this tree does not carry:
+ *
+ *   cc -O2 -D__GNUC_PYTHON__ -DARM_MFCC_BENCHMARK -IInclude -IPrivateInclude
+ *      -Itests benchmarks/arm_mfcc_stream_q15_benchmark.c
+ *      $(find src -name 'arm_*.c') arm_common_tables.c -lm
+ *      -o arm_mfcc_stream_q15_benchmark
+ *
+ * On the target, add the file to an application built with the library;
+ * the times are then in cycles.
+ */
+
+#if defined(ARM_MFCC_BENCHMARK)
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dsp/transform_functions.h"
+#include "arm_mfcc_test_tables.h"
+
+#define BENCH_FRAMES 16U
+#define BENCH_REPEAT 200U
+
+#if defined(__riscv)
+#define BENCH_UNIT "cycles"
+
+static uint64_t bench_now(void)
+{
+  uint32_t hi;
+  uint32_t lo;
+  uint32_t hi2;
+
+  do
+  {
+    __asm__ volatile("rdcycleh %0" : "=r"(hi));
+    __asm__ volatile("rdcycle %0" : "=r"(lo));
+    __asm__ volatile("rdcycleh %0" : "=r"(hi2));
+  } while (hi != hi2);
+  return ((uint64_t)hi << 32) | lo;
+}
+#else
+#include <time.h>
+
+#define BENCH_UNIT "ns"
+
+static uint64_t bench_now(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (uint64_t)t.tv_sec * 1000000000U + (uint64_t)t.tv_nsec;
+}
+#endif
+
+typedef struct
+{
+  uint32_t fftLen;
+  uint32_t nbMelFilters;
+  uint32_t nbDctOutputs;
+} bench_config;
+
+static const bench_config bench_configs[] = {
+  {256, 20, 10},
+  {512, 40, 13},
+  {1024, 40, 13},
+};
+
+static mfcc_test_tables tables;
+static q15_t frames[BENCH_FRAMES][MFCC_TEST_MAX_FFT_LEN];
+static float32_t framesF32[BENCH_FRAMES][MFCC_TEST_MAX_FFT_LEN];
+static q15_t src[MFCC_TEST_MAX_FFT_LEN];
+static float32_t srcF32[MFCC_TEST_MAX_FFT_LEN];
+static q31_t tmpQ15[2U * MFCC_TEST_MAX_FFT_LEN];
+static q15_t tmpStream[2U * MFCC_TEST_MAX_FFT_LEN];
+static float32_t tmpF32[2U * MFCC_TEST_MAX_FFT_LEN];
+static q15_t outQ15[BENCH_FRAMES][MFCC_TEST_MAX_DCT];
+static q15_t outStream[BENCH_FRAMES][MFCC_TEST_MAX_DCT];
+static float32_t outF32[BENCH_FRAMES][MFCC_TEST_MAX_DCT];
+static arm_mfcc_instance_f32 mf32;
+static arm_mfcc_instance_q15 mq15;
+static arm_mfcc_stream_instance_q15 ms;
+static uint32_t seed = 12345U;
+
+/* Speech-like frames: two tones and noise, from full scale to -40 dB */
+static void make_frames(uint32_t fftLen)
+{
+  for (uint32_t f = 0; f < BENCH_FRAMES; f++)
+  {
+    const double amp = pow(10.0, -2.0 * f / BENCH_FRAMES);
+
+    for (uint32_t i = 0; i < fftLen; i++)
+    {
+      double v;
+
+      seed = seed * 1103515245U + 12345U;
+      v = amp * (0.4 * sin(0.05 * (f + 1) * i) + 0.3 * sin(0.61 * i) +
+                 0.2 * ((double)(seed >> 8) / (double)(1U << 23) - 1.0));
+      frames[f][i] = (q15_t)lround(v * 32767.0);
+      framesF32[f][i] = (float32_t)frames[f][i] / 32768.0f;
+    }
+  }
+}
+
+static uint64_t bench_copy(uint32_t fftLen)
+{
+  uint64_t start = bench_now();
+
+  for (uint32_t r = 0; r < BENCH_REPEAT; r++)
+  {
+    for (uint32_t f = 0; f < BENCH_FRAMES; f++)
+    {
+      memcpy(src, frames[f], sizeof(q15_t) * fftLen);
+    }
+  }
+  return((bench_now() - start) / (BENCH_REPEAT * BENCH_FRAMES));
+}
+
+static uint64_t bench_q15(uint32_t fftLen)
+{
+  uint64_t start = bench_now();
+
+  for (uint32_t r = 0; r < BENCH_REPEAT; r++)
+  {
+    for (uint32_t f = 0; f < BENCH_FRAMES; f++)
+    {
+      memcpy(src, frames[f], sizeof(q15_t) * fftLen);
+      (void)arm_mfcc_q15(&mq15, src, outQ15[f], tmpQ15);
+    }
+  }
+  return((bench_now() - start) / (BENCH_REPEAT * BENCH_FRAMES));
+}
+
+static uint64_t bench_stream(uint32_t fftLen)
+{
+  uint64_t start = bench_now();
+
+  for (uint32_t r = 0; r < BENCH_REPEAT; r++)
+  {
+    for (uint32_t f = 0; f < BENCH_FRAMES; f++)
+    {
+      memcpy(src, frames[f], sizeof(q15_t) * fftLen);
+      (void)arm_mfcc_stream_q15(&ms, src, outStream[f], tmpStream);
+    }
+  }
+  return((bench_now() - start) / (BENCH_REPEAT * BENCH_FRAMES));
+}
+
+static uint64_t bench_f32(uint32_t fftLen)
+{
+  uint64_t start = bench_now();
+
+  for (uint32_t r = 0; r < BENCH_REPEAT; r++)
+  {
+    for (uint32_t f = 0; f < BENCH_FRAMES; f++)
+    {
+      memcpy(srcF32, framesF32[f], sizeof(float32_t) * fftLen);
+      arm_mfcc_f32(&mf32, srcF32, outF32[f], tmpF32);
+    }
+  }
+  return((bench_now() - start) / (BENCH_REPEAT * BENCH_FRAMES));
+}
+
+/* Largest error against arm_mfcc_f32 over the last outputs, in log units */
+static double bench_error(q15_t out[BENCH_FRAMES][MFCC_TEST_MAX_DCT], uint32_t nbDctOutputs)
+{
+  double err = 0.0;
+
+  for (uint32_t f = 0; f < BENCH_FRAMES; f++)
+  {
+    for (uint32_t k = 0; k < nbDctOutputs; k++)
+    {
+      err = fmax(err, fabs(out[f][k] / 128.0 - outF32[f][k]));
+    }
+  }
+  return(err);
+}
+
+int main(void)
+{
+  for (uint32_t c = 0; c < sizeof(bench_configs) / sizeof(bench_configs[0]); c++)
+  {
+    const bench_config *C = &bench_configs[c];
+    const mfcc_test_tables *T = &tables;
+    uint64_t copy, q15, stream, f32;
+
+    mfcc_test_tables_init(&tables, C->fftLen, C->nbMelFilters, C->nbDctOutputs);
+    if ((arm_mfcc_init_f32(&mf32, T->fftLen, T->nbMelFilters, T->nbDctOutputs,
+                           T->dctCoefsF32, T->filterPos, T->filterLengths,
+                           T->filterCoefsF32, T->windowF32) != ARM_MATH_SUCCESS) ||
+        (arm_mfcc_init_q15(&mq15, T->fftLen, T->nbMelFilters, T->nbDctOutputs,
+                           T->dctCoefsQ15, T->filterPos, T->filterLengths,
+                           T->filterCoefsQ15, T->windowQ15) != ARM_MATH_SUCCESS) ||
+        (arm_mfcc_stream_init_q15(&ms, T->fftLen, T->nbMelFilters, T->nbDctOutputs,
+                                  T->dctCoefsQ15, T->filterPos, T->filterLengths,
+                                  T->filterCoefsQ15, T->windowQ15) != ARM_MATH_SUCCESS))
+    {
+      printf("fftLen %u: init failed\n", (unsigned)C->fftLen);
+      return(1);
+    }
+    make_frames(C->fftLen);
+
+    copy = bench_copy(C->fftLen);
+    q15 = bench_q15(C->fftLen);
+    stream = bench_stream(C->fftLen);
+    f32 = bench_f32(C->fftLen);
+
+    printf("fftLen %4u, %2u Mel, %2u DCT, per frame (copy %llu %s):\n",
+           (unsigned)C->fftLen, (unsigned)C->nbMelFilters, (unsigned)C->nbDctOutputs,
+           (unsigned long long)copy, BENCH_UNIT);
+    printf("  arm_mfcc_q15        %8llu %s, max error against f32 %.3f\n",
+           (unsigned long long)q15, BENCH_UNIT, bench_error(outQ15, C->nbDctOutputs));
+    printf("  arm_mfcc_stream_q15 %8llu %s, max error against f32 %.3f, %.2fx arm_mfcc_q15\n",
+           (unsigned long long)stream, BENCH_UNIT, bench_error(outStream, C->nbDctOutputs),
+           (double)q15 / (double)stream);
+    printf("  arm_mfcc_f32        %8llu %s\n", (unsigned long long)f32, BENCH_UNIT);
+  }
+  return(0);
+}
+
+#endif /* defined(ARM_MFCC_BENCHMARK) */
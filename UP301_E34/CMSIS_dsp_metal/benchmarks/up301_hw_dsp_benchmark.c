@@ -0,0 +1,368 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        up301_hw_dsp_benchmark.c
+ * Description:  Dispatch thresholds of the UP301 DSP block
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 UpbeatTech Inc. All Rights Reserved
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Times each dispatched function on the CPU and through the DSP block for
+ * every size, and prints the thresholds of dsp/up301_hw_dsp.h: the smallest
+ * size from which the block path stays under SHARE of the CPU time.
+ *
+ * The library is built with the thresholds disabled, so that the arm_*
+ * functions time the CPU, and the up301_hw_* functions time the block.
+ *
+ * On the target (cycles, SHARE 1) the block path includes the block
+ * itself, and the thresholds are the crossovers. On a host (ns, SHARE 1/2)
+ * the model is replaced by a block that returns at once: the block path is
+ * only the CPU work around the block (checks, rescaling, conjugate half),
+ * and the other half of the CPU time is left for the block. These are the
+ * defaults of up301_hw_dsp.h, a lower bound until the target is measured.
+ *
+ * Only built on request. On a host, from the CMSIS_dsp_metal directory,
+ * with arm_common_tables.c of CMSIS-DSP, which this tree does not carry:
+ *
+ *   cc -O2 -D__GNUC_PYTHON__ -DUP301_HW_DSP -DUP301_HW_DSP_BENCHMARK
+ *      -DUPT_DSP_HOST_MODEL -DUP301_HW_DSP_RFFT_THRESHOLD=0xFFFFFFFFU
+ *      -DUP301_HW_DSP_DOT_PROD_THRESHOLD=0xFFFFFFFFU
+ *      -DUP301_HW_DSP_SQRT_THRESHOLD=0xFFFFFFFFU -IInclude -I../freedom-metal
+ *      benchmarks/up301_hw_dsp_benchmark.c src/SupportFunctions/up301_hw_dsp.c
+ *      src/TransformFunctions/arm_rfft_q15.c src/TransformFunctions/arm_rfft_q31.c
+ *      src/TransformFunctions/arm_rfft_init_q15.c
+ *      src/TransformFunctions/arm_rfft_init_q31.c
+ *      src/TransformFunctions/arm_cfft_q15.c src/TransformFunctions/arm_cfft_q31.c
+ *      src/TransformFunctions/arm_cfft_init_q15.c
+ *      src/TransformFunctions/arm_cfft_init_q31.c
+ *      src/TransformFunctions/arm_cfft_radix4_q15.c
+ *      src/TransformFunctions/arm_cfft_radix4_q31.c
+ *      src/TransformFunctions/arm_bitreversal.c
+ *      src/TransformFunctions/arm_bitreversal2.c
+ *      src/BasicMathFunctions/arm_shift_q15.c src/BasicMathFunctions/arm_shift_q31.c
+ *      src/BasicMathFunctions/arm_dot_prod_q15.c
+ *      src/FastMathFunctions/arm_sqrt_q15.c src/FastMathFunctions/arm_sqrt_q31.c
+ *      src/CommonTables/arm_const_structs.c arm_common_tables.c
+ *      ../freedom-metal/src/up_dsp_model.c ../freedom-metal/src/dsp_queue.c
+ *      -lm -lpthread -o up301_hw_dsp_benchmark
+ *
+ * On the target, add the same sources and defines, without
+ * UPT_DSP_HOST_MODEL and the model, to an application.
+ */
+
+#if defined(UP301_HW_DSP) && defined(UP301_HW_DSP_BENCHMARK)
+
+#include <stdio.h>
+#include <string.h>
+
+#include "dsp/basic_math_functions.h"
+#include "dsp/fast_math_functions.h"
+#include "dsp/transform_functions.h"
+#include "dsp/up301_hw_dsp.h"
+#include "metal/dsp.h"
+
+#define BENCH_REPEAT 1000U
+#define BENCH_RUNS 5U
+#define BENCH_MAX_DOT 4096U
+
+static q15_t src15[BENCH_MAX_DOT] __ALIGNED(4);
+static q15_t srcB15[BENCH_MAX_DOT] __ALIGNED(4);
+static q15_t work15[2U * UP301_HW_DSP_MAX_FFT_LEN + 2U] __ALIGNED(4);
+static q15_t dst15[2U * UP301_HW_DSP_MAX_FFT_LEN] __ALIGNED(4);
+static q31_t src31[UP301_HW_DSP_MAX_FFT_LEN + 2U] __ALIGNED(4);
+static q31_t work31[2U * UP301_HW_DSP_MAX_FFT_LEN + 2U] __ALIGNED(4);
+static q31_t dst31[2U * UP301_HW_DSP_MAX_FFT_LEN] __ALIGNED(4);
+
+#if defined(UPT_DSP_HOST_MODEL)
+#include <time.h>
+
+#define BENCH_UNIT "ns"
+/* Block path under half of the CPU time, the block gets the other half */
+#define BENCH_SHARE_NUM 1U
+#define BENCH_SHARE_DEN 2U
+
+static uint64_t bench_now(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (uint64_t)t.tv_sec * 1000000000U + (uint64_t)t.tv_nsec;
+}
+
+/*
+ * A block that costs nothing. The scale factors make the dispatch run its
+ * rescaling passes, as the block does for most inputs.
+ */
+static enum_dsp_retcode_Type free_rfft_q15(metal_dsp_Type *dsp, const upt_dsp_config_Type *cfg,
+                                           int16_t *pSrc, int16_t *pDst, int32_t *sfDst)
+{
+  (void)dsp; (void)cfg; (void)pSrc; (void)pDst;
+  *sfDst = 0;
+  return(E_DSP_SUCCESS);
+}
+
+static enum_dsp_retcode_Type free_rfft_q31(metal_dsp_Type *dsp, const upt_dsp_config_Type *cfg,
+                                           int32_t *pSrc, int32_t *pDst, int32_t *sfDst)
+{
+  (void)dsp; (void)cfg; (void)pSrc; (void)pDst;
+  *sfDst = 0;
+  return(E_DSP_SUCCESS);
+}
+
+static enum_dsp_retcode_Type free_dot_prod_q15(metal_dsp_Type *dsp, const upt_dsp_config_Type *cfg,
+                                               const int16_t *pSrcA, const int16_t *pSrcB,
+                                               int16_t *pDst, int32_t *sfDst)
+{
+  (void)dsp; (void)pSrcA; (void)pSrcB;
+  memset(pDst, 0, sizeof(int16_t) * cfg->length);
+  *sfDst = 0;
+  return(E_DSP_SUCCESS);
+}
+
+static enum_dsp_retcode_Type free_sqrt_q15(metal_dsp_Type *dsp, int16_t *pSrc, int16_t *pDst,
+                                           int16_t *pScale, int32_t length)
+{
+  (void)dsp; (void)pSrc; (void)pDst; (void)length;
+  *pScale = 1;
+  return(E_DSP_SUCCESS);
+}
+
+static enum_dsp_retcode_Type free_sqrt_q31(metal_dsp_Type *dsp, int32_t *pSrc, int32_t *pDst,
+                                           int32_t *pScale, int32_t length)
+{
+  (void)dsp; (void)pSrc; (void)pDst; (void)length;
+  *pScale = 1;
+  return(E_DSP_SUCCESS);
+}
+
+static const struct metal_dsp_vtable free_vtable = {
+  .rfft_q15 = free_rfft_q15,
+  .rfft_q31 = free_rfft_q31,
+  .dot_prod_q15 = free_dot_prod_q15,
+  .sqrt_q15 = free_sqrt_q15,
+  .sqrt_q31 = free_sqrt_q31,
+};
+#else
+#define BENCH_UNIT "cycles"
+#define BENCH_SHARE_NUM 1U
+#define BENCH_SHARE_DEN 1U
+
+static uint64_t bench_now(void)
+{
+  uint32_t hi;
+  uint32_t lo;
+  uint32_t hi2;
+
+  do
+  {
+    __asm__ volatile("rdcycleh %0" : "=r"(hi));
+    __asm__ volatile("rdcycle %0" : "=r"(lo));
+    __asm__ volatile("rdcycleh %0" : "=r"(hi2));
+  } while (hi != hi2);
+  return ((uint64_t)hi << 32) | lo;
+}
+#endif
+
+typedef void (*bench_fn)(uint32_t n);
+
+static uint32_t bench_fft_len;
+static arm_rfft_instance_q15 rfft15;
+static arm_rfft_instance_q31 rfft31;
+
+/* The transforms modify their input, both paths copy it first */
+static void cpu_rfft_q15(uint32_t n)
+{
+  memcpy(work15, src15, sizeof(q15_t) * n);
+  arm_rfft_q15(&rfft15, work15, dst15);
+}
+
+static void hw_rfft_q15(uint32_t n)
+{
+  memcpy(work15, src15, sizeof(q15_t) * n);
+  (void)up301_hw_rfft_q15(&rfft15, work15, dst15);
+}
+
+static void cpu_rfft_q31(uint32_t n)
+{
+  memcpy(work31, src31, sizeof(q31_t) * n);
+  arm_rfft_q31(&rfft31, work31, dst31);
+}
+
+static void hw_rfft_q31(uint32_t n)
+{
+  memcpy(work31, src31, sizeof(q31_t) * n);
+  (void)up301_hw_rfft_q31(&rfft31, work31, dst31);
+}
+
+static void cpu_dot_prod_q15(uint32_t n)
+{
+  q63_t result;
+
+  arm_dot_prod_q15(src15, srcB15, n, &result);
+}
+
+static void hw_dot_prod_q15(uint32_t n)
+{
+  q63_t result;
+
+  (void)up301_hw_dot_prod_q15(src15, srcB15, n, &result);
+}
+
+static void cpu_sqrt_q15(uint32_t n)
+{
+  arm_vsqrt_q15(src15, dst15, n);
+}
+
+static void hw_sqrt_q15(uint32_t n)
+{
+  (void)up301_hw_sqrt_q15(src15, dst15, n);
+}
+
+static void cpu_sqrt_q31(uint32_t n)
+{
+  arm_vsqrt_q31(src31, dst31, n);
+}
+
+static void hw_sqrt_q31(uint32_t n)
+{
+  (void)up301_hw_sqrt_q31(src31, dst31, n);
+}
+
+/* Best of BENCH_RUNS averages, against interrupts and preemption */
+static uint64_t bench_time(bench_fn fn, uint32_t n)
+{
+  uint64_t best = UINT64_MAX;
+
+  fn(n);
+  for (uint32_t r = 0; r < BENCH_RUNS; r++)
+  {
+    uint64_t start = bench_now();
+    uint64_t time;
+
+    for (uint32_t i = 0; i < BENCH_REPEAT; i++)
+    {
+      fn(n);
+    }
+    time = (bench_now() - start) / BENCH_REPEAT;
+    if (time < best)
+    {
+      best = time;
+    }
+  }
+  return(best);
+}
+
+static void rfft_init(uint32_t n)
+{
+  bench_fft_len = n;
+  (void)arm_rfft_init_q15(&rfft15, n, 0U, 1U);
+  (void)arm_rfft_init_q31(&rfft31, n, 0U, 1U);
+}
+
+/*
+ * Times cpu and hw for the sizes first, first * 2, ... last and returns the
+ * smallest size from which hw stays under the share of cpu, or 0 if none.
+ */
+static uint32_t bench_threshold(const char *name, bench_fn cpu, bench_fn hw,
+                                void (*init)(uint32_t n), uint32_t first, uint32_t last)
+{
+  uint32_t threshold = 0U;
+
+  for (uint32_t n = first; n <= last; n *= 2U)
+  {
+    uint64_t cpuTime;
+    uint64_t hwTime;
+
+    if (init != NULL)
+    {
+      init(n);
+    }
+    cpuTime = bench_time(cpu, n);
+    hwTime = bench_time(hw, n);
+    printf("%-16s n %4u: cpu %8llu %s, block path %8llu %s (%3llu%%)\n", name, (unsigned)n,
+           (unsigned long long)cpuTime, BENCH_UNIT, (unsigned long long)hwTime, BENCH_UNIT,
+           (unsigned long long)(cpuTime ? 100U * hwTime / cpuTime : 0U));
+    if (hwTime * BENCH_SHARE_DEN <= cpuTime * BENCH_SHARE_NUM)
+    {
+      if (threshold == 0U)
+      {
+        threshold = n;
+      }
+    }
+    else
+    {
+      threshold = 0U;
+    }
+  }
+  return(threshold);
+}
+
+static uint32_t bench_max(uint32_t a, uint32_t b)
+{
+  if (a == 0U || b == 0U)
+  {
+    return(0U);
+  }
+  return(a > b ? a : b);
+}
+
+int main(void)
+{
+  uint32_t rfft;
+  uint32_t dot;
+  uint32_t sqrt;
+
+#if defined(UPT_DSP_HOST_MODEL)
+  upt_dsp_get_device(NAON_UDL_1_2_DSP)->vtable = &free_vtable;
+#endif
+
+  for (uint32_t i = 0; i < BENCH_MAX_DOT; i++)
+  {
+    src15[i] = (q15_t)((i * 7919U) % 16384U + 1U);
+    srcB15[i] = (q15_t)((i * 104729U) % 16384U);
+  }
+  for (uint32_t i = 0; i < UP301_HW_DSP_MAX_FFT_LEN + 2U; i++)
+  {
+    src31[i] = (q31_t)(((i * 7919U) % 65536U + 1U) << 14);
+  }
+
+  rfft = bench_max(bench_threshold("arm_rfft_q15", cpu_rfft_q15, hw_rfft_q15, rfft_init,
+                                   UP301_HW_DSP_MIN_FFT_LEN, UP301_HW_DSP_MAX_FFT_LEN),
+                   bench_threshold("arm_rfft_q31", cpu_rfft_q31, hw_rfft_q31, rfft_init,
+                                   UP301_HW_DSP_MIN_FFT_LEN, UP301_HW_DSP_MAX_FFT_LEN));
+  dot = bench_threshold("arm_dot_prod_q15", cpu_dot_prod_q15, hw_dot_prod_q15, NULL,
+                        4U, BENCH_MAX_DOT);
+  sqrt = bench_max(bench_threshold("arm_vsqrt_q15", cpu_sqrt_q15, hw_sqrt_q15, NULL,
+                                   1U, UP301_HW_DSP_MAX_POINTS),
+                   bench_threshold("arm_vsqrt_q31", cpu_sqrt_q31, hw_sqrt_q31, NULL,
+                                   1U, UP301_HW_DSP_MAX_POINTS));
+
+  /* 0: the block never pays off, keep the CPU */
+  printf("-DUP301_HW_DSP_RFFT_THRESHOLD=%uU -DUP301_HW_DSP_DOT_PROD_THRESHOLD=%uU "
+         "-DUP301_HW_DSP_SQRT_THRESHOLD=%uU\n",
+         rfft ? (unsigned)rfft : 0xFFFFFFFFU, dot ? (unsigned)dot : 0xFFFFFFFFU,
+         sqrt ? (unsigned)sqrt : 0xFFFFFFFFU);
+  return(0);
+}
+
+#endif /* defined(UP301_HW_DSP) && defined(UP301_HW_DSP_BENCHMARK) */
@@ -32,33 +32,10 @@
 //   #define UP301_HW_DSP
 //#endif
 
-#ifdef UP301_HW_DSP
-
-#include "metal/dsp.h"
-
-static metal_dsp_Type *udl1_2_dsp;
-
-ARM_DSP_ATTRIBUTE void up301_hw_dot_prod_q15(q15_t *a, q15_t *b, uint32_t len, q63_t *result)
-{
-	upt_dsp_config_Type cfg;
-    int32_t scale;
-
-	udl1_2_dsp=upt_dsp_get_device(NAON_UDL_1_2_DSP);
-	cfg.dim=len;
-	cfg.length=0;//Seems no work in dot product
-	cfg.dsp_ifftFlag=UPT_DSP_DOT_PROD_MODE;
-
-    enum_dsp_retcode_Type ret = upt_dsp_dot_prod_q15(udl1_2_dsp, &cfg, a, b, result, &scale);
-
-    if (ret != E_DSP_SUCCESS) {
-        	printf("dot_prod_q15 Error\n");
-    	return;
-    }
-
-    *result <<= scale; //  scale
-    return ;
-}
+#if defined(UP301_HW_DSP)
+#include "dsp/up301_hw_dsp.h"
 #endif
+
 /**
   @ingroup groupMath
  */
@@ -132,15 +109,6 @@ ARM_DSP_ATTRIBUTE void arm_dot_prod_q15(
 
     *result = sum;
 }
-#elif defined(UP301_HW_DSP)
-ARM_DSP_ATTRIBUTE void arm_dot_prod_q15(
-	  const q15_t * pSrcA,
-	  const q15_t * pSrcB,
-	  uint32_t blockSize,
-	  q63_t * result)
-{
-	  up301_hw_dot_prod_q15((q15_t *)pSrcA, (q15_t *)pSrcB, blockSize, result);
-}
 #else
 ARM_DSP_ATTRIBUTE void arm_dot_prod_q15(
   const q15_t * pSrcA,
@@ -201,6 +169,40 @@ ARM_DSP_ATTRIBUTE void arm_dot_prod_q15(
 }
 #endif /* defined(ARM_MATH_MVEI) */
 
+/**
+  @brief         Dot product of Q15 vectors, with rounded partial sums.
+  @param[in]     pSrcA      points to the first input vector
+  @param[in]     pSrcB      points to the second input vector
+  @param[in]     blockSize  number of samples in each vector
+  @param[out]    result     output result returned here
+
+  @par           Description
+                   Same as arm_dot_prod_q15 when the library is built without
+                   UP301_HW_DSP. With UP301_HW_DSP, long vectors are computed
+                   on the DSP block, which returns the sum of each row of 512
+                   elements rounded to q15 (or coarser when the row sums do
+                   not fit q15). The result then loses up to 2^14 LSB of the
+                   34.30 format per row, and vectors of small amplitude can
+                   give 0: use it only where that resolution is enough.
+                   The return result is in 34.30 format.
+ */
+ARM_DSP_ATTRIBUTE void arm_dot_prod_fast_q15(
+  const q15_t * pSrcA,
+  const q15_t * pSrcB,
+        uint32_t blockSize,
+        q63_t * result)
+{
+#if defined(UP301_HW_DSP)
+  if ((blockSize >= UP301_HW_DSP_DOT_PROD_THRESHOLD) &&
+      (up301_hw_dot_prod_q15(pSrcA, pSrcB, blockSize, result) == ARM_MATH_SUCCESS))
+  {
+    return;
+  }
+#endif
+
+  arm_dot_prod_q15(pSrcA, pSrcB, blockSize, result);
+}
+
 /**
   @} end of BasicDotProd group
  */
@@ -32,33 +32,6 @@
 //   #define UP301_HW_DSP
 //#endif
 
-#ifdef UP301_HW_DSP
-
-#include "metal/dsp.h"
-
-static metal_dsp_Type *udl1_2_dsp;
-
-ARM_DSP_ATTRIBUTE void up301_hw_dot_prod_q31(q31_t *a, q31_t *b, uint32_t len, q63_t *result)
-{
-	upt_dsp_config_Type cfg;
-    int32_t scale;
-
-	udl1_2_dsp=upt_dsp_get_device(NAON_UDL_1_2_DSP);
-	cfg.dim=len;
-	cfg.length=0;//Seems no work in dot product
-	cfg.dsp_ifftFlag=UPT_DSP_DOT_PROD_MODE;
-
-    enum_dsp_retcode_Type ret = upt_dsp_dot_prod_q31(udl1_2_dsp, &cfg, a, b, result, &scale);
-
-    if (ret != E_DSP_SUCCESS) {
-        	printf("dot_prod_q31 Error\n");
-    	return;
-    }
-
-    *result <<= scale; //  scale
-    return ;
-}
-#endif
 /**
   @ingroup groupMath
  */
@@ -141,16 +114,6 @@ ARM_DSP_ATTRIBUTE void arm_dot_prod_q31(
     *result = asrl(sum, (14 - 8));
 }
 
-#elif defined(UP301_HW_DSP)
-ARM_DSP_ATTRIBUTE void arm_dot_prod_q31(
-	  const q31_t * pSrcA,
-	  const q31_t * pSrcB,
-	  uint32_t blockSize,
-	  q63_t * result)
-{
-	      up301_hw_dot_prod_q31((q31_t *)pSrcA, (q31_t *)pSrcB, blockSize, result);
-}
-
 #else
 ARM_DSP_ATTRIBUTE void arm_dot_prod_q31(
   const q31_t * pSrcA,
@@ -35,34 +35,8 @@
 //   #define UP301_HW_DSP
 //#endif
 
-#ifdef UP301_HW_DSP
-
-#include "metal/dsp.h"
-
-static metal_dsp_Type *udl1_2_dsp;
-
-ARM_DSP_ATTRIBUTE arm_status up301_hw_sqrt_q15(q15_t in, q15_t * pOut)
-{
-	upt_dsp_config_Type cfg;
-
-    if (in < 0 || pOut == NULL)
-        return ARM_MATH_ARGUMENT_ERROR;
-
-	udl1_2_dsp=upt_dsp_get_device(NAON_UDL_1_2_DSP);
-	int16_t scale=0;
-	int32_t length;
-	cfg.length=0;//Seems no work in dot product
-	cfg.dsp_ifftFlag=UPT_DSP_SQUARE_ROOT_MODE;
-
-    enum_dsp_retcode_Type ret = upt_dsp_sqrt_q15(udl1_2_dsp, in, pOut, scale, length);
-    if (ret != E_DSP_SUCCESS) {
-        	printf("sqrt_q15 Error\n");
-    	return ARM_MATH_TEST_FAILURE;
-    }
-
-    *pOut <<= scale; //  scale
-    return ARM_MATH_SUCCESS;
-}
+#if defined(UP301_HW_DSP)
+#include "dsp/up301_hw_dsp.h"
 #endif
 
 /**
@@ -82,15 +56,6 @@ ARM_DSP_ATTRIBUTE arm_status up301_hw_sqrt_q15(q15_t in, q15_t * pOut)
                    - \ref ARM_MATH_SUCCESS        : input value is positive
                    - \ref ARM_MATH_ARGUMENT_ERROR : input value is negative; *pOut is set to 0
  */
-#if defined(UP301_HW_DSP)
-ARM_DSP_ATTRIBUTE arm_status arm_sqrt_q15(
-		  q15_t in,
-		  q15_t * pOut)
-{
-
-		return up301_hw_sqrt_q15(in, pOut);
-}
-#else
 ARM_DSP_ATTRIBUTE arm_status arm_sqrt_q15(
   q15_t in,
   q15_t * pOut)
@@ -167,8 +132,39 @@ ARM_DSP_ATTRIBUTE arm_status arm_sqrt_q15(
     }
   }
 }
+
+/**
+  @brief         Q15 vector square root function.
+  @param[in]     pSrc       points to the input vector in q15
+  @param[out]    pDst       points to the output vector in q15
+  @param[in]     blockSize  number of samples in each vector
+
+  @par           Description
+                   Same result as arm_sqrt_q15 on each element. Negative
+                   inputs give 0.
+                   When the library is built with UP301_HW_DSP, long
+                   vectors are computed on the DSP block.
+ */
+ARM_DSP_ATTRIBUTE void arm_vsqrt_q15(
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+#if defined(UP301_HW_DSP)
+  if ((blockSize >= UP301_HW_DSP_SQRT_THRESHOLD) &&
+      (up301_hw_sqrt_q15(pSrc, pDst, blockSize) == ARM_MATH_SUCCESS))
+  {
+    return;
+  }
 #endif
 
+  while (blockSize > 0U)
+  {
+    arm_sqrt_q15(*pSrc++, pDst++);
+    blockSize--;
+  }
+}
+
 /**
   @} end of SQRT group
  */
@@ -69,4 +69,6 @@
 #include "arm_q7_to_float.c"
 #include "arm_q7_to_q15.c"
 #include "arm_q7_to_q31.c"
+
+#include "up301_hw_dsp.c"
 CCTest*/
@@ -0,0 +1,332 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        up301_hw_dsp.c
+ * Description:  Dispatch of CMSIS DSP functions to the UP301 DSP block
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 UpbeatTech Inc. All Rights Reserved
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(UP301_HW_DSP)
+
+#include "dsp/up301_hw_dsp.h"
+#include "metal/dsp.h"
+
+/* Rows of a long dot product sent to the block per call */
+#define UP301_HW_DSP_DOT_ROWS 32U
+
+#define UP301_HW_DSP_IS_ALIGNED(p) ((((uintptr_t)(p)) & 3U) == 0U)
+
+static metal_dsp_Type *up301_hw_dsp_device(void)
+{
+  static metal_dsp_Type *dsp = NULL;
+
+  if (dsp == NULL)
+  {
+    dsp = upt_dsp_get_device(NAON_UDL_1_2_DSP);
+  }
+  return(dsp);
+}
+
+static uint32_t up301_hw_dsp_fft_len_valid(uint32_t fftLen)
+{
+  return((fftLen >= UP301_HW_DSP_MIN_FFT_LEN) && (fftLen <= UP301_HW_DSP_MAX_FFT_LEN) &&
+         ((fftLen & (fftLen - 1U)) == 0U));
+}
+
+/*
+  The block returns value * 2^scale. Converts to value * 2^-downShift,
+  rounding to nearest and saturating to bits.
+ */
+static q31_t up301_hw_dsp_rescale(q31_t value, int32_t scale, int32_t downShift, uint32_t bits)
+{
+  const int32_t shift = downShift - scale;
+  q63_t v = value;
+
+  if (shift > 0)
+  {
+    v = (v + ((q63_t)1 << (shift - 1))) >> shift;
+  }
+  else if (shift < 0)
+  {
+    v = v << -shift;
+  }
+  if (bits == 16U)
+  {
+    return(__SSAT((q31_t)clip_q63_to_q31(v), 16));
+  }
+  return(clip_q63_to_q31(v));
+}
+
+/*
+ * Run the transform on the DSP block.
+ *
+ * Refer header file for details.
+ *
+ */
+ARM_DSP_ATTRIBUTE arm_status up301_hw_rfft_q15(
+  const arm_rfft_instance_q15 * S,
+        q15_t * pSrc,
+        q15_t * pDst)
+{
+  const uint32_t fftLen = S->fftLenReal;
+  const int32_t log2Len = 31 - (int32_t)__CLZ(fftLen);
+  metal_dsp_Type *dsp = up301_hw_dsp_device();
+  upt_dsp_config_Type cfg = {0};
+  int32_t scale = 0;
+  uint32_t count;
+  uint32_t i;
+
+  if (!up301_hw_dsp_fft_len_valid(fftLen))
+  {
+    return(ARM_MATH_LENGTH_ERROR);
+  }
+  /* The block always returns the bins in natural order */
+  if ((dsp == NULL) || (S->bitReverseFlagR == 0U) ||
+      !UP301_HW_DSP_IS_ALIGNED(pSrc) || !UP301_HW_DSP_IS_ALIGNED(pDst))
+  {
+    return(ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  cfg.length = fftLen;
+  cfg.dsp_ifftFlag = S->ifftFlagR ? UPT_DSP_IRFFT_MODE : UPT_DSP_RFFT_MODE;
+  if (upt_dsp_rfft_q15(dsp, &cfg, pSrc, pDst, &scale) != E_DSP_SUCCESS)
+  {
+    return(ARM_MATH_TEST_FAILURE);
+  }
+
+  /* The CPU transform is downscaled by fftLen in both directions */
+  count = S->ifftFlagR ? fftLen : fftLen + 2U;
+  if (scale != log2Len)
+  {
+    for (i = 0; i < count; i++)
+    {
+      pDst[i] = (q15_t)up301_hw_dsp_rescale(pDst[i], scale, log2Len, 16U);
+    }
+  }
+
+  if (!S->ifftFlagR)
+  {
+    /* The block returns bins 0..fftLen/2, add the conjugate part */
+    for (i = fftLen / 2U + 1U; i < fftLen; i++)
+    {
+      pDst[2U * i] = pDst[2U * (fftLen - i)];
+      pDst[2U * i + 1U] = (q15_t)__SSAT(-(q31_t)pDst[2U * (fftLen - i) + 1U], 16);
+    }
+  }
+  return(ARM_MATH_SUCCESS);
+}
+
+ARM_DSP_ATTRIBUTE arm_status up301_hw_rfft_q31(
+  const arm_rfft_instance_q31 * S,
+        q31_t * pSrc,
+        q31_t * pDst)
+{
+  const uint32_t fftLen = S->fftLenReal;
+  const int32_t log2Len = 31 - (int32_t)__CLZ(fftLen);
+  metal_dsp_Type *dsp = up301_hw_dsp_device();
+  upt_dsp_config_Type cfg = {0};
+  int32_t scale = 0;
+  uint32_t count;
+  uint32_t i;
+
+  if (!up301_hw_dsp_fft_len_valid(fftLen))
+  {
+    return(ARM_MATH_LENGTH_ERROR);
+  }
+  if ((dsp == NULL) || (S->bitReverseFlagR == 0U) ||
+      !UP301_HW_DSP_IS_ALIGNED(pSrc) || !UP301_HW_DSP_IS_ALIGNED(pDst))
+  {
+    return(ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  cfg.length = fftLen;
+  cfg.dsp_ifftFlag = S->ifftFlagR ? UPT_DSP_IRFFT_MODE : UPT_DSP_RFFT_MODE;
+  if (upt_dsp_rfft_q31(dsp, &cfg, pSrc, pDst, &scale) != E_DSP_SUCCESS)
+  {
+    return(ARM_MATH_TEST_FAILURE);
+  }
+
+  count = S->ifftFlagR ? fftLen : fftLen + 2U;
+  if (scale != log2Len)
+  {
+    for (i = 0; i < count; i++)
+    {
+      pDst[i] = up301_hw_dsp_rescale(pDst[i], scale, log2Len, 32U);
+    }
+  }
+
+  if (!S->ifftFlagR)
+  {
+    for (i = fftLen / 2U + 1U; i < fftLen; i++)
+    {
+      pDst[2U * i] = pDst[2U * (fftLen - i)];
+      pDst[2U * i + 1U] = clip_q63_to_q31(-(q63_t)pDst[2U * (fftLen - i) + 1U]);
+    }
+  }
+  return(ARM_MATH_SUCCESS);
+}
+
+/*
+ * The vector is cut in rows of up to UP301_HW_DSP_MAX_DOT_DIM_Q15 elements,
+ * the block returns one q15 sum per row and the tail that does not fill a
+ * row is added on the CPU.
+ */
+ARM_DSP_ATTRIBUTE arm_status up301_hw_dot_prod_q15(
+  const q15_t * pSrcA,
+  const q15_t * pSrcB,
+        uint32_t blockSize,
+        q63_t * result)
+{
+  metal_dsp_Type *dsp = up301_hw_dsp_device();
+  upt_dsp_config_Type cfg = {0};
+  q15_t rows[UP301_HW_DSP_DOT_ROWS];
+  const uint32_t dim = blockSize < UP301_HW_DSP_MAX_DOT_DIM_Q15 ? blockSize : UP301_HW_DSP_MAX_DOT_DIM_Q15;
+  uint32_t rowCnt = blockSize / dim;
+  q63_t sum = 0;
+  uint32_t i;
+
+  if (blockSize == 0U)
+  {
+    return(ARM_MATH_LENGTH_ERROR);
+  }
+  if ((dsp == NULL) || !UP301_HW_DSP_IS_ALIGNED(pSrcA) || !UP301_HW_DSP_IS_ALIGNED(pSrcB))
+  {
+    return(ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  cfg.dim = dim;
+  cfg.dsp_ifftFlag = UPT_DSP_DOT_PROD_MODE;
+  while (rowCnt > 0U)
+  {
+    const uint32_t n = rowCnt < UP301_HW_DSP_DOT_ROWS ? rowCnt : UP301_HW_DSP_DOT_ROWS;
+    int32_t scale = 0;
+
+    cfg.length = n;
+    if (upt_dsp_dot_prod_q15(dsp, &cfg, pSrcA, pSrcB, rows, &scale) != E_DSP_SUCCESS)
+    {
+      return(ARM_MATH_TEST_FAILURE);
+    }
+    /* q15 * 2^scale -> 34.30 */
+    for (i = 0; i < n; i++)
+    {
+      sum += (q63_t)rows[i] << (scale + 15);
+    }
+    pSrcA += n * dim;
+    pSrcB += n * dim;
+    blockSize -= n * dim;
+    rowCnt -= n;
+  }
+
+  while (blockSize > 0U)
+  {
+    sum += (q31_t)*pSrcA++ * *pSrcB++;
+    blockSize--;
+  }
+
+  *result = sum;
+  return(ARM_MATH_SUCCESS);
+}
+
+/*
+ * Negative inputs are rejected by the block, they are left to the CPU
+ * which sets their square root to 0.
+ */
+ARM_DSP_ATTRIBUTE arm_status up301_hw_sqrt_q15(
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+  metal_dsp_Type *dsp = up301_hw_dsp_device();
+  int16_t scale = 0;
+  uint32_t i;
+
+  if (blockSize == 0U || blockSize > UP301_HW_DSP_MAX_POINTS)
+  {
+    return(ARM_MATH_LENGTH_ERROR);
+  }
+  if ((dsp == NULL) || !UP301_HW_DSP_IS_ALIGNED(pSrc) || !UP301_HW_DSP_IS_ALIGNED(pDst))
+  {
+    return(ARM_MATH_ARGUMENT_ERROR);
+  }
+  for (i = 0; i < blockSize; i++)
+  {
+    if (pSrc[i] < 0)
+    {
+      return(ARM_MATH_ARGUMENT_ERROR);
+    }
+  }
+
+  if (upt_dsp_sqrt_q15(dsp, (int16_t *)pSrc, pDst, &scale, (int32_t)blockSize) != E_DSP_SUCCESS)
+  {
+    return(ARM_MATH_TEST_FAILURE);
+  }
+  if (scale != 0)
+  {
+    for (i = 0; i < blockSize; i++)
+    {
+      pDst[i] = (q15_t)up301_hw_dsp_rescale(pDst[i], scale, 0, 16U);
+    }
+  }
+  return(ARM_MATH_SUCCESS);
+}
+
+ARM_DSP_ATTRIBUTE arm_status up301_hw_sqrt_q31(
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+  metal_dsp_Type *dsp = up301_hw_dsp_device();
+  int32_t scale = 0;
+  uint32_t i;
+
+  if (blockSize == 0U || blockSize > UP301_HW_DSP_MAX_POINTS)
+  {
+    return(ARM_MATH_LENGTH_ERROR);
+  }
+  if ((dsp == NULL) || !UP301_HW_DSP_IS_ALIGNED(pSrc) || !UP301_HW_DSP_IS_ALIGNED(pDst))
+  {
+    return(ARM_MATH_ARGUMENT_ERROR);
+  }
+  for (i = 0; i < blockSize; i++)
+  {
+    if (pSrc[i] < 0)
+    {
+      return(ARM_MATH_ARGUMENT_ERROR);
+    }
+  }
+
+  if (upt_dsp_sqrt_q31(dsp, (int32_t *)pSrc, pDst, &scale, (int32_t)blockSize) != E_DSP_SUCCESS)
+  {
+    return(ARM_MATH_TEST_FAILURE);
+  }
+  if (scale != 0)
+  {
+    for (i = 0; i < blockSize; i++)
+    {
+      pDst[i] = up301_hw_dsp_rescale(pDst[i], scale, 0, 32U);
+    }
+  }
+  return(ARM_MATH_SUCCESS);
+}
+
+#endif /* defined(UP301_HW_DSP) */
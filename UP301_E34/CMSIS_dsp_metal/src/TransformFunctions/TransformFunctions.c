@@ -57,6 +57,9 @@
 #include "arm_mfcc_init_q15.c"
 #include "arm_mfcc_q15.c"
 
+#include "arm_mfcc_stream_init_q15.c"
+#include "arm_mfcc_stream_q15.c"
+
 
 
 #include "arm_rfft_q15.c"
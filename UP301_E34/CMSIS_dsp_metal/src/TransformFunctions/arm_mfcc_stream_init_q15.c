@@ -0,0 +1,122 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_stream_init_q15.c
+ * Description:  Streaming MFCC initialization function for the q15 version
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores, RISC-V
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 UpbeatTech Inc. All Rights Reserved
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/* Same scaling as arm_mfcc_q15 */
+#define SHIFT_MELFILTER_SATURATION_Q15 10
+
+/**
+  @ingroup MFCC
+ */
+
+/**
+  @addtogroup MFCCQ15
+  @{
+ */
+
+/**
+  @brief         Initialization of the streaming MFCC Q15 instance structure
+  @param[out]    S       points to the streaming mfcc instance structure
+  @param[in]     fftLen  fft length
+  @param[in]     nbMelFilters  number of Mel filters
+  @param[in]     nbDctOutputs  number of Dct outputs
+  @param[in]     dctCoefs  points to an array of DCT coefficients
+  @param[in]     filterPos  points of the array of filter positions
+  @param[in]     filterLengths  points to the array of filter lengths
+  @param[in]     filterCoefs  points to the array of filter coefficients
+  @param[in]     windowCoefs  points to the array of window coefficients
+
+  @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the
+                 FFT length is not supported or if the Mel filters
+                 cannot be streamed
+
+  @par           Description
+                   The tables are the ones used by arm_mfcc_init_q15 and
+                   are generated by the same script: each Mel filter is
+                   described by the nonzero part of its coefficients only.
+
+                   The filters are consumed while the spectrum is swept
+                   once from low to high frequencies, so the filter positions
+                   must be increasing and every filter must end before the
+                   Nyquist bin (included).
+
+                   All the per frame constants (FFT instance, scaling of
+                   the log-Mel energies) are computed here once.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mfcc_stream_init_q15(
+  arm_mfcc_stream_instance_q15 * S,
+  uint32_t fftLen,
+  uint32_t nbMelFilters,
+  uint32_t nbDctOutputs,
+  const q15_t *dctCoefs,
+  const uint32_t *filterPos,
+  const uint32_t *filterLengths,
+  const q15_t *filterCoefs,
+  const q15_t *windowCoefs
+  )
+{
+  arm_status status;
+  uint32_t fftShift;
+  uint32_t i;
+
+  if ((fftLen == 0U) || ((fftLen & (fftLen - 1U)) != 0U))
+  {
+    return(ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (i = 0; i < nbMelFilters; i++)
+  {
+    if ((i > 0U) && (filterPos[i] < filterPos[i - 1U]))
+    {
+      return(ARM_MATH_ARGUMENT_ERROR);
+    }
+    if (filterPos[i] + filterLengths[i] > 1U + (fftLen >> 1))
+    {
+      return(ARM_MATH_ARGUMENT_ERROR);
+    }
+  }
+
+  status = arm_mfcc_init_q15(&(S->mfcc), fftLen, nbMelFilters, nbDctOutputs,
+    dctCoefs, filterPos, filterLengths, filterCoefs, windowCoefs);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return(status);
+  }
+
+  /* The FFT output is downscaled by log2(fftLen), the magnitude is in
+     2.14 format and the Mel accumulator is shifted before the log. */
+  fftShift = 31 - __CLZ(fftLen);
+  S->log2Offset = (int32_t)((fftShift + 2 + SHIFT_MELFILTER_SATURATION_Q15) << 16);
+
+  return(ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of MFCCQ15 group
+ */
@@ -0,0 +1,240 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_stream_q15.c
+ * Description:  Streaming MFCC function for the q15 version
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores, RISC-V
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 UpbeatTech Inc. All Rights Reserved
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/statistics_functions.h"
+#include "dsp/fast_math_functions.h"
+#include "dsp/matrix_functions.h"
+
+/* Same constants as arm_mfcc_q15 */
+#define MICRO_Q15 0x00000219
+#define SHIFT_MELFILTER_SATURATION_Q15 10
+
+/* ln(2) in Q31 */
+#define LN2_Q31 0x58B90BFB
+
+/* log2(1 + k/32) in Q16 for k = 0..32 */
+static const int32_t mfcc_log2_table_q16[33] = {
+    0x00000, 0x00B5D, 0x01664, 0x02119, 0x02B80, 0x0359F, 0x03F78, 0x04910,
+    0x0526A, 0x05B89, 0x0646F, 0x06D20, 0x0759D, 0x07DEA, 0x08608, 0x08DFA,
+    0x095C0, 0x09D5E, 0x0A4D4, 0x0AC24, 0x0B350, 0x0BA59, 0x0C140, 0x0C807,
+    0x0CEAF, 0x0D538, 0x0DBA5, 0x0E1F5, 0x0E82A, 0x0EE45, 0x0F446, 0x0FA2F,
+    0x10000
+};
+
+/*
+  Natural log of a Mel energy, in q8.7.
+  The energy is a q31 value, log2Offset is the log2 of its scaling in Q16.
+  The exponent comes from the CLZ and the mantissa from a linearly
+  interpolated table. The error is below 2e-4, far under the q8.7 LSB.
+ */
+__STATIC_FORCEINLINE q15_t arm_mfcc_stream_log_q15(q31_t energy, int32_t log2Offset)
+{
+  int32_t log2;
+
+  if (energy <= 0)
+  {
+    /* Same floor as arm_vlog_q31 */
+    log2 = -(32 << 16);
+  }
+  else
+  {
+    const uint32_t c = __CLZ((uint32_t)energy);
+    const uint32_t x = (uint32_t)energy << c;
+    const uint32_t idx = (x >> 26) & 0x1FU;
+    const int32_t frac = (int32_t)((x >> 10) & 0xFFFFU);
+    const int32_t t0 = mfcc_log2_table_q16[idx];
+    const int32_t t1 = mfcc_log2_table_q16[idx + 1U];
+
+    log2 = t0 + (((t1 - t0) * frac) >> 16) - (int32_t)(c << 16);
+  }
+  log2 += log2Offset;
+
+  /* Q16 * Q31 -> Q7 */
+  return((q15_t)__SSAT((int32_t)(((q63_t)log2 * LN2_Q31 + (1LL << 39)) >> 40), 16));
+}
+
+/**
+  @ingroup MFCC
+ */
+
+/**
+  @addtogroup MFCCQ15
+  @{
+ */
+
+/**
+  @brief         Streaming MFCC Q15
+  @param[in]     S     points to the streaming mfcc instance structure
+  @param[in]     pSrc  points to the input samples in Q15
+  @param[out]    pDst  points to the output MFCC values in q8.7 format
+  @param[inout]  pTmp  points to a temporary buffer of 2*fftLen q15 values
+  @return        error status
+
+  @par           Description
+                   Computes the same MFCC as arm_mfcc_q15 with fewer
+                   passes over the data:
+                   - the frame is normalized by a power of 2 and windowed
+                     in a single pass, the normalization is then removed
+                     in the log domain instead of rescaling the energies;
+                   - the magnitude of a spectrum bin is computed only if
+                     a Mel filter covers it, and is accumulated into the
+                     filter as soon as it is computed;
+                   - the log of each Mel energy uses CLZ and a small table
+                     instead of the iterative arm_vlog_q31.
+
+  @par             Buffer schedule
+                   The frame is windowed in place in pSrc, the FFT writes
+                   the spectrum into pTmp, each magnitude overwrites the
+                   part of pTmp that has already been consumed, the log-Mel
+                   energies are written back into pSrc and the DCT writes
+                   pDst. No other buffer is used.
+
+                   The outputs are not bit exact with arm_mfcc_q15. The
+                   normalization and the log are computed differently, and
+                   the outputs are at least as close to arm_mfcc_f32: within
+                   0.13 against 0.86 for arm_mfcc_q15 on the frames of
+                   tests/arm_mfcc_stream_q15_test.c.
+                   The source buffer is modified by this function.
+
+  @par Neon implementation
+       There is an additional temporary buffer used for the RFFT.
+       It has 2*fftLength size.
+
+  @code
+      arm_status arm_mfcc_stream_q15(
+  const arm_mfcc_stream_instance_q15 * S,
+  q15_t *pSrc,
+  q15_t *pDst,
+  q15_t *pTmp,
+  q15_t *pTmp_rfft
+  )
+  @endcode
+ */
+#if defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE)
+ARM_DSP_ATTRIBUTE arm_status arm_mfcc_stream_q15(
+  const arm_mfcc_stream_instance_q15 * S,
+  q15_t *pSrc,
+  q15_t *pDst,
+  q15_t *pTmp,
+  q15_t *pTmp_rfft
+  )
+#else
+ARM_DSP_ATTRIBUTE arm_status arm_mfcc_stream_q15(
+  const arm_mfcc_stream_instance_q15 * S,
+  q15_t *pSrc,
+  q15_t *pDst,
+  q15_t *pTmp
+  )
+#endif
+{
+    const arm_mfcc_instance_q15 *M = &(S->mfcc);
+    const q15_t *pCoefs = M->filterCoefs;
+    arm_matrix_instance_q15 pDctMat;
+    q15_t m;
+    uint32_t index;
+    uint32_t i;
+    uint32_t k;
+    uint32_t normShift = 0;
+    uint32_t nextBin = 0;
+    int32_t log2Offset;
+
+    arm_absmax_q15(pSrc, M->fftLen, &m, &index);
+    if (m != 0)
+    {
+      /* Largest shift keeping m << normShift in Q15 */
+      normShift = __CLZ((uint32_t)m) - 17;
+    }
+
+    for (i = 0; i < M->fftLen; i++)
+    {
+      pSrc[i] = (q15_t)__SSAT(((q31_t)pSrc[i] * M->windowCoefs[i]) >> (15 - normShift), 16);
+    }
+
+#if defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE)
+    arm_rfft_q15(&(M->rfft), pSrc, pTmp, pTmp_rfft, 0);
+#else
+#if defined(ARM_MFCC_CFFT_BASED)
+    for (i = 0; i < M->fftLen; i++)
+    {
+      pTmp[2 * i] = pSrc[i];
+      pTmp[2 * i + 1] = 0;
+    }
+    arm_cfft_q15(&(M->cfft), pTmp, 0, 1);
+#else
+    arm_rfft_q15(&(M->rfft), pSrc, pTmp);
+#endif
+#endif
+
+    /* The filters are sorted, so the spectrum is swept once. Bins below
+       nextBin already hold their magnitude in pTmp[bin]. */
+    log2Offset = S->log2Offset - (int32_t)(normShift << 16);
+    for (i = 0; i < M->nbMelFilters; i++)
+    {
+      const uint32_t start = M->filterPos[i];
+      const uint32_t end = start + M->filterLengths[i];
+      q63_t acc = 0;
+
+      k = start;
+      for (; (k < nextBin) && (k < end); k++)
+      {
+        acc += (q31_t)pTmp[k] * *pCoefs++;
+      }
+      for (; k < end; k++)
+      {
+        const q31_t real = pTmp[2 * k];
+        const q31_t imag = pTmp[2 * k + 1];
+        q31_t mag;
+
+        /* Same 2.14 magnitude as arm_cmplx_mag_q15 */
+        arm_sqrt_q31((q31_t)(((uint32_t)(real * real) + (uint32_t)(imag * imag)) >> 1), &mag);
+        pTmp[k] = (q15_t)(mag >> 16);
+        acc += (q31_t)pTmp[k] * *pCoefs++;
+      }
+      if (end > nextBin)
+      {
+        nextBin = end;
+      }
+
+      acc += MICRO_Q15;
+      acc >>= SHIFT_MELFILTER_SATURATION_Q15;
+      pSrc[i] = arm_mfcc_stream_log_q15(clip_q63_to_q31(acc), log2Offset);
+    }
+
+    pDctMat.numRows = M->nbDctOutputs;
+    pDctMat.numCols = M->nbMelFilters;
+    pDctMat.pData = (q15_t *)M->dctCoefs;
+
+    arm_mat_vec_mult_q15(&pDctMat, pSrc, pDst);
+
+    return(ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of MFCCQ15 group
+ */
@@ -35,41 +35,7 @@
  * Internal functions prototypes
  * -------------------------------------------------------------------- */
 #if defined(UP301_HW_DSP)
-#include "up_dsp.h"
-#include "metal/dsp.h"
-
-static metal_dsp_Type *udl1_2_dsp;
-
-//Move Result to Memory
-static volatile int32_t *pMem_Dst = (volatile uint32_t *)0x500C0000;				//L2 SRAM2
-//Move Result to Memory
-
-ARM_DSP_ATTRIBUTE void up301_hw_fft_q31(q31_t *pSrc, q31_t *pDst, uint32_t len, int32_t is_ifft)
-{
-	upt_dsp_config_Type cfg = {
-		.length = len,
-		.dsp_ifftFlag = is_ifft ? UPT_DSP_IRFFT_MODE : UPT_DSP_RFFT_MODE
-	};
-
-	int32_t scale = 0;
-
-	udl1_2_dsp=upt_dsp_get_device(NAON_UDL_1_2_DSP);
-
-	enum_dsp_retcode_Type ret = upt_dsp_rfft_q31(udl1_2_dsp, &cfg, pSrc, pDst, &scale);
-
-	if (ret != E_DSP_SUCCESS) {
-		printf("fft_q31 Error\n");
-		return;
-	}
-
-	for (uint32_t i = 0; i < len; i++) {
-	    int64_t val = (int64_t)pDst[i] << scale;
-	    pDst[i] = (q31_t)__SSAT((val >> 0), 32);  //
-	}
-
-	return ;
-}
-
+#include "dsp/up301_hw_dsp.h"
 #endif
 
 
@@ -197,17 +163,6 @@ ARM_DSP_ATTRIBUTE void arm_rfft_q31(
     }
 }
 
-#elif defined(UP301_HW_DSP)
-ARM_DSP_ATTRIBUTE void arm_rfft_q31(
-  const arm_rfft_instance_q31 * S,
-  q31_t * pSrc,
-  q31_t * pDst)
-{
-
-    up301_hw_fft_q31(pSrc, pDst, S->fftLenReal, 0);
-
-}
-
 #else
 ARM_DSP_ATTRIBUTE void arm_rfft_q31(
   const arm_rfft_instance_q31 * S,
@@ -221,6 +176,14 @@ ARM_DSP_ATTRIBUTE void arm_rfft_q31(
 #endif
         uint32_t L2 = S->fftLenReal >> 1U;
 
+#if defined(UP301_HW_DSP)
+  if ((S->fftLenReal >= UP301_HW_DSP_RFFT_THRESHOLD) &&
+      (up301_hw_rfft_q31(S, pSrc, pDst) == ARM_MATH_SUCCESS))
+  {
+    return;
+  }
+#endif
+
   /* Calculation of RIFFT of input */
   if (S->ifftFlagR == 1U)
   {
@@ -0,0 +1,238 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_stream_q15_test.c
+ * Description:  Host test of the streaming q15 MFCC
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores, RISC-V
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 UpbeatTech Inc. All Rights Reserved
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Checks arm_mfcc_stream_q15 against arm_mfcc_f32 and arm_mfcc_q15 on the
+ * same tables, for several FFT lengths, Mel and DCT sizes, and frames from
+ * full scale down to a few LSB:
+ *  - the stream outputs are within MFCC_STREAM_TOLERANCE of the f32 ones,
+ *    and not further from them than arm_mfcc_q15 is, give or take an LSB,
+ *  - a silent frame gives the same outputs as arm_mfcc_q15,
+ *  - the init rejects the tables the single sweep cannot handle.
+ *
+ * Only built on a host. From the CMSIS_dsp_metal directory, with
+ * arm_common_tables.c of CMSIS-DSP, which this tree does not carry:
+ *
+ *   cc -O2 -D__GNUC_PYTHON__ -DARM_MFCC_HOST_TEST -IInclude -IPrivateInclude
+ *      tests/arm_mfcc_stream_q15_test.c $(find src -name 'arm_*.c')
+ *      arm_common_tables.c -lm -o arm_mfcc_stream_q15_test
+ */
+
+#if defined(ARM_MFCC_HOST_TEST)
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dsp/transform_functions.h"
+#include "arm_mfcc_test_tables.h"
+
+/*
+ * Largest error against arm_mfcc_f32, in natural log units (q8.7 / 128).
+ * Measured up to 0.13 for the stream version and 0.86 for arm_mfcc_q15.
+ */
+#define MFCC_STREAM_TOLERANCE 0.25
+#define TEST_FRAMES 64
+
+typedef struct
+{
+  uint32_t fftLen;
+  uint32_t nbMelFilters;
+  uint32_t nbDctOutputs;
+} test_config;
+
+static const test_config test_configs[] = {
+  {256, 20, 10},
+  {512, 40, 13},
+  {1024, 40, 13},
+  {1024, 64, 32},
+};
+
+static mfcc_test_tables tables;
+static q15_t frame[MFCC_TEST_MAX_FFT_LEN];
+static q15_t srcQ15[MFCC_TEST_MAX_FFT_LEN];
+static q15_t srcStream[MFCC_TEST_MAX_FFT_LEN];
+static float32_t srcF32[MFCC_TEST_MAX_FFT_LEN];
+static q31_t tmpQ15[2U * MFCC_TEST_MAX_FFT_LEN];
+static q15_t tmpStream[2U * MFCC_TEST_MAX_FFT_LEN];
+static float32_t tmpF32[2U * MFCC_TEST_MAX_FFT_LEN];
+static uint32_t seed = 12345U;
+static int failures;
+
+#define CHECK(cond)                                                        \
+  do {                                                                     \
+    if (!(cond)) {                                                         \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);               \
+      failures++;                                                          \
+    }                                                                      \
+  } while (0)
+
+static double test_rand(void)
+{
+  seed = seed * 1103515245U + 12345U;
+  return((double)(seed >> 8) / (double)(1U << 24) * 2.0 - 1.0);
+}
+
+/* Tone plus noise at 10^(-0.7 * (f % 5)) of full scale, one clipped frame */
+static void make_frame(uint32_t fftLen, uint32_t f)
+{
+  const double amp = (f == 1U) ? 4.0 : pow(10.0, -0.7 * (f % 5U));
+  const double tone = 0.02 + 0.37 * (f % 7U) / 7.0;
+
+  for (uint32_t i = 0; i < fftLen; i++)
+  {
+    double v = amp * 0.9 * (0.6 * sin(tone * i) + 0.4 * test_rand());
+
+    v = v > 0.999 ? 0.999 : (v < -0.999 ? -0.999 : v);
+    frame[i] = (q15_t)lround(v * 32768.0);
+  }
+}
+
+static void test_accuracy(const test_config *C)
+{
+  arm_mfcc_instance_f32 mf32;
+  arm_mfcc_instance_q15 mq15;
+  arm_mfcc_stream_instance_q15 ms;
+  const mfcc_test_tables *T = &tables;
+  double errStream = 0.0;
+  double errQ15 = 0.0;
+
+  mfcc_test_tables_init(&tables, C->fftLen, C->nbMelFilters, C->nbDctOutputs);
+  CHECK(arm_mfcc_init_f32(&mf32, T->fftLen, T->nbMelFilters, T->nbDctOutputs,
+                          T->dctCoefsF32, T->filterPos, T->filterLengths,
+                          T->filterCoefsF32, T->windowF32) == ARM_MATH_SUCCESS);
+  CHECK(arm_mfcc_init_q15(&mq15, T->fftLen, T->nbMelFilters, T->nbDctOutputs,
+                          T->dctCoefsQ15, T->filterPos, T->filterLengths,
+                          T->filterCoefsQ15, T->windowQ15) == ARM_MATH_SUCCESS);
+  CHECK(arm_mfcc_stream_init_q15(&ms, T->fftLen, T->nbMelFilters, T->nbDctOutputs,
+                                 T->dctCoefsQ15, T->filterPos, T->filterLengths,
+                                 T->filterCoefsQ15, T->windowQ15) == ARM_MATH_SUCCESS);
+
+  for (uint32_t f = 0; f < TEST_FRAMES; f++)
+  {
+    q15_t outQ15[MFCC_TEST_MAX_DCT];
+    q15_t outStream[MFCC_TEST_MAX_DCT];
+    float32_t outF32[MFCC_TEST_MAX_DCT];
+    double frameStream = 0.0;
+    double frameQ15 = 0.0;
+
+    make_frame(C->fftLen, f);
+    for (uint32_t i = 0; i < C->fftLen; i++)
+    {
+      srcF32[i] = (float32_t)frame[i] / 32768.0f;
+    }
+    memcpy(srcQ15, frame, sizeof(q15_t) * C->fftLen);
+    memcpy(srcStream, frame, sizeof(q15_t) * C->fftLen);
+
+    arm_mfcc_f32(&mf32, srcF32, outF32, tmpF32);
+    CHECK(arm_mfcc_q15(&mq15, srcQ15, outQ15, tmpQ15) == ARM_MATH_SUCCESS);
+    CHECK(arm_mfcc_stream_q15(&ms, srcStream, outStream, tmpStream) == ARM_MATH_SUCCESS);
+
+    for (uint32_t k = 0; k < C->nbDctOutputs; k++)
+    {
+      frameStream = fmax(frameStream, fabs(outStream[k] / 128.0 - outF32[k]));
+      frameQ15 = fmax(frameQ15, fabs(outQ15[k] / 128.0 - outF32[k]));
+    }
+    errStream = fmax(errStream, frameStream);
+    errQ15 = fmax(errQ15, frameQ15);
+  }
+
+  printf("fftLen %4u, %2u Mel, %2u DCT: max error against f32 stream %.3f, q15 %.3f\n",
+         (unsigned)C->fftLen, (unsigned)C->nbMelFilters, (unsigned)C->nbDctOutputs,
+         errStream, errQ15);
+  CHECK(errStream <= MFCC_STREAM_TOLERANCE);
+  CHECK(errStream <= errQ15 + 1.0 / 128.0);
+}
+
+static void test_silence(void)
+{
+  arm_mfcc_instance_q15 mq15;
+  arm_mfcc_stream_instance_q15 ms;
+  const mfcc_test_tables *T = &tables;
+  q15_t outQ15[MFCC_TEST_MAX_DCT];
+  q15_t outStream[MFCC_TEST_MAX_DCT];
+
+  mfcc_test_tables_init(&tables, 512, 40, 13);
+  (void)arm_mfcc_init_q15(&mq15, T->fftLen, T->nbMelFilters, T->nbDctOutputs,
+                          T->dctCoefsQ15, T->filterPos, T->filterLengths,
+                          T->filterCoefsQ15, T->windowQ15);
+  (void)arm_mfcc_stream_init_q15(&ms, T->fftLen, T->nbMelFilters, T->nbDctOutputs,
+                                 T->dctCoefsQ15, T->filterPos, T->filterLengths,
+                                 T->filterCoefsQ15, T->windowQ15);
+
+  memset(srcQ15, 0, sizeof(srcQ15));
+  memset(srcStream, 0, sizeof(srcStream));
+  CHECK(arm_mfcc_q15(&mq15, srcQ15, outQ15, tmpQ15) == ARM_MATH_SUCCESS);
+  CHECK(arm_mfcc_stream_q15(&ms, srcStream, outStream, tmpStream) == ARM_MATH_SUCCESS);
+  CHECK(memcmp(outQ15, outStream, sizeof(q15_t) * T->nbDctOutputs) == 0);
+}
+
+static void test_init(void)
+{
+  arm_mfcc_stream_instance_q15 ms;
+  mfcc_test_tables *T = &tables;
+  uint32_t pos;
+
+  mfcc_test_tables_init(&tables, 512, 40, 13);
+
+  /* Not a power of 2 */
+  CHECK(arm_mfcc_stream_init_q15(&ms, 500, T->nbMelFilters, T->nbDctOutputs,
+                                 T->dctCoefsQ15, T->filterPos, T->filterLengths,
+                                 T->filterCoefsQ15, T->windowQ15) == ARM_MATH_ARGUMENT_ERROR);
+
+  /* Filters out of order */
+  pos = T->filterPos[10];
+  T->filterPos[10] = T->filterPos[9] - 1U;
+  CHECK(arm_mfcc_stream_init_q15(&ms, T->fftLen, T->nbMelFilters, T->nbDctOutputs,
+                                 T->dctCoefsQ15, T->filterPos, T->filterLengths,
+                                 T->filterCoefsQ15, T->windowQ15) == ARM_MATH_ARGUMENT_ERROR);
+  T->filterPos[10] = pos;
+
+  /* Last filter past the Nyquist bin */
+  T->filterLengths[T->nbMelFilters - 1U] = T->fftLen / 2U + 2U - T->filterPos[T->nbMelFilters - 1U];
+  CHECK(arm_mfcc_stream_init_q15(&ms, T->fftLen, T->nbMelFilters, T->nbDctOutputs,
+                                 T->dctCoefsQ15, T->filterPos, T->filterLengths,
+                                 T->filterCoefsQ15, T->windowQ15) == ARM_MATH_ARGUMENT_ERROR);
+}
+
+int main(void)
+{
+  for (uint32_t i = 0; i < sizeof(test_configs) / sizeof(test_configs[0]); i++)
+  {
+    test_accuracy(&test_configs[i]);
+  }
+  test_silence();
+  test_init();
+
+  printf(failures == 0 ? "arm_mfcc_stream_q15_test: OK\n"
+                       : "arm_mfcc_stream_q15_test: %d failures\n",
+         failures);
+  return failures != 0;
+}
+
+#endif /* defined(ARM_MFCC_HOST_TEST) */
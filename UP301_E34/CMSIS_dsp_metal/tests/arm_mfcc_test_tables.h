@@ -0,0 +1,147 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_test_tables.h
+ * Description:  MFCC tables for the host tests and benchmarks
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M cores, RISC-V
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 UpbeatTech Inc. All Rights Reserved
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ARM_MFCC_TEST_TABLES_H_
+#define _ARM_MFCC_TEST_TABLES_H_
+
+#include <math.h>
+
+#include "arm_math_types.h"
+
+/*
+ * Tables of the CMSIS-DSP MFCC generator (Hann window, triangular Mel
+ * filters between 20 Hz and fs/2 stored by their nonzero range, DCT-II
+ * with orthonormal scaling), computed at run time in f32 and q15 so that
+ * every arm_mfcc_* variant gets the same filters.
+ */
+
+#define MFCC_TEST_MAX_FFT_LEN 1024U
+#define MFCC_TEST_MAX_MEL 64U
+#define MFCC_TEST_MAX_DCT 32U
+#define MFCC_TEST_SAMPLE_RATE 16000.0
+
+typedef struct
+{
+  uint32_t fftLen;
+  uint32_t nbMelFilters;
+  uint32_t nbDctOutputs;
+  uint32_t filterPos[MFCC_TEST_MAX_MEL];
+  uint32_t filterLengths[MFCC_TEST_MAX_MEL];
+  float32_t filterCoefsF32[2U * MFCC_TEST_MAX_FFT_LEN];
+  q15_t filterCoefsQ15[2U * MFCC_TEST_MAX_FFT_LEN];
+  float32_t dctCoefsF32[MFCC_TEST_MAX_MEL * MFCC_TEST_MAX_DCT];
+  q15_t dctCoefsQ15[MFCC_TEST_MAX_MEL * MFCC_TEST_MAX_DCT];
+  float32_t windowF32[MFCC_TEST_MAX_FFT_LEN];
+  q15_t windowQ15[MFCC_TEST_MAX_FFT_LEN];
+} mfcc_test_tables;
+
+static inline q15_t mfcc_test_to_q15(double x)
+{
+  double v = round(x * 32768.0);
+
+  return((q15_t)(v > 32767.0 ? 32767.0 : (v < -32768.0 ? -32768.0 : v)));
+}
+
+static inline double mfcc_test_hz_to_mel(double f)
+{
+  return(1127.0 * log(1.0 + f / 700.0));
+}
+
+static inline double mfcc_test_mel_to_hz(double m)
+{
+  return(700.0 * (exp(m / 1127.0) - 1.0));
+}
+
+static inline void mfcc_test_tables_init(
+  mfcc_test_tables * T,
+  uint32_t fftLen,
+  uint32_t nbMelFilters,
+  uint32_t nbDctOutputs)
+{
+  const double pi = acos(-1.0);
+  const double lo = mfcc_test_hz_to_mel(20.0);
+  const double hi = mfcc_test_hz_to_mel(MFCC_TEST_SAMPLE_RATE / 2.0);
+  uint32_t nbCoefs = 0;
+
+  T->fftLen = fftLen;
+  T->nbMelFilters = nbMelFilters;
+  T->nbDctOutputs = nbDctOutputs;
+
+  for (uint32_t i = 0; i < nbMelFilters; i++)
+  {
+    const double left = mfcc_test_mel_to_hz(lo + (hi - lo) * i / (nbMelFilters + 1));
+    const double center = mfcc_test_mel_to_hz(lo + (hi - lo) * (i + 1) / (nbMelFilters + 1));
+    const double right = mfcc_test_mel_to_hz(lo + (hi - lo) * (i + 2) / (nbMelFilters + 1));
+
+    /* An empty filter keeps the position of the previous one */
+    T->filterPos[i] = (i > 0) ? T->filterPos[i - 1] : 0;
+    T->filterLengths[i] = 0;
+    for (uint32_t k = 0; k <= fftLen / 2; k++)
+    {
+      const double f = k * MFCC_TEST_SAMPLE_RATE / fftLen;
+      const double w = fmin((f - left) / (center - left), (right - f) / (right - center));
+
+      if (w > 0.0)
+      {
+        if (T->filterLengths[i] == 0)
+        {
+          T->filterPos[i] = k;
+        }
+        T->filterLengths[i]++;
+        T->filterCoefsF32[nbCoefs] = (float32_t)w;
+        T->filterCoefsQ15[nbCoefs] = mfcc_test_to_q15(w);
+        nbCoefs++;
+      }
+    }
+  }
+
+  for (uint32_t k = 0; k < nbDctOutputs; k++)
+  {
+    for (uint32_t n = 0; n < nbMelFilters; n++)
+    {
+      double v = cos(pi * k * (n + 0.5) / nbMelFilters) * sqrt(2.0 / nbMelFilters);
+
+      if (k == 0)
+      {
+        v /= sqrt(2.0);
+      }
+      T->dctCoefsF32[k * nbMelFilters + n] = (float32_t)v;
+      T->dctCoefsQ15[k * nbMelFilters + n] = mfcc_test_to_q15(v);
+    }
+  }
+
+  for (uint32_t i = 0; i < fftLen; i++)
+  {
+    const double w = 0.5 - 0.5 * cos(2.0 * pi * i / fftLen);
+
+    T->windowF32[i] = (float32_t)w;
+    T->windowQ15[i] = mfcc_test_to_q15(w);
+  }
+}
+
+#endif /* _ARM_MFCC_TEST_TABLES_H_ */
@@ -0,0 +1,376 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        up301_hw_dsp_test.c
+ * Description:  Host test of the UP301 DSP block dispatch
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 UpbeatTech Inc. All Rights Reserved
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Runs the UP301_HW_DSP build against the C model of the DSP block and
+ * checks that:
+ *  - the transforms of the block match a double DFT within an LSB (q15),
+ *  - arm_dot_prod_q15 and arm_dot_prod_q31 never use the block and stay
+ *    exact, arm_dot_prod_fast_q15 stays within its documented rounding,
+ *  - arm_vsqrt_q15/q31 on the block are within an LSB of the exact roots,
+ *  - sizes from the threshold up reach the block, smaller ones do not,
+ *  - with the block failing, the results are those of the CPU bit exactly.
+ *
+ * Only built on a host, with the model. From the CMSIS_dsp_metal directory:
+ *
+ *   cc -O2 -D__GNUC_PYTHON__ -DUP301_HW_DSP -DUPT_DSP_HOST_MODEL
+ *      -IInclude -I../freedom-metal tests/up301_hw_dsp_test.c
+ *      src/BasicMathFunctions/arm_dot_prod_q15.c
+ *      src/BasicMathFunctions/arm_dot_prod_q31.c
+ *      src/FastMathFunctions/arm_sqrt_q15.c
+ *      src/FastMathFunctions/arm_sqrt_q31.c
+ *      src/SupportFunctions/up301_hw_dsp.c
+ *      ../freedom-metal/src/up_dsp_model.c ../freedom-metal/src/dsp_queue.c
+ *      -lm -lpthread -o up301_hw_dsp_test
+ */
+
+#if defined(UP301_HW_DSP) && defined(UPT_DSP_HOST_MODEL)
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dsp/basic_math_functions.h"
+#include "dsp/fast_math_functions.h"
+#include "dsp/transform_functions.h"
+#include "dsp/up301_hw_dsp.h"
+#include "metal/drivers/up_dsp_model.h"
+
+#define TEST_MAX_LEN 4096U
+
+/* Largest error against a double DFT, in LSB. The block twiddles are Q20. */
+#define RFFT_TOLERANCE_Q15 1.0
+#define RFFT_TOLERANCE_Q31 32.0
+
+/*
+ * Starting points 1/sqrt(x) of the Newton iterations of arm_sqrt_q15/q31,
+ * normally from arm_common_tables.c, which this tree does not carry.
+ */
+const q15_t sqrt_initial_lut_q15[16] = {
+  7723, 6986, 6426, 5983, 5620, 5316, 5056, 4831,
+  4634, 4459, 4303, 4162, 4033, 3917, 3809, 3710
+};
+const q31_t sqrt_initial_lut_q31[32] = {
+  520841289, 492666537, 468619351, 447781295, 429496730, 413283421, 398777702, 385699449,
+  373828920, 362990988, 353044137, 343872592, 335380600, 327488186, 320127961, 313242684,
+  306783378, 300707858, 294979565, 289566636, 284441158, 279578557, 274957106, 270557508,
+  266362564, 262356884, 258526651, 254859420, 251343950, 247970052, 244728474, 241610787
+};
+
+static q15_t src15[TEST_MAX_LEN] __ALIGNED(4);
+static q15_t srcB15[TEST_MAX_LEN] __ALIGNED(4);
+static q15_t work15[2U * UP301_HW_DSP_MAX_FFT_LEN + 2U] __ALIGNED(4);
+static q15_t hw15[2U * UP301_HW_DSP_MAX_FFT_LEN] __ALIGNED(4);
+static q15_t cpu15[2U * UP301_HW_DSP_MAX_FFT_LEN] __ALIGNED(4);
+static q31_t src31[TEST_MAX_LEN] __ALIGNED(4);
+static q31_t srcB31[TEST_MAX_LEN] __ALIGNED(4);
+static q31_t work31[2U * UP301_HW_DSP_MAX_FFT_LEN + 2U] __ALIGNED(4);
+static q31_t hw31[2U * UP301_HW_DSP_MAX_FFT_LEN] __ALIGNED(4);
+static q31_t cpu31[2U * UP301_HW_DSP_MAX_FFT_LEN] __ALIGNED(4);
+
+static uint32_t seed = 12345U;
+static int failures;
+
+#define CHECK(cond)                                                        \
+  do {                                                                     \
+    if (!(cond)) {                                                         \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);               \
+      failures++;                                                          \
+    }                                                                      \
+  } while (0)
+
+static int32_t test_rand(int32_t range)
+{
+  seed = seed * 1103515245U + 12345U;
+  return (int32_t)((seed >> 8) % (uint32_t)(2 * range + 1)) - range;
+}
+
+/*
+ * Both transforms of every length against a double DFT, scaled like the
+ * CPU functions (by 1/N in both directions). The CPU transforms need the
+ * twiddle tables of arm_common_tables.c, which this tree does not carry,
+ * so the dispatch is called directly with the fields it reads.
+ */
+static void test_rfft(void)
+{
+  const double pi = acos(-1.0);
+
+  for (uint32_t n = UP301_HW_DSP_MIN_FFT_LEN; n <= UP301_HW_DSP_MAX_FFT_LEN; n *= 2U)
+  {
+    for (uint32_t inverse = 0; inverse < 2U; inverse++)
+    {
+      const uint32_t inLen = inverse ? n + 2U : n;
+      const uint32_t outLen = inverse ? n : n + 2U;
+      arm_rfft_instance_q15 s15 = { 0 };
+      arm_rfft_instance_q31 s31 = { 0 };
+      double err15 = 0.0;
+      double err31 = 0.0;
+
+      s15.fftLenReal = n;
+      s15.ifftFlagR = (uint8_t)inverse;
+      s15.bitReverseFlagR = 1U;
+      s31.fftLenReal = n;
+      s31.ifftFlagR = (uint8_t)inverse;
+      s31.bitReverseFlagR = 1U;
+      for (uint32_t i = 0; i < inLen; i++)
+      {
+        src15[i] = (q15_t)test_rand(8000);
+        src31[i] = test_rand(1 << 28);
+      }
+      if (inverse)
+      {
+        /* Imaginary parts of DC and Nyquist */
+        src15[1] = src15[n + 1U] = 0;
+        src31[1] = src31[n + 1U] = 0;
+      }
+
+      upt_dsp_model_reset();
+      memcpy(work15, src15, sizeof(q15_t) * inLen);
+      CHECK(up301_hw_rfft_q15(&s15, work15, hw15) == ARM_MATH_SUCCESS);
+      memcpy(work31, src31, sizeof(q31_t) * inLen);
+      CHECK(up301_hw_rfft_q31(&s31, work31, hw31) == ARM_MATH_SUCCESS);
+      CHECK(upt_dsp_model_op_count() == 2U);
+
+      for (uint32_t k = 0; k < outLen / (inverse ? 1U : 2U); k++)
+      {
+        double re15 = 0.0, im15 = 0.0, re31 = 0.0, im31 = 0.0;
+
+        for (uint32_t m = 0; m < n; m++)
+        {
+          const double angle = 2.0 * pi * (double)((k * m) % n) / n;
+
+          if (inverse)
+          {
+            /* Hermitian spectrum from its first half */
+            const uint32_t j = m <= n / 2U ? m : n - m;
+            const double sign = m <= n / 2U ? 1.0 : -1.0;
+
+            re15 += src15[2U * j] * cos(angle) - sign * src15[2U * j + 1U] * sin(angle);
+            re31 += src31[2U * j] * cos(angle) - sign * src31[2U * j + 1U] * sin(angle);
+          }
+          else
+          {
+            re15 += src15[m] * cos(angle);
+            im15 -= src15[m] * sin(angle);
+            re31 += src31[m] * cos(angle);
+            im31 -= src31[m] * sin(angle);
+          }
+        }
+        if (inverse)
+        {
+          err15 = fmax(err15, fabs(re15 / n - hw15[k]));
+          err31 = fmax(err31, fabs(re31 / n - hw31[k]));
+        }
+        else
+        {
+          err15 = fmax(err15, fmax(fabs(re15 / n - hw15[2U * k]), fabs(im15 / n - hw15[2U * k + 1U])));
+          err31 = fmax(err31, fmax(fabs(re31 / n - hw31[2U * k]), fabs(im31 / n - hw31[2U * k + 1U])));
+        }
+      }
+      CHECK(err15 <= RFFT_TOLERANCE_Q15);
+      CHECK(err31 <= RFFT_TOLERANCE_Q31);
+
+      /* Errors leave the output to the CPU, untouched */
+      memset(hw15, 0x5a, sizeof(hw15));
+      memcpy(cpu15, hw15, sizeof(hw15));
+      memcpy(work15, src15, sizeof(q15_t) * inLen);
+      upt_dsp_model_force_error(1);
+      CHECK(up301_hw_rfft_q15(&s15, work15, hw15) == ARM_MATH_TEST_FAILURE);
+      upt_dsp_model_force_error(0);
+      CHECK(up301_hw_rfft_q15(&s15, work15 + 1, hw15) == ARM_MATH_ARGUMENT_ERROR);
+      CHECK(memcmp(hw15, cpu15, sizeof(hw15)) == 0);
+    }
+  }
+
+  {
+    arm_rfft_instance_q15 s15 = { 0 };
+
+    s15.fftLenReal = UP301_HW_DSP_MIN_FFT_LEN / 2U;
+    s15.bitReverseFlagR = 1U;
+    CHECK(up301_hw_rfft_q15(&s15, work15, hw15) == ARM_MATH_LENGTH_ERROR);
+  }
+}
+
+/* The exact dot products keep their 34.30 and 16.48 sums, on any input */
+static void test_dot_prod_exact(void)
+{
+  static const uint32_t lengths[] = { 5U, 64U, 512U, 513U, 1500U, TEST_MAX_LEN };
+
+  for (uint32_t k = 0; k < sizeof(lengths) / sizeof(lengths[0]); k++)
+  {
+    const uint32_t n = lengths[k];
+
+    for (int32_t range = 1; range <= 32767; range = range * 181 + 1)
+    {
+      q63_t ref15 = 0;
+      q63_t ref31 = 0;
+      q63_t r15;
+      q63_t r31;
+
+      for (uint32_t i = 0; i < n; i++)
+      {
+        src15[i] = (q15_t)test_rand(range);
+        srcB15[i] = (q15_t)test_rand(range);
+        src31[i] = test_rand(range) * 65536;
+        srcB31[i] = test_rand(range) * 65536;
+        ref15 += (q31_t)src15[i] * srcB15[i];
+        ref31 += ((q63_t)src31[i] * srcB31[i]) >> 14U;
+      }
+      upt_dsp_model_reset();
+      arm_dot_prod_q15(src15, srcB15, n, &r15);
+      arm_dot_prod_q31(src31, srcB31, n, &r31);
+      CHECK(upt_dsp_model_op_count() == 0U);
+      CHECK(r15 == ref15);
+      CHECK(r31 == ref31);
+    }
+  }
+}
+
+/*
+ * With inputs below 2^8 the row sums fit q15, so the block rounds each row
+ * by at most 2^14 in the 34.30 format. Inputs of 1 round every row to 0.
+ */
+static void test_dot_prod_fast(void)
+{
+  static const uint32_t lengths[] = { 5U, 63U, 64U, 512U, 513U, 1500U, TEST_MAX_LEN };
+
+  for (uint32_t k = 0; k < sizeof(lengths) / sizeof(lengths[0]); k++)
+  {
+    const uint32_t n = lengths[k];
+    const int dispatched = n >= UP301_HW_DSP_DOT_PROD_THRESHOLD;
+    const uint32_t rows = (n + UP301_HW_DSP_MAX_DOT_DIM_Q15 - 1U) / UP301_HW_DSP_MAX_DOT_DIM_Q15;
+    q63_t exact;
+    q63_t fast;
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+      src15[i] = (q15_t)test_rand(255);
+      srcB15[i] = (q15_t)test_rand(255);
+    }
+    arm_dot_prod_q15(src15, srcB15, n, &exact);
+    upt_dsp_model_reset();
+    arm_dot_prod_fast_q15(src15, srcB15, n, &fast);
+    CHECK((upt_dsp_model_op_count() != 0U) == dispatched);
+    CHECK(llabs(fast - exact) <= (q63_t)rows << 14);
+
+    upt_dsp_model_force_error(1);
+    arm_dot_prod_fast_q15(src15, srcB15, n, &fast);
+    upt_dsp_model_force_error(0);
+    CHECK(fast == exact);
+  }
+
+  for (uint32_t i = 0; i < UP301_HW_DSP_MAX_DOT_DIM_Q15; i++)
+  {
+    src15[i] = 1;
+    srcB15[i] = 1;
+  }
+  {
+    q63_t fast;
+
+    arm_dot_prod_fast_q15(src15, srcB15, UP301_HW_DSP_MAX_DOT_DIM_Q15, &fast);
+    CHECK(fast == 0);
+  }
+}
+
+/*
+ * Square roots within an LSB of the exact ones (the CPU iterations lose up
+ * to 7); a negative input leaves the whole vector to the CPU.
+ */
+static void test_vsqrt(void)
+{
+  static const uint32_t lengths[] = { 1U, 15U, 16U, 300U, UP301_HW_DSP_MAX_POINTS, UP301_HW_DSP_MAX_POINTS + 1U };
+
+  for (uint32_t k = 0; k < sizeof(lengths) / sizeof(lengths[0]); k++)
+  {
+    const uint32_t n = lengths[k];
+    const int dispatched = (n >= UP301_HW_DSP_SQRT_THRESHOLD) && (n <= UP301_HW_DSP_MAX_POINTS);
+    double err15 = 0.0;
+    double err31 = 0.0;
+
+    for (int negative = 0; negative < 2; negative++)
+    {
+      for (uint32_t i = 0; i < n; i++)
+      {
+        src15[i] = (q15_t)(test_rand(16383) + 16384);
+        src31[i] = test_rand(1073741823) + 1073741824;
+        arm_sqrt_q15(src15[i], &cpu15[i]);
+        arm_sqrt_q31(src31[i], &cpu31[i]);
+      }
+      if (negative)
+      {
+        src15[n / 2U] = -5;
+        src31[n / 2U] = -3;
+        cpu15[n / 2U] = 0;
+        cpu31[n / 2U] = 0;
+      }
+
+      upt_dsp_model_reset();
+      arm_vsqrt_q15(src15, hw15, n);
+      arm_vsqrt_q31(src31, hw31, n);
+      if (dispatched && !negative)
+      {
+        CHECK(upt_dsp_model_op_count() == 2U);
+        for (uint32_t i = 0; i < n; i++)
+        {
+          err15 = fmax(err15, fabs(hw15[i] - sqrt(src15[i] * 32768.0)));
+          err31 = fmax(err31, fabs(hw31[i] - sqrt(src31[i] * 2147483648.0)));
+        }
+        CHECK(err15 <= 1.0 && err31 <= 1.0);
+      }
+      else
+      {
+        CHECK(upt_dsp_model_op_count() == 0U);
+        CHECK(memcmp(hw15, cpu15, sizeof(q15_t) * n) == 0);
+        CHECK(memcmp(hw31, cpu31, sizeof(q31_t) * n) == 0);
+      }
+
+      upt_dsp_model_force_error(1);
+      arm_vsqrt_q15(src15, hw15, n);
+      arm_vsqrt_q31(src31, hw31, n);
+      upt_dsp_model_force_error(0);
+      CHECK(memcmp(hw15, cpu15, sizeof(q15_t) * n) == 0);
+      CHECK(memcmp(hw31, cpu31, sizeof(q31_t) * n) == 0);
+    }
+  }
+}
+
+int main(void)
+{
+  test_rfft();
+  test_dot_prod_exact();
+  test_dot_prod_fast();
+  test_vsqrt();
+
+  printf(failures == 0 ? "up301_hw_dsp_test: OK\n"
+                       : "up301_hw_dsp_test: %d failures\n",
+         failures);
+  return failures != 0;
+}
+
+#endif /* defined(UP301_HW_DSP) && defined(UPT_DSP_HOST_MODEL) */
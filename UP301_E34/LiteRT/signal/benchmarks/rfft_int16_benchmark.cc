@@ -0,0 +1,134 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host benchmark of the size-specialized int16 RFFT against the kissfft
+// path it replaces. Reports time per transform and the worst error of each
+// against a double precision DFT scaled like the int16 output (DFT / N).
+//
+// Only built on request, since the firmware build globs every .cc file.
+// From the LiteRT directory:
+//
+//   g++ -O2 -std=c++17 -DSIGNAL_HOST_BENCHMARK -I. -Ithird_party/kissfft
+//       signal/benchmarks/rfft_int16_benchmark.cc signal/src/rfft_int16.cc
+//       signal/src/rfft_int16_fixed.cc
+//       signal/src/kiss_fft_wrappers/kiss_fft_int16.cc
+//       -o rfft_int16_benchmark
+
+#if defined(SIGNAL_HOST_BENCHMARK)
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "signal/src/complex.h"
+#include "signal/src/kiss_fft_wrappers/kiss_fft_int16.h"
+#include "signal/src/rfft.h"
+
+namespace {
+
+constexpr int kIterations = 20000;
+constexpr int kAccuracyFrames = 200;
+
+double MaxError(const std::vector<int16_t>& input,
+                const std::vector<Complex<int16_t>>& output, int fft_length) {
+  const double pi = std::acos(-1.0);
+  double max_error = 0.0;
+  for (int k = 0; k <= fft_length / 2; ++k) {
+    double re = 0.0;
+    double im = 0.0;
+    for (int n = 0; n < fft_length; ++n) {
+      const double angle = 2.0 * pi * k * n / fft_length;
+      re += input[n] * std::cos(angle);
+      im -= input[n] * std::sin(angle);
+    }
+    max_error = std::fmax(max_error,
+                          std::fabs(re / fft_length - output[k].real));
+    max_error = std::fmax(max_error,
+                          std::fabs(im / fft_length - output[k].imag));
+  }
+  return max_error;
+}
+
+template <typename Fn>
+double NanosecondsPerCall(Fn fn) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kIterations; ++i) {
+    fn();
+  }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() /
+         kIterations;
+}
+
+void Benchmark(int fft_length) {
+  std::vector<int16_t> input(fft_length);
+  std::vector<Complex<int16_t>> fixed_out(fft_length / 2 + 1);
+  std::vector<Complex<int16_t>> kiss_out(fft_length / 2 + 1);
+
+  std::vector<int8_t> fixed_state(
+      tflm_signal::RfftInt16GetNeededMemory(fft_length));
+  void* fixed = tflm_signal::RfftInt16Init(fft_length, fixed_state.data(),
+                                           fixed_state.size());
+  size_t kiss_size = 0;
+  kiss_fft_fixed16::kiss_fftr_alloc(fft_length, 0, nullptr, &kiss_size);
+  std::vector<int8_t> kiss_state(kiss_size);
+  auto kiss = kiss_fft_fixed16::kiss_fftr_alloc(fft_length, 0,
+                                                kiss_state.data(), &kiss_size);
+
+  double fixed_error = 0.0;
+  double kiss_error = 0.0;
+  for (int frame = 0; frame < kAccuracyFrames; ++frame) {
+    // Mix of full scale and quiet frames, as seen after FftAutoScale.
+    const int shift = frame % 4;
+    for (int16_t& v : input) {
+      v = static_cast<int16_t>((std::rand() % 65536 - 32768) >> shift);
+    }
+    tflm_signal::RfftInt16Apply(fixed, input.data(), fixed_out.data());
+    kiss_fft_fixed16::kiss_fftr(
+        kiss, input.data(),
+        reinterpret_cast<kiss_fft_fixed16::kiss_fft_cpx*>(kiss_out.data()));
+    fixed_error =
+        std::fmax(fixed_error, MaxError(input, fixed_out, fft_length));
+    kiss_error = std::fmax(kiss_error, MaxError(input, kiss_out, fft_length));
+  }
+
+  const double fixed_ns = NanosecondsPerCall([&]() {
+    tflm_signal::RfftInt16Apply(fixed, input.data(), fixed_out.data());
+  });
+  const double kiss_ns = NanosecondsPerCall([&]() {
+    kiss_fft_fixed16::kiss_fftr(
+        kiss, input.data(),
+        reinterpret_cast<kiss_fft_fixed16::kiss_fft_cpx*>(kiss_out.data()));
+  });
+
+  std::printf(
+      "fft_length %4d: fixed %8.0f ns (max err %.2f LSB, state %zu B), "
+      "kissfft %8.0f ns (max err %.2f LSB, state %zu B), speedup %.2fx\n",
+      fft_length, fixed_ns, fixed_error, fixed_state.size(), kiss_ns,
+      kiss_error, kiss_size, kiss_ns / fixed_ns);
+}
+
+}  // namespace
+
+int main() {
+  Benchmark(256);
+  Benchmark(512);
+  return 0;
+}
+
+#endif  // defined(SIGNAL_HOST_BENCHMARK)
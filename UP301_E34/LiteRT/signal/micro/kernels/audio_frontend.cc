@@ -0,0 +1,375 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "signal/src/complex.h"
+#include "signal/src/energy.h"
+#include "signal/src/filter_bank.h"
+#include "signal/src/filter_bank_log.h"
+#include "signal/src/filter_bank_spectral_subtraction.h"
+#include "signal/src/filter_bank_square_root.h"
+#include "signal/src/pcan_argc_fixed.h"
+#include "signal/src/rfft.h"
+#include "signal/src/upt_dsp.h"
+#include "signal/src/window.h"
+#include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/flatbuffer_utils.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/memory_helpers.h"
+#include "tensorflow/lite/micro/micro_context.h"
+#include "tensorflow/lite/micro/micro_utils.h"
+
+// Fused audio frontend:
+//   Window -> Rfft -> Energy -> FilterBank -> FilterBankSquareRoot
+//     [-> FilterBankSpectralSubtraction -> PCAN] -> FilterBankLog
+// Each frame (innermost dimension of the input) is taken through all stages
+// before the next one starts, using two small scratch buffers instead of one
+// arena tensor per stage. Every stage takes the same path as its standalone
+// op, including the UPT DSP block for the Rfft, so the output is
+// bit-identical to the unfused graph (see audio_frontend_test.cc).
+//
+// With PCAN, the noise estimate comes from spectral subtraction, as in the
+// unfused graph. It is kept across invocations and cleared by Reset.
+
+namespace tflite {
+namespace {
+
+constexpr int kInputTensor = 0;
+constexpr int kWindowWeightsTensor = 1;
+constexpr int kWeightTensor = 2;
+constexpr int kUnweightTensor = 3;
+constexpr int kChFreqStartsTensor = 4;
+constexpr int kChWeightStartsTensor = 5;
+constexpr int kChannelWidthsTensor = 6;
+constexpr int kScaleBitsTensor = 7;
+// Only present when PCAN is enabled
+constexpr int kGainLutTensor = 8;
+constexpr int kOutputTensor = 0;
+
+constexpr int kNumInputsWithoutPcan = 8;
+constexpr int kNumInputsWithPcan = 9;
+
+// The parameters keep the names used by the standalone ops:
+// Window:        'shift'
+// Rfft:          'fft_length'
+// Energy:        'start_index', 'end_index'
+// FilterBank:    'num_channels'
+// FilterBankLog: 'input_correction_bits', 'output_scale'
+// FilterBankSpectralSubtraction and PCAN (only read when PCAN inputs are
+// present): 'alternate_one_minus_smoothing', 'alternate_smoothing',
+//   'clamping', 'min_signal_remaining', 'one_minus_smoothing', 'smoothing',
+//   'smoothing_bits', 'spectral_subtraction_bits', 'snr_shift'
+struct TFLMSignalAudioFrontendParams {
+  int32_t shift;
+  int32_t fft_length;
+  int32_t start_index;
+  int32_t end_index;
+  int32_t input_correction_bits;
+  int32_t output_scale;
+  int32_t snr_shift;
+  tflm_signal::FilterbankConfig filter_bank_config;
+  tflm_signal::SpectralSubtractionConfig spectral_subtraction_config;
+
+  int32_t frame_size;
+  int32_t num_frames;
+  bool use_pcan;
+  // Run the Rfft on the UPT DSP block, as the standalone Rfft op does.
+  bool use_dsp;
+  int8_t* rfft_state;
+  // Spectral subtraction state, carried from one invocation to the next.
+  // Only allocated with PCAN.
+  uint32_t* noise_estimate;
+
+  // int16 time domain frame, reused for the uint64 filter bank accumulators
+  int time_scratch_index;
+  // Complex<int16_t> spectrum, converted to uint32 energy in place
+  int spectrum_scratch_index;
+};
+
+void* AudioFrontendInit(TfLiteContext* context, const char* buffer,
+                        size_t length) {
+  TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
+
+  auto* params = static_cast<TFLMSignalAudioFrontendParams*>(
+      context->AllocatePersistentBuffer(
+          context, sizeof(TFLMSignalAudioFrontendParams)));
+  if (params == nullptr) {
+    return nullptr;
+  }
+
+  const uint8_t* buffer_t = reinterpret_cast<const uint8_t*>(buffer);
+  const flexbuffers::Map& m = flexbuffers::GetRoot(buffer_t, length).AsMap();
+  params->shift = m["shift"].AsInt32();
+  params->fft_length = m["fft_length"].AsInt32();
+  params->start_index = m["start_index"].AsInt32();
+  params->end_index = m["end_index"].AsInt32();
+  params->filter_bank_config.num_channels = m["num_channels"].AsInt32();
+  params->input_correction_bits = m["input_correction_bits"].AsInt32();
+  params->output_scale = m["output_scale"].AsInt32();
+  params->snr_shift = m["snr_shift"].AsInt32();
+
+  tflm_signal::SpectralSubtractionConfig* ss =
+      &params->spectral_subtraction_config;
+  ss->num_channels = params->filter_bank_config.num_channels;
+  ss->alternate_one_minus_smoothing =
+      m["alternate_one_minus_smoothing"].AsInt32();
+  ss->alternate_smoothing = m["alternate_smoothing"].AsInt32();
+  ss->clamping = m["clamping"].AsBool();
+  ss->min_signal_remaining = m["min_signal_remaining"].AsInt32();
+  ss->one_minus_smoothing = m["one_minus_smoothing"].AsInt32();
+  ss->smoothing = m["smoothing"].AsInt32();
+  ss->smoothing_bits = m["smoothing_bits"].AsInt32();
+  ss->spectral_subtraction_bits = m["spectral_subtraction_bits"].AsInt32();
+  params->noise_estimate = nullptr;
+  params->use_dsp = tflm_signal::UptDspFftSupported(params->fft_length);
+
+  size_t state_size =
+      ::tflm_signal::RfftInt16GetNeededMemory(params->fft_length);
+  params->rfft_state = static_cast<int8_t*>(
+      context->AllocatePersistentBuffer(context, state_size * sizeof(int8_t)));
+  if (params->rfft_state == nullptr) {
+    return nullptr;
+  }
+  ::tflm_signal::RfftInt16Init(params->fft_length, params->rfft_state,
+                               state_size);
+  return params;
+}
+
+void AudioFrontendResetState(TFLMSignalAudioFrontendParams* params) {
+  if (params->noise_estimate != nullptr) {
+    memset(params->noise_estimate, 0,
+           sizeof(uint32_t) * params->filter_bank_config.num_channels);
+  }
+}
+
+TfLiteStatus EnsureInput(TfLiteContext* context, TfLiteNode* node, int index,
+                         int num_dimensions, TfLiteType type) {
+  MicroContext* micro_context = GetMicroContext(context);
+  TfLiteTensor* input = micro_context->AllocateTempInputTensor(node, index);
+  TF_LITE_ENSURE(context, input != nullptr);
+  TF_LITE_ENSURE_EQ(context, NumDimensions(input), num_dimensions);
+  TF_LITE_ENSURE_TYPES_EQ(context, input->type, type);
+  micro_context->DeallocateTempTfLiteTensor(input);
+  return kTfLiteOk;
+}
+
+TfLiteStatus AudioFrontendPrepare(TfLiteContext* context, TfLiteNode* node) {
+  TF_LITE_ENSURE(context, NumInputs(node) == kNumInputsWithoutPcan ||
+                              NumInputs(node) == kNumInputsWithPcan);
+  TF_LITE_ENSURE_EQ(context, NumOutputs(node), 1);
+
+  auto* params =
+      reinterpret_cast<TFLMSignalAudioFrontendParams*>(node->user_data);
+  TF_LITE_ENSURE(context, params != nullptr);
+  const int num_channels = params->filter_bank_config.num_channels;
+  const int spectrum_length = params->fft_length / 2 + 1;
+
+  MicroContext* micro_context = GetMicroContext(context);
+  TfLiteTensor* input =
+      micro_context->AllocateTempInputTensor(node, kInputTensor);
+  TF_LITE_ENSURE(context, input != nullptr);
+  TfLiteTensor* window_weights =
+      micro_context->AllocateTempInputTensor(node, kWindowWeightsTensor);
+  TF_LITE_ENSURE(context, window_weights != nullptr);
+  TfLiteTensor* output =
+      micro_context->AllocateTempOutputTensor(node, kOutputTensor);
+  TF_LITE_ENSURE(context, output != nullptr);
+
+  TF_LITE_ENSURE(context, NumDimensions(input) >= 1);
+  TF_LITE_ENSURE_EQ(context, NumDimensions(window_weights), 1);
+  TF_LITE_ENSURE_EQ(context, NumDimensions(input), NumDimensions(output));
+  TF_LITE_ENSURE_TYPES_EQ(context, input->type, kTfLiteInt16);
+  TF_LITE_ENSURE_TYPES_EQ(context, window_weights->type, kTfLiteInt16);
+  TF_LITE_ENSURE_TYPES_EQ(context, output->type, kTfLiteInt16);
+
+  RuntimeShape input_shape = GetTensorShape(input);
+  RuntimeShape output_shape = GetTensorShape(output);
+  params->frame_size = input_shape.Dims(input_shape.DimensionsCount() - 1);
+  params->num_frames = input_shape.FlatSize() / params->frame_size;
+  TF_LITE_ENSURE_EQ(context, window_weights->dims->data[0],
+                    params->frame_size);
+  TF_LITE_ENSURE(context, params->fft_length >= params->frame_size);
+  TF_LITE_ENSURE(context, params->start_index >= 0 &&
+                              params->start_index <= params->end_index &&
+                              params->end_index <= spectrum_length);
+  TF_LITE_ENSURE_EQ(context,
+                    output_shape.Dims(output_shape.DimensionsCount() - 1),
+                    num_channels);
+  TF_LITE_ENSURE_EQ(context, output_shape.FlatSize(),
+                    params->num_frames * num_channels);
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(window_weights);
+  micro_context->DeallocateTempTfLiteTensor(output);
+
+  TF_LITE_ENSURE_OK(context, EnsureInput(context, node, kWeightTensor, 1,
+                                         kTfLiteInt16));
+  TF_LITE_ENSURE_OK(context, EnsureInput(context, node, kUnweightTensor, 1,
+                                         kTfLiteInt16));
+  TF_LITE_ENSURE_OK(context, EnsureInput(context, node, kChFreqStartsTensor, 1,
+                                         kTfLiteInt16));
+  TF_LITE_ENSURE_OK(context, EnsureInput(context, node, kChWeightStartsTensor,
+                                         1, kTfLiteInt16));
+  TF_LITE_ENSURE_OK(context, EnsureInput(context, node, kChannelWidthsTensor,
+                                         1, kTfLiteInt16));
+  TF_LITE_ENSURE_OK(context, EnsureInput(context, node, kScaleBitsTensor, 0,
+                                         kTfLiteInt32));
+  params->use_pcan = NumInputs(node) == kNumInputsWithPcan;
+  if (params->use_pcan) {
+    TF_LITE_ENSURE_OK(context, EnsureInput(context, node, kGainLutTensor, 1,
+                                           kTfLiteInt16));
+    if (params->noise_estimate == nullptr) {
+      params->noise_estimate =
+          static_cast<uint32_t*>(context->AllocatePersistentBuffer(
+              context, num_channels * sizeof(uint32_t)));
+      TF_LITE_ENSURE(context, params->noise_estimate != nullptr);
+    }
+    AudioFrontendResetState(params);
+  }
+
+  // The time domain frame is dead once the spectrum is computed, so the same
+  // buffer holds the filter bank accumulators afterwards.
+  const size_t time_scratch_size =
+      std::max(params->fft_length * sizeof(int16_t),
+               (num_channels + 1) * sizeof(uint64_t));
+  TF_LITE_ENSURE_OK(context, context->RequestScratchBufferInArena(
+                                 context, time_scratch_size,
+                                 &params->time_scratch_index));
+  TF_LITE_ENSURE_OK(context,
+                    context->RequestScratchBufferInArena(
+                        context, spectrum_length * sizeof(Complex<int16_t>),
+                        &params->spectrum_scratch_index));
+  return kTfLiteOk;
+}
+
+// Windows the frame and zero pads it to FFT length.
+void StageFrame(const TFLMSignalAudioFrontendParams* params,
+                const int16_t* input, const int16_t* window, int16_t* frame) {
+  ::tflm_signal::ApplyWindow(input, window, params->frame_size, params->shift,
+                             frame);
+  memset(&frame[params->frame_size], 0,
+         sizeof(int16_t) * (params->fft_length - params->frame_size));
+}
+
+TfLiteStatus AudioFrontendEval(TfLiteContext* context, TfLiteNode* node) {
+  auto* params =
+      reinterpret_cast<TFLMSignalAudioFrontendParams*>(node->user_data);
+  tflm_signal::FilterbankConfig* config = &params->filter_bank_config;
+
+  const int16_t* input_data = tflite::micro::GetTensorData<int16_t>(
+      tflite::micro::GetEvalInput(context, node, kInputTensor));
+  const int16_t* window_data = tflite::micro::GetTensorData<int16_t>(
+      tflite::micro::GetEvalInput(context, node, kWindowWeightsTensor));
+  config->weights = tflite::micro::GetTensorData<int16_t>(
+      tflite::micro::GetEvalInput(context, node, kWeightTensor));
+  config->unweights = tflite::micro::GetTensorData<int16_t>(
+      tflite::micro::GetEvalInput(context, node, kUnweightTensor));
+  config->channel_frequency_starts = tflite::micro::GetTensorData<int16_t>(
+      tflite::micro::GetEvalInput(context, node, kChFreqStartsTensor));
+  config->channel_weight_starts = tflite::micro::GetTensorData<int16_t>(
+      tflite::micro::GetEvalInput(context, node, kChWeightStartsTensor));
+  config->channel_widths = tflite::micro::GetTensorData<int16_t>(
+      tflite::micro::GetEvalInput(context, node, kChannelWidthsTensor));
+  const int32_t scale_bits = *tflite::micro::GetTensorData<int32_t>(
+      tflite::micro::GetEvalInput(context, node, kScaleBitsTensor));
+  const int16_t* gain_lut = nullptr;
+  if (params->use_pcan) {
+    gain_lut = tflite::micro::GetTensorData<int16_t>(
+        tflite::micro::GetEvalInput(context, node, kGainLutTensor));
+  }
+  int16_t* output_data = tflite::micro::GetTensorData<int16_t>(
+      tflite::micro::GetEvalOutput(context, node, kOutputTensor));
+
+  void* time_scratch =
+      context->GetScratchBuffer(context, params->time_scratch_index);
+  int16_t* frame = static_cast<int16_t*>(time_scratch);
+  uint64_t* accumulators = static_cast<uint64_t*>(time_scratch);
+  // Channel 0 of the accumulators is scratch, see
+  // FilterbankAccumulateChannels(). The square root is written over the
+  // accumulators in place: output[i] never lies past the input[i] still to
+  // be read.
+  uint32_t* channels = reinterpret_cast<uint32_t*>(accumulators);
+  Complex<int16_t>* spectrum = static_cast<Complex<int16_t>*>(
+      context->GetScratchBuffer(context, params->spectrum_scratch_index));
+  // SpectrumToEnergy() reads and writes element i only, so the energy can
+  // replace the spectrum in place.
+  uint32_t* energy = reinterpret_cast<uint32_t*>(spectrum);
+  const int spectrum_length = params->fft_length / 2 + 1;
+  const int num_channels = config->num_channels;
+
+  for (int frame_idx = 0; frame_idx < params->num_frames; ++frame_idx) {
+    StageFrame(params, &input_data[frame_idx * params->frame_size],
+               window_data, frame);
+    if (!params->use_dsp ||
+        !tflm_signal::UptDspRfftApply(params->fft_length, frame, spectrum)) {
+      if (params->use_dsp) {
+        // The DSP may have used the frame as scratch before failing.
+        StageFrame(params, &input_data[frame_idx * params->frame_size],
+                   window_data, frame);
+      }
+      ::tflm_signal::RfftInt16Apply(params->rfft_state, frame, spectrum);
+    }
+
+    tflm_signal::SpectrumToEnergy(spectrum, params->start_index,
+                                  params->end_index, energy);
+    // Bins outside [start_index, end_index) still hold spectrum values.
+    memset(energy, 0, params->start_index * sizeof(uint32_t));
+    memset(&energy[params->end_index], 0,
+           (spectrum_length - params->end_index) * sizeof(uint32_t));
+
+    tflm_signal::FilterbankAccumulateChannels(config, energy, accumulators);
+    tflm_signal::FilterbankSqrt(accumulators + 1, num_channels, scale_bits,
+                                channels);
+    if (params->use_pcan) {
+      // Element i is read before it is written, so this runs in place.
+      tflm_signal::FilterbankSpectralSubtraction(
+          &params->spectral_subtraction_config, channels, channels,
+          params->noise_estimate);
+      tflm_signal::ApplyPcanAutoGainControlFixed(gain_lut, params->snr_shift,
+                                                 params->noise_estimate,
+                                                 channels, num_channels);
+    }
+    tflm_signal::FilterbankLog(channels, num_channels, params->output_scale,
+                               params->input_correction_bits,
+                               &output_data[frame_idx * num_channels]);
+  }
+  return kTfLiteOk;
+}
+
+void AudioFrontendReset(TfLiteContext* context, void* buffer) {
+  AudioFrontendResetState(
+      static_cast<TFLMSignalAudioFrontendParams*>(buffer));
+}
+
+}  // namespace
+
+namespace tflm_signal {
+
+TFLMRegistration* Register_AUDIO_FRONTEND() {
+  static TFLMRegistration r = tflite::micro::RegisterOp(
+      AudioFrontendInit, AudioFrontendPrepare, AudioFrontendEval,
+      /*Free*/ nullptr, AudioFrontendReset);
+  return &r;
+}
+
+}  // namespace tflm_signal
+
+}  // namespace tflite
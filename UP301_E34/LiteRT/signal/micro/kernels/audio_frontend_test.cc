@@ -0,0 +1,363 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Checks that the fused SignalAudioFrontend op gives the same output as the
+// unfused graph, with and without PCAN, over several invocations so that the
+// spectral subtraction state is carried across them, and after Reset.
+//
+// The reference chains the signal/src functions called by the standalone
+// ops, in the same order and with the same intermediate buffers: all
+// KernelRunners share one arena, so only one op can be alive at a time.
+//
+// Only built on request, since the firmware build globs every .cc file.
+// From the LiteRT directory:
+//
+//   g++ -O2 -std=c++17 -DSIGNAL_HOST_TEST -DTF_LITE_STATIC_MEMORY -I.
+//       -Ithird_party/kissfft -Ithird_party/flatbuffers/include
+//       -Ithird_party/gemmlowp -Ithird_party/ruy
+//       signal/micro/kernels/audio_frontend_test.cc
+//       signal/micro/kernels/audio_frontend.cc $(find signal/src -name '*.cc')
+//       libtflm_host.a -o audio_frontend_test
+//
+// where libtflm_host.a holds the tensorflow/lite sources built for the host
+// with -fno-exceptions, with a DebugLog() that prints to stderr in place of
+// the UART one of tensorflow/lite/micro/debug_log.cc.
+
+#if defined(SIGNAL_HOST_TEST)
+
+#include <stdint.h>
+#include <string.h>
+
+#include <cmath>
+#include <vector>
+
+#include "signal/src/complex.h"
+#include "signal/src/energy.h"
+#include "signal/src/filter_bank.h"
+#include "signal/src/filter_bank_log.h"
+#include "signal/src/filter_bank_spectral_subtraction.h"
+#include "signal/src/filter_bank_square_root.h"
+#include "signal/src/pcan_argc_fixed.h"
+#include "signal/src/rfft.h"
+#include "signal/src/window.h"
+#include "tensorflow/lite/micro/flatbuffer_utils.h"
+#include "tensorflow/lite/micro/kernels/kernel_runner.h"
+#include "tensorflow/lite/micro/kernels/micro_ops.h"
+#include "tensorflow/lite/micro/micro_testing.h"
+#include "tensorflow/lite/micro/test_helpers.h"
+
+namespace tflite {
+namespace {
+
+constexpr int kWindowShift = 12;
+constexpr int kScaleBits = 7;
+constexpr int kInputCorrectionBits = 3;
+constexpr int kSnrShift = 6;
+constexpr int kGainLutSize = 125;
+constexpr int kInvocations = 6;
+
+struct AudioFrontendTestConfig {
+  int fft_length;
+  int frame_size;
+  int num_frames;
+  int num_channels;
+  int channel_width;
+  int start_index;
+  bool use_pcan;
+};
+
+// Op inputs and parameters, with a triangular filter bank of equal width
+// channels starting at start_index.
+struct AudioFrontendTestData {
+  explicit AudioFrontendTestData(const AudioFrontendTestConfig& c)
+      : config(c),
+        end_index(c.start_index + (c.num_channels + 1) * c.channel_width),
+        window(c.frame_size),
+        weights((c.num_channels + 1) * c.channel_width),
+        unweights(weights.size()),
+        channel_frequency_starts(c.num_channels + 1),
+        channel_weight_starts(c.num_channels + 1),
+        channel_widths(c.num_channels + 1, c.channel_width),
+        gain_lut(kGainLutSize) {
+    const double pi = std::acos(-1.0);
+    for (int i = 0; i < c.frame_size; ++i) {
+      window[i] = static_cast<int16_t>(std::lround(
+          (1 << kWindowShift) * (0.5 - 0.5 * std::cos(2 * pi * i /
+                                                      c.frame_size))));
+    }
+    for (int i = 0; i <= c.num_channels; ++i) {
+      channel_frequency_starts[i] = c.start_index + i * c.channel_width;
+      channel_weight_starts[i] = i * c.channel_width;
+      for (int j = 0; j < c.channel_width; ++j) {
+        const int16_t w =
+            (4096 * (c.channel_width - j)) / (c.channel_width + 1);
+        weights[i * c.channel_width + j] = w;
+        unweights[i * c.channel_width + j] = 4096 - w;
+      }
+    }
+    for (int i = 0; i < kGainLutSize; ++i) {
+      gain_lut[i] = static_cast<int16_t>(1500 + (i * 733) % 3000);
+    }
+    ss_config.num_channels = c.num_channels;
+    ss_config.smoothing = 655;
+    ss_config.one_minus_smoothing = 15729;
+    ss_config.alternate_smoothing = 1310;
+    ss_config.alternate_one_minus_smoothing = 15074;
+    ss_config.min_signal_remaining = 819;
+    ss_config.smoothing_bits = 10;
+    ss_config.spectral_subtraction_bits = 14;
+    ss_config.clamping = false;
+  }
+
+  std::vector<uint8_t> Flexbuffer() const {
+    flexbuffers::Builder fbb;
+    fbb.Map([&]() {
+      fbb.Int("shift", kWindowShift);
+      fbb.Int("fft_length", config.fft_length);
+      fbb.Int("start_index", config.start_index);
+      fbb.Int("end_index", end_index);
+      fbb.Int("num_channels", config.num_channels);
+      fbb.Int("input_correction_bits", kInputCorrectionBits);
+      fbb.Int("output_scale", OutputScale());
+      fbb.Int("snr_shift", kSnrShift);
+      fbb.Int("alternate_one_minus_smoothing",
+              ss_config.alternate_one_minus_smoothing);
+      fbb.Int("alternate_smoothing", ss_config.alternate_smoothing);
+      fbb.Bool("clamping", ss_config.clamping);
+      fbb.Int("min_signal_remaining", ss_config.min_signal_remaining);
+      fbb.Int("one_minus_smoothing", ss_config.one_minus_smoothing);
+      fbb.Int("smoothing", ss_config.smoothing);
+      fbb.Int("smoothing_bits", ss_config.smoothing_bits);
+      fbb.Int("spectral_subtraction_bits",
+              ss_config.spectral_subtraction_bits);
+    });
+    fbb.Finish();
+    return fbb.GetBuffer();
+  }
+
+  // PCAN output has kPcanOutputBits fractional bits.
+  int OutputScale() const {
+    return config.use_pcan ? 1 << kPcanOutputBits : 1;
+  }
+
+  const AudioFrontendTestConfig config;
+  const int end_index;
+  std::vector<int16_t> window;
+  std::vector<int16_t> weights;
+  std::vector<int16_t> unweights;
+  std::vector<int16_t> channel_frequency_starts;
+  std::vector<int16_t> channel_weight_starts;
+  std::vector<int16_t> channel_widths;
+  std::vector<int16_t> gain_lut;
+  tflm_signal::SpectralSubtractionConfig ss_config;
+};
+
+// Window -> Rfft -> Energy -> FilterBank -> FilterBankSquareRoot
+//   [-> FilterBankSpectralSubtraction -> PCAN] -> FilterBankLog
+// one frame at a time, as the standalone ops compute it.
+class UnfusedAudioFrontend {
+ public:
+  explicit UnfusedAudioFrontend(const AudioFrontendTestData& data)
+      : data_(data),
+        rfft_state_(::tflm_signal::RfftInt16GetNeededMemory(
+            data.config.fft_length)),
+        noise_estimate_(data.config.num_channels) {
+    ::tflm_signal::RfftInt16Init(data.config.fft_length, rfft_state_.data(),
+                               rfft_state_.size());
+    filter_bank_config_.num_channels = data.config.num_channels;
+    filter_bank_config_.weights = data.weights.data();
+    filter_bank_config_.unweights = data.unweights.data();
+    filter_bank_config_.channel_frequency_starts =
+        data.channel_frequency_starts.data();
+    filter_bank_config_.channel_weight_starts =
+        data.channel_weight_starts.data();
+    filter_bank_config_.channel_widths = data.channel_widths.data();
+  }
+
+  void Reset() {
+    memset(noise_estimate_.data(), 0,
+           noise_estimate_.size() * sizeof(uint32_t));
+  }
+
+  void Apply(const int16_t* input, int16_t* output) {
+    const AudioFrontendTestConfig& c = data_.config;
+    std::vector<int16_t> windowed(c.fft_length);
+    std::vector<Complex<int16_t>> spectrum(c.fft_length / 2 + 1);
+    std::vector<uint32_t> energy(spectrum.size(), 0);
+    std::vector<uint64_t> work_area(c.num_channels + 1);
+    std::vector<uint32_t> channels(c.num_channels);
+    std::vector<uint32_t> subtracted(c.num_channels);
+
+    for (int frame = 0; frame < c.num_frames; ++frame) {
+      ::tflm_signal::ApplyWindow(&input[frame * c.frame_size],
+                               data_.window.data(), c.frame_size,
+                               kWindowShift, windowed.data());
+      // Zero pad to FFT length, as the Rfft op does for every frame
+      memset(&windowed[c.frame_size], 0,
+             (c.fft_length - c.frame_size) * sizeof(int16_t));
+      ::tflm_signal::RfftInt16Apply(rfft_state_.data(), windowed.data(),
+                                  spectrum.data());
+      tflm_signal::SpectrumToEnergy(spectrum.data(), c.start_index,
+                                    data_.end_index, energy.data());
+      tflm_signal::FilterbankAccumulateChannels(
+          &filter_bank_config_, energy.data(), work_area.data());
+      tflm_signal::FilterbankSqrt(work_area.data() + 1, c.num_channels,
+                                  kScaleBits, channels.data());
+      if (c.use_pcan) {
+        tflm_signal::FilterbankSpectralSubtraction(
+            &data_.ss_config, channels.data(), subtracted.data(),
+            noise_estimate_.data());
+        tflm_signal::ApplyPcanAutoGainControlFixed(
+            data_.gain_lut.data(), kSnrShift, noise_estimate_.data(),
+            subtracted.data(), c.num_channels);
+        channels = subtracted;
+      }
+      tflm_signal::FilterbankLog(channels.data(), c.num_channels,
+                                 data_.OutputScale(), kInputCorrectionBits,
+                                 &output[frame * c.num_channels]);
+    }
+  }
+
+ private:
+  const AudioFrontendTestData& data_;
+  std::vector<int8_t> rfft_state_;
+  std::vector<uint32_t> noise_estimate_;
+  tflm_signal::FilterbankConfig filter_bank_config_;
+};
+
+// Tone plus noise, from full scale down to a few LSB, so that the noise
+// estimate has something to track. The same for a given invocation.
+void MakeInput(const AudioFrontendTestConfig& c, int invocation,
+               std::vector<int16_t>* input) {
+  uint32_t seed = 12345 + invocation;
+  for (int frame = 0; frame < c.num_frames; ++frame) {
+    const double amp =
+        std::pow(10.0, -0.8 * ((invocation * c.num_frames + frame) % 5));
+    for (int i = 0; i < c.frame_size; ++i) {
+      seed = seed * 1103515245u + 12345u;
+      const double noise = static_cast<double>(seed >> 8) / (1 << 23) - 1.0;
+      const double v =
+          amp * (0.6 * std::sin(0.11 * (frame + 1) * i) + 0.3 * noise);
+      (*input)[frame * c.frame_size + i] =
+          static_cast<int16_t>(std::lround(v * 32767.0));
+    }
+  }
+}
+
+void TestAudioFrontend(const AudioFrontendTestConfig& c) {
+  AudioFrontendTestData data(c);
+  UnfusedAudioFrontend unfused(data);
+  const std::vector<uint8_t> flexbuffer = data.Flexbuffer();
+  std::vector<int16_t> input(c.num_frames * c.frame_size);
+  std::vector<int16_t> output(c.num_frames * c.num_channels);
+  std::vector<int16_t> expected(output.size());
+  std::vector<int16_t> first_output(output.size());
+  int32_t scale_bits = kScaleBits;
+
+  int input_shape[] = {2, c.num_frames, c.frame_size};
+  int frame_shape[] = {1, c.frame_size};
+  int weights_shape[] = {1, static_cast<int>(data.weights.size())};
+  int channels_shape[] = {1, c.num_channels + 1};
+  int scalar_shape[] = {0};
+  int gain_lut_shape[] = {1, kGainLutSize};
+  int output_shape[] = {2, c.num_frames, c.num_channels};
+
+  TfLiteTensor tensors[] = {
+      testing::CreateTensor(input.data(),
+                            testing::IntArrayFromInts(input_shape)),
+      testing::CreateTensor(data.window.data(),
+                            testing::IntArrayFromInts(frame_shape)),
+      testing::CreateTensor(data.weights.data(),
+                            testing::IntArrayFromInts(weights_shape)),
+      testing::CreateTensor(data.unweights.data(),
+                            testing::IntArrayFromInts(weights_shape)),
+      testing::CreateTensor(data.channel_frequency_starts.data(),
+                            testing::IntArrayFromInts(channels_shape)),
+      testing::CreateTensor(data.channel_weight_starts.data(),
+                            testing::IntArrayFromInts(channels_shape)),
+      testing::CreateTensor(data.channel_widths.data(),
+                            testing::IntArrayFromInts(channels_shape)),
+      testing::CreateTensor(&scale_bits,
+                            testing::IntArrayFromInts(scalar_shape)),
+      testing::CreateTensor(data.gain_lut.data(),
+                            testing::IntArrayFromInts(gain_lut_shape)),
+      testing::CreateTensor(output.data(),
+                            testing::IntArrayFromInts(output_shape)),
+  };
+  constexpr int kTensorsSize = sizeof(tensors) / sizeof(tensors[0]);
+  int inputs_without_pcan[] = {8, 0, 1, 2, 3, 4, 5, 6, 7};
+  int inputs_with_pcan[] = {9, 0, 1, 2, 3, 4, 5, 6, 7, 8};
+  int outputs[] = {1, kTensorsSize - 1};
+
+  micro::KernelRunner runner(
+      *tflm_signal::Register_AUDIO_FRONTEND(), tensors, kTensorsSize,
+      testing::IntArrayFromInts(c.use_pcan ? inputs_with_pcan
+                                           : inputs_without_pcan),
+      testing::IntArrayFromInts(outputs), /*builtin_data=*/nullptr);
+  TF_LITE_MICRO_EXPECT_EQ(
+      runner.InitAndPrepare(reinterpret_cast<const char*>(flexbuffer.data()),
+                            flexbuffer.size()),
+      kTfLiteOk);
+
+  // Twice, the second time after Reset, which must start over from the
+  // same output.
+  for (int pass = 0; pass < 2; ++pass) {
+    for (int invocation = 0; invocation < kInvocations; ++invocation) {
+      MakeInput(c, invocation, &input);
+      unfused.Apply(input.data(), expected.data());
+      TF_LITE_MICRO_EXPECT_EQ(runner.Invoke(), kTfLiteOk);
+      TF_LITE_MICRO_EXPECT(output == expected);
+      if (invocation == 0) {
+        if (pass == 0) {
+          first_output = output;
+        } else {
+          TF_LITE_MICRO_EXPECT(output == first_output);
+        }
+      }
+    }
+    TF_LITE_MICRO_EXPECT_EQ(runner.Reset(), kTfLiteOk);
+    unfused.Reset();
+  }
+}
+
+}  // namespace
+}  // namespace tflite
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(AudioFrontendMatchesUnfusedGraph) {
+  tflite::TestAudioFrontend({/*fft_length=*/256, /*frame_size=*/200,
+                             /*num_frames=*/3, /*num_channels=*/16,
+                             /*channel_width=*/6, /*start_index=*/4,
+                             /*use_pcan=*/false});
+}
+
+TF_LITE_MICRO_TEST(AudioFrontendWithPcanMatchesUnfusedGraph) {
+  tflite::TestAudioFrontend({/*fft_length=*/256, /*frame_size=*/200,
+                             /*num_frames=*/3, /*num_channels=*/16,
+                             /*channel_width=*/6, /*start_index=*/4,
+                             /*use_pcan=*/true});
+}
+
+TF_LITE_MICRO_TEST(AudioFrontendWithPcanMatchesUnfusedGraph512) {
+  tflite::TestAudioFrontend({/*fft_length=*/512, /*frame_size=*/400,
+                             /*num_frames=*/2, /*num_channels=*/40,
+                             /*channel_width=*/5, /*start_index=*/3,
+                             /*use_pcan=*/true});
+}
+
+TF_LITE_MICRO_TESTS_END
+
+#endif  // defined(SIGNAL_HOST_TEST)
@@ -44,6 +44,9 @@ constexpr int kNumChannelsIndex = 0;  // 'num_channels'
 struct TFLMSignalFilterBankParams {
   tflm_signal::FilterbankConfig config;
   uint64_t* work_area;
+  // Set in Prepare when the filter tensors are constant and could be packed.
+  bool use_packed;
+  tflm_signal::FilterbankPackedConfig packed;
 };
 
 void* FilterBankInit(TfLiteContext* context, const char* buffer,
@@ -67,10 +70,67 @@ void* FilterBankInit(TfLiteContext* context, const char* buffer,
   if (params->work_area == nullptr) {
     return nullptr;
   }
+  params->use_packed = false;
 
   return params;
 }
 
+// Builds the packed filter bank layout if the filter tensors are constant.
+// The weights only become readable in Prepare, so this is the earliest point
+// the fast path can be chosen.
+TfLiteStatus PackFilterBank(TfLiteContext* context, TfLiteNode* node,
+                            TFLMSignalFilterBankParams* params) {
+  MicroContext* micro_context = GetMicroContext(context);
+  TfLiteTensor* weights =
+      micro_context->AllocateTempInputTensor(node, kWeightTensor);
+  TfLiteTensor* unweights =
+      micro_context->AllocateTempInputTensor(node, kUnweightTensor);
+  TfLiteTensor* freq_starts =
+      micro_context->AllocateTempInputTensor(node, kChFreqStartsTensor);
+  TfLiteTensor* weight_starts =
+      micro_context->AllocateTempInputTensor(node, kChWeightStartsTensor);
+  TfLiteTensor* widths =
+      micro_context->AllocateTempInputTensor(node, kChannelWidthsTensor);
+
+  const int num_channels = params->config.num_channels;
+  params->use_packed = false;
+  if (IsConstantTensor(weights) && IsConstantTensor(unweights) &&
+      IsConstantTensor(freq_starts) && IsConstantTensor(weight_starts) &&
+      IsConstantTensor(widths) &&
+      NumElements(unweights) == NumElements(weights) &&
+      NumElements(freq_starts) >= num_channels + 1 &&
+      NumElements(weight_starts) >= num_channels + 1 &&
+      NumElements(widths) >= num_channels + 1) {
+    tflm_signal::FilterbankConfig config = params->config;
+    config.weights = GetTensorData<int16_t>(weights);
+    config.unweights = GetTensorData<int16_t>(unweights);
+    config.channel_frequency_starts = GetTensorData<int16_t>(freq_starts);
+    config.channel_weight_starts = GetTensorData<int16_t>(weight_starts);
+    config.channel_widths = GetTensorData<int16_t>(widths);
+    const int32_t num_pairs = tflm_signal::FilterbankPackedPairCount(
+        &config, NumElements(weights));
+    if (num_pairs >= 0) {
+      auto* spans = static_cast<tflm_signal::FilterbankChannelSpan*>(
+          context->AllocatePersistentBuffer(
+              context,
+              (num_channels + 1) * sizeof(tflm_signal::FilterbankChannelSpan)));
+      auto* pairs = static_cast<tflm_signal::FilterbankWeightPair*>(
+          context->AllocatePersistentBuffer(
+              context, num_pairs * sizeof(tflm_signal::FilterbankWeightPair)));
+      TF_LITE_ENSURE(context, spans != nullptr && pairs != nullptr);
+      tflm_signal::FilterbankPack(&config, spans, pairs, &params->packed);
+      params->use_packed = true;
+    }
+  }
+
+  micro_context->DeallocateTempTfLiteTensor(weights);
+  micro_context->DeallocateTempTfLiteTensor(unweights);
+  micro_context->DeallocateTempTfLiteTensor(freq_starts);
+  micro_context->DeallocateTempTfLiteTensor(weight_starts);
+  micro_context->DeallocateTempTfLiteTensor(widths);
+  return kTfLiteOk;
+}
+
 TfLiteStatus FilterBankPrepare(TfLiteContext* context, TfLiteNode* node) {
   TF_LITE_ENSURE_EQ(context, NumInputs(node), 6);
   TF_LITE_ENSURE_EQ(context, NumOutputs(node), 1);
@@ -120,7 +180,8 @@ TfLiteStatus FilterBankPrepare(TfLiteContext* context, TfLiteNode* node) {
   TF_LITE_ENSURE_TYPES_EQ(context, output->type, kTfLiteUInt64);
   micro_context->DeallocateTempTfLiteTensor(output);
 
-  return kTfLiteOk;
+  auto* params = reinterpret_cast<TFLMSignalFilterBankParams*>(node->user_data);
+  return PackFilterBank(context, node, params);
 }
 
 TfLiteStatus FilterBankEval(TfLiteContext* context, TfLiteNode* node) {
@@ -128,31 +189,38 @@ TfLiteStatus FilterBankEval(TfLiteContext* context, TfLiteNode* node) {
 
   const TfLiteEvalTensor* input0 =
       tflite::micro::GetEvalInput(context, node, kInputTensor);
-  const TfLiteEvalTensor* input1 =
-      tflite::micro::GetEvalInput(context, node, kWeightTensor);
-  const TfLiteEvalTensor* input2 =
-      tflite::micro::GetEvalInput(context, node, kUnweightTensor);
-  const TfLiteEvalTensor* input3 =
-      tflite::micro::GetEvalInput(context, node, kChFreqStartsTensor);
-  const TfLiteEvalTensor* input4 =
-      tflite::micro::GetEvalInput(context, node, kChWeightStartsTensor);
-  const TfLiteEvalTensor* input5 =
-      tflite::micro::GetEvalInput(context, node, kChannelWidthsTensor);
   TfLiteEvalTensor* output =
       tflite::micro::GetEvalOutput(context, node, kOutputTensor);
-
-  params->config.weights = tflite::micro::GetTensorData<int16_t>(input1);
-  params->config.unweights = tflite::micro::GetTensorData<int16_t>(input2);
-  params->config.channel_frequency_starts =
-      tflite::micro::GetTensorData<int16_t>(input3);
-  params->config.channel_weight_starts =
-      tflite::micro::GetTensorData<int16_t>(input4);
-  params->config.channel_widths = tflite::micro::GetTensorData<int16_t>(input5);
-
   const uint32_t* input_data = tflite::micro::GetTensorData<uint32_t>(input0);
   uint64_t* output_data = tflite::micro::GetTensorData<uint64_t>(output);
-  tflm_signal::FilterbankAccumulateChannels(&params->config, input_data,
-                                            params->work_area);
+
+  if (params->use_packed) {
+    tflm_signal::FilterbankAccumulateChannelsPacked(&params->packed, input_data,
+                                                    params->work_area);
+  } else {
+    const TfLiteEvalTensor* input1 =
+        tflite::micro::GetEvalInput(context, node, kWeightTensor);
+    const TfLiteEvalTensor* input2 =
+        tflite::micro::GetEvalInput(context, node, kUnweightTensor);
+    const TfLiteEvalTensor* input3 =
+        tflite::micro::GetEvalInput(context, node, kChFreqStartsTensor);
+    const TfLiteEvalTensor* input4 =
+        tflite::micro::GetEvalInput(context, node, kChWeightStartsTensor);
+    const TfLiteEvalTensor* input5 =
+        tflite::micro::GetEvalInput(context, node, kChannelWidthsTensor);
+
+    params->config.weights = tflite::micro::GetTensorData<int16_t>(input1);
+    params->config.unweights = tflite::micro::GetTensorData<int16_t>(input2);
+    params->config.channel_frequency_starts =
+        tflite::micro::GetTensorData<int16_t>(input3);
+    params->config.channel_weight_starts =
+        tflite::micro::GetTensorData<int16_t>(input4);
+    params->config.channel_widths =
+        tflite::micro::GetTensorData<int16_t>(input5);
+
+    tflm_signal::FilterbankAccumulateChannels(&params->config, input_data,
+                                              params->work_area);
+  }
 
   size_t output_size;
   TfLiteTypeSizeOf(output->type, &output_size);
@@ -18,7 +18,11 @@ limitations under the License.
 #include <math.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
+#include <type_traits>
+
+#include "signal/src/upt_dsp.h"
 #include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/micro/flatbuffer_utils.h"
@@ -45,6 +49,10 @@ struct TfLiteAudioFrontendIrfftParams {
   int32_t input_length;
   int32_t output_length;
   TfLiteType fft_type;
+  // Run the transform on the UPT DSP block instead of kissfft. The DSP uses
+  // its input as work memory, so each frame is first copied to scratch.
+  bool use_dsp;
+  int scratch_buffer_index;
   int8_t* state;
 };
 
@@ -65,6 +73,8 @@ void* IrfftInit(TfLiteContext* context, const char* buffer, size_t length) {
                                 length);
   params->fft_length = fbw.ElementAsInt32(kFftLengthIndex);
   params->fft_type = typeToTfLiteType<T>();
+  params->use_dsp = std::is_integral<T>::value &&
+                    tflm_signal::UptDspFftSupported(params->fft_length);
 
   size_t state_size = (*get_needed_memory_func)(params->fft_length);
   params->state = reinterpret_cast<int8_t*>(
@@ -78,7 +88,7 @@ void* IrfftInit(TfLiteContext* context, const char* buffer, size_t length) {
   return params;
 }
 
-template <TfLiteType TfLiteTypeEnum>
+template <typename T, TfLiteType TfLiteTypeEnum>
 TfLiteStatus IrfftPrepare(TfLiteContext* context, TfLiteNode* node) {
   TF_LITE_ENSURE_EQ(context, NumInputs(node), 1);
   TF_LITE_ENSURE_EQ(context, NumOutputs(node), 1);
@@ -107,6 +117,13 @@ TfLiteStatus IrfftPrepare(TfLiteContext* context, TfLiteNode* node) {
   params->input_size = input_shape.FlatSize() / 2;
   params->output_length = output_shape.Dims(output_shape.DimensionsCount() - 1);
 
+  if (params->use_dsp) {
+    TF_LITE_ENSURE_OK(
+        context, context->RequestScratchBufferInArena(
+                     context, params->input_length * sizeof(Complex<T>),
+                     &params->scratch_buffer_index));
+  }
+
   micro_context->DeallocateTempTfLiteTensor(input);
   micro_context->DeallocateTempTfLiteTensor(output);
   return kTfLiteOk;
@@ -125,8 +142,20 @@ TfLiteStatus IrfftEval(TfLiteContext* context, TfLiteNode* node) {
   const Complex<T>* input_data =
       tflite::micro::GetTensorData<Complex<T>>(input);
   T* output_data = tflite::micro::GetTensorData<T>(output);
+  Complex<T>* dsp_input =
+      params->use_dsp ? static_cast<Complex<T>*>(context->GetScratchBuffer(
+                            context, params->scratch_buffer_index))
+                      : nullptr;
   for (int input_idx = 0, output_idx = 0; input_idx < params->input_size;
        input_idx += params->input_length, output_idx += params->output_length) {
+    if (dsp_input != nullptr) {
+      memcpy(dsp_input, &input_data[input_idx],
+             params->input_length * sizeof(Complex<T>));
+      if (tflm_signal::UptDspIrfftApply(params->fft_length, dsp_input,
+                                        &output_data[output_idx])) {
+        continue;
+      }
+    }
     (*apply_func)(params->state, &input_data[input_idx],
                   &output_data[output_idx]);
   }
@@ -162,13 +191,13 @@ TfLiteStatus IrfftPrepareAll(TfLiteContext* context, TfLiteNode* node) {
 
   switch (params->fft_type) {
     case kTfLiteInt16: {
-      return IrfftPrepare<kTfLiteInt16>(context, node);
+      return IrfftPrepare<int16_t, kTfLiteInt16>(context, node);
     }
     case kTfLiteInt32: {
-      return IrfftPrepare<kTfLiteInt32>(context, node);
+      return IrfftPrepare<int32_t, kTfLiteInt32>(context, node);
     }
     case kTfLiteFloat32: {
-      return IrfftPrepare<kTfLiteFloat32>(context, node);
+      return IrfftPrepare<float, kTfLiteFloat32>(context, node);
     }
     default:
       return kTfLiteError;
@@ -208,21 +237,24 @@ TFLMRegistration* Register_IRFFT() {
 TFLMRegistration* Register_IRFFT_FLOAT() {
   static TFLMRegistration r = tflite::micro::RegisterOp(
       IrfftInit<float, IrfftFloatGetNeededMemory, IrfftFloatInit>,
-      IrfftPrepare<kTfLiteFloat32>, IrfftEval<float, IrfftFloatApply>);
+      IrfftPrepare<float, kTfLiteFloat32>,
+      IrfftEval<float, IrfftFloatApply>);
   return &r;
 }
 
 TFLMRegistration* Register_IRFFT_INT16() {
   static TFLMRegistration r = tflite::micro::RegisterOp(
       IrfftInit<int16_t, IrfftInt16GetNeededMemory, IrfftInt16Init>,
-      IrfftPrepare<kTfLiteInt16>, IrfftEval<int16_t, IrfftInt16Apply>);
+      IrfftPrepare<int16_t, kTfLiteInt16>,
+      IrfftEval<int16_t, IrfftInt16Apply>);
   return &r;
 }
 
 TFLMRegistration* Register_IRFFT_INT32() {
   static TFLMRegistration r = tflite::micro::RegisterOp(
       IrfftInit<int32_t, IrfftInt32GetNeededMemory, IrfftInt32Init>,
-      IrfftPrepare<kTfLiteInt32>, IrfftEval<int32_t, IrfftInt32Apply>);
+      IrfftPrepare<int32_t, kTfLiteInt32>,
+      IrfftEval<int32_t, IrfftInt32Apply>);
   return &r;
 }
 
@@ -19,7 +19,10 @@ limitations under the License.
 #include <stddef.h>
 #include <stdint.h>
 
+#include <type_traits>
+
 #include "signal/micro/kernels/rfft.h"
+#include "signal/src/upt_dsp.h"
 #include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/micro/flatbuffer_utils.h"
@@ -47,6 +50,8 @@ struct TfLiteAudioFrontendRfftParams {
   int32_t input_length;
   int32_t output_length;
   TfLiteType fft_type;
+  // Run the transform on the UPT DSP block instead of kissfft.
+  bool use_dsp;
   T* work_area;
   int scratch_buffer_index;
   int8_t* state;
@@ -65,6 +70,8 @@ void* RfftInit(TfLiteContext* context, const char* buffer, size_t length) {
   tflite::FlexbufferWrapper fbw(buffer_t, length);
   params->fft_length = fbw.ElementAsInt32(kFftLengthIndex);
   params->fft_type = typeToTfLiteType<T>();
+  params->use_dsp = std::is_integral<T>::value &&
+                    tflm_signal::UptDspFftSupported(params->fft_length);
 
   size_t state_size = (*get_needed_memory_func)(params->fft_length);
   params->state = static_cast<int8_t*>(
@@ -108,6 +115,15 @@ TfLiteStatus RfftPrepare(TfLiteContext* context, TfLiteNode* node) {
   return kTfLiteOk;
 }
 
+template <typename T>
+void StageFrame(const T* frame, const TfLiteAudioFrontendRfftParams<T>* params,
+                T* work_area) {
+  memcpy(work_area, frame, sizeof(T) * params->input_length);
+  // Zero pad input to FFT length
+  memset(&work_area[params->input_length], 0,
+         sizeof(T) * (params->fft_length - params->input_length));
+}
+
 template <typename T, void (*apply_func)(void*, const T* input, Complex<T>*)>
 TfLiteStatus RfftEval(TfLiteContext* context, TfLiteNode* node) {
   auto* params =
@@ -127,11 +143,16 @@ TfLiteStatus RfftEval(TfLiteContext* context, TfLiteNode* node) {
 
   for (int input_idx = 0, output_idx = 0; input_idx < params->input_size;
        input_idx += params->input_length, output_idx += params->output_length) {
-    memcpy(work_area, &input_data[input_idx], sizeof(T) * params->input_length);
-    // Zero pad input to FFT length
-    memset(&work_area[params->input_length], 0,
-           sizeof(T) * (params->fft_length - params->input_length));
-
+    StageFrame(&input_data[input_idx], params, work_area);
+
+    if (params->use_dsp) {
+      if (tflm_signal::UptDspRfftApply(params->fft_length, work_area,
+                                       &output_data[output_idx])) {
+        continue;
+      }
+      // The DSP may have used the work area as scratch before failing.
+      StageFrame(&input_data[input_idx], params, work_area);
+    }
     (*apply_func)(params->state, work_area, &output_data[output_idx]);
   }
   return kTfLiteOk;
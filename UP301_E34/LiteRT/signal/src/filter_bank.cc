@@ -15,6 +15,8 @@ limitations under the License.
 
 #include "signal/src/filter_bank.h"
 
+#include "signal/src/msb.h"
+
 namespace tflite {
 namespace tflm_signal {
 
@@ -49,5 +51,140 @@ void FilterbankAccumulateChannels(const FilterbankConfig* config,
   }
 }
 
+namespace {
+
+int32_t BitsNeeded(uint32_t x) {
+  return x == 0 ? 0 : static_cast<int32_t>(MostSignificantBit32(x));
+}
+
+// Every channel's weighted sum is known to fit in 32 bits, so both
+// accumulators stay 32 bits wide and only the carry into the next channel is
+// widened.
+void AccumulateChannels32(const FilterbankPackedConfig* config,
+                          const uint32_t* input, uint64_t* output) {
+  const FilterbankWeightPair* pair = config->pairs;
+  uint32_t carry = 0;
+  for (int i = 0; i < config->num_channels + 1; i++) {
+    const uint32_t* in = input + config->spans[i].frequency_start;
+    const int width = config->spans[i].width;
+    uint32_t weight_accumulator = 0;
+    uint32_t unweight_accumulator = 0;
+    for (int j = 0; j < width; ++j) {
+      const uint32_t x = in[j];
+      weight_accumulator += x * pair[j].weight;
+      unweight_accumulator += x * pair[j].unweight;
+    }
+    pair += width;
+    output[i] = static_cast<uint64_t>(carry) + weight_accumulator;
+    carry = unweight_accumulator;
+  }
+}
+
+void AccumulateChannels64(const FilterbankPackedConfig* config,
+                          const uint32_t* input, uint64_t* output) {
+  const FilterbankWeightPair* pair = config->pairs;
+  uint64_t weight_accumulator = 0;
+  uint64_t unweight_accumulator = 0;
+  for (int i = 0; i < config->num_channels + 1; i++) {
+    const uint32_t* in = input + config->spans[i].frequency_start;
+    const int width = config->spans[i].width;
+    for (int j = 0; j < width; ++j) {
+      const uint64_t x = in[j];
+      weight_accumulator += x * pair[j].weight;
+      unweight_accumulator += x * pair[j].unweight;
+    }
+    pair += width;
+    output[i] = weight_accumulator;
+    weight_accumulator = unweight_accumulator;
+    unweight_accumulator = 0;
+  }
+}
+
+}  // namespace
+
+int32_t FilterbankPackedPairCount(const FilterbankConfig* config,
+                                  int32_t num_weights) {
+  int32_t count = 0;
+  for (int i = 0; i < config->num_channels + 1; i++) {
+    const int16_t freq_start = config->channel_frequency_starts[i];
+    const int16_t weight_start = config->channel_weight_starts[i];
+    const int16_t width = config->channel_widths[i];
+    if (freq_start < 0 || weight_start < 0 || width < 0 ||
+        weight_start + width > num_weights) {
+      return -1;
+    }
+    for (int j = 0; j < width; ++j) {
+      if (config->weights[weight_start + j] < 0 ||
+          config->unweights[weight_start + j] < 0) {
+        return -1;
+      }
+    }
+    count += width;
+  }
+  return count;
+}
+
+void FilterbankPack(const FilterbankConfig* config,
+                    FilterbankChannelSpan* spans, FilterbankWeightPair* pairs,
+                    FilterbankPackedConfig* packed) {
+  int32_t input_start = 0;
+  int32_t input_end = 0;
+  uint32_t max_weight_sum = 0;
+  FilterbankWeightPair* pair = pairs;
+  for (int i = 0; i < config->num_channels + 1; i++) {
+    const int16_t freq_start = config->channel_frequency_starts[i];
+    const int16_t weight_start = config->channel_weight_starts[i];
+    const int16_t width = config->channel_widths[i];
+    spans[i].frequency_start = freq_start;
+    spans[i].width = width;
+    uint32_t weight_sum = 0;
+    uint32_t unweight_sum = 0;
+    for (int j = 0; j < width; ++j) {
+      pair[j].weight = config->weights[weight_start + j];
+      pair[j].unweight = config->unweights[weight_start + j];
+      weight_sum += pair[j].weight;
+      unweight_sum += pair[j].unweight;
+    }
+    pair += width;
+    if (weight_sum > max_weight_sum) {
+      max_weight_sum = weight_sum;
+    }
+    if (unweight_sum > max_weight_sum) {
+      max_weight_sum = unweight_sum;
+    }
+    if (width == 0) {
+      continue;
+    }
+    if (input_end == 0 || freq_start < input_start) {
+      input_start = freq_start;
+    }
+    if (freq_start + width > input_end) {
+      input_end = freq_start + width;
+    }
+  }
+  packed->num_channels = config->num_channels;
+  packed->spans = spans;
+  packed->pairs = pairs;
+  packed->input_start = input_start;
+  packed->input_end = input_end;
+  packed->weight_sum_bits = BitsNeeded(max_weight_sum);
+}
+
+void FilterbankAccumulateChannelsPacked(const FilterbankPackedConfig* config,
+                                        const uint32_t* input,
+                                        uint64_t* output) {
+  // The largest bin bounds every product, so an OR over the bins read gives a
+  // cheap upper bound on each channel's sum.
+  uint32_t input_bits = 0;
+  for (int i = config->input_start; i < config->input_end; ++i) {
+    input_bits |= input[i];
+  }
+  if (BitsNeeded(input_bits) + config->weight_sum_bits <= 32) {
+    AccumulateChannels32(config, input, output);
+  } else {
+    AccumulateChannels64(config, input, output);
+  }
+}
+
 }  // namespace tflm_signal
 }  // namespace tflite
\ No newline at end of file
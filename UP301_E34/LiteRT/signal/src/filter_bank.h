@@ -63,6 +63,54 @@ struct FilterbankConfig {
 void FilterbankAccumulateChannels(const FilterbankConfig* config,
                                   const uint32_t* input, uint64_t* output);
 
+// Filter weights of one spectrum bin: the weight for the channel that owns the
+// bin and the unweight that is carried into the next channel.
+struct FilterbankWeightPair {
+  uint16_t weight;
+  uint16_t unweight;
+};
+
+// Band of a channel in the packed layout. Its weight pairs follow those of the
+// previous channel, so no weight start is needed.
+struct FilterbankChannelSpan {
+  int16_t frequency_start;
+  int16_t width;
+};
+
+// FilterbankConfig preprocessed by FilterbankPack(): one array of
+// `num_channels` + 1 spans and one contiguous array of interleaved weight
+// pairs in channel order.
+struct FilterbankPackedConfig {
+  int32_t num_channels;
+  const FilterbankChannelSpan* spans;
+  const FilterbankWeightPair* pairs;
+  // Range [input_start, input_end) of spectrum bins read by any channel.
+  int32_t input_start;
+  int32_t input_end;
+  // Bits needed for the largest sum of weights (or unweights) of one channel.
+  // When the input bins fit in 32 - weight_sum_bits bits, every channel can be
+  // accumulated in 32 bits without overflow.
+  int32_t weight_sum_bits;
+};
+
+// Returns the number of weight pairs FilterbankPack() writes for `config`, or
+// -1 if `config` cannot be packed (a negative weight or an out of range span).
+// `num_weights` is the length of the weights and unweights arrays.
+int32_t FilterbankPackedPairCount(const FilterbankConfig* config,
+                                  int32_t num_weights);
+
+// Fills `packed` from `config`, using `spans` (`config.num_channels` + 1
+// elements) and `pairs` (FilterbankPackedPairCount() elements) as storage.
+void FilterbankPack(const FilterbankConfig* config,
+                    FilterbankChannelSpan* spans, FilterbankWeightPair* pairs,
+                    FilterbankPackedConfig* packed);
+
+// Same result as FilterbankAccumulateChannels() on the config that was packed.
+// Frames whose input dynamic range allows it are accumulated in 32 bits.
+void FilterbankAccumulateChannelsPacked(const FilterbankPackedConfig* config,
+                                        const uint32_t* input,
+                                        uint64_t* output);
+
 }  // namespace tflm_signal
 }  // namespace tflite
 
@@ -0,0 +1,233 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Checks that FilterbankAccumulateChannelsPacked() gives the same channels as
+// FilterbankAccumulateChannels(), bit for bit, on the 32 and 16 channel mel
+// filter banks of the filter_bank kernel test vectors, whether a frame takes
+// the 32-bit fast path or falls back to 64 bits. The frames straddle the
+// headroom check: bins one bit below the limit must still be exact in 32 bits,
+// and one more bit must fall back.
+//
+// Only built on request, since the firmware build globs every .cc file.
+// From the LiteRT directory:
+//
+//   g++ -O2 -std=c++17 -DSIGNAL_HOST_TEST -DTF_LITE_STATIC_MEMORY -I.
+//       -Ithird_party/flatbuffers/include -Ithird_party/gemmlowp
+//       -Ithird_party/ruy signal/src/filter_bank_test.cc
+//       signal/src/filter_bank.cc signal/src/msb_32.cc libtflm_host.a
+//       -o filter_bank_test
+//
+// where libtflm_host.a holds the tensorflow/lite sources built for the host
+// with -fno-exceptions, with a DebugLog() that prints to stderr in place of
+// the UART one of tensorflow/lite/micro/debug_log.cc.
+
+#if defined(SIGNAL_HOST_TEST)
+
+#include "signal/src/filter_bank.h"
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "tensorflow/lite/micro/micro_testing.h"
+
+namespace tflite {
+namespace tflm_signal {
+namespace {
+
+constexpr int kFilterbankBits = 12;
+constexpr int kRandomFrames = 50;
+
+struct MelFilterBankConfig {
+  int num_channels;
+  int sample_rate;
+  int spectrum_size;
+  float lower_band_limit;
+  float upper_band_limit;
+};
+
+// Mel filter banks with the parameters of the kernel test vectors
+// (filter_bank_flexbuffers_generated_data.h): 32 channels over a 512-point
+// FFT and 16 channels over a 256-point FFT of 16 kHz audio.
+constexpr MelFilterBankConfig k32ChannelConfig = {32, 16000, 257, 125.0f,
+                                                  7500.0f};
+constexpr MelFilterBankConfig k16ChannelConfig = {16, 16000, 129, 125.0f,
+                                                  3800.0f};
+
+float FreqToMel(float freq) { return 1127.0f * std::log1p(freq / 700.0f); }
+
+// Triangular filters on the mel scale, laid out as the filter_bank op expects
+// them: channel i owns the bins between centers i - 1 and i, with the
+// weight for channel i and the unweight carried into channel i + 1.
+struct FilterBankData {
+  explicit FilterBankData(const MelFilterBankConfig& c)
+      : channel_frequency_starts(c.num_channels + 1),
+        channel_weight_starts(c.num_channels + 1),
+        channel_widths(c.num_channels + 1) {
+    const float mel_low = FreqToMel(c.lower_band_limit);
+    const float mel_spacing =
+        (FreqToMel(c.upper_band_limit) - mel_low) / (c.num_channels + 1);
+    const float hz_per_bin = 0.5f * c.sample_rate / (c.spectrum_size - 1);
+    int bin = static_cast<int>(1.5f + c.lower_band_limit / hz_per_bin);
+    for (int i = 0; i < c.num_channels + 1; ++i) {
+      const float center = mel_low + mel_spacing * (i + 1);
+      channel_frequency_starts[i] = bin;
+      channel_weight_starts[i] = weights.size();
+      for (; FreqToMel(bin * hz_per_bin) <= center; ++bin) {
+        const float w = (center - FreqToMel(bin * hz_per_bin)) / mel_spacing;
+        const int16_t weight = static_cast<int16_t>(
+            std::lround((1.0f - w) * (1 << kFilterbankBits)));
+        weights.push_back(weight);
+        unweights.push_back((1 << kFilterbankBits) - weight);
+      }
+      channel_widths[i] = bin - channel_frequency_starts[i];
+    }
+    config.num_channels = c.num_channels;
+    config.channel_frequency_starts = channel_frequency_starts.data();
+    config.channel_weight_starts = channel_weight_starts.data();
+    config.channel_widths = channel_widths.data();
+    config.weights = weights.data();
+    config.unweights = unweights.data();
+    config.output_scale = 1;
+    config.input_correction_bits = 0;
+
+    const int32_t num_pairs =
+        FilterbankPackedPairCount(&config, weights.size());
+    TF_LITE_MICRO_EXPECT_EQ(num_pairs, static_cast<int32_t>(weights.size()));
+    spans.resize(c.num_channels + 1);
+    pairs.resize(num_pairs);
+    FilterbankPack(&config, spans.data(), pairs.data(), &packed);
+  }
+
+  std::vector<int16_t> channel_frequency_starts;
+  std::vector<int16_t> channel_weight_starts;
+  std::vector<int16_t> channel_widths;
+  std::vector<int16_t> weights;
+  std::vector<int16_t> unweights;
+  std::vector<FilterbankChannelSpan> spans;
+  std::vector<FilterbankWeightPair> pairs;
+  FilterbankConfig config;
+  FilterbankPackedConfig packed;
+};
+
+uint32_t seed = 1;
+
+uint32_t RandomBin() {
+  seed = seed * 1103515245u + 12345u;
+  const uint32_t high = seed >> 16;
+  seed = seed * 1103515245u + 12345u;
+  return (high << 16) | (seed >> 16);
+}
+
+void ExpectPackedMatches(const FilterBankData& data,
+                         const std::vector<uint32_t>& input) {
+  std::vector<uint64_t> expected(data.config.num_channels + 1);
+  std::vector<uint64_t> actual(data.config.num_channels + 1);
+  FilterbankAccumulateChannels(&data.config, input.data(), expected.data());
+  FilterbankAccumulateChannelsPacked(&data.packed, input.data(),
+                                     actual.data());
+  // Element 0 is scratch.
+  for (int i = 1; i < data.config.num_channels + 1; ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(actual[i], expected[i]);
+  }
+}
+
+// Random frames from full 32-bit bins down to bins that leave ample headroom,
+// so that both paths are taken.
+void TestRandomFrames(const MelFilterBankConfig& c) {
+  const FilterBankData data(c);
+  std::vector<uint32_t> input(c.spectrum_size);
+  for (int frame = 0; frame < kRandomFrames; ++frame) {
+    const int shift = frame % 32;
+    for (uint32_t& v : input) {
+      v = RandomBin() >> shift;
+    }
+    ExpectPackedMatches(data, input);
+  }
+}
+
+// The fast path is taken when the bins fit in 32 - weight_sum_bits bits.
+void TestHeadroomBoundary(const MelFilterBankConfig& c) {
+  const FilterBankData data(c);
+  const int32_t input_bits = 32 - data.packed.weight_sum_bits;
+  TF_LITE_MICRO_EXPECT_GT(input_bits, 0);
+
+  // Every bin at the largest value the fast path accepts: the channel sums
+  // come as close to 2^32 as the weights allow and must not wrap.
+  const uint32_t max_fast = (1u << input_bits) - 1;
+  std::vector<uint32_t> input(c.spectrum_size, max_fast);
+  ExpectPackedMatches(data, input);
+
+  // One bin in the band a bit over the limit must switch the frame to 64
+  // bits.
+  input[data.packed.input_end - 1] = max_fast + 1;
+  ExpectPackedMatches(data, input);
+
+  // With every bin one bit over, the 32-bit sums would wrap: check that they
+  // really would, so that a missing fallback cannot go unnoticed.
+  input.assign(c.spectrum_size, 2 * max_fast + 1);
+  uint64_t max_sum = 0;
+  for (int i = 0; i < c.num_channels + 1; ++i) {
+    uint64_t weight_sum = 0;
+    uint64_t unweight_sum = 0;
+    for (int j = 0; j < data.channel_widths[i]; ++j) {
+      weight_sum += data.weights[data.channel_weight_starts[i] + j];
+      unweight_sum += data.unweights[data.channel_weight_starts[i] + j];
+    }
+    max_sum = std::max(max_sum, std::max(weight_sum, unweight_sum));
+  }
+  TF_LITE_MICRO_EXPECT_GT(max_sum * input[0], UINT32_MAX);
+  ExpectPackedMatches(data, input);
+
+  // Bins outside the band are not read, so they do not count.
+  input.assign(c.spectrum_size, max_fast);
+  for (int i = 0; i < data.packed.input_start; ++i) {
+    input[i] = UINT32_MAX;
+  }
+  for (int i = data.packed.input_end; i < c.spectrum_size; ++i) {
+    input[i] = UINT32_MAX;
+  }
+  ExpectPackedMatches(data, input);
+}
+
+}  // namespace
+}  // namespace tflm_signal
+}  // namespace tflite
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(FilterBankPacked32ChannelMatchesOnRandomFrames) {
+  tflite::tflm_signal::TestRandomFrames(tflite::tflm_signal::k32ChannelConfig);
+}
+
+TF_LITE_MICRO_TEST(FilterBankPacked16ChannelMatchesOnRandomFrames) {
+  tflite::tflm_signal::TestRandomFrames(tflite::tflm_signal::k16ChannelConfig);
+}
+
+TF_LITE_MICRO_TEST(FilterBankPacked32ChannelMatchesAtHeadroomBoundary) {
+  tflite::tflm_signal::TestHeadroomBoundary(
+      tflite::tflm_signal::k32ChannelConfig);
+}
+
+TF_LITE_MICRO_TEST(FilterBankPacked16ChannelMatchesAtHeadroomBoundary) {
+  tflite::tflm_signal::TestHeadroomBoundary(
+      tflite::tflm_signal::k16ChannelConfig);
+}
+
+TF_LITE_MICRO_TESTS_END
+
+#endif  // defined(SIGNAL_HOST_TEST)
@@ -19,24 +19,62 @@ limitations under the License.
 #include "signal/src/complex.h"
 #include "signal/src/kiss_fft_wrappers/kiss_fft_int16.h"
 #include "signal/src/rfft.h"
+#include "signal/src/rfft_int16_fixed.h"
 
 // TODO(b/286250473): remove namespace once de-duped libraries
 namespace tflm_signal {
+namespace {
+
+// Lengths with a size-specialized engine (rfft_int16_fixed.h) only need this
+// header. Other lengths are followed by the kissfft state.
+struct RfftInt16State {
+  int32_t fft_length;
+  int32_t use_fixed;
+};
+
+// Keeps the kissfft state that follows suitably aligned.
+constexpr size_t kStateHeaderSize =
+    (sizeof(RfftInt16State) + sizeof(void*) - 1) & ~(sizeof(void*) - 1);
+
+}  // namespace
 
 size_t RfftInt16GetNeededMemory(int32_t fft_length) {
+  if (RfftInt16FixedSupported(fft_length)) {
+    return kStateHeaderSize;
+  }
   size_t state_size = 0;
   kiss_fft_fixed16::kiss_fftr_alloc(fft_length, 0, nullptr, &state_size);
-  return state_size;
+  return kStateHeaderSize + state_size;
 }
 
 void* RfftInt16Init(int32_t fft_length, void* state, size_t state_size) {
-  return kiss_fft_fixed16::kiss_fftr_alloc(fft_length, 0, state, &state_size);
+  if (state == nullptr || state_size < kStateHeaderSize) {
+    return nullptr;
+  }
+  auto* header = static_cast<RfftInt16State*>(state);
+  header->fft_length = fft_length;
+  header->use_fixed = RfftInt16FixedSupported(fft_length);
+  if (!header->use_fixed) {
+    size_t kiss_size = state_size - kStateHeaderSize;
+    if (kiss_fft_fixed16::kiss_fftr_alloc(
+            fft_length, 0, static_cast<int8_t*>(state) + kStateHeaderSize,
+            &kiss_size) == nullptr) {
+      return nullptr;
+    }
+  }
+  return state;
 }
 
 void RfftInt16Apply(void* state, const int16_t* input,
                     Complex<int16_t>* output) {
+  const auto* header = static_cast<const RfftInt16State*>(state);
+  if (header->use_fixed) {
+    RfftInt16FixedApply(header->fft_length, input, output);
+    return;
+  }
   kiss_fft_fixed16::kiss_fftr(
-      static_cast<kiss_fft_fixed16::kiss_fftr_cfg>(state),
+      reinterpret_cast<kiss_fft_fixed16::kiss_fftr_cfg>(
+          static_cast<int8_t*>(state) + kStateHeaderSize),
       reinterpret_cast<const kiss_fft_scalar*>(input),
       reinterpret_cast<kiss_fft_fixed16::kiss_fft_cpx*>(output));
 }
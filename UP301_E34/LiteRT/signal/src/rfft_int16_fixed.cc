@@ -0,0 +1,290 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "signal/src/rfft_int16_fixed.h"
+
+#include <stdint.h>
+
+#include "signal/src/complex.h"
+
+// TODO(b/286250473): remove namespace once de-duped libraries
+namespace tflm_signal {
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+
+// Taylor series, accurate to double precision for |x| <= pi / 4. <cmath> is
+// not constexpr, and the tables below must be built by the compiler.
+constexpr double SinSmall(double x) {
+  double term = x;
+  double sum = x;
+  for (int i = 1; i < 12; ++i) {
+    term *= -x * x / ((2 * i) * (2 * i + 1));
+    sum += term;
+  }
+  return sum;
+}
+
+constexpr double CosSmall(double x) {
+  double term = 1.0;
+  double sum = 1.0;
+  for (int i = 1; i < 12; ++i) {
+    term *= -x * x / ((2 * i - 1) * (2 * i));
+    sum += term;
+  }
+  return sum;
+}
+
+constexpr int16_t ToQ15(double x) {
+  const double scaled = x * 32768.0;
+  const int32_t rounded =
+      static_cast<int32_t>(scaled >= 0 ? scaled + 0.5 : scaled - 0.5);
+  return static_cast<int16_t>(rounded > 32767 ? 32767 : rounded);
+}
+
+// exp(-2 * pi * j * index / n) in Q15, n a multiple of 8. The angle is
+// reduced exactly on the integer index so the series only sees [0, pi / 4].
+constexpr Complex<int16_t> Twiddle(int32_t index, int32_t n) {
+  index %= n;
+  const int32_t quadrant = index / (n / 4);
+  const int32_t offset = index % (n / 4);
+  double c = 0.0;
+  double s = 0.0;
+  if (offset <= n / 8) {
+    const double angle = 2.0 * kPi * offset / n;
+    c = CosSmall(angle);
+    s = SinSmall(angle);
+  } else {
+    const double angle = 2.0 * kPi * (n / 4 - offset) / n;
+    c = SinSmall(angle);
+    s = CosSmall(angle);
+  }
+  // Rotate (cos, sin) of the reduced angle into its quadrant.
+  for (int32_t q = 0; q < quadrant; ++q) {
+    const double t = c;
+    c = -s;
+    s = t;
+  }
+  return Complex<int16_t>{ToQ15(c), ToQ15(-s)};
+}
+
+// Radix-4 stage lengths run from 4 (or 8 after a radix-2 stage) up to `half`.
+constexpr int32_t FirstRadix4Length(int32_t half) {
+  // An odd power of two needs one radix-2 stage first.
+  return (half & 0x55555555) == 0 ? 8 : 4;
+}
+
+// Twiddles for k = 1 .. length / 4 - 1 of every radix-4 stage; k = 0 is 1.
+constexpr int32_t StageTwiddleCount(int32_t half) {
+  int32_t count = 0;
+  for (int32_t length = FirstRadix4Length(half); length <= half; length *= 4) {
+    count += 3 * (length / 4 - 1);
+  }
+  return count;
+}
+
+template <int32_t kFftLength>
+struct RfftInt16Tables {
+  static constexpr int32_t kHalf = kFftLength / 2;
+  // Per radix-4 stage, W_length^k, W_length^2k and W_length^3k stored next to
+  // each other for k = 1 .. length / 4 - 1, so the butterflies read them
+  // sequentially.
+  Complex<int16_t> stage_twiddle[StageTwiddleCount(kHalf)];
+  // W_fft_length^k for the real split, k = 0 .. kHalf / 2.
+  Complex<int16_t> split[kHalf / 2 + 1];
+  uint16_t bit_reverse[kHalf];
+};
+
+template <int32_t kFftLength>
+constexpr RfftInt16Tables<kFftLength> MakeRfftInt16Tables() {
+  constexpr int32_t kHalf = RfftInt16Tables<kFftLength>::kHalf;
+  RfftInt16Tables<kFftLength> tables = {};
+  int32_t t = 0;
+  for (int32_t length = FirstRadix4Length(kHalf); length <= kHalf;
+       length *= 4) {
+    for (int32_t k = 1; k < length / 4; ++k) {
+      tables.stage_twiddle[t++] = Twiddle(k, length);
+      tables.stage_twiddle[t++] = Twiddle(2 * k, length);
+      tables.stage_twiddle[t++] = Twiddle(3 * k, length);
+    }
+  }
+  for (int32_t k = 0; k <= kHalf / 2; ++k) {
+    tables.split[k] = Twiddle(k, kFftLength);
+  }
+  int32_t bits = 0;
+  while ((1 << bits) < kHalf) {
+    ++bits;
+  }
+  for (int32_t i = 0; i < kHalf; ++i) {
+    int32_t reversed = 0;
+    for (int32_t b = 0; b < bits; ++b) {
+      reversed |= ((i >> b) & 1) << (bits - 1 - b);
+    }
+    tables.bit_reverse[i] = static_cast<uint16_t>(reversed);
+  }
+  return tables;
+}
+
+// Built at compile time and placed in read-only memory.
+template <int32_t kFftLength>
+constexpr RfftInt16Tables<kFftLength> kRfftInt16Tables =
+    MakeRfftInt16Tables<kFftLength>();
+
+inline int16_t Saturate16(int32_t x) {
+  return static_cast<int16_t>(x > INT16_MAX ? INT16_MAX
+                                            : (x < INT16_MIN ? INT16_MIN : x));
+}
+
+// Rounded (a * w) for a Q15 twiddle w.
+inline void MulQ15(int32_t a_re, int32_t a_im, const Complex<int16_t>& w,
+                   int32_t* re, int32_t* im) {
+  *re = (a_re * w.real - a_im * w.imag + (1 << 14)) >> 15;
+  *im = (a_re * w.imag + a_im * w.real + (1 << 14)) >> 15;
+}
+
+// One radix-4 decimation-in-time butterfly, scaled by 1/4. (b, c, d) are the
+// rotated values of the x[4n + 1], x[4n + 2] and x[4n + 3] sub-DFTs, which
+// live in q2, q1 and q3 respectively. Results are written in natural order.
+inline void Radix4Butterfly(Complex<int16_t>* q0, Complex<int16_t>* q1,
+                            Complex<int16_t>* q2, Complex<int16_t>* q3,
+                            int32_t b_re, int32_t b_im, int32_t c_re,
+                            int32_t c_im, int32_t d_re, int32_t d_im) {
+  const int32_t a_re = q0->real;
+  const int32_t a_im = q0->imag;
+  const int32_t t0_re = a_re + c_re;
+  const int32_t t0_im = a_im + c_im;
+  const int32_t t1_re = a_re - c_re;
+  const int32_t t1_im = a_im - c_im;
+  const int32_t t2_re = b_re + d_re;
+  const int32_t t2_im = b_im + d_im;
+  const int32_t t3_re = b_re - d_re;
+  const int32_t t3_im = b_im - d_im;
+
+  q0->real = Saturate16((t0_re + t2_re + 2) >> 2);
+  q0->imag = Saturate16((t0_im + t2_im + 2) >> 2);
+  q1->real = Saturate16((t1_re + t3_im + 2) >> 2);
+  q1->imag = Saturate16((t1_im - t3_re + 2) >> 2);
+  q2->real = Saturate16((t0_re - t2_re + 2) >> 2);
+  q2->imag = Saturate16((t0_im - t2_im + 2) >> 2);
+  q3->real = Saturate16((t1_re - t3_im + 2) >> 2);
+  q3->imag = Saturate16((t1_im + t3_re + 2) >> 2);
+}
+
+template <int32_t kFftLength>
+void RfftInt16FixedApplyImpl(const int16_t* input, Complex<int16_t>* data) {
+  constexpr int32_t kHalf = kFftLength / 2;
+  constexpr const RfftInt16Tables<kFftLength>& kTables =
+      kRfftInt16Tables<kFftLength>;
+
+  // Pack pairs of real samples as complex values, in bit-reversed order for
+  // the decimation-in-time stages.
+  for (int32_t i = 0; i < kHalf; ++i) {
+    const int32_t src = 2 * kTables.bit_reverse[i];
+    data[i].real = input[src];
+    data[i].imag = input[src + 1];
+  }
+
+  // An odd power of two needs one radix-2 stage first.
+  if (FirstRadix4Length(kHalf) == 8) {
+    for (int32_t i = 0; i < kHalf; i += 2) {
+      const int32_t a_re = data[i].real;
+      const int32_t a_im = data[i].imag;
+      const int32_t b_re = data[i + 1].real;
+      const int32_t b_im = data[i + 1].imag;
+      data[i].real = Saturate16((a_re + b_re + 1) >> 1);
+      data[i].imag = Saturate16((a_im + b_im + 1) >> 1);
+      data[i + 1].real = Saturate16((a_re - b_re + 1) >> 1);
+      data[i + 1].imag = Saturate16((a_im - b_im + 1) >> 1);
+    }
+  }
+
+  // Radix-4 stages. With bit-reversed input the quarters of a block hold the
+  // sub-DFTs of x[4n], x[4n + 2], x[4n + 1] and x[4n + 3], in that order.
+  const Complex<int16_t>* stage_twiddle = kTables.stage_twiddle;
+  for (int32_t length = FirstRadix4Length(kHalf); length <= kHalf;
+       length *= 4) {
+    const int32_t quarter = length / 4;
+    for (int32_t base = 0; base < kHalf; base += length) {
+      Complex<int16_t>* q0 = &data[base];
+      Complex<int16_t>* q1 = q0 + quarter;
+      Complex<int16_t>* q2 = q1 + quarter;
+      Complex<int16_t>* q3 = q2 + quarter;
+      // k = 0: all twiddles are 1.
+      Radix4Butterfly(q0, q1, q2, q3, q2->real, q2->imag, q1->real, q1->imag,
+                      q3->real, q3->imag);
+      const Complex<int16_t>* w = stage_twiddle;
+      for (int32_t k = 1; k < quarter; ++k, w += 3) {
+        int32_t b_re, b_im, c_re, c_im, d_re, d_im;
+        MulQ15(q2[k].real, q2[k].imag, w[0], &b_re, &b_im);
+        MulQ15(q1[k].real, q1[k].imag, w[1], &c_re, &c_im);
+        MulQ15(q3[k].real, q3[k].imag, w[2], &d_re, &d_im);
+        Radix4Butterfly(&q0[k], &q1[k], &q2[k], &q3[k], b_re, b_im, c_re, c_im,
+                        d_re, d_im);
+      }
+    }
+    stage_twiddle += 3 * (quarter - 1);
+  }
+
+  // Real split, in place: X[k] and X[half - k] from Z[k] and Z[half - k].
+  const int32_t z0_re = data[0].real;
+  const int32_t z0_im = data[0].imag;
+  data[0].real = Saturate16((z0_re + z0_im + 1) >> 1);
+  data[0].imag = 0;
+  data[kHalf].real = Saturate16((z0_re - z0_im + 1) >> 1);
+  data[kHalf].imag = 0;
+  for (int32_t k = 1; k <= kHalf / 2; ++k) {
+    const int32_t a_re = data[k].real;
+    const int32_t a_im = data[k].imag;
+    const int32_t b_re = data[kHalf - k].real;
+    const int32_t b_im = data[kHalf - k].imag;
+    const int32_t f1_re = a_re + b_re;
+    const int32_t f1_im = a_im - b_im;
+    const int32_t f2_re = a_re - b_re;
+    const int32_t f2_im = a_im + b_im;
+    // tw = f2 * -j * W^k. f2 has 17 significant bits, so the products need
+    // 64-bit accumulation.
+    const Complex<int16_t>& w = kTables.split[k];
+    const int32_t tw_re = static_cast<int32_t>(
+        (int64_t{f2_re} * w.imag + int64_t{f2_im} * w.real + (1 << 14)) >> 15);
+    const int32_t tw_im = static_cast<int32_t>(
+        (int64_t{f2_im} * w.imag - int64_t{f2_re} * w.real + (1 << 14)) >> 15);
+    data[k].real = Saturate16((f1_re + tw_re + 2) >> 2);
+    data[k].imag = Saturate16((f1_im + tw_im + 2) >> 2);
+    data[kHalf - k].real = Saturate16((f1_re - tw_re + 2) >> 2);
+    data[kHalf - k].imag = Saturate16((tw_im - f1_im + 2) >> 2);
+  }
+}
+
+}  // namespace
+
+bool RfftInt16FixedSupported(int32_t fft_length) {
+  return fft_length == 256 || fft_length == 512;
+}
+
+void RfftInt16FixedApply(int32_t fft_length, const int16_t* input,
+                         Complex<int16_t>* output) {
+  switch (fft_length) {
+    case 256:
+      RfftInt16FixedApplyImpl<256>(input, output);
+      break;
+    case 512:
+      RfftInt16FixedApplyImpl<512>(input, output);
+      break;
+    default:
+      break;
+  }
+}
+
+}  // namespace tflm_signal
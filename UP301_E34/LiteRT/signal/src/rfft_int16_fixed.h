@@ -0,0 +1,45 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef SIGNAL_SRC_RFFT_INT16_FIXED_H_
+#define SIGNAL_SRC_RFFT_INT16_FIXED_H_
+
+#include <stdint.h>
+
+#include "signal/src/complex.h"
+
+// TODO(b/286250473): remove namespace once de-duped libraries
+namespace tflm_signal {
+
+// Size-specialized 16-bit real FFT: a radix-4 (plus one radix-2 stage when
+// needed) complex FFT of half length followed by the real split, with all
+// twiddles and the bit-reversal permutation in constexpr tables.
+//
+// Scaling matches the kissfft int16 path: every stage divides by its radix,
+// so the output is the DFT divided by `fft_length`. Callers that use
+// FftAutoScale can keep their scale compensation unchanged.
+
+// Returns true if there is a specialization for `fft_length`.
+bool RfftInt16FixedSupported(int32_t fft_length);
+
+// Applies the RFFT to `input` (`fft_length` elements) and writes
+// `fft_length` / 2 + 1 elements to `output`. `output` is also the work area.
+// `fft_length` must be supported.
+void RfftInt16FixedApply(int32_t fft_length, const int16_t* input,
+                         Complex<int16_t>* output);
+
+}  // namespace tflm_signal
+
+#endif  // SIGNAL_SRC_RFFT_INT16_FIXED_H_
@@ -0,0 +1,162 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "signal/src/upt_dsp.h"
+
+#include <stdint.h>
+
+#include "signal/src/complex.h"
+
+#if defined(UP301_HW_DSP)
+extern "C" {
+#include "metal/dsp.h"
+}
+#endif
+
+// TODO(b/286250473): remove namespace once de-duped libraries
+namespace tflite {
+namespace tflm_signal {
+
+#if defined(UP301_HW_DSP)
+
+namespace {
+
+// Power-of-two transform sizes the DSP block accepts.
+constexpr int32_t kMinFftLength = 32;
+constexpr int32_t kMaxFftLength = 1024;
+
+metal_dsp_Type* GetDsp() {
+  static metal_dsp_Type* dsp = upt_dsp_get_device(NAON_UDL_1_2_DSP);
+  return dsp;
+}
+
+int Log2(int32_t n) {
+  int log2 = 0;
+  while ((1 << log2) < n) {
+    log2++;
+  }
+  return log2;
+}
+
+// The DSP reports its output as value * 2^scale_factor in the input's units.
+// Convert that to value * 2^-`log2_divisor`, rounding to nearest.
+template <typename T>
+T Rescale(T value, int32_t scale_factor, int log2_divisor) {
+  const int shift = log2_divisor - scale_factor;
+  int64_t v = value;
+  if (shift > 0) {
+    v = (v + (int64_t{1} << (shift - 1))) >> shift;
+  } else if (shift < 0) {
+    v <<= -shift;
+  }
+  constexpr int64_t kMax = (int64_t{1} << (sizeof(T) * 8 - 1)) - 1;
+  constexpr int64_t kMin = -kMax - 1;
+  return static_cast<T>(v > kMax ? kMax : (v < kMin ? kMin : v));
+}
+
+template <typename T>
+void RescaleAll(T* data, int count, int32_t scale_factor, int log2_divisor) {
+  if (scale_factor == log2_divisor) {
+    return;
+  }
+  for (int i = 0; i < count; ++i) {
+    data[i] = Rescale(data[i], scale_factor, log2_divisor);
+  }
+}
+
+upt_dsp_config_Type FftConfig(int32_t fft_length, bool inverse) {
+  upt_dsp_config_Type cfg = {};
+  cfg.length = static_cast<uint32_t>(fft_length);
+  cfg.dsp_ifftFlag = inverse ? UPT_DSP_IRFFT_MODE : UPT_DSP_RFFT_MODE;
+  return cfg;
+}
+
+}  // namespace
+
+bool UptDspAvailable() { return GetDsp() != nullptr; }
+
+bool UptDspFftSupported(int32_t fft_length) {
+  return UptDspAvailable() && fft_length >= kMinFftLength &&
+         fft_length <= kMaxFftLength && (fft_length & (fft_length - 1)) == 0;
+}
+
+bool UptDspRfftApply(int32_t fft_length, int16_t* input,
+                     Complex<int16_t>* output) {
+  const upt_dsp_config_Type cfg = FftConfig(fft_length, false);
+  int16_t* out = reinterpret_cast<int16_t*>(output);
+  int32_t scale_factor = 0;
+  if (upt_dsp_rfft_q15(GetDsp(), &cfg, input, out, &scale_factor) !=
+      E_DSP_SUCCESS) {
+    return false;
+  }
+  RescaleAll(out, fft_length + 2, scale_factor, Log2(fft_length));
+  return true;
+}
+
+bool UptDspRfftApply(int32_t fft_length, int32_t* input,
+                     Complex<int32_t>* output) {
+  const upt_dsp_config_Type cfg = FftConfig(fft_length, false);
+  int32_t* out = reinterpret_cast<int32_t*>(output);
+  int32_t scale_factor = 0;
+  if (upt_dsp_rfft_q31(GetDsp(), &cfg, input, out, &scale_factor) !=
+      E_DSP_SUCCESS) {
+    return false;
+  }
+  RescaleAll(out, fft_length + 2, scale_factor, Log2(fft_length));
+  return true;
+}
+
+bool UptDspIrfftApply(int32_t fft_length, Complex<int16_t>* input,
+                      int16_t* output) {
+  const upt_dsp_config_Type cfg = FftConfig(fft_length, true);
+  int32_t scale_factor = 0;
+  if (upt_dsp_rfft_q15(GetDsp(), &cfg, reinterpret_cast<int16_t*>(input),
+                       output, &scale_factor) != E_DSP_SUCCESS) {
+    return false;
+  }
+  RescaleAll(output, fft_length, scale_factor, Log2(fft_length));
+  return true;
+}
+
+bool UptDspIrfftApply(int32_t fft_length, Complex<int32_t>* input,
+                      int32_t* output) {
+  const upt_dsp_config_Type cfg = FftConfig(fft_length, true);
+  int32_t scale_factor = 0;
+  if (upt_dsp_rfft_q31(GetDsp(), &cfg, reinterpret_cast<int32_t*>(input),
+                       output, &scale_factor) != E_DSP_SUCCESS) {
+    return false;
+  }
+  RescaleAll(output, fft_length, scale_factor, Log2(fft_length));
+  return true;
+}
+
+#else  // defined(UP301_HW_DSP)
+
+bool UptDspAvailable() { return false; }
+
+bool UptDspFftSupported(int32_t) { return false; }
+
+bool UptDspRfftApply(int32_t, int16_t*, Complex<int16_t>*) { return false; }
+
+bool UptDspRfftApply(int32_t, int32_t*, Complex<int32_t>*) { return false; }
+
+bool UptDspIrfftApply(int32_t, Complex<int16_t>*, int16_t*) { return false; }
+
+bool UptDspIrfftApply(int32_t, Complex<int32_t>*, int32_t*) { return false; }
+
+#endif  // defined(UP301_HW_DSP)
+
+}  // namespace tflm_signal
+}  // namespace tflite
@@ -0,0 +1,68 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef SIGNAL_SRC_UPT_DSP_H_
+#define SIGNAL_SRC_UPT_DSP_H_
+
+#include <stdint.h>
+
+#include "signal/src/complex.h"
+
+// TODO(b/286250473): remove namespace once de-duped libraries
+namespace tflite {
+namespace tflm_signal {
+
+// Offload of the signal library's transforms to the UPT DSP block
+// (freedom-metal/metal/dsp.h). Only active when built with UP301_HW_DSP;
+// otherwise every query returns false and callers keep their CPU path.
+//
+// The Apply functions return false if the DSP reported an error, in which
+// case the caller must run its CPU implementation for that frame.
+
+// Returns true if the DSP block is present.
+bool UptDspAvailable();
+
+// Returns true if the DSP block can run a real FFT/IFFT of `fft_length`.
+bool UptDspFftSupported(int32_t fft_length);
+
+// RFFT with the same scaling as RfftInt16Apply/RfftInt32Apply (the DFT
+// divided by `fft_length`). `input` holds `fft_length` samples and is used as
+// DSP work memory. `output` holds `fft_length` / 2 + 1 elements.
+bool UptDspRfftApply(int32_t fft_length, int16_t* input,
+                     Complex<int16_t>* output);
+bool UptDspRfftApply(int32_t fft_length, int32_t* input,
+                     Complex<int32_t>* output);
+
+// IRFFT with the same scaling as IrfftInt16Apply/IrfftInt32Apply. `input`
+// holds `fft_length` / 2 + 1 elements and is used as DSP work memory.
+bool UptDspIrfftApply(int32_t fft_length, Complex<int16_t>* input,
+                      int16_t* output);
+bool UptDspIrfftApply(int32_t fft_length, Complex<int32_t>* input,
+                      int32_t* output);
+
+// Types the DSP does not handle.
+template <typename T>
+bool UptDspRfftApply(int32_t, T*, Complex<T>*) {
+  return false;
+}
+template <typename T>
+bool UptDspIrfftApply(int32_t, Complex<T>*, T*) {
+  return false;
+}
+
+}  // namespace tflm_signal
+}  // namespace tflite
+
+#endif  // SIGNAL_SRC_UPT_DSP_H_
@@ -236,9 +236,11 @@ TfLiteStatus PopulateConvolutionQuantizationParams(
  TF_LITE_ENSURE(context, affine_quantization->scale);
  const bool is_per_channel = affine_quantization->scale->size > 1;
  if (is_per_channel) {
-   //  Currently only Int8/Int16 is supported for per channel quantization.
-   TF_LITE_ENSURE(context,
-                  input->type == kTfLiteInt8 || input->type == kTfLiteInt16);
+   //  Currently only Int4/Int8/Int16 is supported for per channel
+   //  quantization.
+   TF_LITE_ENSURE(context, input->type == kTfLiteInt4 ||
+                               input->type == kTfLiteInt8 ||
+                               input->type == kTfLiteInt16);
    TF_LITE_ENSURE(context,
                   filter->type == kTfLiteInt8 || filter->type == kTfLiteInt4);
    TF_LITE_ENSURE_EQ(context, affine_quantization->scale->size, num_channels);
@@ -280,8 +282,8 @@ TfLiteStatus PopulateConvolutionQuantizationParams(
    QuantizeMultiplier(real_multiplier, multiplier, &exponent);
    *shift = -exponent;
  }
- if (input->type == kTfLiteInt8 || input->type == kTfLiteUInt8 ||
-     input->type == kTfLiteInt16) {
+ if (input->type == kTfLiteInt4 || input->type == kTfLiteInt8 ||
+     input->type == kTfLiteUInt8 || input->type == kTfLiteInt16) {
    TF_LITE_ENSURE_STATUS(CalculateActivationRangeQuantized(
        context, activation, output, output_activation_min,
        output_activation_max));
@@ -396,6 +398,9 @@ TfLiteStatus CalculateActivationRangeQuantized(TfLiteContext* context,
  if (output->type == kTfLiteUInt8) {
    qmin = std::numeric_limits<uint8_t>::min();
    qmax = std::numeric_limits<uint8_t>::max();
+ } else if (output->type == kTfLiteInt4) {
+   qmin = -8;
+   qmax = 7;
  } else if (output->type == kTfLiteInt8) {
    qmin = std::numeric_limits<int8_t>::min();
    qmax = std::numeric_limits<int8_t>::max();
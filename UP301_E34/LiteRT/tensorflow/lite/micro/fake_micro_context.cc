@@ -64,6 +64,10 @@ void FakeMicroContext::DeallocateTempBuffer(uint8_t* buffer) {
   allocator_->DeallocateTemp(buffer);
 }
 
+size_t FakeMicroContext::GetRemainingArenaBytes() {
+  return allocator_->GetAvailableMemory(MicroArenaBufferAlignment());
+}
+
 TfLiteEvalTensor* FakeMicroContext::GetEvalTensor(int tensor_index) {
   TfLiteEvalTensor* eval_tensor =
       reinterpret_cast<TfLiteEvalTensor*>(allocator_->AllocateTemp(
@@ -49,6 +49,8 @@ class FakeMicroContext : public MicroContext {
   uint8_t* AllocateTempBuffer(size_t size, size_t alignment) override;
   void DeallocateTempBuffer(uint8_t* buffer) override;
 
+  size_t GetRemainingArenaBytes() override;
+
   TfLiteEvalTensor* GetEvalTensor(int tensor_index) override;
 
   TfLiteStatus set_external_context(void* external_context_payload) override;
@@ -61,6 +61,22 @@ uint32_t NumSubgraphOperators(const Model* model, int subgraph_idx) {
   return NumSubgraphOperators(subgraph);
 }
 
+bool IsSubgraphInputOrOutput(const SubGraph* subgraph, int tensor_index) {
+  for (size_t i = 0;
+       subgraph->inputs() != nullptr && i < subgraph->inputs()->size(); ++i) {
+    if (subgraph->inputs()->Get(i) == tensor_index) {
+      return true;
+    }
+  }
+  for (size_t i = 0;
+       subgraph->outputs() != nullptr && i < subgraph->outputs()->size(); ++i) {
+    if (subgraph->outputs()->Get(i) == tensor_index) {
+      return true;
+    }
+  }
+  return false;
+}
+
 TfLiteIntArray* FlatBufferVectorToTfLiteTypeArray(
     const flatbuffers::Vector<int32_t>* flatbuffer_array) {
   // On little-endian machines, TfLiteIntArray happens to have the same memory
@@ -52,6 +52,9 @@ class FlexbufferWrapper : public flexbuffers::Vector {
 uint32_t NumSubgraphOperators(const SubGraph* subgraph);
 uint32_t NumSubgraphOperators(const Model* model, int subgraph_idx);
 
+// Returns true if tensor_index is one of the inputs or outputs of subgraph.
+bool IsSubgraphInputOrOutput(const SubGraph* subgraph, int tensor_index);
+
 // Converts a flatbuffer array to a TfLiteArray.
 // TODO(b/188459715): These function convert a const input to a non-const via a
 // const_cast. It is unclear exactly why this is required.
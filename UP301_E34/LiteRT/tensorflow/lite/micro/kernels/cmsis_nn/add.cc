@@ -18,8 +18,6 @@ limitations under the License.
 #include "Include/arm_nnfunctions.h"
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/kernels/internal/quantization_util.h"
-#include "tensorflow/lite/kernels/internal/reference/integer_ops/add.h"
-#include "tensorflow/lite/kernels/internal/reference/process_broadcast_shapes.h"
 #include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/kernels/op_macros.h"
@@ -59,8 +57,19 @@ struct OpData {
   // Used only for float evals:
   float output_activation_min_f32;
   float output_activation_max_f32;
+
+  // Shapes extended to 4D, used by the quantized broadcast kernels
+  cmsis_nn_dims input1_dims;
+  cmsis_nn_dims input2_dims;
+  cmsis_nn_dims output_dims;
 };
 
+cmsis_nn_dims ExtendedDims(const TfLiteTensor* tensor) {
+  const RuntimeShape shape =
+      RuntimeShape::ExtendedShape(4, GetTensorShape(tensor));
+  return {shape.Dims(0), shape.Dims(1), shape.Dims(2), shape.Dims(3)};
+}
+
 TfLiteStatus CalculateOpData(TfLiteContext* context, TfLiteAddParams* params,
                              const TfLiteTensor* input1,
                              const TfLiteTensor* input2, TfLiteTensor* output,
@@ -96,6 +105,13 @@ TfLiteStatus CalculateOpData(TfLiteContext* context, TfLiteAddParams* params,
     TF_LITE_ENSURE_STATUS(CalculateActivationRangeQuantized(
         context, params->activation, output, &data->output_activation_min,
         &data->output_activation_max));
+
+    if (data->requires_broadcast) {
+      TF_LITE_ENSURE(context, NumDimensions(output) <= 4);
+      data->input1_dims = ExtendedDims(input1);
+      data->input2_dims = ExtendedDims(input2);
+      data->output_dims = ExtendedDims(output);
+    }
   } else if (output->type == kTfLiteFloat32) {
     CalculateActivationRange(params->activation,
                              &data->output_activation_min_f32,
@@ -129,18 +145,21 @@ TfLiteStatus EvalAddQuantizedInt8(TfLiteContext* context, TfLiteNode* node,
   tflite::ArithmeticParams op_params;
   UpdateOpParams(&op_params, data);
 
-  bool need_broadcast = reference_ops::ProcessBroadcastShapes(
-      tflite::micro::GetTensorShape(input1),
-      tflite::micro::GetTensorShape(input2), &op_params);
-
-  if (need_broadcast) {
-    reference_integer_ops::BroadcastAdd4DSlow(
-        op_params, tflite::micro::GetTensorShape(input1),
-        tflite::micro::GetTensorData<int8_t>(input1),
-        tflite::micro::GetTensorShape(input2),
-        tflite::micro::GetTensorData<int8_t>(input2),
-        tflite::micro::GetTensorShape(output),
-        tflite::micro::GetTensorData<int8_t>(output));
+  if (data->requires_broadcast) {
+    TF_LITE_ENSURE_EQ(
+        context,
+        arm_elementwise_add_broadcast_s8(
+            tflite::micro::GetTensorData<int8_t>(input1), &data->input1_dims,
+            tflite::micro::GetTensorData<int8_t>(input2), &data->input2_dims,
+            op_params.input1_offset, op_params.input1_multiplier,
+            op_params.input1_shift, op_params.input2_offset,
+            op_params.input2_multiplier, op_params.input2_shift,
+            op_params.left_shift, tflite::micro::GetTensorData<int8_t>(output),
+            &data->output_dims, op_params.output_offset,
+            op_params.output_multiplier, op_params.output_shift,
+            op_params.quantized_activation_min,
+            op_params.quantized_activation_max),
+        ARM_CMSIS_NN_SUCCESS);
   } else {
     arm_elementwise_add_s8(
         tflite::micro::GetTensorData<int8_t>(input1),
@@ -168,18 +187,21 @@ TfLiteStatus EvalAddQuantizedInt16(TfLiteContext* context, TfLiteNode* node,
   tflite::ArithmeticParams op_params;
   UpdateOpParams(&op_params, data);
 
-  bool need_broadcast = reference_ops::ProcessBroadcastShapes(
-      tflite::micro::GetTensorShape(input1),
-      tflite::micro::GetTensorShape(input2), &op_params);
-
-  if (need_broadcast) {
-    reference_ops::BroadcastAdd4DSlow(
-        op_params, tflite::micro::GetTensorShape(input1),
-        tflite::micro::GetTensorData<int16_t>(input1),
-        tflite::micro::GetTensorShape(input2),
-        tflite::micro::GetTensorData<int16_t>(input2),
-        tflite::micro::GetTensorShape(output),
-        tflite::micro::GetTensorData<int16_t>(output));
+  if (data->requires_broadcast) {
+    TF_LITE_ENSURE_EQ(
+        context,
+        arm_elementwise_add_broadcast_s16(
+            tflite::micro::GetTensorData<int16_t>(input1), &data->input1_dims,
+            tflite::micro::GetTensorData<int16_t>(input2), &data->input2_dims,
+            op_params.input1_offset, op_params.input1_multiplier,
+            op_params.input1_shift, op_params.input2_offset,
+            op_params.input2_multiplier, op_params.input2_shift,
+            op_params.left_shift, tflite::micro::GetTensorData<int16_t>(output),
+            &data->output_dims, op_params.output_offset,
+            op_params.output_multiplier, op_params.output_shift,
+            op_params.quantized_activation_min,
+            op_params.quantized_activation_max),
+        ARM_CMSIS_NN_SUCCESS);
   } else {
     arm_elementwise_add_s16(
         tflite::micro::GetTensorData<int16_t>(input1),
@@ -261,12 +283,15 @@ TfLiteStatus EvalAddQuantized(TfLiteContext* context, TfLiteNode* node,
                               TfLiteEvalTensor* output) {
   switch (output->type) {
     case kTfLiteInt8: {
-      EvalAddQuantizedInt8(context, node, params, data, input1, input2, output);
+      TF_LITE_ENSURE_OK(context,
+                        EvalAddQuantizedInt8(context, node, params, data,
+                                             input1, input2, output));
       break;
     }
     case kTfLiteInt16: {
-      EvalAddQuantizedInt16(context, node, params, data, input1, input2,
-                            output);
+      TF_LITE_ENSURE_OK(context,
+                        EvalAddQuantizedInt16(context, node, params, data,
+                                              input1, input2, output));
       break;
     }
     default:
@@ -30,13 +30,46 @@ limitations under the License.
 namespace tflite {
 namespace {
 
+// Largest Winograd-transformed filter (bytes of persistent arena) a single
+// conv node may allocate. The transformed filter is 16/9 the element count of
+// the original and twice the width, so larger layers keep the regular kernel.
+#ifndef CMSIS_NN_WINOGRAD_MAX_FILTER_BYTES
+#define CMSIS_NN_WINOGRAD_MAX_FILTER_BYTES (32 * 1024)
+#endif
+
+// Largest scratch buffer (bytes) a single conv node may request. Layers whose
+// kernel needs more, or more than is left of the arena when the node is
+// prepared, run the implicit GEMM kernels, which read the input in place and
+// need no scratch at the cost of some speed. The arena check alone only
+// catches buffers that could never fit, so set this for builds where the
+// tensors and the scratch buffers compete for a tight arena.
+#ifndef CMSIS_NN_CONV_MAX_SCRATCH_BYTES
+#define CMSIS_NN_CONV_MAX_SCRATCH_BYTES INT32_MAX
+#endif
+
 struct OpData {
   OpDataConv reference_op_data;
 
   // Index to buffer for optimizations if applicable.
   int buffer_idx;
+
+  // Filter transformed for arm_convolve_winograd_s8, or nullptr if the
+  // layer runs through arm_convolve_wrapper_s8.
+  const int16_t* winograd_filter;
+
+  // Run arm_convolve_implicit_[type] without scratch, see
+  // CMSIS_NN_CONV_MAX_SCRATCH_BYTES.
+  bool use_implicit;
 };
 
+// Returns true if a scratch buffer of `bytes` is allowed by
+// CMSIS_NN_CONV_MAX_SCRATCH_BYTES and can fit in the remaining arena.
+bool ScratchFits(TfLiteContext* context, int32_t bytes) {
+  return bytes <= CMSIS_NN_CONV_MAX_SCRATCH_BYTES &&
+         static_cast<size_t>(bytes) <=
+             GetMicroContext(context)->GetRemainingArenaBytes();
+}
+
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
   TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
   return context->AllocatePersistentBuffer(context, sizeof(OpData));
@@ -70,13 +103,14 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   TF_LITE_ENSURE_MSG(context,
                      input->type == kTfLiteFloat32 ||
                          input->type == kTfLiteInt16 ||
-                         input->type == kTfLiteInt8,
+                         input->type == kTfLiteInt8 ||
+                         input->type == kTfLiteInt4,
                      "Input data type not supported");
   TF_LITE_ENSURE_MSG(
       context,
       (input->type == kTfLiteFloat32 && filter->type == kTfLiteFloat32) ||
           (input->type == kTfLiteInt16 && filter->type == kTfLiteInt8) ||
-          (input->type == kTfLiteInt8 &&
+          ((input->type == kTfLiteInt8 || input->type == kTfLiteInt4) &&
            (filter->type == kTfLiteInt4 || filter->type == kTfLiteInt8)),
       "Hybrid models are not supported on TFLite Micro.");
 
@@ -119,7 +153,8 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   output_dims.w = output->dims->data[2];
   output_dims.c = output->dims->data[3];
 
-  if (input->type == kTfLiteInt8 || input->type == kTfLiteInt16) {
+  if (input->type == kTfLiteInt4 || input->type == kTfLiteInt8 ||
+      input->type == kTfLiteInt16) {
     const int num_channels = filter->dims->data[kConvQuantizedDimension];
     data->reference_op_data.per_channel_output_multiplier =
         static_cast<int32_t*>(context->AllocatePersistentBuffer(
@@ -134,8 +169,11 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
       filter_dims.h, output_dims.w, output_dims.h, input->type,
       &data->reference_op_data));
 
+  data->winograd_filter = nullptr;
+  data->use_implicit = false;
+
   // CMSIS_NN allows INT64 or nullptr bias data pointer
-  if (input->type == kTfLiteInt8 ||
+  if (input->type == kTfLiteInt4 || input->type == kTfLiteInt8 ||
       (input->type == kTfLiteInt16 &&
        (bias_type == kTfLiteInt64 || bias_type == kTfLiteNoType))) {
     // Initialize cmsis_nn convolution parameters
@@ -152,13 +190,54 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
     conv_params.activation.max = data->reference_op_data.output_activation_max;
 
     if (input->type == kTfLiteInt8) {
-      buf_size = arm_convolve_wrapper_s8_get_buffer_size(
-          &conv_params, &input_dims, &filter_dims, &output_dims);
+      // 3x3 stride 1 layers with constant int8 weights use Winograd
+      // F(2x2,3x3) when the transformed filter fits the arena budget.
+      const int32_t winograd_filter_size =
+          (filter->type == kTfLiteInt8 && IsConstantTensor(filter))
+              ? arm_convolve_winograd_s8_get_filter_size(
+                    &conv_params, &input_dims, &filter_dims, &output_dims)
+              : 0;
+      if (winograd_filter_size > 0 &&
+          winograd_filter_size <= CMSIS_NN_WINOGRAD_MAX_FILTER_BYTES &&
+          ScratchFits(context,
+                      arm_convolve_winograd_s8_get_buffer_size(&input_dims))) {
+        int16_t* winograd_filter =
+            static_cast<int16_t*>(context->AllocatePersistentBuffer(
+                context, winograd_filter_size));
+        if (winograd_filter != nullptr &&
+            arm_convolve_winograd_s8_transform_filter(
+                &filter_dims, &output_dims, GetTensorData<int8_t>(filter),
+                winograd_filter) == ARM_CMSIS_NN_SUCCESS) {
+          data->winograd_filter = winograd_filter;
+        }
+      }
+
+      if (data->winograd_filter != nullptr) {
+        buf_size = arm_convolve_winograd_s8_get_buffer_size(&input_dims);
+      } else {
+        buf_size = arm_convolve_wrapper_s8_get_buffer_size(
+            &conv_params, &input_dims, &filter_dims, &output_dims);
+      }
     } else if (input->type == kTfLiteInt16) {
       TF_LITE_ENSURE_EQ(context, input->params.zero_point, 0);
       TF_LITE_ENSURE_EQ(context, output->params.zero_point, 0);
       buf_size = arm_convolve_wrapper_s16_get_buffer_size(
           &conv_params, &input_dims, &filter_dims, &output_dims);
+    } else if (input->type == kTfLiteInt4) {
+      // Packed int4 activations are unpacked a few output pixels at a time
+      // into the im2col scratch buffer.
+      buf_size = filter->type == kTfLiteInt4
+                     ? arm_convolve_s4_s4_get_buffer_size(
+                           &input_dims, &filter_dims, &output_dims)
+                     : arm_convolve_s4_s8_get_buffer_size(
+                           &input_dims, &filter_dims, &output_dims);
+    }
+
+    data->use_implicit = input->type != kTfLiteInt4 &&
+                         filter->type != kTfLiteInt4 &&
+                         !ScratchFits(context, buf_size);
+    if (data->use_implicit) {
+      buf_size = 0;
     }
 
     if (buf_size > 0) {
@@ -241,6 +320,104 @@ arm_cmsis_nn_status convolve_wrapper(
                                   &bias_data, output_dims, output);
 }
 
+arm_cmsis_nn_status convolve_int4_activations_wrapper(
+    const cmsis_nn_context* ctx, const cmsis_nn_conv_params* conv_params,
+    const cmsis_nn_per_channel_quant_params* quant_params,
+    const cmsis_nn_dims* input_dims, const int8_t* input,
+    const cmsis_nn_dims* filter_dims, const int8_t* filter,
+    const cmsis_nn_dims* bias_dims, const int32_t* bias,
+    const cmsis_nn_dims* output_dims, int8_t* output, TfLiteType weightsT) {
+  if (weightsT == kTfLiteInt8) {
+    return arm_convolve_s4_s8(ctx, conv_params, quant_params, input_dims,
+                              input, filter_dims, filter, bias_dims, bias,
+                              output_dims, output);
+  } else if (weightsT == kTfLiteInt4) {
+    return arm_convolve_s4_s4(ctx, conv_params, quant_params, input_dims,
+                              input, filter_dims, filter, bias_dims, bias,
+                              output_dims, output);
+  } else {
+    return ARM_CMSIS_NN_ARG_ERROR;
+  }
+}
+
+template <class ActType, class BiasType>
+arm_cmsis_nn_status winograd_wrapper(
+    const cmsis_nn_context* ctx, const cmsis_nn_conv_params* conv_params,
+    const cmsis_nn_per_channel_quant_params* quant_params,
+    const cmsis_nn_dims* input_dims, const ActType* input,
+    const cmsis_nn_dims* filter_dims, const int16_t* winograd_filter,
+    const cmsis_nn_dims* bias_dims, const BiasType* bias,
+    const cmsis_nn_dims* output_dims, ActType* output) {
+  return ARM_CMSIS_NN_ARG_ERROR;
+}
+
+template <>
+arm_cmsis_nn_status winograd_wrapper(
+    const cmsis_nn_context* ctx, const cmsis_nn_conv_params* conv_params,
+    const cmsis_nn_per_channel_quant_params* quant_params,
+    const cmsis_nn_dims* input_dims, const int8_t* input,
+    const cmsis_nn_dims* filter_dims, const int16_t* winograd_filter,
+    const cmsis_nn_dims* bias_dims, const int32_t* bias,
+    const cmsis_nn_dims* output_dims, int8_t* output) {
+  return arm_convolve_winograd_s8(ctx, conv_params, quant_params, input_dims,
+                                  input, filter_dims, winograd_filter,
+                                  bias_dims, bias, output_dims, output);
+}
+
+template <class ActType, class BiasType>
+arm_cmsis_nn_status implicit_wrapper(
+    const cmsis_nn_context* ctx, const cmsis_nn_conv_params* conv_params,
+    const cmsis_nn_per_channel_quant_params* quant_params,
+    const cmsis_nn_dims* input_dims, const ActType* input,
+    const cmsis_nn_dims* filter_dims, const int8_t* filter,
+    const cmsis_nn_dims* bias_dims, const BiasType* bias,
+    const cmsis_nn_dims* output_dims, ActType* output) {
+  return ARM_CMSIS_NN_ARG_ERROR;
+}
+
+template <>
+arm_cmsis_nn_status implicit_wrapper(
+    const cmsis_nn_context* ctx, const cmsis_nn_conv_params* conv_params,
+    const cmsis_nn_per_channel_quant_params* quant_params,
+    const cmsis_nn_dims* input_dims, const int8_t* input,
+    const cmsis_nn_dims* filter_dims, const int8_t* filter,
+    const cmsis_nn_dims* bias_dims, const int32_t* bias,
+    const cmsis_nn_dims* output_dims, int8_t* output) {
+  return arm_convolve_implicit_s8(ctx, conv_params, quant_params, input_dims,
+                                  input, filter_dims, filter, bias_dims, bias,
+                                  output_dims, output);
+}
+
+template <>
+arm_cmsis_nn_status implicit_wrapper(
+    const cmsis_nn_context* ctx, const cmsis_nn_conv_params* conv_params,
+    const cmsis_nn_per_channel_quant_params* quant_params,
+    const cmsis_nn_dims* input_dims, const int16_t* input,
+    const cmsis_nn_dims* filter_dims, const int8_t* filter,
+    const cmsis_nn_dims* bias_dims, const int64_t* bias,
+    const cmsis_nn_dims* output_dims, int16_t* output) {
+  const cmsis_nn_bias_data bias_data = {bias, false};
+
+  return arm_convolve_implicit_s16(ctx, conv_params, quant_params, input_dims,
+                                   input, filter_dims, filter, bias_dims,
+                                   &bias_data, output_dims, output);
+}
+
+template <>
+arm_cmsis_nn_status implicit_wrapper(
+    const cmsis_nn_context* ctx, const cmsis_nn_conv_params* conv_params,
+    const cmsis_nn_per_channel_quant_params* quant_params,
+    const cmsis_nn_dims* input_dims, const int16_t* input,
+    const cmsis_nn_dims* filter_dims, const int8_t* filter,
+    const cmsis_nn_dims* bias_dims, const int32_t* bias,
+    const cmsis_nn_dims* output_dims, int16_t* output) {
+  const cmsis_nn_bias_data bias_data = {bias, true};
+
+  return arm_convolve_implicit_s16(ctx, conv_params, quant_params, input_dims,
+                                   input, filter_dims, filter, bias_dims,
+                                   &bias_data, output_dims, output);
+}
+
 template <typename ActType, typename BiasType, TfLiteType type>
 TfLiteStatus EvalQuantizedPerChannel(TfLiteContext* context, TfLiteNode* node,
                                      const TfLiteConvParams& params,
@@ -308,6 +485,42 @@ TfLiteStatus EvalQuantizedPerChannel(TfLiteContext* context, TfLiteNode* node,
     // the corresponding arm_convolve_wrapper_[type]_get_buffer_size
   }
 
+  if (input->type == kTfLiteInt4) {
+    TFLITE_DCHECK_EQ(
+        convolve_int4_activations_wrapper(
+            &ctx, &conv_params, &quant_params, &input_dims,
+            tflite::micro::GetTensorData<int8_t>(input), &filter_dims,
+            tflite::micro::GetTensorData<int8_t>(filter), &bias_dims,
+            tflite::micro::GetOptionalTensorData<int32_t>(bias), &output_dims,
+            tflite::micro::GetTensorData<int8_t>(output), filter->type),
+        ARM_CMSIS_NN_SUCCESS);
+    return kTfLiteOk;
+  }
+
+  if (type != kTfLiteInt4 && data.use_implicit) {
+    TFLITE_DCHECK_EQ(
+        implicit_wrapper(
+            &ctx, &conv_params, &quant_params, &input_dims,
+            tflite::micro::GetTensorData<ActType>(input), &filter_dims,
+            tflite::micro::GetTensorData<int8_t>(filter), &bias_dims,
+            tflite::micro::GetOptionalTensorData<BiasType>(bias), &output_dims,
+            tflite::micro::GetTensorData<ActType>(output)),
+        ARM_CMSIS_NN_SUCCESS);
+    return kTfLiteOk;
+  }
+
+  if (type == kTfLiteInt8 && data.winograd_filter != nullptr) {
+    TFLITE_DCHECK_EQ(
+        winograd_wrapper(
+            &ctx, &conv_params, &quant_params, &input_dims,
+            tflite::micro::GetTensorData<ActType>(input), &filter_dims,
+            data.winograd_filter, &bias_dims,
+            tflite::micro::GetOptionalTensorData<BiasType>(bias), &output_dims,
+            tflite::micro::GetTensorData<ActType>(output)),
+        ARM_CMSIS_NN_SUCCESS);
+    return kTfLiteOk;
+  }
+
   // arm_convolve_wrapper_[type] dispatches the optimized kernel accordingly
   // with the parameters passed
   TFLITE_DCHECK_EQ(
@@ -420,7 +633,8 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
       context,
       input->type == filter->type ||
           (input->type == kTfLiteInt16 && filter->type == kTfLiteInt8) ||
-          (input->type == kTfLiteInt8 && filter->type == kTfLiteInt4),
+          (input->type == kTfLiteInt8 && filter->type == kTfLiteInt4) ||
+          (input->type == kTfLiteInt4 && filter->type == kTfLiteInt8),
       "Hybrid models are not supported on TFLite Micro.");
 
   switch (input->type) {  // Already know in/out types are same.
@@ -456,6 +670,11 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
       }
       break;
     }
+    case kTfLiteInt4: {
+      // Packed int4 activations with int4 or int8 weights.
+      return EvalQuantizedPerChannel<int8_t, int32_t, kTfLiteInt4>(
+          context, node, params, data, input, filter, bias, output);
+    }
     case kTfLiteInt16: {
       if (bias == nullptr || bias->type == kTfLiteInt32) {
         return EvalQuantizedPerChannel<int16_t, int32_t, kTfLiteInt16>(
@@ -170,6 +170,8 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
     cmsis_nn_dw_conv_params dw_conv_params;
     dw_conv_params.padding.h = data->reference_op_data.padding.height;
     dw_conv_params.padding.w = data->reference_op_data.padding.width;
+    dw_conv_params.stride.h = params.stride_height;
+    dw_conv_params.stride.w = params.stride_width;
     dw_conv_params.dilation.h = params.dilation_height_factor;
     dw_conv_params.dilation.w = params.dilation_width_factor;
 
@@ -41,6 +41,10 @@ struct OpData {
 
   int32_t* kernel_sums;
 
+  // Filter buffer was packed offline by arm_fully_connected_pack_weights_s8,
+  // with the kernel sums and bias folded in.
+  bool packed_weights;
+
   int32_t batches;
   int32_t accum_depth;
   int32_t output_depth;
@@ -76,13 +80,14 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   TF_LITE_ENSURE_MSG(context,
                      input->type == kTfLiteFloat32 ||
                          input->type == kTfLiteInt16 ||
-                         input->type == kTfLiteInt8,
+                         input->type == kTfLiteInt8 ||
+                         input->type == kTfLiteInt4,
                      "Input data type not supported");
   TF_LITE_ENSURE_MSG(
       context,
       (input->type == kTfLiteFloat32 && filter->type == kTfLiteFloat32) ||
           (input->type == kTfLiteInt16 && filter->type == kTfLiteInt8) ||
-          (input->type == kTfLiteInt8 &&
+          ((input->type == kTfLiteInt8 || input->type == kTfLiteInt4) &&
            (filter->type == kTfLiteInt4 || filter->type == kTfLiteInt8)),
       "Hybrid models are not supported on TFLite Micro.");
 
@@ -120,10 +125,27 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
 
   int32_t buf_size = 0;
 
-  if (input->type == kTfLiteInt16) {
+  data->packed_weights =
+      input->type == kTfLiteInt8 && filter->type == kTfLiteInt8 &&
+      IsConstantTensor(filter) &&
+      arm_fully_connected_s8_is_packed(&filter_dims,
+                                       GetTensorData<int8_t>(filter));
+  if (data->packed_weights) {
+    // The packed weights carry their kernel sums, no scratch buffer needed.
+    TF_LITE_ENSURE_MSG(
+        context,
+        reinterpret_cast<uintptr_t>(filter->data.raw) % sizeof(int32_t) == 0,
+        "Packed fully connected weights must be 4 byte aligned");
+  } else if (input->type == kTfLiteInt16) {
     TF_LITE_ENSURE_EQ(context, input->params.zero_point, 0);
     TF_LITE_ENSURE_EQ(context, output->params.zero_point, 0);
     buf_size = arm_fully_connected_s16_get_buffer_size(&filter_dims);
+  } else if (input->type == kTfLiteInt4) {
+    // Packed int4 activations are unpacked one batch at a time into the
+    // scratch buffer, so the activation tensors keep half the arena size.
+    buf_size = filter->type == kTfLiteInt4
+                   ? arm_fully_connected_s4_s4_get_buffer_size(&filter_dims)
+                   : arm_fully_connected_s4_s8_get_buffer_size(&filter_dims);
   } else if (input->type == kTfLiteInt8 && filter->type != kTfLiteInt4) {
     const bool is_conv_1x1_possible =
         output_dim_count > 2 && data->accum_depth % 4 == 0;
@@ -264,6 +286,47 @@ TfLiteStatus EvalQuantizedInt4(TfLiteContext* context, TfLiteNode* node,
   return kTfLiteOk;
 }
 
+TfLiteStatus EvalQuantizedInt4Activations(TfLiteContext* context,
+                                          TfLiteNode* node, const OpData& data,
+                                          const TfLiteEvalTensor* input,
+                                          const TfLiteEvalTensor* filter,
+                                          const TfLiteEvalTensor* bias,
+                                          TfLiteEvalTensor* output) {
+  cmsis_nn_per_tensor_quant_params quant_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims bias_dims;
+  cmsis_nn_dims output_dims;
+  cmsis_nn_context ctx;
+
+  PopulateCommonParams(context, &quant_params, &input_dims, &filter_dims,
+                       &bias_dims, &output_dims, &ctx, data);
+
+  const int32_t* bias_data =
+      tflite::micro::GetOptionalTensorData<int32_t>(bias);
+
+  cmsis_nn_fc_params fc_params;
+  fc_params.input_offset = -data.reference_op_data.input_zero_point;
+  fc_params.output_offset = data.reference_op_data.output_zero_point;
+  fc_params.filter_offset = -data.reference_op_data.filter_zero_point;
+  fc_params.activation.min = data.reference_op_data.output_activation_min;
+  fc_params.activation.max = data.reference_op_data.output_activation_max;
+
+  const auto fully_connected = filter->type == kTfLiteInt4
+                                   ? arm_fully_connected_s4_s4
+                                   : arm_fully_connected_s4_s8;
+  TF_LITE_ENSURE_EQ(
+      context,
+      fully_connected(&ctx, &fc_params, &quant_params, &input_dims,
+                      tflite::micro::GetTensorData<int8_t>(input), &filter_dims,
+                      tflite::micro::GetTensorData<int8_t>(filter), &bias_dims,
+                      bias_data, &output_dims,
+                      tflite::micro::GetTensorData<int8_t>(output)),
+      ARM_CMSIS_NN_SUCCESS);
+
+  return kTfLiteOk;
+}
+
 TfLiteStatus EvalQuantizedInt8(TfLiteContext* context, TfLiteNode* node,
                                const OpData& data,
                                const TfLiteEvalTensor* input,
@@ -286,7 +349,34 @@ TfLiteStatus EvalQuantizedInt8(TfLiteContext* context, TfLiteNode* node,
   const int32_t* bias_data =
       tflite::micro::GetOptionalTensorData<int32_t>(bias);
 
-  if (output_dim_count > 2 && data.accum_depth % 4 == 0) {
+  if (data.packed_weights) {
+    cmsis_nn_fc_params fc_params;
+    fc_params.input_offset = -data.reference_op_data.input_zero_point;
+    fc_params.filter_offset = 0;
+    fc_params.output_offset = data.reference_op_data.output_zero_point;
+    fc_params.activation.min = data.reference_op_data.output_activation_min;
+    fc_params.activation.max = data.reference_op_data.output_activation_max;
+
+    cmsis_nn_quant_params quant_params;
+    quant_params.is_per_channel = data.reference_op_data.is_per_channel;
+    if (quant_params.is_per_channel) {
+      quant_params.multiplier =
+          data.reference_op_data.per_channel_output_multiplier;
+      quant_params.shift = data.reference_op_data.per_channel_output_shift;
+    } else {
+      quant_params.multiplier = &per_tensor_quant_params.multiplier;
+      quant_params.shift = &per_tensor_quant_params.shift;
+    }
+
+    TF_LITE_ENSURE_EQ(
+        context,
+        arm_fully_connected_packed_s8(
+            &fc_params, &quant_params, &input_dims,
+            tflite::micro::GetTensorData<int8_t>(input), &filter_dims,
+            tflite::micro::GetTensorData<int8_t>(filter), &output_dims,
+            tflite::micro::GetTensorData<int8_t>(output)),
+        ARM_CMSIS_NN_SUCCESS);
+  } else if (output_dim_count > 2 && data.accum_depth % 4 == 0) {
     cmsis_nn_conv_params conv_params;
     conv_params.dilation.h = 1;
     conv_params.dilation.w = 1;
@@ -459,6 +549,10 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
       return EvalQuantizedInt16(context, node, data, input, filter, bias,
                                 output);
     }
+    case kTfLiteInt4: {
+      return EvalQuantizedInt4Activations(context, node, data, input, filter,
+                                          bias, output);
+    }
     default: {
       MicroPrintf("Type %s (%d) not supported.", TfLiteTypeGetName(input->type),
                   input->type);
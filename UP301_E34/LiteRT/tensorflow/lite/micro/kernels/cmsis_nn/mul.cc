@@ -17,8 +17,6 @@ limitations under the License.
 
 #include "Include/arm_nnfunctions.h"
 #include "tensorflow/lite/kernels/internal/quantization_util.h"
-#include "tensorflow/lite/kernels/internal/reference/integer_ops/mul.h"
-#include "tensorflow/lite/kernels/internal/reference/process_broadcast_shapes.h"
 #include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
@@ -29,43 +27,60 @@ limitations under the License.
 namespace tflite {
 namespace {
 
-void EvalQuantized(TfLiteContext* context, TfLiteNode* node,
-                   const OpDataMul* data, const TfLiteEvalTensor* input1,
-                   const TfLiteEvalTensor* input2, TfLiteEvalTensor* output) {
-  tflite::ArithmeticParams op_params = {};
+struct OpData {
+  OpDataMul reference_op_data;
+
+  // Shapes extended to 4D, used by the quantized broadcast kernels
+  bool requires_broadcast;
+  cmsis_nn_dims input1_dims;
+  cmsis_nn_dims input2_dims;
+  cmsis_nn_dims output_dims;
+};
 
-  op_params.quantized_activation_min = data->output_activation_min;
-  op_params.quantized_activation_max = data->output_activation_max;
-  op_params.float_activation_max = data->output_activation_max_f32;
-  op_params.input1_offset = -data->input1_zero_point;
-  op_params.input2_offset = -data->input2_zero_point;
-  op_params.output_offset = data->output_zero_point;
-  op_params.output_multiplier = data->output_multiplier;
-  op_params.output_shift = data->output_shift;
+cmsis_nn_dims ExtendedDims(const TfLiteTensor* tensor) {
+  const RuntimeShape shape =
+      RuntimeShape::ExtendedShape(4, GetTensorShape(tensor));
+  return {shape.Dims(0), shape.Dims(1), shape.Dims(2), shape.Dims(3)};
+}
 
-  bool need_broadcast = reference_ops::ProcessBroadcastShapes(
-      tflite::micro::GetTensorShape(input1),
-      tflite::micro::GetTensorShape(input2), &op_params);
+TfLiteStatus EvalQuantized(TfLiteContext* context, TfLiteNode* node,
+                           const OpData* data, const TfLiteEvalTensor* input1,
+                           const TfLiteEvalTensor* input2,
+                           TfLiteEvalTensor* output) {
+  const OpDataMul& reference_op_data = data->reference_op_data;
+  tflite::ArithmeticParams op_params = {};
 
-  if (need_broadcast) {
+  op_params.quantized_activation_min = reference_op_data.output_activation_min;
+  op_params.quantized_activation_max = reference_op_data.output_activation_max;
+  op_params.float_activation_max = reference_op_data.output_activation_max_f32;
+  op_params.input1_offset = -reference_op_data.input1_zero_point;
+  op_params.input2_offset = -reference_op_data.input2_zero_point;
+  op_params.output_offset = reference_op_data.output_zero_point;
+  op_params.output_multiplier = reference_op_data.output_multiplier;
+  op_params.output_shift = reference_op_data.output_shift;
+
+  if (data->requires_broadcast) {
+    arm_cmsis_nn_status status = ARM_CMSIS_NN_ARG_ERROR;
     if (input1->type == kTfLiteInt8) {
-      reference_integer_ops::BroadcastMul4DSlow(
-          op_params, tflite::micro::GetTensorShape(input1),
-          tflite::micro::GetTensorData<int8_t>(input1),
-          tflite::micro::GetTensorShape(input2),
-          tflite::micro::GetTensorData<int8_t>(input2),
-          tflite::micro::GetTensorShape(output),
-          tflite::micro::GetTensorData<int8_t>(output));
+      status = arm_elementwise_mul_broadcast_s8(
+          tflite::micro::GetTensorData<int8_t>(input1), &data->input1_dims,
+          tflite::micro::GetTensorData<int8_t>(input2), &data->input2_dims,
+          op_params.input1_offset, op_params.input2_offset,
+          tflite::micro::GetTensorData<int8_t>(output), &data->output_dims,
+          op_params.output_offset, op_params.output_multiplier,
+          op_params.output_shift, op_params.quantized_activation_min,
+          op_params.quantized_activation_max);
     } else if (input1->type == kTfLiteInt16) {
-      reference_integer_ops::BroadcastMul4DSlow(
-          op_params, tflite::micro::GetTensorShape(input1),
-          tflite::micro::GetTensorData<int16_t>(input1),
-          tflite::micro::GetTensorShape(input2),
-          tflite::micro::GetTensorData<int16_t>(input2),
-          tflite::micro::GetTensorShape(output),
-          tflite::micro::GetTensorData<int16_t>(output));
+      status = arm_elementwise_mul_broadcast_s16(
+          tflite::micro::GetTensorData<int16_t>(input1), &data->input1_dims,
+          tflite::micro::GetTensorData<int16_t>(input2), &data->input2_dims,
+          op_params.input1_offset, op_params.input2_offset,
+          tflite::micro::GetTensorData<int16_t>(output), &data->output_dims,
+          op_params.output_offset, op_params.output_multiplier,
+          op_params.output_shift, op_params.quantized_activation_min,
+          op_params.quantized_activation_max);
     }
-
+    TF_LITE_ENSURE_EQ(context, status, ARM_CMSIS_NN_SUCCESS);
   } else {
     if (input1->type == kTfLiteInt8) {
       arm_elementwise_mul_s8(
@@ -92,6 +107,44 @@ void EvalQuantized(TfLiteContext* context, TfLiteNode* node,
                                tflite::micro::GetTensorShape(output)));
     }
   }
+
+  return kTfLiteOk;
+}
+
+void* Init(TfLiteContext* context, const char* buffer, size_t length) {
+  TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
+  return context->AllocatePersistentBuffer(context, sizeof(OpData));
+}
+
+TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
+  TF_LITE_ENSURE_STATUS(MulPrepare(context, node));
+
+  MicroContext* micro_context = GetMicroContext(context);
+
+  TfLiteTensor* input1 =
+      micro_context->AllocateTempInputTensor(node, kMulInput1Tensor);
+  TF_LITE_ENSURE(context, input1 != nullptr);
+  TfLiteTensor* input2 =
+      micro_context->AllocateTempInputTensor(node, kMulInput2Tensor);
+  TF_LITE_ENSURE(context, input2 != nullptr);
+  TfLiteTensor* output =
+      micro_context->AllocateTempOutputTensor(node, kMulOutputTensor);
+  TF_LITE_ENSURE(context, output != nullptr);
+
+  auto* data = static_cast<OpData*>(node->user_data);
+  data->requires_broadcast = !HaveSameShapes(input1, input2);
+  if (data->requires_broadcast &&
+      (input1->type == kTfLiteInt8 || input1->type == kTfLiteInt16)) {
+    TF_LITE_ENSURE(context, NumDimensions(output) <= 4);
+    data->input1_dims = ExtendedDims(input1);
+    data->input2_dims = ExtendedDims(input2);
+    data->output_dims = ExtendedDims(output);
+  }
+
+  micro_context->DeallocateTempTfLiteTensor(input1);
+  micro_context->DeallocateTempTfLiteTensor(input2);
+  micro_context->DeallocateTempTfLiteTensor(output);
+  return kTfLiteOk;
 }
 
 }  // namespace
@@ -101,7 +154,7 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   auto* params = reinterpret_cast<TfLiteMulParams*>(node->builtin_data);
 
   TFLITE_DCHECK(node->user_data != nullptr);
-  const OpDataMul* data = static_cast<const OpDataMul*>(node->user_data);
+  const OpData* data = static_cast<const OpData*>(node->user_data);
 
   const TfLiteEvalTensor* input1 =
       tflite::micro::GetEvalInput(context, node, kMulInput1Tensor);
@@ -112,17 +165,17 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
 
   switch (input1->type) {
     case kTfLiteInt8:
-      EvalQuantized(context, node, data, input1, input2, output);
-      break;
     case kTfLiteInt16:
-      EvalQuantized(context, node, data, input1, input2, output);
+      TF_LITE_ENSURE_OK(
+          context, EvalQuantized(context, node, data, input1, input2, output));
       break;
     case kTfLiteInt32:
-      EvalMulQuantizedReference(context, node, data, input1, input2, output);
+      EvalMulQuantizedReference(context, node, &data->reference_op_data,
+                                input1, input2, output);
       break;
     case kTfLiteFloat32:
-      EvalMulFloatReference(context, node, params, data, input1, input2,
-                            output);
+      EvalMulFloatReference(context, node, params, &data->reference_op_data,
+                            input1, input2, output);
       break;
     default:
       MicroPrintf("Type %s (%d) not supported.",
@@ -137,7 +190,7 @@ TfLiteStatus EvalInt8(TfLiteContext* context, TfLiteNode* node) {
   TFLITE_DCHECK(node->builtin_data != nullptr);
   TFLITE_DCHECK(node->user_data != nullptr);
 
-  const OpDataMul* data = static_cast<const OpDataMul*>(node->user_data);
+  const OpData* data = static_cast<const OpData*>(node->user_data);
   const TfLiteEvalTensor* input1 =
       tflite::micro::GetEvalInput(context, node, kMulInput1Tensor);
   const TfLiteEvalTensor* input2 =
@@ -146,16 +199,14 @@ TfLiteStatus EvalInt8(TfLiteContext* context, TfLiteNode* node) {
       tflite::micro::GetEvalOutput(context, node, kMulOutputTensor);
   TFLITE_DCHECK(input1->type == kTfLiteInt8);
 
-  EvalQuantized(context, node, data, input1, input2, output);
-
-  return kTfLiteOk;
+  return EvalQuantized(context, node, data, input1, input2, output);
 }
 
 TfLiteStatus EvalInt16(TfLiteContext* context, TfLiteNode* node) {
   TFLITE_DCHECK(node->builtin_data != nullptr);
   TFLITE_DCHECK(node->user_data != nullptr);
 
-  const OpDataMul* data = static_cast<const OpDataMul*>(node->user_data);
+  const OpData* data = static_cast<const OpData*>(node->user_data);
   const TfLiteEvalTensor* input1 =
       tflite::micro::GetEvalInput(context, node, kMulInput1Tensor);
   const TfLiteEvalTensor* input2 =
@@ -164,21 +215,19 @@ TfLiteStatus EvalInt16(TfLiteContext* context, TfLiteNode* node) {
       tflite::micro::GetEvalOutput(context, node, kMulOutputTensor);
   TFLITE_DCHECK(input1->type == kTfLiteInt16);
 
-  EvalQuantized(context, node, data, input1, input2, output);
-
-  return kTfLiteOk;
+  return EvalQuantized(context, node, data, input1, input2, output);
 }
 
 TFLMRegistration Register_MUL() {
-  return tflite::micro::RegisterOp(MulInit, MulPrepare, Eval);
+  return tflite::micro::RegisterOp(Init, Prepare, Eval);
 }
 
 TFLMRegistration Register_MUL_INT8() {
-  return tflite::micro::RegisterOp(MulInit, MulPrepare, EvalInt8);
+  return tflite::micro::RegisterOp(Init, Prepare, EvalInt8);
 }
 
 TFLMRegistration Register_MUL_INT16() {
-  return tflite::micro::RegisterOp(MulInit, MulPrepare, EvalInt16);
+  return tflite::micro::RegisterOp(Init, Prepare, EvalInt16);
 }
 
 }  // namespace tflite
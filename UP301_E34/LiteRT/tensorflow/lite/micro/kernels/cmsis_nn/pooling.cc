@@ -14,7 +14,10 @@ limitations under the License.
 ==============================================================================*/
 #include "tensorflow/lite/kernels/internal/reference/pooling.h"
 
+#include <algorithm>
+
 #include "Include/arm_nnfunctions.h"
+#include "Include/arm_nnsupportfunctions.h"
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
@@ -32,6 +35,7 @@ struct OpData {
 
   // Index to buffer for optimizations if applicable.
   int buffer_idx;
+  int32_t buffer_size;
 };
 
 void PopulateCommonParams(
@@ -67,7 +71,37 @@ void PopulateCommonParams(
   ctx->size = 0;
   if (data.buffer_idx > -1) {
     ctx->buf = context->GetScratchBuffer(context, data.buffer_idx);
+    ctx->size = data.buffer_size;
+  }
+}
+
+// Scratch buffer size of the sliding window kernels, which arm_avgpool_s8()
+// and arm_max_pool_s8() use for large overlapping windows if ctx.size allows.
+int32_t SlidingWindowBufferSize(const TfLitePoolParams* params,
+                                const OpData& data,
+                                const RuntimeShape& input_shape,
+                                const RuntimeShape& output_shape,
+                                bool max_pool) {
+  const int depth = MatchingDim(input_shape, 3, output_shape, 3);
+  const cmsis_nn_dims input_dims = {1, input_shape.Dims(1),
+                                    input_shape.Dims(2), depth};
+  const cmsis_nn_dims output_dims = {1, output_shape.Dims(1),
+                                     output_shape.Dims(2), depth};
+  const cmsis_nn_dims filter_dims = {1, params->filter_height,
+                                     params->filter_width, 1};
+  cmsis_nn_pool_params pool_params;
+  pool_params.stride.h = params->stride_height;
+  pool_params.stride.w = params->stride_width;
+  pool_params.padding.h = data.reference_op_data.padding.height;
+  pool_params.padding.w = data.reference_op_data.padding.width;
+
+  if (!arm_nn_pool_use_sliding_window(&pool_params, &filter_dims)) {
+    return 0;
   }
+  return max_pool ? arm_max_pool_sliding_s8_get_buffer_size(
+                        &input_dims, &filter_dims, &output_dims)
+                  : arm_avgpool_sliding_s8_get_buffer_size(
+                        &input_dims, &filter_dims, &output_dims);
 }
 
 void AverageEvalQuantized(TfLiteContext* context, const TfLiteNode* node,
@@ -152,7 +186,29 @@ void* Init(TfLiteContext* context, const char* buffer, size_t length) {
 TfLiteStatus MaxPrepare(TfLiteContext* context, TfLiteNode* node) {
   TF_LITE_ENSURE_STATUS(PoolingPrepare(context, node));
   // Set buffer index to a reset value
-  static_cast<OpData*>(node->user_data)->buffer_idx = -1;
+  auto* data = static_cast<OpData*>(node->user_data);
+  data->buffer_idx = -1;
+
+  MicroContext* micro_context = GetMicroContext(context);
+
+  TfLiteTensor* input =
+      micro_context->AllocateTempInputTensor(node, kPoolingInputTensor);
+  TfLiteTensor* output =
+      micro_context->AllocateTempOutputTensor(node, kPoolingOutputTensor);
+
+  if (input->type == kTfLiteInt8) {
+    auto* params = reinterpret_cast<TfLitePoolParams*>(node->builtin_data);
+    data->buffer_size =
+        SlidingWindowBufferSize(params, *data, GetTensorShape(input),
+                                GetTensorShape(output), /*max_pool=*/true);
+    if (data->buffer_size > 0) {
+      TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+          context, data->buffer_size, &data->buffer_idx));
+    }
+  }
+
+  micro_context->DeallocateTempTfLiteTensor(output);
+  micro_context->DeallocateTempTfLiteTensor(input);
   return kTfLiteOk;
 }
 
@@ -176,12 +232,19 @@ TfLiteStatus AveragePrepare(TfLiteContext* context, TfLiteNode* node) {
     const int depth = MatchingDim(input_shape, 3, output_shape, 3);
     const int output_width = output_shape.Dims(2);
 
-    const int32_t buffer_size =
-        input->type == kTfLiteInt16
-            ? arm_avgpool_s16_get_buffer_size(output_width, depth)
-            : arm_avgpool_s8_get_buffer_size(output_width, depth);
-
     auto* data = static_cast<OpData*>(node->user_data);
+    int32_t buffer_size;
+    if (input->type == kTfLiteInt16) {
+      buffer_size = arm_avgpool_s16_get_buffer_size(output_width, depth);
+    } else {
+      auto* params = reinterpret_cast<TfLitePoolParams*>(node->builtin_data);
+      buffer_size = std::max(
+          arm_avgpool_s8_get_buffer_size(output_width, depth),
+          SlidingWindowBufferSize(params, *data, input_shape, output_shape,
+                                  /*max_pool=*/false));
+    }
+    data->buffer_size = buffer_size;
+
     if (buffer_size > 0) {
       TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
           context, buffer_size, &data->buffer_idx));
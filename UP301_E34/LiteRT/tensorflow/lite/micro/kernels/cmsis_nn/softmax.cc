@@ -33,14 +33,34 @@ struct CMSISNNSoftmaxParams {
   SoftmaxParams softmax_params;
   int32_t num_rows;
   int32_t row_size;
+  // Exponent table of the int8 input/output kernels, filled in Prepare.
+  int32_t* exp_lut_s8;
 };
 
+constexpr int kTopKScoresTensor = 0;
+constexpr int kTopKIndicesTensor = 1;
+
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
   TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
   return context->AllocatePersistentBuffer(context,
                                            sizeof(CMSISNNSoftmaxParams));
 }
 
+TfLiteStatus PrepareExpLut(TfLiteContext* context,
+                           CMSISNNSoftmaxParams* op_data) {
+  op_data->exp_lut_s8 =
+      static_cast<int32_t*>(context->AllocatePersistentBuffer(
+          context, SOFTMAX_S8_EXP_LUT_SIZE * sizeof(int32_t)));
+  TF_LITE_ENSURE(context, op_data->exp_lut_s8 != nullptr);
+  TF_LITE_ENSURE_EQ(context,
+                    arm_softmax_s8_exp_lut_init(
+                        op_data->softmax_params.input_multiplier,
+                        op_data->softmax_params.input_left_shift,
+                        op_data->softmax_params.diff_min, op_data->exp_lut_s8),
+                    ARM_CMSIS_NN_SUCCESS);
+  return kTfLiteOk;
+}
+
 TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   MicroContext* micro_context = GetMicroContext(context);
 
@@ -80,12 +100,73 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
       MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
   op_data->num_rows = outer_size;
   op_data->row_size = depth;
+  op_data->exp_lut_s8 = nullptr;
+
+  if (ret_val == kTfLiteOk && input->type == kTfLiteInt8 &&
+      output->type == kTfLiteInt8) {
+    ret_val = PrepareExpLut(context, op_data);
+  }
 
   micro_context->DeallocateTempTfLiteTensor(input);
   micro_context->DeallocateTempTfLiteTensor(output);
   return ret_val;
 }
 
+// Prepare of the top-k variant. Output 0 holds the k largest int8
+// probabilities of every row and output 1 their int32 column indices, both of
+// shape [..., k], like the outputs of TOPK_V2. The softmax parameters are
+// taken from the builtin data when present and otherwise default to beta 1.0,
+// so that the kernel can also be registered as a custom operator.
+TfLiteStatus PrepareTopK(TfLiteContext* context, TfLiteNode* node) {
+  MicroContext* micro_context = GetMicroContext(context);
+
+  TF_LITE_ENSURE_EQ(context, NumInputs(node), 1);
+  TF_LITE_ENSURE_EQ(context, NumOutputs(node), 2);
+  TfLiteTensor* input = micro_context->AllocateTempInputTensor(node, 0);
+  TF_LITE_ENSURE(context, input != nullptr);
+  TF_LITE_ENSURE(context, NumDimensions(input) >= 1);
+  TfLiteTensor* scores =
+      micro_context->AllocateTempOutputTensor(node, kTopKScoresTensor);
+  TF_LITE_ENSURE(context, scores != nullptr);
+  TfLiteTensor* indices =
+      micro_context->AllocateTempOutputTensor(node, kTopKIndicesTensor);
+  TF_LITE_ENSURE(context, indices != nullptr);
+
+  TF_LITE_ENSURE_TYPES_EQ(context, input->type, kTfLiteInt8);
+  TF_LITE_ENSURE_TYPES_EQ(context, scores->type, kTfLiteInt8);
+  TF_LITE_ENSURE_TYPES_EQ(context, indices->type, kTfLiteInt32);
+
+  TF_LITE_ENSURE(context, node->user_data != nullptr);
+  CMSISNNSoftmaxParams* op_data =
+      static_cast<CMSISNNSoftmaxParams*>(node->user_data);
+
+  TfLiteSoftmaxParams default_params = {1.0f};
+  auto* params = node->builtin_data != nullptr
+                     ? static_cast<TfLiteSoftmaxParams*>(node->builtin_data)
+                     : &default_params;
+  TF_LITE_ENSURE_STATUS(CalculateSoftmaxParams(context, input, scores, params,
+                                               &op_data->softmax_params));
+
+  const auto input_shape = GetTensorShape(input);
+  const auto scores_shape = GetTensorShape(scores);
+  const auto indices_shape = GetTensorShape(indices);
+  const int trailing_dim = input_shape.DimensionsCount() - 1;
+  op_data->num_rows =
+      MatchingFlatSizeSkipDim(input_shape, trailing_dim, scores_shape);
+  op_data->row_size = input_shape.Dims(trailing_dim);
+  TF_LITE_ENSURE(context, scores_shape == indices_shape);
+
+  const int k = scores_shape.Dims(trailing_dim);
+  TF_LITE_ENSURE(context, k >= 1 && k <= op_data->row_size);
+
+  TF_LITE_ENSURE_STATUS(PrepareExpLut(context, op_data));
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(scores);
+  micro_context->DeallocateTempTfLiteTensor(indices);
+  return kTfLiteOk;
+}
+
 TfLiteStatus SoftmaxEval(TfLiteContext* context, TfLiteNode* node) {
   const TfLiteEvalTensor* input = tflite::micro::GetEvalInput(context, node, 0);
   TfLiteEvalTensor* output = tflite::micro::GetEvalOutput(context, node, 0);
@@ -105,12 +186,10 @@ TfLiteStatus SoftmaxEval(TfLiteContext* context, TfLiteNode* node) {
     }
     case kTfLiteInt8: {
       if (output->type == kTfLiteInt8) {
-        arm_softmax_s8(tflite::micro::GetTensorData<int8_t>(input),
-                       op_data.num_rows, op_data.row_size,
-                       op_data.softmax_params.input_multiplier,
-                       op_data.softmax_params.input_left_shift,
-                       op_data.softmax_params.diff_min,
-                       tflite::micro::GetTensorData<int8_t>(output));
+        arm_softmax_lut_s8(tflite::micro::GetTensorData<int8_t>(input),
+                           op_data.num_rows, op_data.row_size,
+                           op_data.exp_lut_s8,
+                           tflite::micro::GetTensorData<int8_t>(output));
       } else {
         arm_softmax_s8_s16(tflite::micro::GetTensorData<int8_t>(input),
                            op_data.num_rows, op_data.row_size,
@@ -150,11 +229,34 @@ TfLiteStatus SoftmaxEvalInt8(TfLiteContext* context, TfLiteNode* node) {
   const CMSISNNSoftmaxParams op_data =
       *static_cast<const CMSISNNSoftmaxParams*>(node->user_data);
 
-  arm_softmax_s8(tflite::micro::GetTensorData<int8_t>(input), op_data.num_rows,
-                 op_data.row_size, op_data.softmax_params.input_multiplier,
-                 op_data.softmax_params.input_left_shift,
-                 op_data.softmax_params.diff_min,
-                 tflite::micro::GetTensorData<int8_t>(output));
+  arm_softmax_lut_s8(tflite::micro::GetTensorData<int8_t>(input),
+                     op_data.num_rows, op_data.row_size, op_data.exp_lut_s8,
+                     tflite::micro::GetTensorData<int8_t>(output));
+
+  return kTfLiteOk;
+}
+
+TfLiteStatus SoftmaxEvalInt8TopK(TfLiteContext* context, TfLiteNode* node) {
+  const TfLiteEvalTensor* input = tflite::micro::GetEvalInput(context, node, 0);
+  TfLiteEvalTensor* scores =
+      tflite::micro::GetEvalOutput(context, node, kTopKScoresTensor);
+  TfLiteEvalTensor* indices =
+      tflite::micro::GetEvalOutput(context, node, kTopKIndicesTensor);
+
+  TFLITE_DCHECK(node->user_data != nullptr);
+  const CMSISNNSoftmaxParams op_data =
+      *static_cast<const CMSISNNSoftmaxParams*>(node->user_data);
+
+  const RuntimeShape scores_shape = tflite::micro::GetTensorShape(scores);
+  const int k = scores_shape.Dims(scores_shape.DimensionsCount() - 1);
+
+  TFLITE_DCHECK_EQ(
+      arm_softmax_top_k_s8(tflite::micro::GetTensorData<int8_t>(input),
+                           op_data.num_rows, op_data.row_size,
+                           op_data.exp_lut_s8, k,
+                           tflite::micro::GetTensorData<int8_t>(scores),
+                           tflite::micro::GetTensorData<int32_t>(indices)),
+      ARM_CMSIS_NN_SUCCESS);
 
   return kTfLiteOk;
 }
@@ -209,6 +311,10 @@ TFLMRegistration Register_SOFTMAX_INT8() {
   return tflite::micro::RegisterOp(Init, Prepare, SoftmaxEvalInt8);
 }
 
+TFLMRegistration Register_SOFTMAX_INT8_TOP_K() {
+  return tflite::micro::RegisterOp(Init, PrepareTopK, SoftmaxEvalInt8TopK);
+}
+
 TFLMRegistration Register_SOFTMAX_INT8_INT16() {
   return tflite::micro::RegisterOp(Init, Prepare, SoftmaxEvalInt8_Int16);
 }
@@ -49,6 +49,10 @@ struct CmsisNnOpDataSvdf {
   int output_zero_point;
   int activation_state_zero_point;
   int32_t* kernel_sums;
+  // Oldest entry of every int8 state row. The int8 state is kept as a
+  // circular buffer by arm_svdf_circular_s8 instead of being shifted on each
+  // invoke.
+  int32_t* state_head;
 };
 
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
@@ -172,6 +176,14 @@ TfLiteStatus CmsisNnPrepareSvdf(TfLiteContext* context, TfLiteNode* node) {
     data->output_zero_point = output->params.zero_point;
     data->activation_state_zero_point = activation_state->params.zero_point;
 
+    data->state_head = nullptr;
+    if (activation_state->type == kTfLiteInt8) {
+      data->state_head = static_cast<int32_t*>(
+          context->AllocatePersistentBuffer(context, sizeof(int32_t)));
+      TF_LITE_ENSURE(context, data->state_head != nullptr);
+      *data->state_head = 0;
+    }
+
     TFLITE_DCHECK(context->RequestScratchBufferInArena != nullptr);
 
     const TfLiteStatus scratch_status = context->RequestScratchBufferInArena(
@@ -322,12 +334,12 @@ TfLiteStatus EvalIntegerSVDF(TfLiteContext* context, TfLiteNode* node,
           -data.input_zero_point, -data.activation_state_zero_point, nullptr);
 #endif
 
-      arm_svdf_s8(
+      arm_svdf_circular_s8(
           &ctx, &scratch_ctx, &scratch_output_ctx, &svdf_params,
           &in_quant_params, &out_quant_params, &input_dims,
           tflite::micro::GetTensorData<int8_t>(input_tensor), &state_dims,
           tflite::micro::GetTensorData<int8_t>(activation_state_tensor),
-          &weights_feature_dims,
+          data.state_head, &weights_feature_dims,
           tflite::micro::GetTensorData<int8_t>(weights_feature_tensor),
           &weights_time_dims,
           tflite::micro::GetTensorData<int8_t>(weights_time_tensor), &bias_dims,
@@ -27,28 +27,24 @@ TfLiteStatus TransposeEvalInt8(TfLiteContext* context, TfLiteNode* node) {
   const TfLiteEvalTensor* perm_tensor =
       tflite::micro::GetEvalInput(context, node, kTransposePermTensor);
   const int size = perm_tensor->dims->data[0];
-  TF_LITE_ENSURE(context, size <= 4);
+  TF_LITE_ENSURE(context, size <= TRANSPOSE_TILED_MAX_DIMS);
   const TfLiteEvalTensor* input =
       tflite::micro::GetEvalInput(context, node, kTransposeInputTensor);
   TfLiteEvalTensor* output =
       tflite::micro::GetEvalOutput(context, node, kTransposeOutputTensor);
   const cmsis_nn_transpose_params transpose_params = {
       size, reinterpret_cast<const uint32_t*>(perm_tensor->data.i32)};
-  cmsis_nn_dims input_dims = {
-      tflite::micro::GetTensorShape(input).DimsData()[0],
-      tflite::micro::GetTensorShape(input).DimsData()[1],
-      tflite::micro::GetTensorShape(input).DimsData()[2],
-      tflite::micro::GetTensorShape(input).DimsData()[3]};
-  cmsis_nn_dims output_dims = {
-      tflite::micro::GetTensorShape(output).DimsData()[0],
-      tflite::micro::GetTensorShape(output).DimsData()[1],
-      tflite::micro::GetTensorShape(output).DimsData()[2],
-      tflite::micro::GetTensorShape(output).DimsData()[3]};
 
-  TFLITE_DCHECK_EQ(
-      arm_transpose_s8(tflite::micro::GetTensorData<int8_t>(input),
-                       tflite::micro::GetTensorData<int8_t>(output),
-                       &input_dims, &output_dims, &transpose_params),
+  // The tiled kernel takes the shape as is, so no padding to 4D is needed
+  // and 5D permutations stay on the optimized path.
+  TFLITE_DCHECK_EQ(input->dims->size, size);
+  TF_LITE_ENSURE_EQ(
+      context,
+      arm_transpose_tiled_s8(
+          tflite::micro::GetTensorData<int8_t>(input),
+          tflite::micro::GetTensorData<int8_t>(output),
+          reinterpret_cast<const int32_t*>(input->dims->data),
+          &transpose_params),
       ARM_CMSIS_NN_SUCCESS);
 
   return kTfLiteOk;
@@ -79,9 +75,8 @@ TfLiteStatus TransposeEval(TfLiteContext* context, TfLiteNode* node) {
                                tflite::micro::GetTensorShape(output),
                                tflite::micro::GetTensorData<float>(output));
       break;
-    case kTfLiteInt8: {
-      TransposeEvalInt8(context, node);
-    } break;
+    case kTfLiteInt8:
+      return TransposeEvalInt8(context, node);
     case kTfLiteInt16:
       reference_ops::Transpose(params, tflite::micro::GetTensorShape(input),
                                tflite::micro::GetTensorData<int16_t>(input),
@@ -32,6 +32,13 @@ namespace tflite {
 
 namespace {
 
+// Largest copy of the interleaved gate weights (bytes of persistent arena) a
+// single LSTM node may allocate. With the copy all four gates are computed in
+// one pass over the inputs of a step; larger layers compute gate by gate.
+#ifndef CMSIS_NN_LSTM_MAX_FUSED_WEIGHT_BYTES
+#define CMSIS_NN_LSTM_MAX_FUSED_WEIGHT_BYTES (32 * 1024)
+#endif
+
 struct OpData {
   OpDataLSTM params_ref;                 // Used for fallback implementation
   cmsis_nn_lstm_params params_cmsis_nn;  // Used for  CMSIS-NN implementation
@@ -62,6 +69,62 @@ void CMSIS_NN_VectorSum(int64_t* kernel_sum, const int32_t size1,
   arm_vector_sum_s8_s64(kernel_sum, size1, size2, weights, offset, biases);
 }
 
+arm_cmsis_nn_status CMSIS_NN_InterleaveGates(
+    const cmsis_nn_lstm_params* params, int8_t* input_weights,
+    int32_t* input_effective_bias, int8_t* hidden_weights,
+    int32_t* hidden_effective_bias, cmsis_nn_lstm_fused_gates* fused_gates) {
+  return arm_lstm_interleave_gates_s8(params, input_weights,
+                                      input_effective_bias, hidden_weights,
+                                      hidden_effective_bias, fused_gates);
+}
+
+arm_cmsis_nn_status CMSIS_NN_InterleaveGates(
+    const cmsis_nn_lstm_params* params, int8_t* input_weights,
+    int64_t* input_effective_bias, int8_t* hidden_weights,
+    int64_t* hidden_effective_bias, cmsis_nn_lstm_fused_gates* fused_gates) {
+  return arm_lstm_interleave_gates_s16(params, input_weights,
+                                       input_effective_bias, hidden_weights,
+                                       hidden_effective_bias, fused_gates);
+}
+
+template <typename BiasType>
+void CMSIS_NN_FuseGates(TfLiteContext* context,
+                        cmsis_nn_lstm_params* params_cmsis_nn) {
+  const int32_t gate_rows = 4 * params_cmsis_nn->hidden_size;
+  const size_t input_weights_size = gate_rows * params_cmsis_nn->input_size;
+  const size_t hidden_weights_size = gate_rows * params_cmsis_nn->hidden_size;
+  if (input_weights_size + hidden_weights_size >
+      CMSIS_NN_LSTM_MAX_FUSED_WEIGHT_BYTES) {
+    return;
+  }
+
+  int8_t* input_weights = static_cast<int8_t*>(
+      context->AllocatePersistentBuffer(context, input_weights_size));
+  int8_t* hidden_weights = static_cast<int8_t*>(
+      context->AllocatePersistentBuffer(context, hidden_weights_size));
+  BiasType* input_effective_bias =
+      static_cast<BiasType*>(context->AllocatePersistentBuffer(
+          context, gate_rows * sizeof(BiasType)));
+  BiasType* hidden_effective_bias =
+      static_cast<BiasType*>(context->AllocatePersistentBuffer(
+          context, gate_rows * sizeof(BiasType)));
+  cmsis_nn_lstm_fused_gates* fused_gates =
+      static_cast<cmsis_nn_lstm_fused_gates*>(context->AllocatePersistentBuffer(
+          context, sizeof(cmsis_nn_lstm_fused_gates)));
+  if (input_weights == nullptr || hidden_weights == nullptr ||
+      input_effective_bias == nullptr || hidden_effective_bias == nullptr ||
+      fused_gates == nullptr) {
+    return;
+  }
+
+  if (CMSIS_NN_InterleaveGates(params_cmsis_nn, input_weights,
+                               input_effective_bias, hidden_weights,
+                               hidden_effective_bias,
+                               fused_gates) == ARM_CMSIS_NN_SUCCESS) {
+    params_cmsis_nn->fused_gates = fused_gates;
+  }
+}
+
 template <typename BiasType>
 TfLiteStatus CMSIS_NN_PortOpData(TfLiteContext* context, OpDataLSTM* params_ref,
                                  const LSTMKernelContents& kernel_content,
@@ -264,7 +327,10 @@ TfLiteStatus CMSIS_NN_PortOpData(TfLiteContext* context, OpDataLSTM* params_ref,
       gate_forget,
       gate_input,
       gate_cell,
-      gate_output};
+      gate_output,
+      nullptr};
+
+  CMSIS_NN_FuseGates<BiasType>(context, params_cmsis_nn);
 
   return kTfLiteOk;
 }
@@ -15,6 +15,7 @@ limitations under the License.
 #include "tensorflow/lite/kernels/internal/reference/concatenation.h"
 
 #include <cstdint>
+#include <cstring>
 
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/common.h"
@@ -33,6 +34,10 @@ constexpr int kOutputTensor = 0;
 
 struct OpData {
   ConcatenationParams params;
+  // All dimensions in front of the axis are 1, so each input is a contiguous
+  // slab of the output. The memory planner may then have placed the inputs
+  // in their slabs already (see MarkConcatenationAliases).
+  bool inputs_are_slabs;
 
 #ifdef USE_TFLM_COMPRESSION
 
@@ -114,6 +119,19 @@ void EvalUnquantized(TfLiteContext* context, TfLiteNode* node) {
   TfLiteEvalTensor* output =
       tflite::micro::GetEvalOutput(context, node, kOutputTensor);
 
+  if (data->inputs_are_slabs) {
+    // Only copy the inputs that were not planned in place.
+    data_type* output_data = tflite::micro::GetTensorData<data_type>(output);
+    for (int i = 0; i < node->inputs->size; ++i) {
+      const int flat_size = inputs_shape[i].FlatSize();
+      if (inputs_data[i] != output_data) {
+        std::memcpy(output_data, inputs_data[i], flat_size * sizeof(data_type));
+      }
+      output_data += flat_size;
+    }
+    return;
+  }
+
   reference_ops::Concatenation(data->params, inputs_shape_ptr, inputs_data,
                                tflite::micro::GetTensorShape(output),
                                tflite::micro::GetTensorData<data_type>(output));
@@ -214,6 +232,11 @@ TfLiteStatus ConcatenationPrepare(TfLiteContext* context, TfLiteNode* node) {
     case kTfLiteInt64: {
       data->params.axis = CalculatePositiveAxis(params->axis, output_tensor);
       data->params.inputs_count = node->inputs->size;
+      data->inputs_are_slabs = true;
+      for (int d = 0; d < data->params.axis; ++d) {
+        data->inputs_are_slabs =
+            data->inputs_are_slabs && SizeOfDimension(output_tensor, d) == 1;
+      }
       break;
     }
     default:
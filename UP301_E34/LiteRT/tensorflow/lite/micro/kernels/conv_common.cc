@@ -97,6 +97,13 @@ TfLiteStatus CalculateOpDataConv(TfLiteContext* context, TfLiteNode* node,
 
   MicroContext* micro_context = GetMicroContext(context);
 
+  // A PAD operator folded into this node leaves its padding to the kernel.
+  const TfLitePaddingValues* folded_padding =
+      micro_context->GetFoldedPadding(node);
+  if (folded_padding != nullptr) {
+    data->padding = *folded_padding;
+  }
+
   TfLiteTensor* input =
       micro_context->AllocateTempInputTensor(node, kConvInputTensor);
   TF_LITE_ENSURE(context, input != nullptr);
@@ -38,6 +38,10 @@ namespace {
  * 1.) Temporaries (temporary tensors) - Micro use instead scratch buffer API.
  * 2.) Output dimensions - the TFLite version does not support undefined out
  * dimensions. So model must have static out dimensions.
+ * 3.) Int8 inputs - box encodings and class predictions are never dequantized.
+ * Candidates are rejected and ordered on the raw int8 scores and only the
+ * boxes that reach NMS are decoded, in Q16 fixed point. See
+ * NonMaxSuppressionMultiClassQuantized().
  */
 
 // Input tensors
@@ -56,6 +60,15 @@ constexpr int kBatchSize = 1;
 
 constexpr int kNumDetectionsPerClass = 100;
 
+// Quantized path: decoded coordinates are Q16, multipliers are Q24.
+constexpr int kQuantizedCoordBits = 16;
+constexpr int kQuantizedMultiplierBits = 24;
+// Score threshold that no int8 score can reach.
+constexpr int32_t kQuantizedRejectAllScores = 128;
+// NMS grid: coordinates in [0, 1) are split into 32 rows and 32 columns.
+constexpr int kGridBinShift = kQuantizedCoordBits - 5;
+constexpr int kGridMaxBin = 31;
+
 // Object Detection model produces axis-aligned boxes in two formats:
 // BoxCorner represents the lower left corner (xmin, ymin) and
 // the upper right corner (xmax, ymax).
@@ -88,6 +101,17 @@ static_assert(sizeof(BoxCornerEncoding) == sizeof(float) * kNumCoordBox,
 static_assert(sizeof(CenterSizeEncoding) == sizeof(float) * kNumCoordBox,
               "Size of CenterSizeEncoding is 4 float values");
 
+// BoxCornerEncoding in Q16 fixed point, used by the int8 path.
+struct QuantizedBoxCornerEncoding {
+  int32_t ymin;
+  int32_t xmin;
+  int32_t ymax;
+  int32_t xmax;
+};
+static_assert(sizeof(QuantizedBoxCornerEncoding) ==
+                  sizeof(int32_t) * kNumCoordBox,
+              "Size of QuantizedBoxCornerEncoding is 4 int32 values");
+
 struct OpData {
   int max_detections;
   int max_classes_per_detection;  // Fast Non-Max-Suppression
@@ -110,11 +134,27 @@ struct OpData {
   int sorted_indices_idx;
   int buffer_idx;
   int selected_idx;
+  int selected_masks_idx;
 
   // Cached tensor scale and zero point values for quantized operations
   TfLiteQuantizationParams input_box_encodings;
   TfLiteQuantizationParams input_class_predictions;
   TfLiteQuantizationParams input_anchors;
+
+  // Int8 path, set up in PrepareQuantized()
+  bool use_quantized_path;
+  TfLiteType anchors_type;
+  // Smallest int8 score that passes non_max_suppression_score_threshold
+  int32_t quantized_score_threshold;
+  int32_t iou_threshold_q16;
+  // box_encodings scale / {y,x}_scale and anchors scale, Q24
+  int32_t center_y_multiplier;
+  int32_t center_x_multiplier;
+  int32_t anchor_multiplier;
+  // 0.5 * exp(h / h_scale) and 0.5 * exp(w / w_scale) for every int8
+  // encoding value, Q16
+  int32_t* half_h_table;
+  int32_t* half_w_table;
 };
 
 void* DetectionPostProcessInit(TfLiteContext* context, const char* buffer,
@@ -150,6 +190,108 @@ void* DetectionPostProcessInit(TfLiteContext* context, const char* buffer,
   return op_data;
 }
 
+// Converts a non-negative real multiplier to Q24.
+TfLiteStatus QuantizeMultiplierQ24(TfLiteContext* context, double multiplier,
+                                   int32_t* quantized_multiplier) {
+  const double scaled =
+      std::round(multiplier * (1 << kQuantizedMultiplierBits));
+  TF_LITE_ENSURE(context, scaled >= 0.0 && scaled <= INT32_MAX);
+  *quantized_multiplier = static_cast<int32_t>(scaled);
+  return kTfLiteOk;
+}
+
+int32_t SaturatingToQ16(double value) {
+  const double scaled = std::round(value * (1 << kQuantizedCoordBits));
+  if (scaled >= INT32_MAX) return INT32_MAX;
+  if (scaled <= INT32_MIN) return INT32_MIN;
+  return static_cast<int32_t>(scaled);
+}
+
+// Everything the int8 path needs that depends only on the quantization
+// parameters is computed here, so Eval never touches float for the
+// candidates it rejects.
+TfLiteStatus PrepareQuantized(TfLiteContext* context, OpData* op_data,
+                              int num_boxes, int num_classes) {
+  const double box_scale = op_data->input_box_encodings.scale;
+  const int box_zero_point = op_data->input_box_encodings.zero_point;
+  const float score_scale = op_data->input_class_predictions.scale;
+  const int score_zero_point = op_data->input_class_predictions.zero_point;
+  TF_LITE_ENSURE(context, box_scale > 0.0 && score_scale > 0.0f);
+
+  // Dequantization is monotonic, so the first int8 value whose float score
+  // passes the threshold is the exact integer threshold of the float path.
+  op_data->quantized_score_threshold = kQuantizedRejectAllScores;
+  for (int32_t q = INT8_MAX; q >= INT8_MIN; --q) {
+    const float score =
+        (static_cast<float>(q) - score_zero_point) * score_scale;
+    if (score < op_data->non_max_suppression_score_threshold) break;
+    op_data->quantized_score_threshold = q;
+  }
+  op_data->iou_threshold_q16 =
+      SaturatingToQ16(op_data->intersection_over_union_threshold);
+
+  const CenterSizeEncoding& scale_values = op_data->scale_values;
+  TF_LITE_ENSURE_STATUS(
+      QuantizeMultiplierQ24(context, box_scale / scale_values.y,
+                            &op_data->center_y_multiplier));
+  TF_LITE_ENSURE_STATUS(
+      QuantizeMultiplierQ24(context, box_scale / scale_values.x,
+                            &op_data->center_x_multiplier));
+  if (op_data->anchors_type == kTfLiteInt8) {
+    TF_LITE_ENSURE_STATUS(
+        QuantizeMultiplierQ24(context, op_data->input_anchors.scale,
+                              &op_data->anchor_multiplier));
+  }
+
+  constexpr int kTableSize = UINT8_MAX + 1;
+  op_data->half_h_table =
+      static_cast<int32_t*>(context->AllocatePersistentBuffer(
+          context, 2 * kTableSize * sizeof(int32_t)));
+  TF_LITE_ENSURE(context, op_data->half_h_table != nullptr);
+  op_data->half_w_table = op_data->half_h_table + kTableSize;
+  for (int32_t q = INT8_MIN; q <= INT8_MAX; ++q) {
+    const double encoding = (q - box_zero_point) * box_scale;
+    op_data->half_h_table[q - INT8_MIN] =
+        SaturatingToQ16(0.5 * std::exp(encoding / scale_values.h));
+    op_data->half_w_table[q - INT8_MIN] =
+        SaturatingToQ16(0.5 * std::exp(encoding / scale_values.w));
+  }
+
+  const int max_selected =
+      std::max(op_data->max_detections, op_data->detections_per_class);
+  // Per-box decoded flag and lazily decoded Q16 boxes
+  context->RequestScratchBufferInArena(context, num_boxes,
+                                       &op_data->active_candidate_idx);
+  context->RequestScratchBufferInArena(
+      context, num_boxes * sizeof(QuantizedBoxCornerEncoding),
+      &op_data->decoded_boxes_idx);
+  // Per-box int8 score of the class being suppressed (or the max class score)
+  context->RequestScratchBufferInArena(context, num_boxes,
+                                       &op_data->score_buffer_idx);
+  // Candidate heap
+  context->RequestScratchBufferInArena(context, num_boxes * sizeof(int),
+                                       &op_data->keep_indices_idx);
+  context->RequestScratchBufferInArena(context, max_selected * sizeof(int),
+                                       &op_data->selected_idx);
+  // NMS grid row and column masks of the selected boxes
+  context->RequestScratchBufferInArena(context,
+                                       2 * max_selected * sizeof(uint32_t),
+                                       &op_data->selected_masks_idx);
+  if (op_data->use_regular_non_max_suppression) {
+    // Box indices and scores of the running top detections, plus the
+    // temporaries needed to reorder them
+    const int num_merged =
+        op_data->max_detections + op_data->detections_per_class;
+    context->RequestScratchBufferInArena(context, 4 * num_merged * sizeof(int),
+                                         &op_data->buffer_idx);
+  } else {
+    // Class order of one selected anchor
+    context->RequestScratchBufferInArena(context, num_classes * sizeof(int),
+                                         &op_data->sorted_indices_idx);
+  }
+  return kTfLiteOk;
+}
+
 TfLiteStatus DetectionPostProcessPrepare(TfLiteContext* context,
                                          TfLiteNode* node) {
   auto* op_data = static_cast<OpData*>(node->user_data);
@@ -183,40 +325,51 @@ TfLiteStatus DetectionPostProcessPrepare(TfLiteContext* context,
   op_data->input_anchors.scale = input_anchors->params.scale;
   op_data->input_anchors.zero_point = input_anchors->params.zero_point;
 
-  // Scratch tensors
-  context->RequestScratchBufferInArena(context, num_boxes,
-                                       &op_data->active_candidate_idx);
-  context->RequestScratchBufferInArena(context,
-                                       num_boxes * kNumCoordBox * sizeof(float),
-                                       &op_data->decoded_boxes_idx);
-  context->RequestScratchBufferInArena(
-      context,
-      input_class_predictions->dims->data[1] *
-          input_class_predictions->dims->data[2] * sizeof(float),
-      &op_data->scores_idx);
-
-  // Additional buffers
-  context->RequestScratchBufferInArena(context, num_boxes * sizeof(float),
-                                       &op_data->score_buffer_idx);
-  context->RequestScratchBufferInArena(context, num_boxes * sizeof(float),
-                                       &op_data->keep_scores_idx);
-  context->RequestScratchBufferInArena(
-      context, op_data->max_detections * num_boxes * sizeof(float),
-      &op_data->scores_after_regular_non_max_suppression_idx);
-  context->RequestScratchBufferInArena(
-      context, op_data->max_detections * num_boxes * sizeof(float),
-      &op_data->sorted_values_idx);
-  context->RequestScratchBufferInArena(context, num_boxes * sizeof(int),
-                                       &op_data->keep_indices_idx);
-  context->RequestScratchBufferInArena(
-      context, op_data->max_detections * num_boxes * sizeof(int),
-      &op_data->sorted_indices_idx);
-  int buffer_size = std::max(num_classes, op_data->max_detections);
-  context->RequestScratchBufferInArena(
-      context, buffer_size * num_boxes * sizeof(int), &op_data->buffer_idx);
-  buffer_size = std::min(num_boxes, op_data->max_detections);
-  context->RequestScratchBufferInArena(
-      context, buffer_size * num_boxes * sizeof(int), &op_data->selected_idx);
+  op_data->use_quantized_path = input_box_encodings->type == kTfLiteInt8;
+  if (op_data->use_quantized_path) {
+    TF_LITE_ENSURE_TYPES_EQ(context, input_class_predictions->type,
+                            kTfLiteInt8);
+    TF_LITE_ENSURE(context, input_anchors->type == kTfLiteInt8 ||
+                                input_anchors->type == kTfLiteFloat32);
+    op_data->anchors_type = input_anchors->type;
+    TF_LITE_ENSURE_STATUS(
+        PrepareQuantized(context, op_data, num_boxes, num_classes));
+  } else {
+    // Scratch tensors
+    context->RequestScratchBufferInArena(context, num_boxes,
+                                         &op_data->active_candidate_idx);
+    context->RequestScratchBufferInArena(
+        context, num_boxes * kNumCoordBox * sizeof(float),
+        &op_data->decoded_boxes_idx);
+    context->RequestScratchBufferInArena(
+        context,
+        input_class_predictions->dims->data[1] *
+            input_class_predictions->dims->data[2] * sizeof(float),
+        &op_data->scores_idx);
+
+    // Additional buffers
+    context->RequestScratchBufferInArena(context, num_boxes * sizeof(float),
+                                         &op_data->score_buffer_idx);
+    context->RequestScratchBufferInArena(context, num_boxes * sizeof(float),
+                                         &op_data->keep_scores_idx);
+    context->RequestScratchBufferInArena(
+        context, op_data->max_detections * num_boxes * sizeof(float),
+        &op_data->scores_after_regular_non_max_suppression_idx);
+    context->RequestScratchBufferInArena(
+        context, op_data->max_detections * num_boxes * sizeof(float),
+        &op_data->sorted_values_idx);
+    context->RequestScratchBufferInArena(context, num_boxes * sizeof(int),
+                                         &op_data->keep_indices_idx);
+    context->RequestScratchBufferInArena(
+        context, op_data->max_detections * num_boxes * sizeof(int),
+        &op_data->sorted_indices_idx);
+    int buffer_size = std::max(num_classes, op_data->max_detections);
+    context->RequestScratchBufferInArena(
+        context, buffer_size * num_boxes * sizeof(int), &op_data->buffer_idx);
+    buffer_size = std::min(num_boxes, op_data->max_detections);
+    context->RequestScratchBufferInArena(
+        context, buffer_size * num_boxes * sizeof(int), &op_data->selected_idx);
+  }
 
   // Outputs: detection_boxes, detection_scores, detection_classes,
   // num_detections
@@ -319,8 +472,9 @@ TfLiteStatus DecodeCenterSizeBoxes(TfLiteContext* context, TfLiteNode* node,
   return kTfLiteOk;
 }
 
-void DecreasingPartialArgSort(const float* values, int num_values,
-                              int num_to_sort, int* indices) {
+template <typename T>
+void DecreasingPartialArgSort(const T* values, int num_values, int num_to_sort,
+                              int* indices) {
   std::iota(indices, indices + num_values, 0);
   std::partial_sort(indices, indices + num_to_sort, indices + num_values,
                     [&values](const int i, const int j) {
@@ -776,11 +930,439 @@ TfLiteStatus NonMaxSuppressionMultiClass(TfLiteContext* context,
   return kTfLiteOk;
 }
 
+// Eval-time view of the int8 path's inputs and scratch buffers.
+struct QuantizedEvalData {
+  const int8_t* box_encodings;
+  int box_encoding_stride;
+  const int8_t* anchors;
+  const float* anchors_float;
+  QuantizedBoxCornerEncoding* decoded_boxes;
+  uint8_t* is_decoded;
+  int* selected;
+  uint32_t* selected_masks;
+};
+
+inline int32_t MultiplyQ16(int32_t a, int32_t b) {
+  return static_cast<int32_t>(
+      (static_cast<int64_t>(a) * b + (1 << (kQuantizedCoordBits - 1))) >>
+      kQuantizedCoordBits);
+}
+
+// Scales an integer by a Q24 multiplier into a Q16 value.
+inline int32_t MultiplyByQ24ToQ16(int32_t value, int32_t multiplier) {
+  constexpr int kShift = kQuantizedMultiplierBits - kQuantizedCoordBits;
+  return static_cast<int32_t>(
+      (static_cast<int64_t>(value) * multiplier + (1 << (kShift - 1))) >>
+      kShift);
+}
+
+void GetQuantizedAnchor(const OpData* op_data, const QuantizedEvalData& data,
+                        int idx, int32_t anchor[kNumCoordBox]) {
+  if (data.anchors != nullptr) {
+    const int8_t* quantized = &data.anchors[idx * kNumCoordBox];
+    for (int i = 0; i < kNumCoordBox; ++i) {
+      anchor[i] = MultiplyByQ24ToQ16(
+          quantized[i] - op_data->input_anchors.zero_point,
+          op_data->anchor_multiplier);
+    }
+  } else {
+    const float* values = &data.anchors_float[idx * kNumCoordBox];
+    for (int i = 0; i < kNumCoordBox; ++i) {
+      anchor[i] = SaturatingToQ16(values[i]);
+    }
+  }
+}
+
+// Decodes box `idx` into Q16 BoxCornerEncoding the first time it is needed.
+// Only boxes that reach NMS are ever decoded, and each at most once per Eval.
+TfLiteStatus GetQuantizedDecodedBox(TfLiteContext* context,
+                                    const OpData* op_data,
+                                    const QuantizedEvalData& data, int idx,
+                                    const QuantizedBoxCornerEncoding** box) {
+  QuantizedBoxCornerEncoding& decoded = data.decoded_boxes[idx];
+  *box = &decoded;
+  if (data.is_decoded[idx]) return kTfLiteOk;
+
+  // anchor[] is in CenterSizeEncoding order: y, x, h, w
+  int32_t anchor[kNumCoordBox];
+  GetQuantizedAnchor(op_data, data, idx, anchor);
+  const int8_t* encoding = &data.box_encodings[idx * data.box_encoding_stride];
+  const int32_t zero_point = op_data->input_box_encodings.zero_point;
+
+  const int32_t ycenter =
+      anchor[0] + MultiplyQ16(MultiplyByQ24ToQ16(encoding[0] - zero_point,
+                                                 op_data->center_y_multiplier),
+                              anchor[2]);
+  const int32_t xcenter =
+      anchor[1] + MultiplyQ16(MultiplyByQ24ToQ16(encoding[1] - zero_point,
+                                                 op_data->center_x_multiplier),
+                              anchor[3]);
+  const int32_t half_h =
+      MultiplyQ16(op_data->half_h_table[encoding[2] - INT8_MIN], anchor[2]);
+  const int32_t half_w =
+      MultiplyQ16(op_data->half_w_table[encoding[3] - INT8_MIN], anchor[3]);
+  decoded.ymin = ycenter - half_h;
+  decoded.xmin = xcenter - half_w;
+  decoded.ymax = ycenter + half_h;
+  decoded.xmax = xcenter + half_w;
+  // Same check as ValidateBoxes(), restricted to the boxes actually used.
+  TF_LITE_ENSURE(context,
+                 decoded.ymin < decoded.ymax && decoded.xmin < decoded.xmax);
+  data.is_decoded[idx] = 1;
+  return kTfLiteOk;
+}
+
+// Bit mask of the NMS grid bins covered by [lo, hi]. Two boxes can only
+// intersect if both their row masks and their column masks intersect.
+inline uint32_t GridMask(int32_t lo, int32_t hi) {
+  const int lo_bin =
+      std::min(std::max(static_cast<int>(lo >> kGridBinShift), 0), kGridMaxBin);
+  const int hi_bin =
+      std::min(std::max(static_cast<int>(hi >> kGridBinShift), 0), kGridMaxBin);
+  return ((2u << hi_bin) - 1u) & ~((1u << lo_bin) - 1u);
+}
+
+// IoU(box_i, box_j) > threshold, without division. Areas are Q32.
+bool QuantizedIntersectionOverUnionExceeds(
+    const QuantizedBoxCornerEncoding& box_i,
+    const QuantizedBoxCornerEncoding& box_j, int32_t threshold_q16) {
+  const int64_t intersection_h =
+      std::min(box_i.ymax, box_j.ymax) - std::max(box_i.ymin, box_j.ymin);
+  const int64_t intersection_w =
+      std::min(box_i.xmax, box_j.xmax) - std::max(box_i.xmin, box_j.xmin);
+  if (intersection_h <= 0 || intersection_w <= 0) return false;
+  int64_t intersection = intersection_h * intersection_w;
+  const int64_t area_i = static_cast<int64_t>(box_i.ymax - box_i.ymin) *
+                         (box_i.xmax - box_i.xmin);
+  const int64_t area_j = static_cast<int64_t>(box_j.ymax - box_j.ymin) *
+                         (box_j.xmax - box_j.xmin);
+  int64_t union_area = area_i + area_j - intersection;
+  // Keep union < 2^46 so that neither side of the comparison overflows.
+  while (union_area >= (int64_t{1} << 46)) {
+    union_area >>= 1;
+    intersection >>= 1;
+  }
+  return (intersection << kQuantizedCoordBits) > threshold_q16 * union_area;
+}
+
+// Binary max-heap of box indices ordered by decreasing score and then by
+// increasing index, i.e. the order DecreasingArgSort() produces on the
+// candidates of the float path. Only the candidates NMS actually visits are
+// popped, so the cost is O(N + K log N) rather than a full sort.
+class CandidateHeap {
+ public:
+  CandidateHeap(const int8_t* scores, int* heap)
+      : scores_(scores), heap_(heap) {}
+
+  void Build(int32_t score_threshold, int num_boxes) {
+    size_ = 0;
+    for (int i = 0; i < num_boxes; ++i) {
+      if (scores_[i] >= score_threshold) heap_[size_++] = i;
+    }
+    for (int i = size_ / 2 - 1; i >= 0; --i) SiftDown(i);
+  }
+
+  int size() const { return size_; }
+
+  int Pop() {
+    const int top = heap_[0];
+    heap_[0] = heap_[--size_];
+    SiftDown(0);
+    return top;
+  }
+
+ private:
+  bool Before(int a, int b) const {
+    return scores_[a] > scores_[b] || (scores_[a] == scores_[b] && a < b);
+  }
+
+  void SiftDown(int pos) {
+    const int value = heap_[pos];
+    for (int child = 2 * pos + 1; child < size_; child = 2 * pos + 1) {
+      if (child + 1 < size_ && Before(heap_[child + 1], heap_[child])) ++child;
+      if (!Before(heap_[child], value)) break;
+      heap_[pos] = heap_[child];
+      pos = child;
+    }
+    heap_[pos] = value;
+  }
+
+  const int8_t* scores_;
+  int* heap_;
+  int size_ = 0;
+};
+
+// Int8 counterpart of NonMaxSuppressionSingleClassHelper(). Candidates are
+// popped in score order and kept unless they overlap an already selected box,
+// which selects the same boxes as the pairwise suppression of the float path.
+TfLiteStatus NonMaxSuppressionSingleClassQuantizedHelper(
+    TfLiteContext* context, const OpData* op_data,
+    const QuantizedEvalData& data, const int8_t* scores, int num_boxes,
+    int* selected_size, int max_detections) {
+  TF_LITE_ENSURE(context, (max_detections >= 0));
+  TF_LITE_ENSURE(context, (op_data->intersection_over_union_threshold > 0.0f) &&
+                              (op_data->intersection_over_union_threshold <=
+                               1.0f));
+
+  CandidateHeap candidates(
+      scores, static_cast<int*>(context->GetScratchBuffer(
+                  context, op_data->keep_indices_idx)));
+  candidates.Build(op_data->quantized_score_threshold, num_boxes);
+  const int output_size = std::min(candidates.size(), max_detections);
+
+  *selected_size = 0;
+  while (*selected_size < output_size && candidates.size() > 0) {
+    const int candidate = candidates.Pop();
+    const QuantizedBoxCornerEncoding* box;
+    TF_LITE_ENSURE_STATUS(
+        GetQuantizedDecodedBox(context, op_data, data, candidate, &box));
+    const uint32_t row_mask = GridMask(box->ymin, box->ymax);
+    const uint32_t col_mask = GridMask(box->xmin, box->xmax);
+
+    bool suppressed = false;
+    for (int i = 0; i < *selected_size && !suppressed; ++i) {
+      if ((data.selected_masks[2 * i] & row_mask) == 0 ||
+          (data.selected_masks[2 * i + 1] & col_mask) == 0) {
+        continue;
+      }
+      suppressed = QuantizedIntersectionOverUnionExceeds(
+          data.decoded_boxes[data.selected[i]], *box,
+          op_data->iou_threshold_q16);
+    }
+    if (!suppressed) {
+      data.selected[*selected_size] = candidate;
+      data.selected_masks[2 * *selected_size] = row_mask;
+      data.selected_masks[2 * *selected_size + 1] = col_mask;
+      ++*selected_size;
+    }
+  }
+  return kTfLiteOk;
+}
+
+inline float DequantizeScore(const OpData* op_data, int8_t score) {
+  return (static_cast<float>(score) -
+          op_data->input_class_predictions.zero_point) *
+         op_data->input_class_predictions.scale;
+}
+
+void WriteEmptyDetection(TfLiteContext* context, TfLiteNode* node,
+                         int output_index) {
+  ReInterpretTensor<BoxCornerEncoding*>(tflite::micro::GetEvalOutput(
+      context, node, kOutputTensorDetectionBoxes))[output_index] = {
+      0.0f, 0.0f, 0.0f, 0.0f};
+  tflite::micro::GetTensorData<float>(tflite::micro::GetEvalOutput(
+      context, node, kOutputTensorDetectionClasses))[output_index] = 0.0f;
+  tflite::micro::GetTensorData<float>(tflite::micro::GetEvalOutput(
+      context, node, kOutputTensorDetectionScores))[output_index] = 0.0f;
+}
+
+void WriteQuantizedDetection(const OpData* op_data,
+                             const QuantizedEvalData& data, TfLiteNode* node,
+                             TfLiteContext* context, int output_index,
+                             int anchor_index, int class_index, int8_t score) {
+  constexpr float kQ16ToFloat = 1.0f / (1 << kQuantizedCoordBits);
+  const QuantizedBoxCornerEncoding& decoded = data.decoded_boxes[anchor_index];
+  ReInterpretTensor<BoxCornerEncoding*>(tflite::micro::GetEvalOutput(
+      context, node, kOutputTensorDetectionBoxes))[output_index] = {
+      decoded.ymin * kQ16ToFloat, decoded.xmin * kQ16ToFloat,
+      decoded.ymax * kQ16ToFloat, decoded.xmax * kQ16ToFloat};
+  tflite::micro::GetTensorData<float>(tflite::micro::GetEvalOutput(
+      context, node, kOutputTensorDetectionClasses))[output_index] =
+      class_index;
+  tflite::micro::GetTensorData<float>(tflite::micro::GetEvalOutput(
+      context, node, kOutputTensorDetectionScores))[output_index] =
+      DequantizeScore(op_data, score);
+}
+
+// Int8 counterpart of NonMaxSuppressionMultiClassRegularHelper().
+TfLiteStatus NonMaxSuppressionMultiClassRegularQuantizedHelper(
+    TfLiteContext* context, TfLiteNode* node, const OpData* op_data,
+    const QuantizedEvalData& data, const int8_t* scores, int num_boxes,
+    int num_classes_with_background) {
+  const int num_classes = op_data->num_classes;
+  const int num_detections_per_class = op_data->detections_per_class;
+  const int max_detections = op_data->max_detections;
+  const int label_offset = num_classes_with_background - num_classes;
+  TF_LITE_ENSURE(context, num_detections_per_class > 0);
+
+  int8_t* class_scores = static_cast<int8_t*>(
+      context->GetScratchBuffer(context, op_data->score_buffer_idx));
+  const int num_merged = max_detections + num_detections_per_class;
+  int* merged_box_indices = static_cast<int*>(
+      context->GetScratchBuffer(context, op_data->buffer_idx));
+  int* merged_scores = merged_box_indices + num_merged;
+  int* sorted_indices = merged_scores + num_merged;
+  int* sorted_scores = sorted_indices + num_merged;
+
+  int size_of_sorted_indices = 0;
+  for (int col = 0; col < num_classes; col++) {
+    const int8_t* column = scores + col + label_offset;
+    for (int row = 0; row < num_boxes; row++) {
+      class_scores[row] = column[row * num_classes_with_background];
+    }
+    int selected_size = 0;
+    TF_LITE_ENSURE_STATUS(NonMaxSuppressionSingleClassQuantizedHelper(
+        context, op_data, data, class_scores, num_boxes, &selected_size,
+        num_detections_per_class));
+
+    int output_index = size_of_sorted_indices;
+    for (int i = 0; i < selected_size; i++) {
+      const int selected_index = data.selected[i];
+      merged_box_indices[output_index] =
+          selected_index * num_classes_with_background + col + label_offset;
+      merged_scores[output_index] = class_scores[selected_index];
+      output_index++;
+    }
+    // Keep the running top max_detections, with the same tie-breaking as the
+    // float path.
+    const int num_indices_to_sort = std::min(output_index, max_detections);
+    DecreasingPartialArgSort(merged_scores, output_index, num_indices_to_sort,
+                             sorted_indices);
+    for (int row = 0; row < num_indices_to_sort; row++) {
+      const int temp = sorted_indices[row];
+      sorted_indices[row] = merged_box_indices[temp];
+      sorted_scores[row] = merged_scores[temp];
+    }
+    for (int row = 0; row < num_indices_to_sort; row++) {
+      merged_box_indices[row] = sorted_indices[row];
+      merged_scores[row] = sorted_scores[row];
+    }
+    size_of_sorted_indices = num_indices_to_sort;
+  }
+
+  for (int output_box_index = 0; output_box_index < max_detections;
+       output_box_index++) {
+    if (output_box_index < size_of_sorted_indices) {
+      const int box_index = merged_box_indices[output_box_index];
+      const int anchor_index = box_index / num_classes_with_background;
+      const int class_index = box_index -
+                              anchor_index * num_classes_with_background -
+                              label_offset;
+      WriteQuantizedDetection(op_data, data, node, context, output_box_index,
+                              anchor_index, class_index,
+                              merged_scores[output_box_index]);
+    } else {
+      WriteEmptyDetection(context, node, output_box_index);
+    }
+  }
+  tflite::micro::GetTensorData<float>(tflite::micro::GetEvalOutput(
+      context, node, kOutputTensorNumDetections))[0] = size_of_sorted_indices;
+  return kTfLiteOk;
+}
+
+// Int8 counterpart of NonMaxSuppressionMultiClassFastHelper(). NMS only needs
+// the best class score of each anchor; the per-anchor class order is computed
+// for the selected anchors alone.
+TfLiteStatus NonMaxSuppressionMultiClassFastQuantizedHelper(
+    TfLiteContext* context, TfLiteNode* node, const OpData* op_data,
+    const QuantizedEvalData& data, const int8_t* scores, int num_boxes,
+    int num_classes_with_background) {
+  const int num_classes = op_data->num_classes;
+  const int max_categories_per_anchor = op_data->max_classes_per_detection;
+  const int label_offset = num_classes_with_background - num_classes;
+  TF_LITE_ENSURE(context, (max_categories_per_anchor > 0));
+  const int num_categories_per_anchor =
+      std::min(max_categories_per_anchor, num_classes);
+
+  int8_t* max_scores = static_cast<int8_t*>(
+      context->GetScratchBuffer(context, op_data->score_buffer_idx));
+  for (int row = 0; row < num_boxes; row++) {
+    const int8_t* box_scores =
+        scores + row * num_classes_with_background + label_offset;
+    max_scores[row] = *std::max_element(box_scores, box_scores + num_classes);
+  }
+
+  int selected_size = 0;
+  TF_LITE_ENSURE_STATUS(NonMaxSuppressionSingleClassQuantizedHelper(
+      context, op_data, data, max_scores, num_boxes, &selected_size,
+      op_data->max_detections));
+
+  int* class_indices = static_cast<int*>(
+      context->GetScratchBuffer(context, op_data->sorted_indices_idx));
+  int output_box_index = 0;
+  for (int i = 0; i < selected_size; i++) {
+    const int selected_index = data.selected[i];
+    const int8_t* box_scores =
+        scores + selected_index * num_classes_with_background + label_offset;
+    DecreasingPartialArgSort(box_scores, num_classes, num_categories_per_anchor,
+                             class_indices);
+    for (int col = 0; col < num_categories_per_anchor; ++col) {
+      const int box_offset = num_categories_per_anchor * output_box_index + col;
+      WriteQuantizedDetection(op_data, data, node, context, box_offset,
+                              selected_index, class_indices[col],
+                              box_scores[class_indices[col]]);
+      output_box_index++;
+    }
+  }
+  tflite::micro::GetTensorData<float>(tflite::micro::GetEvalOutput(
+      context, node, kOutputTensorNumDetections))[0] = output_box_index;
+  return kTfLiteOk;
+}
+
+TfLiteStatus NonMaxSuppressionMultiClassQuantized(TfLiteContext* context,
+                                                  TfLiteNode* node,
+                                                  const OpData* op_data) {
+  const TfLiteEvalTensor* input_box_encodings =
+      tflite::micro::GetEvalInput(context, node, kInputTensorBoxEncodings);
+  const TfLiteEvalTensor* input_class_predictions =
+      tflite::micro::GetEvalInput(context, node, kInputTensorClassPredictions);
+  const TfLiteEvalTensor* input_anchors =
+      tflite::micro::GetEvalInput(context, node, kInputTensorAnchors);
+  TF_LITE_ENSURE_EQ(context, input_box_encodings->dims->data[0], kBatchSize);
+  TF_LITE_ENSURE(context, input_box_encodings->dims->data[2] >= kNumCoordBox);
+  const int num_boxes = input_box_encodings->dims->data[1];
+  const int num_classes = op_data->num_classes;
+
+  TF_LITE_ENSURE_EQ(context, input_class_predictions->dims->data[0],
+                    kBatchSize);
+  TF_LITE_ENSURE_EQ(context, input_class_predictions->dims->data[1], num_boxes);
+  const int num_classes_with_background =
+      input_class_predictions->dims->data[2];
+  TF_LITE_ENSURE(context, (num_classes_with_background - num_classes <= 1));
+  TF_LITE_ENSURE(context, (num_classes_with_background >= num_classes));
+
+  QuantizedEvalData data;
+  data.box_encodings =
+      tflite::micro::GetTensorData<int8_t>(input_box_encodings);
+  data.box_encoding_stride = input_box_encodings->dims->data[2];
+  if (op_data->anchors_type == kTfLiteInt8) {
+    data.anchors = tflite::micro::GetTensorData<int8_t>(input_anchors);
+    data.anchors_float = nullptr;
+  } else {
+    data.anchors = nullptr;
+    data.anchors_float = tflite::micro::GetTensorData<float>(input_anchors);
+  }
+  data.decoded_boxes = static_cast<QuantizedBoxCornerEncoding*>(
+      context->GetScratchBuffer(context, op_data->decoded_boxes_idx));
+  data.is_decoded = static_cast<uint8_t*>(
+      context->GetScratchBuffer(context, op_data->active_candidate_idx));
+  data.selected = static_cast<int*>(
+      context->GetScratchBuffer(context, op_data->selected_idx));
+  data.selected_masks = static_cast<uint32_t*>(
+      context->GetScratchBuffer(context, op_data->selected_masks_idx));
+  memset(data.is_decoded, 0, num_boxes);
+
+  const int8_t* scores =
+      tflite::micro::GetTensorData<int8_t>(input_class_predictions);
+  if (op_data->use_regular_non_max_suppression) {
+    return NonMaxSuppressionMultiClassRegularQuantizedHelper(
+        context, node, op_data, data, scores, num_boxes,
+        num_classes_with_background);
+  }
+  return NonMaxSuppressionMultiClassFastQuantizedHelper(
+      context, node, op_data, data, scores, num_boxes,
+      num_classes_with_background);
+}
+
 TfLiteStatus DetectionPostProcessEval(TfLiteContext* context,
                                       TfLiteNode* node) {
   TF_LITE_ENSURE(context, (kBatchSize == 1));
   auto* op_data = static_cast<OpData*>(node->user_data);
 
+  if (op_data->use_quantized_path) {
+    return NonMaxSuppressionMultiClassQuantized(context, node, op_data);
+  }
+
   // These two functions correspond to two blocks in the Object Detection model.
   // In future, we would like to break the custom op in two blocks, which is
   // currently not feasible because we would like to input quantized inputs
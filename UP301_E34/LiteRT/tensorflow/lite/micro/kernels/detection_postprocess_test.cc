@@ -0,0 +1,276 @@
+/* Copyright 2021 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Checks the int8 path of DETECTION_POSTPROCESS against the float path fed
+// the dequantized inputs, on random configurations: regular and fast NMS,
+// int8 and float anchors, and random quantization parameters, thresholds
+// and sizes. Detection counts, classes and scores must match; boxes are
+// decoded in Q16 on the int8 path, so they only have to agree within
+// kBoxTolerance.
+//
+// Only built on request, since the firmware build globs every .cc file.
+// From the LiteRT directory:
+//
+//   g++ -O2 -std=c++17 -DTFLM_HOST_TEST -DTF_LITE_STATIC_MEMORY -I.
+//       -Ithird_party/flatbuffers/include -Ithird_party/gemmlowp
+//       -Ithird_party/ruy
+//       tensorflow/lite/micro/kernels/detection_postprocess_test.cc
+//       libtflm_host.a -o detection_postprocess_test
+//
+// where libtflm_host.a holds the tensorflow/lite sources built for the host
+// with -fno-exceptions, with a DebugLog() that prints to stderr in place of
+// the UART one of tensorflow/lite/micro/debug_log.cc.
+
+#if defined(TFLM_HOST_TEST)
+
+#include <stdint.h>
+
+#include <cmath>
+#include <vector>
+
+#include "flatbuffers/flexbuffers.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/kernels/kernel_runner.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/micro/micro_testing.h"
+#include "tensorflow/lite/micro/test_helpers.h"
+
+namespace tflite {
+namespace testing {
+namespace {
+
+// Largest coordinate error of the Q16 boxes, measured at 4e-5.
+constexpr float kBoxTolerance = 1e-4f;
+constexpr int kNumRandomConfigs = 200;
+constexpr int kNumOutputTensors = 4;
+
+struct DetectionPostprocessConfig {
+  bool use_regular_nms;
+  bool int8_anchors;
+  int num_boxes;
+  int num_classes;
+  int max_detections;
+  int max_classes_per_detection;
+  int detections_per_class;
+  float score_threshold;
+  float iou_threshold;
+  float box_scale;
+  int box_zero_point;
+  float score_scale;
+  int score_zero_point;
+  float anchor_scale;
+  int anchor_zero_point;
+};
+
+struct DetectionPostprocessInputs {
+  std::vector<int8_t> boxes;
+  std::vector<int8_t> scores;
+  std::vector<int8_t> anchors;
+};
+
+struct DetectionPostprocessOutputs {
+  std::vector<float> boxes;
+  std::vector<float> classes;
+  std::vector<float> scores;
+  float num_detections;
+};
+
+uint32_t seed = 1;
+
+int RandomInt(int min, int max) {
+  seed = seed * 1103515245u + 12345u;
+  return min + static_cast<int>((seed >> 8) % (max - min + 1));
+}
+
+float RandomFloat(float min, float max) {
+  return min + (max - min) * RandomInt(0, 1 << 20) / (1 << 20);
+}
+
+DetectionPostprocessConfig RandomConfig() {
+  DetectionPostprocessConfig c;
+  c.use_regular_nms = RandomInt(0, 1) == 1;
+  c.int8_anchors = RandomInt(0, 1) == 1;
+  c.num_boxes = RandomInt(8, 48);
+  c.num_classes = RandomInt(1, 4);
+  c.max_detections = RandomInt(1, 5);
+  c.max_classes_per_detection = c.use_regular_nms ? 1 : RandomInt(1, 3);
+  c.detections_per_class = RandomInt(1, 8);
+  c.score_threshold = RandomFloat(0.0f, 0.6f);
+  c.iou_threshold = RandomFloat(0.2f, 0.8f);
+  c.box_scale = RandomFloat(0.01f, 0.08f);
+  c.box_zero_point = RandomInt(-10, 10);
+  c.score_scale = 1.0f / 256;
+  c.score_zero_point = -128;
+  // Anchors cover [0, 1] in both formats.
+  c.anchor_scale = 1.0f / 255;
+  c.anchor_zero_point = -128;
+  return c;
+}
+
+DetectionPostprocessInputs RandomInputs(const DetectionPostprocessConfig& c) {
+  DetectionPostprocessInputs in;
+  in.boxes.resize(c.num_boxes * 4);
+  in.scores.resize(c.num_boxes * (c.num_classes + 1));
+  in.anchors.resize(c.num_boxes * 4);
+  for (int8_t& v : in.boxes) v = RandomInt(-128, 127);
+  for (int8_t& v : in.scores) v = RandomInt(-128, 127);
+  for (int i = 0; i < c.num_boxes; ++i) {
+    // Center anywhere, height and width in (0, 0.3].
+    in.anchors[i * 4 + 0] = RandomInt(-128, 127);
+    in.anchors[i * 4 + 1] = RandomInt(-128, 127);
+    in.anchors[i * 4 + 2] = RandomInt(-127, -50);
+    in.anchors[i * 4 + 3] = RandomInt(-127, -50);
+  }
+  return in;
+}
+
+std::vector<uint8_t> Flexbuffer(const DetectionPostprocessConfig& c) {
+  flexbuffers::Builder fbb;
+  fbb.Map([&]() {
+    fbb.Int("max_detections", c.max_detections);
+    fbb.Int("max_classes_per_detection", c.max_classes_per_detection);
+    fbb.Int("detections_per_class", c.detections_per_class);
+    fbb.Bool("use_regular_nms", c.use_regular_nms);
+    fbb.Float("nms_score_threshold", c.score_threshold);
+    fbb.Float("nms_iou_threshold", c.iou_threshold);
+    fbb.Int("num_classes", c.num_classes);
+    fbb.Float("y_scale", 10.0);
+    fbb.Float("x_scale", 10.0);
+    fbb.Float("h_scale", 5.0);
+    fbb.Float("w_scale", 5.0);
+  });
+  fbb.Finish();
+  return fbb.GetBuffer();
+}
+
+std::vector<float> Dequantize(const std::vector<int8_t>& q, float scale,
+                              int zero_point) {
+  std::vector<float> f(q.size());
+  for (size_t i = 0; i < q.size(); ++i) {
+    f[i] = (static_cast<float>(q[i]) - zero_point) * scale;
+  }
+  return f;
+}
+
+DetectionPostprocessOutputs Run(const DetectionPostprocessConfig& c,
+                                const DetectionPostprocessInputs& in,
+                                bool quantized) {
+  const int num_outputs = c.max_detections * c.max_classes_per_detection;
+  int box_encodings_shape[] = {3, 1, c.num_boxes, 4};
+  int class_predictions_shape[] = {3, 1, c.num_boxes, c.num_classes + 1};
+  int anchors_shape[] = {2, c.num_boxes, 4};
+  int detection_boxes_shape[] = {3, 1, num_outputs, 4};
+  int detection_shape[] = {2, 1, num_outputs};
+  int num_detections_shape[] = {1, 1};
+
+  std::vector<float> boxes = Dequantize(in.boxes, c.box_scale,
+                                        c.box_zero_point);
+  std::vector<float> scores = Dequantize(in.scores, c.score_scale,
+                                         c.score_zero_point);
+  std::vector<float> anchors = Dequantize(in.anchors, c.anchor_scale,
+                                          c.anchor_zero_point);
+
+  // With fast NMS, both paths advance the output index once per class
+  // rather than once per box, so with several classes per detection they
+  // write up to max_classes_per_detection times past the output shape.
+  const int capacity = num_outputs * c.max_classes_per_detection;
+  DetectionPostprocessOutputs out;
+  out.boxes.assign(capacity * 4, 0.0f);
+  out.classes.assign(capacity, 0.0f);
+  out.scores.assign(capacity, 0.0f);
+  out.num_detections = -1.0f;
+
+  TfLiteTensor tensors[7];
+  if (quantized) {
+    tensors[0] = CreateQuantizedTensor(
+        in.boxes.data(), IntArrayFromInts(box_encodings_shape), c.box_scale,
+        c.box_zero_point);
+    tensors[1] = CreateQuantizedTensor(
+        in.scores.data(), IntArrayFromInts(class_predictions_shape),
+        c.score_scale, c.score_zero_point);
+    tensors[2] =
+        c.int8_anchors
+            ? CreateQuantizedTensor(in.anchors.data(),
+                                    IntArrayFromInts(anchors_shape),
+                                    c.anchor_scale, c.anchor_zero_point)
+            : CreateTensor(anchors.data(), IntArrayFromInts(anchors_shape));
+  } else {
+    tensors[0] =
+        CreateTensor(boxes.data(), IntArrayFromInts(box_encodings_shape));
+    tensors[1] =
+        CreateTensor(scores.data(), IntArrayFromInts(class_predictions_shape));
+    tensors[2] = CreateTensor(anchors.data(), IntArrayFromInts(anchors_shape));
+  }
+  tensors[3] =
+      CreateTensor(out.boxes.data(), IntArrayFromInts(detection_boxes_shape));
+  tensors[4] =
+      CreateTensor(out.classes.data(), IntArrayFromInts(detection_shape));
+  tensors[5] =
+      CreateTensor(out.scores.data(), IntArrayFromInts(detection_shape));
+  tensors[6] = CreateTensor(&out.num_detections,
+                            IntArrayFromInts(num_detections_shape));
+
+  int inputs_array_data[] = {3, 0, 1, 2};
+  int outputs_array_data[] = {kNumOutputTensors, 3, 4, 5, 6};
+  const std::vector<uint8_t> flexbuffer = Flexbuffer(c);
+  micro::KernelRunner runner(*Register_DETECTION_POSTPROCESS(), tensors, 7,
+                             IntArrayFromInts(inputs_array_data),
+                             IntArrayFromInts(outputs_array_data),
+                             /*builtin_data=*/nullptr);
+  TF_LITE_MICRO_EXPECT_EQ(
+      runner.InitAndPrepare(reinterpret_cast<const char*>(flexbuffer.data()),
+                            flexbuffer.size()),
+      kTfLiteOk);
+  TF_LITE_MICRO_EXPECT_EQ(runner.Invoke(), kTfLiteOk);
+  return out;
+}
+
+// Returns the number of detections, so that the caller can check the
+// configurations are not all trivially empty.
+int TestQuantizedMatchesFloat(const DetectionPostprocessConfig& c) {
+  const DetectionPostprocessInputs in = RandomInputs(c);
+  const DetectionPostprocessOutputs expected = Run(c, in, false);
+  const DetectionPostprocessOutputs actual = Run(c, in, true);
+
+  TF_LITE_MICRO_EXPECT_EQ(actual.num_detections, expected.num_detections);
+  for (size_t i = 0; i < expected.classes.size(); ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(actual.classes[i], expected.classes[i]);
+    TF_LITE_MICRO_EXPECT_EQ(actual.scores[i], expected.scores[i]);
+  }
+  for (size_t i = 0; i < expected.boxes.size(); ++i) {
+    TF_LITE_MICRO_EXPECT_NEAR(actual.boxes[i], expected.boxes[i],
+                              kBoxTolerance);
+  }
+  return static_cast<int>(expected.num_detections);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace tflite
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(DetectionPostprocessInt8MatchesFloatOnRandomConfigs) {
+  int num_detections = 0;
+  for (int i = 0; i < tflite::testing::kNumRandomConfigs; ++i) {
+    num_detections += tflite::testing::TestQuantizedMatchesFloat(
+        tflite::testing::RandomConfig());
+  }
+  TF_LITE_MICRO_EXPECT_GT(num_detections, tflite::testing::kNumRandomConfigs);
+}
+
+TF_LITE_MICRO_TESTS_END
+
+#endif  // defined(TFLM_HOST_TEST)
@@ -139,6 +139,7 @@ TFLMInferenceRegistration RegisterInference_FULLY_CONNECTED();
 
 // TODO(b/160234179): Change custom OPs to also return by value.
 namespace tflm_signal {
+TFLMRegistration* Register_AUDIO_FRONTEND();
 TFLMRegistration* Register_DELAY();
 TFLMRegistration* Register_FFT_AUTO_SCALE();
 TFLMRegistration* Register_FILTER_BANK();
@@ -56,6 +56,12 @@ TFLMRegistration Register_SOFTMAX_INT8();
 // int16 input/output and uses the latency optimized implementations.
 TFLMRegistration Register_SOFTMAX_INT16();
 
+// Returns a TFLMRegistration struct for kernel variant that only supports
+// int8 input and writes the k largest int8 probabilities of every row to
+// output 0 and their int32 indices to output 1 instead of the full
+// distribution. k is the last dimension of the outputs.
+TFLMRegistration Register_SOFTMAX_INT8_TOP_K();
+
 #else
 inline TFLMRegistration Register_SOFTMAX_INT8() { return Register_SOFTMAX(); }
 
@@ -120,6 +120,10 @@ TfLiteStatus BytesRequiredForTensor(const tflite::Tensor& flatbuffer_tensor,
       ConvertTensorType(flatbuffer_tensor.type(), &tf_lite_type));
   TF_LITE_ENSURE_STATUS(TfLiteTypeSizeOf(tf_lite_type, type_size));
   *bytes = element_count * (*type_size);
+  // Int4 tensors are stored packed, two elements per byte.
+  if (tf_lite_type == kTfLiteInt4) {
+    *bytes = (element_count + 1) / 2;
+  }
   return kTfLiteOk;
 }
 
@@ -137,6 +141,10 @@ TfLiteStatus TfLiteEvalTensorByteLength(const TfLiteEvalTensor* eval_tensor,
   size_t type_size;
   TF_LITE_ENSURE_STATUS(TfLiteTypeSizeOf(eval_tensor->type, &type_size));
   *out_bytes = element_count * type_size;
+  // Int4 tensors are stored packed, two elements per byte.
+  if (eval_tensor->type == kTfLiteInt4) {
+    *out_bytes = (element_count + 1) / 2;
+  }
   return kTfLiteOk;
 }
 
@@ -29,6 +29,16 @@ namespace tflite {
 namespace {
 constexpr char kOfflineMemAllocMetadata[] = "OfflineMemoryAllocation";
 constexpr int kUninitializedLifetime = -1;
+constexpr int kNotAliased = -1;
+
+// An allocation can be placed inside another one only when it is planned
+// online, has a lifetime and has not been placed elsewhere already.
+bool CanAlias(const AllocationInfo* current) {
+  return current->needs_allocating &&
+         current->first_created != kUninitializedLifetime &&
+         current->offline_offset == kOnlinePlannedBuffer &&
+         current->alias_index == kNotAliased;
+}
 }  // namespace
 
 // Mark the given Allocation info as first created at the specified allocation
@@ -215,6 +225,8 @@ TfLiteStatus AllocationInfoBuilder::InitializeAllocationInfo(
       } else {
         current->offline_offset = kOnlinePlannedBuffer;
       }
+      current->alias_index = kNotAliased;
+      current->alias_offset = 0;
     }
   }
   // Initialize allocation info for every scratch buffer.
@@ -226,6 +238,8 @@ TfLiteStatus AllocationInfoBuilder::InitializeAllocationInfo(
     current->last_used = kUninitializedLifetime;
     current->needs_allocating = true;
     current->offline_offset = kOnlinePlannedBuffer;
+    current->alias_index = kNotAliased;
+    current->alias_offset = 0;
   }
   return kTfLiteOk;
 }
@@ -258,10 +272,14 @@ TfLiteStatus AllocationInfoBuilder::MarkAllocationLifetimes(
     // Each operator has a new allocation scope.
     allocation_scope_count_++;
     const auto* op = subgraph->operators()->Get(i);
+    // The tensors are taken from the node rather than the operator, since
+    // model preparation may have rewired them (see
+    // MicroInterpreterGraph::FoldPadOperators).
+    const TfLiteNode& node =
+        allocations[subgraph_idx].node_and_registrations[i].node;
     // Figure out when the first creation and use of each tensor is.
-    for (size_t n = 0; op->outputs() != nullptr && n < op->outputs()->size();
-         ++n) {
-      const int tensor_index = op->outputs()->Get(n);
+    for (int n = 0; node.outputs != nullptr && n < node.outputs->size; ++n) {
+      const int tensor_index = node.outputs->data[n];
       AllocationInfo* current = &subgraph_allocation_info[tensor_index];
       UpdateFirstCreated(current, allocation_scope_count_);
     }
@@ -276,9 +294,8 @@ TfLiteStatus AllocationInfoBuilder::MarkAllocationLifetimes(
                                      scratch_buffer_handles, allocations);
 
     // Figure out when the last use of each tensor is.
-    for (size_t n = 0; op->inputs() != nullptr && n < op->inputs()->size();
-         ++n) {
-      const int tensor_index = op->inputs()->Get(n);
+    for (int n = 0; node.inputs != nullptr && n < node.inputs->size; ++n) {
+      const int tensor_index = node.inputs->data[n];
       // Optional bias tensors can have an index of -1 when they are omitted.
       if (tensor_index >= 0) {
         AllocationInfo* current = &subgraph_allocation_info[tensor_index];
@@ -288,9 +305,8 @@ TfLiteStatus AllocationInfoBuilder::MarkAllocationLifetimes(
         UpdateLastUsed(current, allocation_scope_count_);
       }
     }
-    for (size_t n = 0; op->outputs() != nullptr && n < op->outputs()->size();
-         ++n) {
-      const int tensor_index = op->outputs()->Get(n);
+    for (int n = 0; node.outputs != nullptr && n < node.outputs->size; ++n) {
+      const int tensor_index = node.outputs->data[n];
       AllocationInfo* current = &subgraph_allocation_info[tensor_index];
       UpdateLastUsed(current, allocation_scope_count_);
     }
@@ -333,6 +349,95 @@ TfLiteStatus AllocationInfoBuilder::MarkAllocationLifetimes(
   return kTfLiteOk;
 }
 
+void AllocationInfoBuilder::SkipUnusedTensors() {
+  for (size_t i = 0; i < info_.tensor_count; ++i) {
+    AllocationInfo* current = &info_.allocation_info[i];
+    if (current->first_created == kUninitializedLifetime) {
+      current->needs_allocating = false;
+    }
+  }
+}
+
+TfLiteStatus AllocationInfoBuilder::MarkConcatenationAliases(
+    SubgraphAllocations* allocations) {
+  AllocationInfo* allocation_info = info_.allocation_info;
+  for (size_t subgraph_idx = 0; subgraph_idx < model_->subgraphs()->size();
+       subgraph_idx++) {
+    const SubGraph* subgraph = model_->subgraphs()->Get(subgraph_idx);
+    const TfLiteEvalTensor* eval_tensors = allocations[subgraph_idx].tensors;
+    const int subgraph_offset =
+        static_cast<int>(info_.subgraph_offsets[subgraph_idx]);
+    uint32_t operators_size = NumSubgraphOperators(subgraph);
+
+    for (uint32_t i = 0; i < operators_size; i++) {
+      const auto* op = subgraph->operators()->Get(i);
+      const OperatorCode* opcode =
+          model_->operator_codes()->Get(op->opcode_index());
+      const ConcatenationOptions* options =
+          op->builtin_options_as_ConcatenationOptions();
+      if (opcode->builtin_code() != BuiltinOperator_CONCATENATION ||
+          options == nullptr || op->inputs() == nullptr ||
+          op->outputs() == nullptr || op->outputs()->size() != 1) {
+        continue;
+      }
+
+      const int output_index = op->outputs()->Get(0);
+      AllocationInfo* output = &allocation_info[subgraph_offset + output_index];
+      const TfLiteIntArray* output_dims = eval_tensors[output_index].dims;
+      if (!CanAlias(output) || output_dims == nullptr) {
+        continue;
+      }
+
+      // Every input is one contiguous slab of the output only when all
+      // dimensions in front of the concatenation axis are 1.
+      int axis = options->axis();
+      if (axis < 0) {
+        axis += output_dims->size;
+      }
+      if (axis < 0 || axis >= output_dims->size) {
+        continue;
+      }
+      bool contiguous = true;
+      for (int d = 0; d < axis; ++d) {
+        contiguous = contiguous && output_dims->data[d] == 1;
+      }
+      size_t total_bytes = 0;
+      for (size_t n = 0; n < op->inputs()->size(); ++n) {
+        const int tensor_index = op->inputs()->Get(n);
+        if (tensor_index < 0) {
+          contiguous = false;
+          break;
+        }
+        total_bytes += allocation_info[subgraph_offset + tensor_index].bytes;
+      }
+      if (!contiguous || total_bytes != output->bytes) {
+        continue;
+      }
+
+      // Inputs that cannot be placed in the output keep their own buffer and
+      // are copied by the operator as before.
+      size_t offset = 0;
+      for (size_t n = 0; n < op->inputs()->size(); ++n) {
+        const int tensor_index = op->inputs()->Get(n);
+        AllocationInfo* current =
+            &allocation_info[subgraph_offset + tensor_index];
+        if (CanAlias(current) &&
+            !IsSubgraphInputOrOutput(subgraph, tensor_index)) {
+          current->needs_allocating = false;
+          current->alias_index = subgraph_offset + output_index;
+          current->alias_offset = offset;
+          // The output buffer now has to live as long as any of its inputs.
+          output->first_created =
+              std::min(output->first_created, current->first_created);
+          output->last_used = std::max(output->last_used, current->last_used);
+        }
+        offset += current->bytes;
+      }
+    }
+  }
+  return kTfLiteOk;
+}
+
 // Get offline tensors allocation plan. See
 // micro/docs/memory_management.md for more info.
 TfLiteStatus AllocationInfoBuilder::GetOfflinePlannedOffsets(
@@ -31,6 +31,11 @@ struct AllocationInfo {
   int last_used;
   int32_t offline_offset;
   bool needs_allocating;
+  // Index of the AllocationInfo whose buffer holds this one, or -1. Aliased
+  // buffers are not planned; they are placed alias_offset bytes into the
+  // buffer of the allocation they alias once that one has been committed.
+  int alias_index;
+  size_t alias_offset;
 };
 
 // Used to hold the allocation info list and related metadata for the entire
@@ -104,6 +109,19 @@ class AllocationInfoBuilder {
       ScratchBufferHandle* scratch_buffer_handles,
       SubgraphAllocations* allocations);
 
+  // Leave tensors that no operator reads or writes out of the memory plan,
+  // such as the output of a PAD operator folded into its consumer. Must be
+  // called after MarkAllocationLifetimes.
+  void SkipUnusedTensors();
+
+  // Let the inputs of CONCATENATION operators live inside the output buffer
+  // when each input is one contiguous slab of the output (the concatenation
+  // axis has no non-unit dimension before it). Producers then write their
+  // results in place and the operator only copies inputs that could not be
+  // aliased. Must be called after MarkAllocationLifetimes, since the lifetime
+  // of the output is extended to cover its aliased inputs.
+  TfLiteStatus MarkConcatenationAliases(SubgraphAllocations* allocations);
+
   // Returns the number of allocations.
   int AllocationCount() const { return info_.allocation_info_count; }
 
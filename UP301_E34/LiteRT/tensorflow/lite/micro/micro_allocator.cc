@@ -141,6 +141,22 @@ TfLiteStatus CommitPlan(MicroMemoryPlanner* planner, uint8_t* starting_point,
       ++planner_index;
     }
   }
+  // Aliased buffers live inside a planned one, possibly through a chain of
+  // aliases (a concatenation feeding another concatenation).
+  for (size_t i = 0; i < allocation_info_size; ++i) {
+    const AllocationInfo* current = &allocation_info[i];
+    if (current->alias_index >= 0) {
+      size_t offset = 0;
+      const AllocationInfo* root = current;
+      while (root->alias_index >= 0) {
+        offset += root->alias_offset;
+        root = &allocation_info[root->alias_index];
+      }
+      TFLITE_DCHECK(root->needs_allocating);
+      *current->output_ptr =
+          reinterpret_cast<uint8_t*>(*root->output_ptr) + offset;
+    }
+  }
   return kTfLiteOk;
 }
 
@@ -768,6 +784,11 @@ size_t MicroAllocator::used_bytes() const {
          persistent_buffer_allocator_->GetPersistentUsedBytes();
 }
 
+size_t MicroAllocator::GetAvailableMemory() const {
+  return non_persistent_buffer_allocator_->GetAvailableMemory(
+      MicroArenaBufferAlignment());
+}
+
 TfLiteStatus MicroAllocator::AllocateNodeAndRegistrations(
     const Model* model, SubgraphAllocations* subgraph_allocations) {
   TFLITE_DCHECK(subgraph_allocations != nullptr);
@@ -1155,6 +1176,8 @@ TfLiteStatus MicroAllocator::CommitStaticMemoryPlan(
       GetScratchBufferRequests();
   TF_LITE_ENSURE_STATUS(builder.MarkAllocationLifetimes(
       0, scratch_buffer_requests, scratch_buffer_handles, allocations));
+  builder.SkipUnusedTensors();
+  TF_LITE_ENSURE_STATUS(builder.MarkConcatenationAliases(allocations));
   int allocation_info_count = builder.AllocationCount();
   AllocationInfo* allocation_info = builder.Finish();
 
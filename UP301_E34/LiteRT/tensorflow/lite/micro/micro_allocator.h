@@ -257,6 +257,10 @@ class MicroAllocator {
   // `FinishModelAllocation`. Otherwise, it will return 0.
   size_t used_bytes() const;
 
+  // Returns the number of bytes the memory plan can still use, that is the
+  // arena minus the persistent and temporary allocations made so far.
+  size_t GetAvailableMemory() const;
+
   TfLiteBridgeBuiltinDataAllocator* GetBuiltinDataAllocator();
 
  protected:
@@ -0,0 +1,375 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Checks where the memory planner places the inputs of CONCATENATION
+// operators (MarkConcatenationAliases and the alias chain of CommitPlan), and
+// that the operator still produces the concatenation: inputs placed in their
+// slab of the output must not be copied, and every other input must be.
+//
+// Each model feeds a "produce" custom op, which writes a pattern unique to
+// its output tensor, into one or more concatenations. The committed data
+// pointers are compared with the slab of the output each input should (or
+// should not) live in, then the model is run and the output is compared with
+// the concatenated patterns.
+//
+// Only built on request, since the firmware build globs every .cc file.
+// From the LiteRT directory:
+//
+//   g++ -O2 -std=c++17 -DTFLM_HOST_TEST -DTF_LITE_STATIC_MEMORY -I.
+//       -Ithird_party/flatbuffers/include -Ithird_party/gemmlowp
+//       -Ithird_party/ruy tensorflow/lite/micro/micro_allocator_test.cc
+//       libtflm_host.a -o micro_allocator_test
+//
+// where libtflm_host.a holds the tensorflow/lite sources built for the host
+// with -fno-exceptions, with a DebugLog() that prints to stderr in place of
+// the UART one of tensorflow/lite/micro/debug_log.cc.
+
+#if defined(TFLM_HOST_TEST)
+
+#include "tensorflow/lite/micro/micro_allocator.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <vector>
+
+#include "flatbuffers/flatbuffers.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/micro/micro_testing.h"
+#include "tensorflow/lite/micro/micro_utils.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace tflite {
+namespace testing {
+namespace {
+
+constexpr int kArenaSize = 4096;
+constexpr int kNotOfflinePlanned = -1;
+constexpr int kMaxTensors = 8;
+
+// Value of element `i` of the subgraph input (tensor 0) and of the tensors
+// written by ProduceInvoke.
+int32_t Pattern(int tensor_index, int i) {
+  return 1000 * (tensor_index + 1) + i;
+}
+
+// Fills the output with its pattern, after reading the whole input so that
+// an output planned over the input would be caught.
+TfLiteStatus ProduceInvoke(TfLiteContext* context, TfLiteNode* node) {
+  const TfLiteEvalTensor* input = micro::GetEvalInput(context, node, 0);
+  TfLiteEvalTensor* output = micro::GetEvalOutput(context, node, 0);
+  TF_LITE_ENSURE(context, input != nullptr && output != nullptr);
+  const int input_size = ElementCount(*input->dims);
+  for (int i = 0; i < input_size; ++i) {
+    TF_LITE_ENSURE_EQ(context, input->data.i32[i], Pattern(0, i));
+  }
+  const int output_size = ElementCount(*output->dims);
+  for (int i = 0; i < output_size; ++i) {
+    output->data.i32[i] = Pattern(node->outputs->data[0], i);
+  }
+  return kTfLiteOk;
+}
+
+TFLMRegistration* ProduceRegistration() {
+  static TFLMRegistration r = {};
+  r.invoke = ProduceInvoke;
+  return &r;
+}
+
+// TF_LITE_STATIC_MEMORY builds have no default flatbuffers allocator.
+class HeapAllocator : public flatbuffers::Allocator {
+ public:
+  uint8_t* allocate(size_t size) override { return new uint8_t[size]; }
+  void deallocate(uint8_t* p, size_t) override { delete[] p; }
+};
+
+// Where a concatenation input is expected to be committed.
+enum Placement {
+  kInSlab,       // At its offset in the output.
+  kOwnBuffer,    // In a buffer that does not overlap the output.
+  kEarlierSlab,  // In the slab of an earlier input (a duplicated input).
+};
+
+struct ConcatenationNode {
+  std::vector<int> inputs;
+  int output;
+  int axis;
+};
+
+// Builds a model whose tensor 0 is the int32 subgraph input, producers[i]
+// are written by a "produce" op reading tensor 0, and concatenations run in
+// the given order. `offline_offsets`, when not empty, holds the offline plan
+// of every tensor.
+class ConcatenationModel {
+ public:
+  ConcatenationModel(const std::vector<std::vector<int32_t>>& shapes,
+                     const std::vector<int>& producers,
+                     const std::vector<ConcatenationNode>& concatenations,
+                     const std::vector<int>& outputs,
+                     const std::vector<int32_t>& offline_offsets = {})
+      : builder_(1024, &allocator_) {
+    using flatbuffers::Offset;
+    std::vector<Offset<Buffer>> buffers = {CreateBuffer(builder_)};
+    std::vector<Offset<Metadata>> metadata;
+    if (!offline_offsets.empty()) {
+      // Version 1, subgraph 0, number of tensors, then one offset each.
+      std::vector<int32_t> plan = {
+          1, 0, static_cast<int32_t>(offline_offsets.size())};
+      plan.insert(plan.end(), offline_offsets.begin(), offline_offsets.end());
+      metadata.push_back(CreateMetadata(
+          builder_, builder_.CreateString("OfflineMemoryAllocation"),
+          buffers.size()));
+      buffers.push_back(CreateBuffer(
+          builder_, builder_.CreateVector(
+                        reinterpret_cast<const uint8_t*>(plan.data()),
+                        plan.size() * sizeof(int32_t))));
+    }
+
+    std::vector<Offset<Tensor>> tensors;
+    for (const std::vector<int32_t>& shape : shapes) {
+      tensors.push_back(CreateTensor(builder_, builder_.CreateVector(shape),
+                                     TensorType_INT32, 0));
+    }
+
+    const Offset<OperatorCode> operator_codes[] = {
+        CreateOperatorCode(builder_, BuiltinOperator_CUSTOM,
+                           builder_.CreateString("produce"), 1,
+                           BuiltinOperator_CUSTOM),
+        CreateOperatorCode(builder_, BuiltinOperator_CONCATENATION, 0, 1,
+                           BuiltinOperator_CONCATENATION)};
+    constexpr uint32_t kProduceOp = 0;
+    constexpr uint32_t kConcatenationOp = 1;
+
+    std::vector<Offset<Operator>> operators;
+    for (int producer : producers) {
+      const int32_t input = 0;
+      operators.push_back(CreateOperator(
+          builder_, kProduceOp, builder_.CreateVector(&input, 1),
+          builder_.CreateVector(&producer, 1)));
+    }
+    for (const ConcatenationNode& node : concatenations) {
+      operators.push_back(CreateOperator(
+          builder_, kConcatenationOp, builder_.CreateVector(node.inputs),
+          builder_.CreateVector(&node.output, 1),
+          BuiltinOptions_ConcatenationOptions,
+          CreateConcatenationOptions(builder_, node.axis).Union()));
+    }
+
+    const int32_t inputs[] = {0};
+    const Offset<SubGraph> subgraph = CreateSubGraph(
+        builder_, builder_.CreateVector(tensors),
+        builder_.CreateVector(inputs, 1), builder_.CreateVector(outputs),
+        builder_.CreateVector(operators));
+    builder_.Finish(CreateModel(
+        builder_, TFLITE_SCHEMA_VERSION,
+        builder_.CreateVector(operator_codes, 2),
+        builder_.CreateVector(&subgraph, 1), builder_.CreateString(""),
+        builder_.CreateVector(buffers), 0, builder_.CreateVector(metadata)));
+  }
+
+  const Model* model() const {
+    return GetModel(builder_.GetBufferPointer());
+  }
+
+ private:
+  HeapAllocator allocator_;
+  flatbuffers::FlatBufferBuilder builder_;
+};
+
+// Gives access to the eval tensors the allocator committed, without the
+// linear planner that GetTensor() requires.
+class ContextMicroInterpreter : public MicroInterpreter {
+ public:
+  using MicroInterpreter::context;
+  using MicroInterpreter::MicroInterpreter;
+};
+
+// Runs the model and checks where every concatenation input was placed:
+// `placements` lists, for each concatenation, where each of its inputs is
+// expected.
+void TestConcatenations(const ConcatenationModel& model,
+                        const std::vector<ConcatenationNode>& concatenations,
+                        const std::vector<std::vector<Placement>>& placements) {
+  alignas(16) static uint8_t arena[kArenaSize];
+  // Slabs that are wrongly left uncopied must not hold the expected values
+  // from an earlier model.
+  memset(arena, 0xa5, kArenaSize);
+  MicroMutableOpResolver<2> resolver;
+  TF_LITE_MICRO_EXPECT_EQ(resolver.AddCustom("produce", ProduceRegistration()),
+                          kTfLiteOk);
+  TF_LITE_MICRO_EXPECT_EQ(resolver.AddConcatenation(), kTfLiteOk);
+  ContextMicroInterpreter interpreter(model.model(), resolver, arena,
+                                      kArenaSize);
+  TF_LITE_MICRO_EXPECT_EQ(interpreter.AllocateTensors(), kTfLiteOk);
+
+  const TfLiteContext& context = interpreter.context();
+  auto data = [&](int tensor_index) {
+    return context.GetEvalTensor(&context, tensor_index)->data.raw;
+  };
+  auto bytes = [&](int tensor_index) {
+    return ElementCount(
+               *context.GetEvalTensor(&context, tensor_index)->dims) *
+           sizeof(int32_t);
+  };
+
+  for (size_t c = 0; c < concatenations.size(); ++c) {
+    const ConcatenationNode& node = concatenations[c];
+    const char* output = data(node.output);
+    size_t offset = 0;
+    for (size_t n = 0; n < node.inputs.size(); ++n) {
+      const char* input = data(node.inputs[n]);
+      switch (placements[c][n]) {
+        case kInSlab:
+          TF_LITE_MICRO_EXPECT(input == output + offset);
+          break;
+        case kOwnBuffer:
+          TF_LITE_MICRO_EXPECT(input + bytes(node.inputs[n]) <= output ||
+                               input >= output + bytes(node.output));
+          break;
+        case kEarlierSlab:
+          TF_LITE_MICRO_EXPECT(input >= output && input < output + offset);
+          break;
+      }
+      offset += bytes(node.inputs[n]);
+    }
+  }
+
+  TfLiteTensor* input = interpreter.input(0);
+  for (int i = 0; i < ElementCount(*input->dims); ++i) {
+    input->data.i32[i] = Pattern(0, i);
+  }
+  TF_LITE_MICRO_EXPECT_EQ(interpreter.Invoke(), kTfLiteOk);
+
+  // Every concatenation output holds its inputs side by side along the axis.
+  std::vector<std::vector<int32_t>> expected(kMaxTensors);
+  for (const ConcatenationNode& node : concatenations) {
+    const TfLiteEvalTensor* output =
+        context.GetEvalTensor(&context, node.output);
+    const int axis = node.axis < 0 ? node.axis + output->dims->size : node.axis;
+    int outer = 1;
+    for (int d = 0; d < axis; ++d) {
+      outer *= output->dims->data[d];
+    }
+    for (int o = 0; o < outer; ++o) {
+      for (int tensor_index : node.inputs) {
+        if (expected[tensor_index].empty()) {
+          const int size = bytes(tensor_index) / sizeof(int32_t);
+          for (int i = 0; i < size; ++i) {
+            expected[tensor_index].push_back(Pattern(tensor_index, i));
+          }
+        }
+        const int inner = expected[tensor_index].size() / outer;
+        expected[node.output].insert(
+            expected[node.output].end(),
+            expected[tensor_index].begin() + o * inner,
+            expected[tensor_index].begin() + (o + 1) * inner);
+      }
+    }
+    const int32_t* actual = output->data.i32;
+    for (size_t i = 0; i < expected[node.output].size(); ++i) {
+      TF_LITE_MICRO_EXPECT_EQ(actual[i], expected[node.output][i]);
+    }
+  }
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace tflite
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(ConcatenationInputsArePlannedInTheirSlabs) {
+  // Tensors: 0 input, 1 and 2 produced, 3 = concat(1, 2).
+  const std::vector<tflite::testing::ConcatenationNode> concatenations = {
+      {{1, 2}, 3, 1}};
+  const tflite::testing::ConcatenationModel model(
+      {{1, 4}, {1, 4}, {1, 6}, {1, 10}}, {1, 2}, concatenations, {3});
+  tflite::testing::TestConcatenations(
+      model, concatenations,
+      {{tflite::testing::kInSlab, tflite::testing::kInSlab}});
+}
+
+TF_LITE_MICRO_TEST(NestedConcatenationInputsArePlannedInTheOuterOutput) {
+  // Tensors: 0 input, 1, 2 and 4 produced, 3 = concat(1, 2) and
+  // 5 = concat(4, 3) along the last axis, so 1 and 2 sit in 5 through 3.
+  const std::vector<tflite::testing::ConcatenationNode> concatenations = {
+      {{1, 2}, 3, -1}, {{4, 3}, 5, -1}};
+  const tflite::testing::ConcatenationModel model(
+      {{1, 4}, {1, 1, 3}, {1, 1, 5}, {1, 1, 8}, {1, 1, 2}, {1, 1, 10}},
+      {1, 2, 4}, concatenations, {5});
+  tflite::testing::TestConcatenations(
+      model, concatenations,
+      {{tflite::testing::kInSlab, tflite::testing::kInSlab},
+       {tflite::testing::kInSlab, tflite::testing::kInSlab}});
+}
+
+TF_LITE_MICRO_TEST(DuplicatedConcatenationInputIsPlannedOnce) {
+  // Tensors: 0 input, 1 produced, 2 = concat(1, 1). Only the first slab can
+  // hold tensor 1; the second one is copied from it.
+  const std::vector<tflite::testing::ConcatenationNode> concatenations = {
+      {{1, 1}, 2, 0}};
+  const tflite::testing::ConcatenationModel model({{4}, {4}, {8}}, {1},
+                                                  concatenations, {2});
+  tflite::testing::TestConcatenations(
+      model, concatenations,
+      {{tflite::testing::kInSlab, tflite::testing::kEarlierSlab}});
+}
+
+TF_LITE_MICRO_TEST(SubgraphInputIsNotPlannedInTheConcatenation) {
+  // Tensors: 0 input, 1 produced, 2 = concat(0, 1). The subgraph input is
+  // copied; the produced tensor still goes after it.
+  const std::vector<tflite::testing::ConcatenationNode> concatenations = {
+      {{0, 1}, 2, 1}};
+  const tflite::testing::ConcatenationModel model({{1, 4}, {1, 4}, {1, 8}},
+                                                  {1}, concatenations, {2});
+  tflite::testing::TestConcatenations(
+      model, concatenations,
+      {{tflite::testing::kOwnBuffer, tflite::testing::kInSlab}});
+}
+
+TF_LITE_MICRO_TEST(OfflinePlannedInputIsNotPlannedInTheConcatenation) {
+  // Tensors: 0 input, 1 and 2 produced, 3 = concat(1, 2), with tensor 1
+  // planned offline at the start of the arena.
+  const std::vector<tflite::testing::ConcatenationNode> concatenations = {
+      {{1, 2}, 3, 1}};
+  const tflite::testing::ConcatenationModel model(
+      {{1, 4}, {1, 4}, {1, 4}, {1, 8}}, {1, 2}, concatenations, {3},
+      {tflite::testing::kNotOfflinePlanned, 0,
+       tflite::testing::kNotOfflinePlanned,
+       tflite::testing::kNotOfflinePlanned});
+  tflite::testing::TestConcatenations(
+      model, concatenations,
+      {{tflite::testing::kOwnBuffer, tflite::testing::kInSlab}});
+}
+
+TF_LITE_MICRO_TEST(InnerAxisConcatenationIsNotPlannedInPlace) {
+  // Tensors: 0 input, 1 and 2 produced, 3 = concat(1, 2) along axis 1 of a
+  // [2, n] shape: the inputs are interleaved in the output, so both are
+  // copied.
+  const std::vector<tflite::testing::ConcatenationNode> concatenations = {
+      {{1, 2}, 3, 1}};
+  const tflite::testing::ConcatenationModel model(
+      {{2, 2}, {2, 2}, {2, 3}, {2, 5}}, {1, 2}, concatenations, {3});
+  tflite::testing::TestConcatenations(
+      model, concatenations,
+      {{tflite::testing::kOwnBuffer, tflite::testing::kOwnBuffer}});
+}
+
+TF_LITE_MICRO_TESTS_END
+
+#endif  // defined(TFLM_HOST_TEST)
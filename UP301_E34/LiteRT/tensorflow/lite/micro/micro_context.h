@@ -16,6 +16,9 @@ limitations under the License.
 #ifndef TENSORFLOW_LITE_MICRO_MICRO_CONTEXT_H_
 #define TENSORFLOW_LITE_MICRO_MICRO_CONTEXT_H_
 
+#include <stdint.h>
+
+#include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/micro/micro_graph.h"
 #include "tensorflow/lite/micro/micro_profiler_interface.h"
@@ -148,6 +151,18 @@ class MicroContext {
 
 #endif  // USE_TFLM_COMPRESSION
 
+  // Returns the padding a convolution node has to apply to its input when a
+  // PAD operator was folded into it, or nullptr otherwise. Available during
+  // Prepare.
+  virtual const TfLitePaddingValues* GetFoldedPadding(const TfLiteNode* node) {
+    return nullptr;
+  }
+
+  // Returns the number of arena bytes left for the memory plan (tensors and
+  // scratch buffers), or SIZE_MAX if unknown. A scratch request larger than
+  // this can never be satisfied. Available during Prepare.
+  virtual size_t GetRemainingArenaBytes() { return SIZE_MAX; }
+
   // Set the alternate MicroProfilerInterface.
   // This can be used to profile subsystems simultaneously with the profiling
   // of kernels during the Eval phase.  See (b/379584353).
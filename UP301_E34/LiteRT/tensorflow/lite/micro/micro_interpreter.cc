@@ -209,6 +209,7 @@ TfLiteStatus MicroInterpreter::AllocateTensors() {
   graph_.SetSubgraphAllocations(allocations);
 
   TF_LITE_ENSURE_STATUS(PrepareNodeAndRegistrationDataFromFlatbuffer());
+  TF_LITE_ENSURE_STATUS(graph_.FoldPadOperators());
 
   micro_context_.SetInterpreterState(
       MicroInterpreterContext::InterpreterState::kInit);
@@ -267,6 +267,16 @@ void MicroInterpreterContext::ResetDecompressionMemoryAllocations() {
 
 #endif  // USE_TFLM_COMPRESSION
 
+const TfLitePaddingValues* MicroInterpreterContext::GetFoldedPadding(
+    const TfLiteNode* node) {
+  return graph_.GetFoldedPadding(node);
+}
+
+size_t MicroInterpreterContext::GetRemainingArenaBytes() {
+  TFLITE_DCHECK(state_ == InterpreterState::kPrepare);
+  return allocator_.GetAvailableMemory();
+}
+
 TfLiteStatus MicroInterpreterContext::SetAlternateProfiler(
     tflite::MicroProfilerInterface* alt_profiler) {
   alt_profiler_ = alt_profiler;
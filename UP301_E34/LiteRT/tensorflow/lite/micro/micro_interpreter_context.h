@@ -144,6 +144,14 @@ class MicroInterpreterContext : public MicroContext {
 
 #endif  // USE_TFLM_COMPRESSION
 
+  // Returns the padding of the PAD operator folded into the convolution node,
+  // or nullptr if none was folded into it.
+  const TfLitePaddingValues* GetFoldedPadding(const TfLiteNode* node) override;
+
+  // Returns the arena bytes not yet taken by persistent or temporary
+  // allocations.
+  size_t GetRemainingArenaBytes() override;
+
   // Set the alternate MicroProfilerInterface.
   // This can be used to profile subsystems simultaneously with the profiling
   // of kernels during the Eval phase.  See (b/379584353).
@@ -42,6 +42,41 @@ const char* OpNameFromRegistration(const TFLMRegistration* registration) {
   }
 }
 
+// Stands in for a PAD operator that was folded into its consumer.
+TfLiteStatus FoldedPadInvoke(TfLiteContext* context, TfLiteNode* node) {
+  return kTfLiteOk;
+}
+
+const TFLMRegistration kFoldedPadRegistration = {
+    /*init=*/nullptr,          /*free=*/nullptr,
+    /*prepare=*/nullptr,       /*invoke=*/FoldedPadInvoke,
+    /*reset=*/nullptr,         /*builtin_code=*/BuiltinOperator_PAD,
+    /*custom_name=*/nullptr};
+
+// The convolution pads with the zero point of its input, which is the value
+// PAD writes as long as both tensors share the quantization.
+bool HaveSameQuantization(const Tensor* a, const Tensor* b) {
+  const QuantizationParameters* qa = a->quantization();
+  const QuantizationParameters* qb = b->quantization();
+  const bool a_quantized = qa != nullptr && qa->zero_point() != nullptr &&
+                           qa->zero_point()->size() > 0;
+  const bool b_quantized = qb != nullptr && qb->zero_point() != nullptr &&
+                           qb->zero_point()->size() > 0;
+  if (!a_quantized || !b_quantized) {
+    return a_quantized == b_quantized;
+  }
+  return qa->zero_point()->Get(0) == qb->zero_point()->Get(0) &&
+         qa->scale() != nullptr && qb->scale() != nullptr &&
+         qa->scale()->size() > 0 && qb->scale()->size() > 0 &&
+         qa->scale()->Get(0) == qb->scale()->Get(0);
+}
+
+// Reads entry i of a constant PAD paddings tensor.
+int64_t GetPadding(const TfLiteEvalTensor& paddings, int i) {
+  return paddings.type == kTfLiteInt64 ? paddings.data.i64[i]
+                                       : paddings.data.i32[i];
+}
+
 }  // namespace
 
 MicroInterpreterGraph::MicroInterpreterGraph(
@@ -60,6 +95,172 @@ MicroInterpreterGraph::MicroInterpreterGraph(
 
 MicroInterpreterGraph::~MicroInterpreterGraph() {}
 
+bool MicroInterpreterGraph::CanFoldPad(int subgraph_idx, uint32_t pad_idx,
+                                       uint32_t* consumer_idx,
+                                       TfLitePaddingValues* padding) {
+  const SubGraph* subgraph = (*subgraphs_)[subgraph_idx];
+  NodeAndRegistration* nodes =
+      subgraph_allocations_[subgraph_idx].node_and_registrations;
+  const TfLiteEvalTensor* tensors = subgraph_allocations_[subgraph_idx].tensors;
+  const TfLiteNode& pad = nodes[pad_idx].node;
+  if (nodes[pad_idx].registration->builtin_code != BuiltinOperator_PAD ||
+      pad.inputs == nullptr || pad.inputs->size != 2 ||
+      pad.outputs == nullptr || pad.outputs->size != 1) {
+    return false;
+  }
+  const int input_index = pad.inputs->data[0];
+  const int paddings_index = pad.inputs->data[1];
+  const int output_index = pad.outputs->data[0];
+  if (IsSubgraphInputOrOutput(subgraph, output_index) ||
+      !HaveSameQuantization(subgraph->tensors()->Get(input_index),
+                            subgraph->tensors()->Get(output_index))) {
+    return false;
+  }
+
+  // Only constant paddings are known at this point. Tensors that are not
+  // constant get their buffers during memory planning.
+  const TfLiteEvalTensor& paddings = tensors[paddings_index];
+  if (paddings.data.data == nullptr ||
+      (paddings.type != kTfLiteInt32 && paddings.type != kTfLiteInt64) ||
+      paddings.dims->size != 2 || paddings.dims->data[0] != 4 ||
+      paddings.dims->data[1] != 2) {
+    return false;
+  }
+#ifdef USE_TFLM_COMPRESSION
+  const CompressedTensorList& compressed =
+      subgraph_allocations_[subgraph_idx].compressed;
+  if (compressed.tensors != nullptr &&
+      compressed.tensors[paddings_index] != nullptr) {
+    return false;
+  }
+#endif  // USE_TFLM_COMPRESSION
+  // Batch and channels must not be padded. Padding on the bottom and right is
+  // implied by the output size of the convolution.
+  if (GetPadding(paddings, 0) != 0 || GetPadding(paddings, 1) != 0 ||
+      GetPadding(paddings, 6) != 0 || GetPadding(paddings, 7) != 0) {
+    return false;
+  }
+  for (int i = 2; i < 6; ++i) {
+    if (GetPadding(paddings, i) < 0) {
+      return false;
+    }
+  }
+
+  // The output must have exactly one reader: the input of a convolution that
+  // does not pad by itself.
+  bool found = false;
+  const uint32_t operators_size = NumSubgraphOperators(model_, subgraph_idx);
+  for (uint32_t i = pad_idx + 1; i < operators_size; ++i) {
+    const TfLiteNode& node = nodes[i].node;
+    for (int n = 0; node.inputs != nullptr && n < node.inputs->size; ++n) {
+      if (node.inputs->data[n] != output_index) {
+        continue;
+      }
+      const int32_t code = nodes[i].registration->builtin_code;
+      TfLitePadding conv_padding = kTfLitePaddingUnknown;
+      if (code == BuiltinOperator_CONV_2D) {
+        conv_padding =
+            static_cast<const TfLiteConvParams*>(node.builtin_data)->padding;
+      } else if (code == BuiltinOperator_DEPTHWISE_CONV_2D) {
+        conv_padding =
+            static_cast<const TfLiteDepthwiseConvParams*>(node.builtin_data)
+                ->padding;
+      }
+      if (found || n != 0 || conv_padding != kTfLitePaddingValid ||
+          GetFoldedPadding(&node) != nullptr) {
+        return false;
+      }
+      found = true;
+      *consumer_idx = i;
+    }
+  }
+  if (!found) {
+    return false;
+  }
+
+  padding->height = static_cast<int>(GetPadding(paddings, 2));
+  padding->width = static_cast<int>(GetPadding(paddings, 4));
+  padding->height_offset =
+      static_cast<int>(GetPadding(paddings, 3)) - padding->height;
+  padding->width_offset =
+      static_cast<int>(GetPadding(paddings, 5)) - padding->width;
+  return true;
+}
+
+TfLiteStatus MicroInterpreterGraph::FoldPadOperators() {
+  uint32_t consumer_idx;
+  TfLitePaddingValues padding;
+  int count = 0;
+  for (size_t subgraph_idx = 0; subgraph_idx < subgraphs_->size();
+       subgraph_idx++) {
+    uint32_t operators_size = NumSubgraphOperators(model_, subgraph_idx);
+    for (uint32_t i = 0; i < operators_size; ++i) {
+      if (CanFoldPad(subgraph_idx, i, &consumer_idx, &padding)) {
+        count++;
+      }
+    }
+  }
+  if (count == 0) {
+    return kTfLiteOk;
+  }
+
+  folded_pads_ = static_cast<FoldedPad*>(
+      allocator_->AllocatePersistentBuffer(count * sizeof(FoldedPad)));
+  TF_LITE_ENSURE(context_, folded_pads_ != nullptr);
+  for (size_t subgraph_idx = 0; subgraph_idx < subgraphs_->size();
+       subgraph_idx++) {
+    NodeAndRegistration* nodes =
+        subgraph_allocations_[subgraph_idx].node_and_registrations;
+    uint32_t operators_size = NumSubgraphOperators(model_, subgraph_idx);
+    for (uint32_t i = 0; i < operators_size; ++i) {
+      if (!CanFoldPad(subgraph_idx, i, &consumer_idx, &padding)) {
+        continue;
+      }
+      TF_LITE_ENSURE(context_, folded_pad_count_ < count);
+      // The node lists point into the flatbuffer, so the convolution gets its
+      // own copy that reads the input of the PAD operator.
+      TfLiteNode* pad = &nodes[i].node;
+      TfLiteNode* conv = &nodes[consumer_idx].node;
+      TfLiteIntArray* conv_inputs =
+          static_cast<TfLiteIntArray*>(allocator_->AllocatePersistentBuffer(
+              TfLiteIntArrayGetSizeInBytes(conv->inputs->size)));
+      TF_LITE_ENSURE(context_, conv_inputs != nullptr);
+      conv_inputs->size = conv->inputs->size;
+      for (int n = 0; n < conv->inputs->size; ++n) {
+        conv_inputs->data[n] = conv->inputs->data[n];
+      }
+      conv_inputs->data[0] = pad->inputs->data[0];
+      conv->inputs = conv_inputs;
+
+      // Without inputs and outputs the PAD operator drops out of the memory
+      // plan, and its output is never allocated.
+      TfLiteIntArray* no_tensors =
+          static_cast<TfLiteIntArray*>(allocator_->AllocatePersistentBuffer(
+              TfLiteIntArrayGetSizeInBytes(0)));
+      TF_LITE_ENSURE(context_, no_tensors != nullptr);
+      no_tensors->size = 0;
+      pad->inputs = no_tensors;
+      pad->outputs = no_tensors;
+      nodes[i].registration = &kFoldedPadRegistration;
+
+      folded_pads_[folded_pad_count_].node = conv;
+      folded_pads_[folded_pad_count_].padding = padding;
+      folded_pad_count_++;
+    }
+  }
+  return kTfLiteOk;
+}
+
+const TfLitePaddingValues* MicroInterpreterGraph::GetFoldedPadding(
+    const TfLiteNode* node) const {
+  for (int i = 0; i < folded_pad_count_; ++i) {
+    if (folded_pads_[i].node == node) {
+      return &folded_pads_[i].padding;
+    }
+  }
+  return nullptr;
+}
+
 TfLiteStatus MicroInterpreterGraph::InitSubgraphs() {
   int previous_subgraph_idx = current_subgraph_index_;
   uint32_t previous_operator_idx = current_operator_index_;
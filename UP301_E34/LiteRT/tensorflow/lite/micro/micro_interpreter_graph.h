@@ -16,6 +16,7 @@ limitations under the License.
 #ifndef TENSORFLOW_LITE_MICRO_MICRO_INTERPRETER_GRAPH_H_
 #define TENSORFLOW_LITE_MICRO_MICRO_INTERPRETER_GRAPH_H_
 
+#include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/micro/micro_allocator.h"
 #include "tensorflow/lite/micro/micro_common.h"
 #include "tensorflow/lite/micro/micro_graph.h"
@@ -43,6 +44,17 @@ class MicroInterpreterGraph : public MicroGraph {
   // operator in every subgraph in the model.
   virtual TfLiteStatus InitSubgraphs();
 
+  // Folds every PAD operator whose output is only read as the input of a
+  // CONV_2D or DEPTHWISE_CONV_2D with VALID padding into that convolution. The
+  // convolution then reads the unpadded tensor and pads it implicitly, and the
+  // PAD operator and its output buffer are dropped. Must be called after the
+  // nodes are set up and before InitSubgraphs.
+  TfLiteStatus FoldPadOperators();
+
+  // Returns the padding of the PAD operator folded into the given convolution
+  // node, or nullptr if none was folded into it.
+  const TfLitePaddingValues* GetFoldedPadding(const TfLiteNode* node) const;
+
   // Calls TFLMRegistration->Prepare for every operator in every subgraph
   // in the model.
   virtual TfLiteStatus PrepareSubgraphs();
@@ -99,10 +111,23 @@ class MicroInterpreterGraph : public MicroGraph {
   MicroResourceVariables* GetResourceVariables() { return resource_variables_; }
 
  private:
+  // A convolution node and the padding of the PAD operator folded into it.
+  struct FoldedPad {
+    const TfLiteNode* node;
+    TfLitePaddingValues padding;
+  };
+
+  // Checks if the PAD operator at pad_idx can be folded. If so, returns the
+  // index of the consuming convolution and the padding it has to apply.
+  bool CanFoldPad(int subgraph_idx, uint32_t pad_idx, uint32_t* consumer_idx,
+                  TfLitePaddingValues* padding);
+
   TfLiteContext* context_;
   const Model* model_;
   MicroAllocator* allocator_;
   SubgraphAllocations* subgraph_allocations_ = nullptr;
+  FoldedPad* folded_pads_ = nullptr;
+  int folded_pad_count_ = 0;
   int current_subgraph_index_;
   uint32_t current_operator_index_;
   MicroResourceVariables* resource_variables_;
@@ -0,0 +1,469 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Checks MicroInterpreterGraph::FoldPadOperators on int8 PAD + CONV_2D and
+// PAD + DEPTHWISE_CONV_2D models.
+//
+// A folded model must give the same output bytes as the same model with the
+// PAD output also listed as a subgraph output, which keeps the PAD. The
+// paddings are asymmetric, with more on the bottom and right, and the shapes
+// reach the 1x1, 1xN, Winograd and generic convolutions and the 3x3, s8_opt
+// and generic depthwise convolutions. Models that must keep their PAD
+// (batch or channel padding, two readers, a SAME consumer, the PAD output as
+// a subgraph output, and a PAD that changes the quantization) are checked to
+// still allocate the PAD output, and paddings that are not constant to still
+// be rejected by the PAD kernel.
+//
+// Only built on request, since the firmware build globs every .cc file.
+// From the LiteRT directory:
+//
+//   g++ -O2 -std=c++17 -DTFLM_HOST_TEST -DTF_LITE_STATIC_MEMORY -DCMSIS_NN
+//       -I. -Ithird_party/flatbuffers/include -Ithird_party/gemmlowp
+//       -Ithird_party/ruy -I../CMSIS_NN-metal -I../CMSIS_NN-metal/Include
+//       tensorflow/lite/micro/micro_interpreter_graph_test.cc
+//       libtflm_host.a -o micro_interpreter_graph_test
+//
+// where libtflm_host.a holds the tensorflow/lite sources, with the cmsis_nn
+// kernels, and the CMSIS-NN sources built for the host with -fno-exceptions,
+// with a DebugLog() that prints to stderr in place of the UART one of
+// tensorflow/lite/micro/debug_log.cc. Build the CMSIS-NN sources once more
+// with -DARM_MATH_RISCV to run the depthwise models through
+// arm_depthwise_conv_row_reuse_s8, as on the target.
+
+#if defined(TFLM_HOST_TEST)
+
+#include "tensorflow/lite/micro/micro_interpreter_graph.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <vector>
+
+#include "flatbuffers/flatbuffers.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/micro/micro_testing.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace tflite {
+namespace testing {
+namespace {
+
+constexpr int kArenaSize = 64 * 1024;
+constexpr float kInputScale = 0.05f;
+constexpr int kInputZeroPoint = -3;
+constexpr float kOutputScale = 0.25f;
+constexpr int kOutputZeroPoint = 5;
+
+// Tensors of the models built by PadConvModel.
+constexpr int kInputTensor = 0;
+constexpr int kPaddingsTensor = 1;
+constexpr int kPadOutputTensor = 2;
+constexpr int kFilterTensor = 3;
+constexpr int kBiasTensor = 4;
+constexpr int kOutputTensor = 5;
+constexpr int kSecondOutputTensor = 6;
+
+struct PadConvConfig {
+  bool depthwise;
+  int input_height;
+  int input_width;
+  int input_channels;
+  // Output channels of CONV_2D, or depth multiplier of DEPTHWISE_CONV_2D.
+  int channels_or_multiplier;
+  int filter_height;
+  int filter_width;
+  int stride;
+  // PAD paddings, {before, after} for batch, height, width and channels.
+  int paddings[4][2];
+  Padding conv_padding;
+  // What keeps the PAD from being folded, if anything.
+  bool paddings_are_input;
+  bool two_readers;
+  bool pad_output_is_subgraph_output;
+  int pad_output_zero_point;
+};
+
+PadConvConfig Conv(int height, int width, int channels, int output_channels,
+                   int filter_height, int filter_width, int stride, int top,
+                   int bottom, int left, int right) {
+  return {false,
+          height,
+          width,
+          channels,
+          output_channels,
+          filter_height,
+          filter_width,
+          stride,
+          {{0, 0}, {top, bottom}, {left, right}, {0, 0}},
+          Padding_VALID,
+          false,
+          false,
+          false,
+          kInputZeroPoint};
+}
+
+PadConvConfig DepthwiseConv(int height, int width, int channels,
+                            int multiplier, int filter_height,
+                            int filter_width, int stride, int top, int bottom,
+                            int left, int right) {
+  PadConvConfig c = Conv(height, width, channels, multiplier, filter_height,
+                         filter_width, stride, top, bottom, left, right);
+  c.depthwise = true;
+  return c;
+}
+
+uint32_t seed = 1;
+
+int RandomInt(int min, int max) {
+  seed = seed * 1103515245u + 12345u;
+  return min + static_cast<int>((seed >> 8) % (max - min + 1));
+}
+
+// TF_LITE_STATIC_MEMORY builds have no default flatbuffers allocator.
+class HeapAllocator : public flatbuffers::Allocator {
+ public:
+  uint8_t* allocate(size_t size) override { return new uint8_t[size]; }
+  void deallocate(uint8_t* p, size_t) override { delete[] p; }
+};
+
+// X -> PAD -> CONV_2D or DEPTHWISE_CONV_2D -> Y, with random int8 filter and
+// int32 bias. A second reader is another convolution with the same filter.
+class PadConvModel {
+ public:
+  PadConvModel(const PadConvConfig& c, bool keep_pad)
+      : builder_(1024, &allocator_) {
+    using flatbuffers::Offset;
+    const int pad_height =
+        c.input_height + c.paddings[1][0] + c.paddings[1][1];
+    const int pad_width = c.input_width + c.paddings[2][0] + c.paddings[2][1];
+    const int pad_channels =
+        c.input_channels + c.paddings[3][0] + c.paddings[3][1];
+    const int output_channels = c.depthwise
+                                    ? pad_channels * c.channels_or_multiplier
+                                    : c.channels_or_multiplier;
+    const int output_height =
+        c.conv_padding == Padding_SAME
+            ? (pad_height + c.stride - 1) / c.stride
+            : (pad_height - c.filter_height) / c.stride + 1;
+    const int output_width =
+        c.conv_padding == Padding_SAME
+            ? (pad_width + c.stride - 1) / c.stride
+            : (pad_width - c.filter_width) / c.stride + 1;
+
+    std::vector<int32_t> paddings;
+    for (int d = 0; d < 4; ++d) {
+      paddings.push_back(c.paddings[d][0]);
+      paddings.push_back(c.paddings[d][1]);
+    }
+    const int filter_size = c.filter_height * c.filter_width * output_channels *
+                            (c.depthwise ? 1 : pad_channels);
+    std::vector<int8_t> filter(filter_size);
+    for (int8_t& v : filter) v = RandomInt(-127, 127);
+    std::vector<float> filter_scales(output_channels);
+    std::vector<int64_t> filter_zero_points(output_channels, 0);
+    std::vector<float> bias_scales(output_channels);
+    std::vector<int64_t> bias_zero_points(output_channels, 0);
+    std::vector<int32_t> bias(output_channels);
+    for (int i = 0; i < output_channels; ++i) {
+      filter_scales[i] = 0.002f * RandomInt(1, 8);
+      bias_scales[i] = kInputScale * filter_scales[i];
+      bias[i] = RandomInt(-2000, 2000);
+    }
+
+    const Offset<Buffer> buffers[] = {
+        CreateBuffer(builder_),
+        CreateBuffer(builder_, Bytes(paddings.data(), paddings.size())),
+        CreateBuffer(builder_, Bytes(filter.data(), filter.size())),
+        CreateBuffer(builder_, Bytes(bias.data(), bias.size()))};
+    const uint32_t paddings_buffer = c.paddings_are_input ? 0 : 1;
+
+    const std::vector<int32_t> input_shape = {1, c.input_height,
+                                              c.input_width, c.input_channels};
+    const std::vector<int32_t> pad_shape = {1, pad_height, pad_width,
+                                            pad_channels};
+    const std::vector<int32_t> filter_shape =
+        c.depthwise ? std::vector<int32_t>{1, c.filter_height, c.filter_width,
+                                           output_channels}
+                    : std::vector<int32_t>{output_channels, c.filter_height,
+                                           c.filter_width, pad_channels};
+    const std::vector<int32_t> output_shape = {1, output_height, output_width,
+                                               output_channels};
+    const Offset<Tensor> tensors[] = {
+        CreateTensor(builder_, builder_.CreateVector(input_shape),
+                     TensorType_INT8, 0, 0,
+                     Quantization({kInputScale}, {kInputZeroPoint}, 0)),
+        CreateTensor(builder_, builder_.CreateVector<int32_t>({4, 2}),
+                     TensorType_INT32, paddings_buffer),
+        CreateTensor(builder_, builder_.CreateVector(pad_shape),
+                     TensorType_INT8, 0, 0,
+                     Quantization({kInputScale}, {c.pad_output_zero_point},
+                                  0)),
+        CreateTensor(builder_, builder_.CreateVector(filter_shape),
+                     TensorType_INT8, 2, 0,
+                     Quantization(filter_scales, filter_zero_points,
+                                  c.depthwise ? 3 : 0)),
+        CreateTensor(builder_,
+                     builder_.CreateVector<int32_t>({output_channels}),
+                     TensorType_INT32, 3, 0,
+                     Quantization(bias_scales, bias_zero_points, 0)),
+        CreateTensor(builder_, builder_.CreateVector(output_shape),
+                     TensorType_INT8, 0, 0,
+                     Quantization({kOutputScale}, {kOutputZeroPoint}, 0)),
+        CreateTensor(builder_, builder_.CreateVector(output_shape),
+                     TensorType_INT8, 0, 0,
+                     Quantization({kOutputScale}, {kOutputZeroPoint}, 0))};
+
+    const BuiltinOperator conv_op = c.depthwise
+                                        ? BuiltinOperator_DEPTHWISE_CONV_2D
+                                        : BuiltinOperator_CONV_2D;
+    const Offset<OperatorCode> operator_codes[] = {
+        CreateOperatorCode(builder_, BuiltinOperator_PAD, 0, 1,
+                           BuiltinOperator_PAD),
+        CreateOperatorCode(builder_, conv_op, 0, 1, conv_op)};
+
+    std::vector<Offset<Operator>> operators;
+    operators.push_back(CreateOperator(
+        builder_, 0,
+        builder_.CreateVector<int32_t>({kInputTensor, kPaddingsTensor}),
+        builder_.CreateVector<int32_t>({kPadOutputTensor})));
+    const int conv_outputs[] = {kOutputTensor, kSecondOutputTensor};
+    for (int i = 0; i < (c.two_readers ? 2 : 1); ++i) {
+      const Offset<void> options =
+          c.depthwise ? CreateDepthwiseConv2DOptions(
+                            builder_, c.conv_padding, c.stride, c.stride,
+                            c.channels_or_multiplier)
+                            .Union()
+                      : CreateConv2DOptions(builder_, c.conv_padding,
+                                            c.stride, c.stride)
+                            .Union();
+      operators.push_back(CreateOperator(
+          builder_, 1,
+          builder_.CreateVector<int32_t>(
+              {kPadOutputTensor, kFilterTensor, kBiasTensor}),
+          builder_.CreateVector<int32_t>({conv_outputs[i]}),
+          c.depthwise ? BuiltinOptions_DepthwiseConv2DOptions
+                      : BuiltinOptions_Conv2DOptions,
+          options));
+    }
+
+    std::vector<int32_t> inputs = {kInputTensor};
+    if (c.paddings_are_input) inputs.push_back(kPaddingsTensor);
+    std::vector<int32_t> outputs = {kOutputTensor};
+    if (c.two_readers) outputs.push_back(kSecondOutputTensor);
+    if (keep_pad || c.pad_output_is_subgraph_output) {
+      outputs.push_back(kPadOutputTensor);
+    }
+    const Offset<SubGraph> subgraph = CreateSubGraph(
+        builder_, builder_.CreateVector(tensors, 7),
+        builder_.CreateVector(inputs), builder_.CreateVector(outputs),
+        builder_.CreateVector(operators));
+    builder_.Finish(CreateModel(builder_, TFLITE_SCHEMA_VERSION,
+                                builder_.CreateVector(operator_codes, 2),
+                                builder_.CreateVector(&subgraph, 1),
+                                builder_.CreateString(""),
+                                builder_.CreateVector(buffers, 4)));
+  }
+
+  const Model* model() const { return GetModel(builder_.GetBufferPointer()); }
+
+ private:
+  template <typename T>
+  flatbuffers::Offset<flatbuffers::Vector<uint8_t>> Bytes(const T* data,
+                                                          size_t size) {
+    return builder_.CreateVector(reinterpret_cast<const uint8_t*>(data),
+                                 size * sizeof(T));
+  }
+
+  flatbuffers::Offset<QuantizationParameters> Quantization(
+      const std::vector<float>& scales,
+      const std::vector<int64_t>& zero_points, int quantized_dimension) {
+    return CreateQuantizationParameters(
+        builder_, 0, 0, builder_.CreateVector(scales),
+        builder_.CreateVector(zero_points), QuantizationDetails_NONE, 0,
+        quantized_dimension);
+  }
+
+  HeapAllocator allocator_;
+  flatbuffers::FlatBufferBuilder builder_;
+};
+
+// Gives access to the eval tensors the allocator committed.
+class ContextMicroInterpreter : public MicroInterpreter {
+ public:
+  using MicroInterpreter::context;
+  using MicroInterpreter::MicroInterpreter;
+};
+
+struct PadConvResult {
+  TfLiteStatus allocate_status;
+  bool pad_output_allocated;
+  std::vector<int8_t> output;
+};
+
+PadConvResult Run(const PadConvConfig& c, bool keep_pad,
+                  const std::vector<int8_t>& input) {
+  const PadConvModel model(c, keep_pad);
+  alignas(16) static uint8_t arena[kArenaSize];
+  memset(arena, 0xa5, kArenaSize);
+  MicroMutableOpResolver<3> resolver;
+  TF_LITE_MICRO_EXPECT_EQ(resolver.AddPad(), kTfLiteOk);
+  TF_LITE_MICRO_EXPECT_EQ(resolver.AddConv2D(), kTfLiteOk);
+  TF_LITE_MICRO_EXPECT_EQ(resolver.AddDepthwiseConv2D(), kTfLiteOk);
+  ContextMicroInterpreter interpreter(model.model(), resolver, arena,
+                                      kArenaSize);
+
+  PadConvResult result;
+  result.allocate_status = interpreter.AllocateTensors();
+  if (result.allocate_status != kTfLiteOk) return result;
+  const TfLiteContext& context = interpreter.context();
+  result.pad_output_allocated =
+      context.GetEvalTensor(&context, kPadOutputTensor)->data.data != nullptr;
+
+  memcpy(interpreter.input(0)->data.int8, input.data(), input.size());
+  TF_LITE_MICRO_EXPECT_EQ(interpreter.Invoke(), kTfLiteOk);
+  const TfLiteTensor* output = interpreter.output(0);
+  result.output.assign(output->data.int8, output->data.int8 + output->bytes);
+  return result;
+}
+
+std::vector<int8_t> RandomInput(const PadConvConfig& c) {
+  std::vector<int8_t> input(c.input_height * c.input_width *
+                            c.input_channels);
+  for (int8_t& v : input) v = RandomInt(-128, 127);
+  return input;
+}
+
+void TestFoldedMatchesUnfolded(const PadConvConfig& c) {
+  const std::vector<int8_t> input = RandomInput(c);
+  const uint32_t model_seed = seed;
+  const PadConvResult folded = Run(c, false, input);
+  // Same filter and bias for the unfolded model.
+  seed = model_seed;
+  const PadConvResult unfolded = Run(c, true, input);
+
+  TF_LITE_MICRO_EXPECT_EQ(folded.allocate_status, kTfLiteOk);
+  TF_LITE_MICRO_EXPECT_EQ(unfolded.allocate_status, kTfLiteOk);
+  TF_LITE_MICRO_EXPECT(!folded.pad_output_allocated);
+  TF_LITE_MICRO_EXPECT(unfolded.pad_output_allocated);
+  TF_LITE_MICRO_EXPECT_EQ(folded.output.size(), unfolded.output.size());
+  for (size_t i = 0; i < unfolded.output.size(); ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(folded.output[i], unfolded.output[i]);
+  }
+}
+
+void TestPadIsKept(const PadConvConfig& c) {
+  const PadConvResult result = Run(c, false, RandomInput(c));
+  TF_LITE_MICRO_EXPECT_EQ(result.allocate_status, kTfLiteOk);
+  TF_LITE_MICRO_EXPECT(result.pad_output_allocated);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace tflite
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(FoldedPadConvMatchesUnfolded) {
+  using tflite::testing::Conv;
+  using tflite::testing::TestFoldedMatchesUnfolded;
+  // Generic kernel, strides 1 and 2, more padding at the bottom and right.
+  TestFoldedMatchesUnfolded(Conv(6, 7, 8, 4, 3, 3, 2, 1, 2, 0, 2));
+  TestFoldedMatchesUnfolded(Conv(5, 5, 3, 4, 2, 3, 1, 0, 1, 2, 3));
+  // 3x3 stride 1 with constant weights goes through Winograd.
+  TestFoldedMatchesUnfolded(Conv(6, 6, 8, 8, 3, 3, 1, 1, 2, 1, 2));
+  TestFoldedMatchesUnfolded(Conv(5, 7, 4, 4, 3, 3, 1, 0, 2, 0, 1));
+  // 1x1 with padding only on the bottom and right.
+  TestFoldedMatchesUnfolded(Conv(4, 4, 8, 8, 1, 1, 1, 0, 1, 0, 1));
+  TestFoldedMatchesUnfolded(Conv(5, 5, 8, 4, 1, 1, 2, 0, 2, 0, 2));
+  // 1xN, padded as for SAME and with all of it on the right.
+  TestFoldedMatchesUnfolded(Conv(1, 9, 4, 4, 1, 3, 1, 0, 0, 1, 1));
+  TestFoldedMatchesUnfolded(Conv(1, 9, 4, 4, 1, 3, 1, 0, 0, 0, 2));
+  TestFoldedMatchesUnfolded(Conv(1, 8, 4, 4, 1, 3, 1, 0, 0, 1, 3));
+}
+
+TF_LITE_MICRO_TEST(FoldedPadDepthwiseConvMatchesUnfolded) {
+  using tflite::testing::DepthwiseConv;
+  using tflite::testing::TestFoldedMatchesUnfolded;
+  // 3x3 kernel: at most one row or column on the top and left, up to two on
+  // the bottom and one on the right, with channels in groups of four and left
+  // over. Stride 2 leaves the second padded column on the right unread.
+  TestFoldedMatchesUnfolded(DepthwiseConv(7, 7, 4, 1, 3, 3, 2, 1, 2, 1, 2));
+  TestFoldedMatchesUnfolded(DepthwiseConv(6, 5, 5, 1, 3, 3, 2, 0, 1, 1, 0));
+  TestFoldedMatchesUnfolded(DepthwiseConv(5, 6, 6, 1, 3, 3, 1, 0, 2, 1, 1));
+  // s8_opt: a 3x3 filter with two columns on the right or on the left, which
+  // the 3x3 kernel does not take, and a 5x5 filter.
+  TestFoldedMatchesUnfolded(DepthwiseConv(6, 6, 8, 1, 3, 3, 1, 1, 2, 1, 2));
+  TestFoldedMatchesUnfolded(DepthwiseConv(5, 6, 6, 1, 3, 3, 1, 0, 2, 0, 2));
+  TestFoldedMatchesUnfolded(DepthwiseConv(6, 6, 8, 1, 3, 3, 1, 0, 1, 2, 3));
+  TestFoldedMatchesUnfolded(DepthwiseConv(7, 6, 6, 1, 5, 5, 1, 1, 3, 2, 3));
+  TestFoldedMatchesUnfolded(DepthwiseConv(8, 8, 4, 1, 5, 5, 2, 2, 3, 0, 2));
+  // Generic kernel with a depth multiplier.
+  TestFoldedMatchesUnfolded(DepthwiseConv(5, 5, 3, 2, 3, 3, 1, 1, 2, 0, 2));
+}
+
+TF_LITE_MICRO_TEST(PadWithPaddingsInputIsKept) {
+  tflite::testing::PadConvConfig c =
+      tflite::testing::Conv(6, 6, 8, 4, 3, 3, 1, 1, 1, 1, 1);
+  c.paddings_are_input = true;
+  // PAD only takes constant paddings, so a PAD that is kept fails to
+  // prepare, where a folded one would have dropped the check.
+  const tflite::testing::PadConvResult result =
+      tflite::testing::Run(c, false, tflite::testing::RandomInput(c));
+  TF_LITE_MICRO_EXPECT_EQ(result.allocate_status, kTfLiteError);
+}
+
+TF_LITE_MICRO_TEST(PadOfBatchOrChannelsIsKept) {
+  tflite::testing::PadConvConfig c =
+      tflite::testing::Conv(6, 6, 8, 4, 3, 3, 1, 1, 1, 1, 1);
+  c.paddings[3][1] = 2;
+  tflite::testing::TestPadIsKept(c);
+  c = tflite::testing::DepthwiseConv(6, 6, 8, 1, 3, 3, 1, 1, 1, 1, 1);
+  c.paddings[3][0] = 4;
+  tflite::testing::TestPadIsKept(c);
+}
+
+TF_LITE_MICRO_TEST(PadWithTwoReadersIsKept) {
+  tflite::testing::PadConvConfig c =
+      tflite::testing::Conv(6, 6, 8, 4, 3, 3, 1, 1, 1, 1, 1);
+  c.two_readers = true;
+  tflite::testing::TestPadIsKept(c);
+}
+
+TF_LITE_MICRO_TEST(PadIntoSameConvIsKept) {
+  tflite::testing::PadConvConfig c =
+      tflite::testing::DepthwiseConv(6, 6, 8, 1, 3, 3, 1, 1, 1, 1, 1);
+  c.conv_padding = tflite::Padding_SAME;
+  tflite::testing::TestPadIsKept(c);
+}
+
+TF_LITE_MICRO_TEST(PadOutputAsSubgraphOutputIsKept) {
+  tflite::testing::PadConvConfig c =
+      tflite::testing::Conv(6, 6, 8, 4, 3, 3, 1, 1, 1, 1, 1);
+  c.pad_output_is_subgraph_output = true;
+  tflite::testing::TestPadIsKept(c);
+}
+
+TF_LITE_MICRO_TEST(PadChangingQuantizationIsKept) {
+  tflite::testing::PadConvConfig c =
+      tflite::testing::DepthwiseConv(6, 6, 8, 1, 3, 3, 1, 1, 1, 1, 1);
+  c.pad_output_zero_point = tflite::testing::kInputZeroPoint + 7;
+  tflite::testing::TestPadIsKept(c);
+}
+
+TF_LITE_MICRO_TESTS_END
+
+#endif  // defined(TFLM_HOST_TEST)
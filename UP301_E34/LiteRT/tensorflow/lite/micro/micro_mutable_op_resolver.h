@@ -144,6 +144,11 @@ class MicroMutableOpResolver : public MicroOpResolver {
                       tflite::Register_ASSIGN_VARIABLE(), ParseAssignVariable);
   }
 
+  TfLiteStatus AddAudioFrontend() {
+    return AddCustom("SignalAudioFrontend",
+                     tflite::tflm_signal::Register_AUDIO_FRONTEND());
+  }
+
   TfLiteStatus AddAveragePool2D(
       const TFLMRegistration& registration = Register_AVERAGE_POOL_2D()) {
     return AddBuiltin(BuiltinOperator_AVERAGE_POOL_2D, registration, ParsePool);
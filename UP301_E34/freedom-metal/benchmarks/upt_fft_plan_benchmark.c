@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2025 UpbeatTech Inc. All Rights Reserved
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX short identifier: Apache-2.0
+ */
+
+/*
+ * Host benchmark of the plan based FFT against the radix-2 fft()/rfft() it
+ * replaces in fft_execute(). Reports time per transform and the worst
+ * error of each against a double precision DFT. The legacy path is timed
+ * with and without the twiddle computation that upt_fft_init() ran on
+ * every initialization; the plan path includes the cache lookup of
+ * upt_fft_init(). The q31 line times fft_fixed() on its cached plan.
+ *
+ * Only built on request, with a cache large enough for every plan. From the
+ * freedom-metal directory:
+ *
+ *   cc -O2 -DUPT_FFT_HOST_BENCHMARK -DUPT_FFT_PLAN_POOL_SIZE=65536
+ *      -DUPT_FFT_PLAN_CACHE_SIZE=16 -I. -Imetal/drivers -I../bsp
+ *      benchmarks/upt_fft_plan_benchmark.c src/upt_fft_plan.c
+ *      src/upt_floatp_fft.c src/upt_fixp_fft.c -lm -lpthread
+ *      -o upt_fft_plan_benchmark
+ */
+
+#if defined(UPT_FFT_HOST_BENCHMARK)
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "metal/drivers/upt_fft.h"
+#include "metal/drivers/upt_fft_plan.h"
+#include "metal/drivers/upt_fixp_fft.h"
+
+#define BENCH_MAX_SIZE 1024
+#define BENCH_WORK 2000000 // points transformed per timing loop
+
+static float input[2 * BENCH_MAX_SIZE];
+static float work[2 * BENCH_MAX_SIZE];
+static float output[2 * BENCH_MAX_SIZE];
+static float twiddle[2 * BENCH_MAX_SIZE];
+static double spectrum[2 * BENCH_MAX_SIZE];
+
+static double now_ns(void) {
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+/* DFT of n complex points, or of n real samples if real */
+static void dft(const float *x, int32_t n, int real) {
+    const double pi = acos(-1.0);
+
+    for (int32_t k = 0; k < n; k++) {
+        double re = 0.0;
+        double im = 0.0;
+
+        for (int32_t m = 0; m < n; m++) {
+            double angle = -2.0 * pi * (double)((int64_t)k * m % n) / n;
+            double xr = real ? x[m] : x[2 * m];
+            double xi = real ? 0.0 : x[2 * m + 1];
+
+            re += xr * cos(angle) - xi * sin(angle);
+            im += xr * sin(angle) + xi * cos(angle);
+        }
+        spectrum[2 * k] = re;
+        spectrum[2 * k + 1] = im;
+    }
+}
+
+/* Worst error of out, complex or in the packed real layout of fft_execute */
+static double max_error(const float *out, int32_t n, int real) {
+    double err = 0.0;
+
+    if (!real) {
+        for (int32_t i = 0; i < 2 * n; i++) {
+            err = fmax(err, fabs(out[i] - spectrum[i]));
+        }
+        return err;
+    }
+    err = fmax(fabs(out[0] - spectrum[0]), fabs(out[1] - spectrum[n]));
+    for (int32_t k = 1; k < n / 2; k++) {
+        err = fmax(err, fabs(out[2 * k] - spectrum[2 * k]));
+        err = fmax(err, fabs(out[2 * k + 1] - spectrum[2 * k + 1]));
+    }
+    return err;
+}
+
+static void legacy_twiddles(int32_t n) {
+    const float two_pi_by_n = 2.0f * (float)acos(-1.0) / n;
+
+    for (int32_t k = 0; k < n; k++) {
+        twiddle[2 * k] = cosf(two_pi_by_n * k);
+        twiddle[2 * k + 1] = sinf(two_pi_by_n * k);
+    }
+}
+
+static void legacy_forward(int32_t n, int real) {
+    memcpy(work, input, sizeof(input));
+    if (real) {
+        rfft(work, output, twiddle, n);
+    } else {
+        fft(work, output, twiddle, n);
+    }
+}
+
+static void benchmark_f32(int32_t n, int real) {
+    fft_Type type = real ? FFT_REAL : FFT_COMPLEX;
+    int32_t len = real ? n : 2 * n;
+    int32_t iterations = BENCH_WORK / n;
+    fft_config_Type config;
+    double legacy_err, plan_err, t0, t1, t2, t3;
+
+    for (int32_t i = 0; i < len; i++) {
+        input[i] = (float)rand() / RAND_MAX * 2.0f - 1.0f;
+    }
+    dft(input, n, real);
+
+    legacy_twiddles(n);
+    legacy_forward(n, real);
+    legacy_err = max_error(output, n, real);
+    if (upt_fft_init(&config, n, type, FFT_FORWARD, input, output, NULL) !=
+        0) {
+        printf("no plan for n %d, is the cache large enough?\n", (int)n);
+        exit(1);
+    }
+    fft_execute(&config);
+    plan_err = max_error(output, n, real);
+
+    t0 = now_ns();
+    for (int32_t i = 0; i < iterations; i++) {
+        legacy_twiddles(n);
+        legacy_forward(n, real);
+    }
+    t1 = now_ns();
+    for (int32_t i = 0; i < iterations; i++) {
+        legacy_forward(n, real);
+    }
+    t2 = now_ns();
+    for (int32_t i = 0; i < iterations; i++) {
+        upt_fft_init(&config, n, type, FFT_FORWARD, input, output, NULL);
+        fft_execute(&config);
+    }
+    t3 = now_ns();
+
+    printf("f32 %-7s n %4d: legacy %8.0f ns (%8.0f ns with twiddles, "
+           "max err %.1e), plan %8.0f ns (max err %.1e), speedup %.2fx\n",
+           real ? "real" : "complex", (int)n, (t2 - t1) / iterations,
+           (t1 - t0) / iterations, legacy_err, (t3 - t2) / iterations,
+           plan_err, (t2 - t1) / (t3 - t2));
+}
+
+static void benchmark_q31(int32_t n) {
+    static int32_t real[BENCH_MAX_SIZE], imag[BENCH_MAX_SIZE];
+    int32_t iterations = BENCH_WORK / n;
+    /* log2(n) bits of headroom */
+    double scale = 2147483648.0 / (2 * n);
+    double err = 0.0;
+    double t0, t1;
+
+    /* Otherwise fft_fixed() falls back to its direct computation */
+    if (upt_fft_plan_get(n, FFT_COMPLEX, UPT_FFT_Q31) == NULL) {
+        printf("no plan for n %d, is the cache large enough?\n", (int)n);
+        exit(1);
+    }
+    for (int32_t i = 0; i < 2 * n; i++) {
+        input[i] = (float)rand() / RAND_MAX * 2.0f - 1.0f;
+    }
+    dft(input, n, 0);
+    for (int32_t i = 0; i < n; i++) {
+        real[i] = (int32_t)lrint(input[2 * i] * scale);
+        imag[i] = (int32_t)lrint(input[2 * i + 1] * scale);
+    }
+    fft_fixed(real, imag, n);
+    for (int32_t i = 0; i < n; i++) {
+        err = fmax(err, fabs(real[i] - spectrum[2 * i] * scale));
+        err = fmax(err, fabs(imag[i] - spectrum[2 * i + 1] * scale));
+    }
+
+    t0 = now_ns();
+    for (int32_t i = 0; i < iterations; i++) {
+        fft_fixed(real, imag, n);
+    }
+    t1 = now_ns();
+
+    printf("q31 complex n %4d: fft_fixed %8.0f ns (max err %.1f LSB)\n",
+           (int)n, (t1 - t0) / iterations, err);
+}
+
+int main(void) {
+    for (int32_t n = 64; n <= BENCH_MAX_SIZE; n *= 4) {
+        benchmark_f32(n, 0);
+        benchmark_f32(n, 1);
+        benchmark_q31(n);
+    }
+    return 0;
+}
+
+#endif /* defined(UPT_FFT_HOST_BENCHMARK) */
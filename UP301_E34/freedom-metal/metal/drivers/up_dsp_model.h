@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2025 UpbeatTech Inc. All Rights Reserved
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX short identifier: Apache-2.0
+ */
+
+#ifndef UPT_METAL_DRIVERS_DSP_MODEL_H
+#define UPT_METAL_DRIVERS_DSP_MODEL_H
+
+/*
+ * C model of the UDL DSP block, used in place of the hardware driver when
+ * code that talks to the DSP is built and tested on a host.
+ *
+ * Build src/up_dsp_model.c and src/dsp_queue.c with UPT_DSP_HOST_MODEL
+ * defined (and without src/dsp.c, which needs the target device tree), and
+ * link with -lpthread. upt_dsp_get_device() then returns the model for
+ * every device index, so callers need no changes.
+ *
+ * The model also has job ops for metal/dsp_queue.h (upt_dsp_model_job_ops):
+ * jobs run on a worker thread, which then calls the handler registered with
+ * upt_dsp_model_set_irq_handler() if the IRQ is enabled, like the DSP
+ * interrupt on the target.
+ *
+ * Numerics follow the contract documented in metal/dsp.h:
+ *  - the transform is computed in 64-bit with Q20 twiddles,
+ *  - results are block normalised: every output is rounded to nearest after
+ *    a right shift by the smallest scale factor that makes the whole block
+ *    fit the output type, and that shift is returned in sfDst/pScale,
+ *  - q31 dot products truncate each product to 2.60 before accumulation.
+ */
+
+#include <stdint.h>
+#include "metal/dsp.h"
+#include "metal/dsp_queue.h"
+
+#define UPT_DSP_MODEL_MAX_FFT_LEN  1024
+
+extern const struct metal_dsp_vtable upt_dsp_model_vtable;
+
+/* Asynchronous interface for upt_dsp_queue_init() */
+extern const upt_dsp_job_ops_Type upt_dsp_model_job_ops;
+
+/*!
+ * @brief Number of operations the model has executed since the last reset.
+ *        Lets host tests check that a code path actually reached the DSP.
+ */
+uint32_t upt_dsp_model_op_count(void);
+
+void upt_dsp_model_reset(void);
+
+/*!
+ * @brief Make every following operation return E_DSP_ERROR (or succeed
+ *        again with fail = 0), to exercise callers' CPU fallbacks.
+ */
+void upt_dsp_model_force_error(int fail);
+
+/*!
+ * @brief Handler of the model "IRQ", called on the worker thread after each
+ *        job started through upt_dsp_model_job_ops, e.g. upt_dsp_queue_isr
+ *        with the queue.
+ */
+void upt_dsp_model_set_irq_handler(void (*handler)(uint32_t id, void *data),
+                                   void *data);
+
+#endif /* UPT_METAL_DRIVERS_DSP_MODEL_H */
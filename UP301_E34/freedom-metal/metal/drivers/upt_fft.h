@@ -45,6 +45,8 @@ typedef enum { FFT_FORWARD, FFT_BACKWARD } fft_direction_Type;
 #define FFT_OWN_INPUT_MEM 1
 #define FFT_OWN_OUTPUT_MEM 2
 
+struct upt_fft_plan;
+
 typedef struct {
   int32_t size;                  // FFT size
   float *input;              // pointer to input buffer
@@ -53,8 +55,16 @@ typedef struct {
   fft_Type type;           // real or complex
   fft_direction_Type direction; // forward or backward
   uint32_t flags;        // FFT flags
+  const struct upt_fft_plan *plan; // cached plan (upt_fft_plan.h), or NULL
 } fft_config_Type;
 
+/*
+ * upt_fft_init() binds the config to a cached plan when the size has one,
+ * and fft_execute() then runs the plan instead of the recursive FFT below.
+ * twiddle may be NULL in that case; when given it is still filled for
+ * direct calls to fft(), rfft(), ifft() and irfft().
+ */
+
 int32_t upt_fft_init(fft_config_Type *config, int32_t size, fft_Type type,
                      fft_direction_Type direction, float *input, float *output,
                      float *twiddle);
@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2025 UpbeatTech Inc. All Rights Reserved
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX short identifier: Apache-2.0
+ */
+
+#ifndef METAL__DRIVERS__UPT_FFT_PLAN_H
+#define METAL__DRIVERS__UPT_FFT_PLAN_H
+
+/*
+ * Plan based FFT for the CPU, in float or in 32-bit fixed point.
+ *
+ * A plan holds the twiddle factors and the bit reversal table of one size,
+ * type and data format. It is built once, in a buffer given by the caller
+ * (upt_fft_plan_init) or in a static pool with a small cache
+ * (upt_fft_plan_get), and then executed any number of times.
+ *
+ * Transforms run in place with radix-4 butterflies (plus one radix-2 pass
+ * when log2 of the length is odd). A real FFT of size N runs a complex FFT
+ * of N/2 points on the even/odd samples and splits the result.
+ *
+ * Data layout:
+ *  - complex: size interleaved points [re0, im0, re1, im1, ...],
+ *  - real forward: size samples in, size values out, packed as
+ *    [re(X0), re(X_N/2), re(X1), im(X1), ..., re(X_N/2-1), im(X_N/2-1)],
+ *  - real backward: the packed spectrum in, size samples out.
+ *
+ * Scaling follows fft()/ifft() of upt_fft.h: the forward transform is not
+ * scaled, the backward one divides by the size, so backward(forward(x)) = x.
+ * With UPT_FFT_Q31 the data can be in any fixed point format: twiddles are
+ * Q31 and the output keeps the input format, so the input needs log2(size)
+ * bits of headroom for the forward transform.
+ *
+ * Speed: a plan saves the twiddle computation that upt_fft_init() used to
+ * run on every initialization, and keeps the twiddles out of the caller's
+ * buffers. Executing a plan is not faster than the split-radix fft() and
+ * rfft() it replaces: on an x86 host the float transforms run at 0.9x to
+ * 1.1x their speed. Radix-4 does not do fewer multiplications than split
+ * radix, so no gain is expected on the target either.
+ */
+
+#include <stdint.h>
+#include "upt_fft.h"
+
+/* Largest size accepted by a plan */
+#define UPT_FFT_PLAN_MAX_SIZE 8192
+
+/* Bytes of the static pool used by upt_fft_plan_get() */
+#ifndef UPT_FFT_PLAN_POOL_SIZE
+#define UPT_FFT_PLAN_POOL_SIZE 16384
+#endif
+
+/* Number of plans cached by upt_fft_plan_get() */
+#ifndef UPT_FFT_PLAN_CACHE_SIZE
+#define UPT_FFT_PLAN_CACHE_SIZE 8
+#endif
+
+typedef enum { UPT_FFT_F32, UPT_FFT_Q31 } upt_fft_data_Type;
+
+typedef struct upt_fft_plan {
+    int32_t size;           // transform size, samples or complex points
+    int32_t n;              // complex FFT length: size, or size/2 if real
+    fft_Type type;          // real or complex
+    upt_fft_data_Type data; // float or q31
+    const void *twiddle;    // exp(-2*pi*i*k/n) for k < 3n/4, [cos, -sin]
+    const void *rtwiddle;   // exp(-2*pi*i*k/size) for k < size/4, if real
+    const uint16_t *bitrev; // pairs of indexes to swap
+    int32_t bitrev_len;     // number of pairs
+} upt_fft_plan_Type;
+
+/*
+ * Bytes of buffer needed by upt_fft_plan_init(), 0 if the size is not a
+ * power of two between 2 (4 if real) and UPT_FFT_PLAN_MAX_SIZE.
+ */
+uint32_t upt_fft_plan_buffer_size(int32_t size, fft_Type type,
+                                  upt_fft_data_Type data);
+
+/*
+ * Build a plan in buffer, which must be 4-byte aligned and stay valid as
+ * long as the plan is used. Returns 0, or -1 if the size is not supported
+ * or the buffer is too small.
+ */
+int32_t upt_fft_plan_init(upt_fft_plan_Type *plan, int32_t size, fft_Type type,
+                          upt_fft_data_Type data, void *buffer,
+                          uint32_t buffer_size);
+
+/*
+ * Plan from the static cache, built on first use. Returns NULL if the size
+ * is not supported, if the pool is full, or while another task is building
+ * the same plan. Safe to call from several tasks; to avoid the build on the
+ * first call of a task, get the plans at initialization.
+ */
+const upt_fft_plan_Type *upt_fft_plan_get(int32_t size, fft_Type type,
+                                          upt_fft_data_Type data);
+
+void upt_fft_plan_execute_f32(const upt_fft_plan_Type *plan, float *data,
+                              fft_direction_Type direction);
+
+void upt_fft_plan_execute_q31(const upt_fft_plan_Type *plan, int32_t *data,
+                              fft_direction_Type direction);
+
+/* Complex q31 plan on separate real and imaginary arrays */
+void upt_fft_plan_execute_split_q31(const upt_fft_plan_Type *plan,
+                                    int32_t *real, int32_t *imag,
+                                    fft_direction_Type direction);
+
+#endif /* METAL__DRIVERS__UPT_FFT_PLAN_H */
@@ -131,7 +131,7 @@ struct metal_dsp_vtable {
  * @param device_num The index of the desired DSP engine.
  * @return A handle to the DSP, or NULL if the engine does not exist.
  */
-__inline__ metal_dsp_Type *upt_dsp_get_device(enum_dsp_device_Type device_num);
+metal_dsp_Type *upt_dsp_get_device(enum_dsp_device_Type device_num);
 
 
 
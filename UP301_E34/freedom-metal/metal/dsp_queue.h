@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2025 UpbeatTech Inc. All Rights Reserved
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX short identifier: Apache-2.0
+ */
+#ifndef METAL_DSP_QUEUE_H
+#define METAL_DSP_QUEUE_H
+
+/*
+ * Asynchronous job queue on top of the DSP block.
+ *
+ * A job describes one metal/dsp.h operation: the op, its configuration and
+ * its buffers. Submitted jobs run in order on the DSP. When a job completes,
+ * the DSP interrupt handler starts the next queued job and then calls the
+ * callback of the completed one, so the CPU is free between submission and
+ * completion and consecutive jobs follow each other without waiting for a
+ * task to be scheduled.
+ *
+ * Jobs linked through job->next form a chain that is submitted as a unit:
+ * the jobs of a chain run back to back, a later job can read the output of
+ * an earlier one, and if one fails the rest of the chain is not run and
+ * completes with E_DSP_ERROR.
+ *
+ * The asynchronous path needs job ops for the device (upt_dsp_job_ops_Type)
+ * given to upt_dsp_queue_init(), and upt_dsp_queue_isr() registered on the
+ * DSP interrupt:
+ *
+ *     upt_dsp_queue_init(&queue, upt_dsp_get_device(NAON_UDL_1_2_DSP),
+ *                        &job_ops);
+ *     upt_interrupt_register_handle(UPT_INTERRUPT_ID(udl1),
+ *                                   upt_dsp_queue_isr, &queue);
+ *     upt_interrupt_enable(UPT_INTERRUPT_ID(udl1));
+ *
+ * The ops are separate from struct metal_dsp_vtable, whose instance for the
+ * target comes prebuilt in lib_sdk/app/libdrivers.a and cannot grow. With
+ * NULL ops (the blocking driver), upt_dsp_queue_submit() runs the jobs
+ * before returning and calls the callbacks from the caller's context, so
+ * the same code still works, without the overlap.
+ *
+ * Callbacks run in interrupt context. To wake a FreeRTOS task:
+ *
+ *     static void spectrum_done(upt_dsp_job_Type *job, void *arg) {
+ *         BaseType_t woken = pdFALSE;
+ *         vTaskNotifyGiveFromISR((TaskHandle_t)arg, &woken);
+ *         portYIELD_FROM_ISR(woken);
+ *     }
+ *
+ * Jobs must be zero initialized before their first submission. A job and
+ * its buffers belong to the queue from submission until its state is
+ * UPT_DSP_JOB_DONE. The blocking upt_dsp_* calls must not be used on the
+ * same device while jobs are queued.
+ */
+
+#include <stdint.h>
+#include "metal/dsp.h"
+
+typedef enum enum_dsp_job_op {
+    UPT_DSP_JOB_RFFT_Q15,     /**< upt_dsp_rfft_q15() */
+    UPT_DSP_JOB_RFFT_Q31,     /**< upt_dsp_rfft_q31() */
+    UPT_DSP_JOB_DOT_PROD_Q15, /**< upt_dsp_dot_prod_q15() */
+    UPT_DSP_JOB_DOT_PROD_Q31, /**< upt_dsp_dot_prod_q31() */
+    UPT_DSP_JOB_SQRT_Q15,     /**< upt_dsp_sqrt_q15(), length in cfg.length */
+    UPT_DSP_JOB_SQRT_Q31,     /**< upt_dsp_sqrt_q31(), length in cfg.length */
+    UPT_DSP_JOB_SPECTRUM_Q15, /**< upt_dsp_spectrum_q15(), length in cfg.length */
+    UPT_DSP_JOB_SPECTRUM_Q31, /**< upt_dsp_spectrum_q31(), length in cfg.length */
+} enum_dsp_job_op_Type;
+
+typedef enum enum_dsp_job_state {
+    UPT_DSP_JOB_IDLE,    /**< Never submitted. */
+    UPT_DSP_JOB_QUEUED,  /**< Waiting for the DSP. */
+    UPT_DSP_JOB_RUNNING, /**< Started on the DSP. */
+    UPT_DSP_JOB_DONE,    /**< Completed, status is valid. */
+} enum_dsp_job_state_Type;
+
+typedef struct upt_dsp_job upt_dsp_job_Type;
+
+typedef void (*upt_dsp_job_callback_Type)(upt_dsp_job_Type *job, void *arg);
+
+/**
+ * @brief Descriptor of one DSP operation.
+ */
+struct upt_dsp_job {
+    enum_dsp_job_op_Type op;
+    upt_dsp_config_Type cfg; /**< As for the blocking call of op. */
+    void *pSrc;              /**< Input, or source A of a dot product. */
+    const void *pSrcB;       /**< Source B of a dot product. */
+    void *pDst;              /**< Output, or magnitudes of a spectrum. */
+    int32_t scale;           /**< In: sqrt input scale. Out: output scale. */
+
+    upt_dsp_job_callback_Type callback; /**< Called on completion, or NULL. */
+    void *arg;                          /**< Passed to callback. */
+    upt_dsp_job_Type *next;             /**< Next job of the chain, or NULL. */
+
+    /* Written by the queue */
+    volatile enum_dsp_job_state_Type state;
+    volatile enum_dsp_retcode_Type status;
+    upt_dsp_job_Type *link;
+};
+
+/**
+ * @brief Asynchronous interface of a DSP device.
+ */
+typedef struct upt_dsp_job_ops {
+    /** Start the job and return, the DSP interrupt signals its completion. */
+    enum_dsp_retcode_Type (*start_job)(metal_dsp_Type *dsp,
+                                       upt_dsp_job_Type *job);
+    /** Called from the DSP interrupt to finish the job (output, scale),
+     *  returns its status. */
+    enum_dsp_retcode_Type (*job_status)(metal_dsp_Type *dsp,
+                                        upt_dsp_job_Type *job);
+} upt_dsp_job_ops_Type;
+
+/**
+ * @brief Queue of jobs for one DSP device.
+ */
+typedef struct upt_dsp_queue {
+    metal_dsp_Type *dsp;
+    const upt_dsp_job_ops_Type *ops; /**< NULL: jobs run synchronously. */
+    upt_dsp_job_Type *head; /**< Running job, then the queued ones. */
+    upt_dsp_job_Type *tail;
+    uint32_t completed;     /**< Number of jobs completed since init. */
+} upt_dsp_queue_Type;
+
+/**
+ * @brief Initialize a queue, and enable the DSP completion interrupt when
+ *        the jobs run asynchronously.
+ * @param queue The queue
+ * @param dsp The DSP handle
+ * @param ops Asynchronous interface of dsp, or NULL to run the jobs with
+ *        the blocking calls. Both entries must be set.
+ * @return 0 for success, others for error
+ */
+enum_dsp_retcode_Type upt_dsp_queue_init(upt_dsp_queue_Type *queue,
+                                         metal_dsp_Type *dsp,
+                                         const upt_dsp_job_ops_Type *ops);
+
+/**
+ * @brief Queue a job, or a chain of jobs linked through job->next.
+ * @param queue The queue
+ * @param job First job of the chain. No job of the chain may be queued.
+ * @return 0 for success, E_DSP_INVPARA if a job is already queued or has an
+ *         unknown op. Errors of the operation itself are reported in
+ *         job->status.
+ */
+enum_dsp_retcode_Type upt_dsp_queue_submit(upt_dsp_queue_Type *queue,
+                                           upt_dsp_job_Type *job);
+
+/**
+ * @brief Completion handler, to call from the DSP interrupt.
+ * @param queue The queue
+ */
+void upt_dsp_queue_irq_handler(upt_dsp_queue_Type *queue);
+
+/**
+ * @brief upt_dsp_queue_irq_handler() with the metal_interrupt_handler_t
+ *        signature, the queue is the private data of the interrupt.
+ */
+void upt_dsp_queue_isr(uint32_t id, void *data);
+
+/**
+ * @brief Busy wait until a job completes.
+ * @param job A submitted job
+ * @return The status of the job
+ */
+enum_dsp_retcode_Type upt_dsp_job_wait(const upt_dsp_job_Type *job);
+
+/**
+ * @brief Run a job with the blocking call of its op.
+ * @details Used by the queue without job ops, and by drivers to implement
+ *          start_job.
+ * @param dsp The DSP handle
+ * @param job The job
+ * @return The status of the blocking call
+ */
+enum_dsp_retcode_Type upt_dsp_job_execute(metal_dsp_Type *dsp,
+                                          upt_dsp_job_Type *job);
+
+__inline__ int upt_dsp_job_done(const upt_dsp_job_Type *job) {
+    return __atomic_load_n(&job->state, __ATOMIC_ACQUIRE) == UPT_DSP_JOB_DONE;
+}
+
+#endif /* METAL_DSP_QUEUE_H */
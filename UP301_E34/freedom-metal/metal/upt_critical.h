@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2025 UpbeatTech Inc. All Rights Reserved
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX short identifier: Apache-2.0
+ */
+
+/*!
+ * @file upt_critical.h
+ * @brief Short critical sections shared by tasks and interrupt handlers
+ *
+ * On the target, upt_critical_enter() masks machine interrupts and returns
+ * the previous mstatus, which upt_critical_exit() restores, so sections can
+ * nest. On a host build (tests, benchmarks and the DSP host model, where
+ * interrupts are raised by worker threads) a mutex is used instead. Each
+ * file that includes this header gets its own mutex, which is enough since
+ * every section only protects the data of its file, and sections must not
+ * nest there.
+ *
+ * Keep the sections short: on the target nothing else runs while one is
+ * held.
+ */
+#ifndef METAL__UPT_CRITICAL_H
+#define METAL__UPT_CRITICAL_H
+
+#include <stdint.h>
+
+#if defined(__riscv) && !defined(UPT_DSP_HOST_MODEL)
+
+#define UPT_CRITICAL_MSTATUS_MIE 0x8U
+
+static __inline__ uintptr_t upt_critical_enter(void) {
+    uintptr_t mstatus;
+
+    __asm__ volatile("csrrci %0, mstatus, 8" : "=r"(mstatus) : : "memory");
+    return mstatus;
+}
+
+static __inline__ void upt_critical_exit(uintptr_t mstatus) {
+    __asm__ volatile("csrs mstatus, %0"
+                     :
+                     : "r"(mstatus & UPT_CRITICAL_MSTATUS_MIE)
+                     : "memory");
+}
+
+#else
+#include <pthread.h>
+
+static pthread_mutex_t upt_critical_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static __inline__ uintptr_t upt_critical_enter(void) {
+    pthread_mutex_lock(&upt_critical_mutex);
+    return 0;
+}
+
+static __inline__ void upt_critical_exit(uintptr_t state) {
+    (void)state;
+    pthread_mutex_unlock(&upt_critical_mutex);
+}
+
+#endif
+
+#endif /* METAL__UPT_CRITICAL_H */
@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2025 UpbeatTech Inc. All Rights Reserved
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX short identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "metal/dsp.h"
+#include "metal/dsp_queue.h"
+#include "metal/upt_critical.h"
+
+extern __inline__ int upt_dsp_job_done(const upt_dsp_job_Type *job);
+
+/*
+ * The queue is shared by the tasks that submit and by the DSP interrupt,
+ * see upt_critical.h for the lock.
+ */
+
+static int queue_is_async(const upt_dsp_queue_Type *queue) {
+    return queue->ops != NULL;
+}
+
+/* Starts job on the DSP, or runs it when the queue has no job ops. */
+static enum_dsp_retcode_Type queue_start(upt_dsp_queue_Type *queue,
+                                         upt_dsp_job_Type *job) {
+    __atomic_store_n(&job->state, UPT_DSP_JOB_RUNNING, __ATOMIC_RELAXED);
+    if (queue_is_async(queue)) {
+        return queue->ops->start_job(queue->dsp, job);
+    }
+    return upt_dsp_job_execute(queue->dsp, job);
+}
+
+/*
+ * The head job has ended with status. Removes it (and the rest of its chain
+ * if it failed), starts the following job, then completes the removed jobs.
+ * Loops while jobs end without an interrupt: no job ops or failed start.
+ */
+static void queue_advance(upt_dsp_queue_Type *queue,
+                          enum_dsp_retcode_Type status) {
+    for (;;) {
+        upt_dsp_job_Type *done;
+        upt_dsp_job_Type *last;
+        upt_dsp_job_Type *next;
+        enum_dsp_retcode_Type next_status = E_DSP_SUCCESS;
+        uintptr_t state;
+
+        state = upt_critical_enter();
+        done = queue->head;
+        last = done;
+        queue->completed++;
+        if (status != E_DSP_SUCCESS) {
+            while (last->next != NULL && last->link == last->next) {
+                last = last->link;
+                queue->completed++;
+            }
+        }
+        next = last->link;
+        queue->head = next;
+        if (next == NULL) {
+            queue->tail = NULL;
+        }
+        upt_critical_exit(state);
+
+        /* Keep the DSP busy while the callbacks run */
+        if (next != NULL) {
+            next_status = queue_start(queue, next);
+        }
+
+        for (;;) {
+            /* The callback may submit the job again */
+            upt_dsp_job_Type *following = (done == last) ? NULL : done->link;
+
+            done->status = status;
+            /* Outputs and status must be visible before the state */
+            __atomic_store_n(&done->state, UPT_DSP_JOB_DONE, __ATOMIC_RELEASE);
+            if (done->callback != NULL) {
+                done->callback(done, done->arg);
+            }
+            if (following == NULL) {
+                break;
+            }
+            done = following;
+            status = E_DSP_ERROR;
+        }
+
+        if (next == NULL ||
+            (queue_is_async(queue) && next_status == E_DSP_SUCCESS)) {
+            return;
+        }
+        status = next_status;
+    }
+}
+
+enum_dsp_retcode_Type upt_dsp_queue_init(upt_dsp_queue_Type *queue,
+                                         metal_dsp_Type *dsp,
+                                         const upt_dsp_job_ops_Type *ops) {
+    if (queue == NULL || dsp == NULL ||
+        (ops != NULL && (ops->start_job == NULL || ops->job_status == NULL))) {
+        return E_DSP_INVPARA;
+    }
+    queue->dsp = dsp;
+    queue->ops = ops;
+    queue->head = NULL;
+    queue->tail = NULL;
+    queue->completed = 0;
+    if (queue_is_async(queue)) {
+        return upt_dsp_fft_enable_irq(dsp);
+    }
+    return E_DSP_SUCCESS;
+}
+
+enum_dsp_retcode_Type upt_dsp_queue_submit(upt_dsp_queue_Type *queue,
+                                           upt_dsp_job_Type *job) {
+    upt_dsp_job_Type *last = NULL;
+    enum_dsp_retcode_Type status;
+    uintptr_t state;
+    int idle;
+
+    if (queue == NULL || job == NULL) {
+        return E_DSP_INVPARA;
+    }
+    for (upt_dsp_job_Type *j = job; j != NULL; j = j->next) {
+        if (j->state == UPT_DSP_JOB_QUEUED || j->state == UPT_DSP_JOB_RUNNING ||
+            j->op > UPT_DSP_JOB_SPECTRUM_Q31) {
+            return E_DSP_INVPARA;
+        }
+    }
+    for (upt_dsp_job_Type *j = job; j != NULL; j = j->next) {
+        j->status = E_DSP_SUCCESS;
+        j->state = UPT_DSP_JOB_QUEUED;
+        j->link = j->next;
+        last = j;
+    }
+
+    state = upt_critical_enter();
+    idle = queue->head == NULL;
+    if (idle) {
+        queue->head = job;
+    } else {
+        queue->tail->link = job;
+    }
+    queue->tail = last;
+    upt_critical_exit(state);
+
+    if (idle) {
+        status = queue_start(queue, job);
+        if (!queue_is_async(queue) || status != E_DSP_SUCCESS) {
+            queue_advance(queue, status);
+        }
+    }
+    return E_DSP_SUCCESS;
+}
+
+void upt_dsp_queue_irq_handler(upt_dsp_queue_Type *queue) {
+    upt_dsp_job_Type *job;
+    uintptr_t state;
+
+    upt_dsp_fft_clear_irq(queue->dsp);
+
+    state = upt_critical_enter();
+    job = queue->head;
+    upt_critical_exit(state);
+    if (job == NULL || job->state != UPT_DSP_JOB_RUNNING) {
+        return;
+    }
+    queue_advance(queue, queue->ops->job_status(queue->dsp, job));
+}
+
+void upt_dsp_queue_isr(uint32_t id, void *data) {
+    (void)id;
+    upt_dsp_queue_irq_handler((upt_dsp_queue_Type *)data);
+}
+
+enum_dsp_retcode_Type upt_dsp_job_wait(const upt_dsp_job_Type *job) {
+    if (__atomic_load_n(&job->state, __ATOMIC_RELAXED) == UPT_DSP_JOB_IDLE) {
+        return E_DSP_INVPARA;
+    }
+    while (!upt_dsp_job_done(job)) {
+    }
+    return job->status;
+}
+
+enum_dsp_retcode_Type upt_dsp_job_execute(metal_dsp_Type *dsp,
+                                          upt_dsp_job_Type *job) {
+    enum_dsp_retcode_Type ret;
+    int16_t scale;
+
+    switch (job->op) {
+    case UPT_DSP_JOB_RFFT_Q15:
+        return upt_dsp_rfft_q15(dsp, &job->cfg, (int16_t *)job->pSrc,
+                                (int16_t *)job->pDst, &job->scale);
+    case UPT_DSP_JOB_RFFT_Q31:
+        return upt_dsp_rfft_q31(dsp, &job->cfg, (int32_t *)job->pSrc,
+                                (int32_t *)job->pDst, &job->scale);
+    case UPT_DSP_JOB_DOT_PROD_Q15:
+        return upt_dsp_dot_prod_q15(dsp, &job->cfg, (const int16_t *)job->pSrc,
+                                    (const int16_t *)job->pSrcB,
+                                    (int16_t *)job->pDst, &job->scale);
+    case UPT_DSP_JOB_DOT_PROD_Q31:
+        return upt_dsp_dot_prod_q31(dsp, &job->cfg, (const int32_t *)job->pSrc,
+                                    (const int32_t *)job->pSrcB,
+                                    (int32_t *)job->pDst, &job->scale);
+    case UPT_DSP_JOB_SQRT_Q15:
+        scale = (int16_t)job->scale;
+        ret = upt_dsp_sqrt_q15(dsp, (int16_t *)job->pSrc, (int16_t *)job->pDst,
+                               &scale, (int32_t)job->cfg.length);
+        job->scale = scale;
+        return ret;
+    case UPT_DSP_JOB_SQRT_Q31:
+        return upt_dsp_sqrt_q31(dsp, (int32_t *)job->pSrc, (int32_t *)job->pDst,
+                                &job->scale, (int32_t)job->cfg.length);
+    case UPT_DSP_JOB_SPECTRUM_Q15:
+        return upt_dsp_spectrum_q15(dsp, (int16_t *)job->pSrc,
+                                    (int32_t *)job->pDst, &job->scale,
+                                    (int32_t)job->cfg.length);
+    case UPT_DSP_JOB_SPECTRUM_Q31:
+        return upt_dsp_spectrum_q31(dsp, (int32_t *)job->pSrc,
+                                    (int32_t *)job->pDst, &job->scale,
+                                    (int32_t)job->cfg.length);
+    default:
+        return E_DSP_INVPARA;
+    }
+}
@@ -0,0 +1,683 @@
+/*
+ * Copyright (C) 2025 UpbeatTech Inc. All Rights Reserved
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX short identifier: Apache-2.0
+ */
+
+/*
+ * Host C model of the UDL DSP block. See metal/drivers/up_dsp_model.h.
+ * Only built for host tests; target images use the hardware driver.
+ */
+#if defined(UPT_DSP_HOST_MODEL)
+
+#include <math.h>
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "metal/dsp.h"
+#include "metal/dsp_queue.h"
+#include "metal/drivers/up_dsp_model.h"
+
+#define MODEL_TWIDDLE_BITS  20
+#define MODEL_MIN_FFT_LEN   32
+#define MODEL_MAX_DOT_DIM   512
+
+/* RFFT results are interleaved in place, hence the two extra entries. */
+static int64_t model_re[UPT_DSP_MODEL_MAX_FFT_LEN + 2];
+static int64_t model_im[UPT_DSP_MODEL_MAX_FFT_LEN + 2];
+static int64_t model_tw_re[UPT_DSP_MODEL_MAX_FFT_LEN / 2];
+static int64_t model_tw_im[UPT_DSP_MODEL_MAX_FFT_LEN / 2];
+static int model_tw_ready;
+static uint32_t model_ops;
+static int model_fail;
+
+/* Asynchronous jobs run on a worker thread that then raises the "IRQ". */
+static pthread_mutex_t model_job_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t model_job_cond = PTHREAD_COND_INITIALIZER;
+static pthread_t model_worker;
+static int model_worker_started;
+static upt_dsp_job_Type *model_job;
+static enum_dsp_retcode_Type model_job_ret;
+static int model_irq_enabled;
+static void (*model_irq_handler)(uint32_t id, void *data);
+static void *model_irq_data;
+
+static metal_dsp_Type model_device = {
+    .vtable = &upt_dsp_model_vtable,
+};
+
+uint32_t upt_dsp_model_op_count(void) {
+    return model_ops;
+}
+
+void upt_dsp_model_reset(void) {
+    model_ops = 0;
+    model_fail = 0;
+}
+
+void upt_dsp_model_force_error(int fail) {
+    model_fail = fail;
+}
+
+void upt_dsp_model_set_irq_handler(void (*handler)(uint32_t id, void *data),
+                                   void *data) {
+    pthread_mutex_lock(&model_job_mutex);
+    model_irq_handler = handler;
+    model_irq_data = data;
+    pthread_mutex_unlock(&model_job_mutex);
+}
+
+static int model_fft_len_valid(uint32_t n) {
+    return n >= MODEL_MIN_FFT_LEN && n <= UPT_DSP_MODEL_MAX_FFT_LEN &&
+           (n & (n - 1)) == 0;
+}
+
+static int64_t model_round_shift(int64_t v, int32_t s) {
+    if (s == 0) {
+        return v;
+    }
+    return (v + ((int64_t)1 << (s - 1))) >> s;
+}
+
+/* Smallest right shift after which every rounded value fits [lo, hi]. */
+static int32_t model_block_shift(const int64_t *v, uint32_t count,
+                                 int64_t lo, int64_t hi) {
+    int64_t vmax = 0;
+    int64_t vmin = 0;
+    int32_t s = 0;
+
+    for (uint32_t i = 0; i < count; i++) {
+        if (v[i] > vmax) {
+            vmax = v[i];
+        }
+        if (v[i] < vmin) {
+            vmin = v[i];
+        }
+    }
+    while (model_round_shift(vmax, s) > hi || model_round_shift(vmin, s) < lo) {
+        s++;
+    }
+    return s;
+}
+
+static uint64_t model_isqrt(uint64_t x) {
+    uint64_t res = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+
+    while (bit > x) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (x >= res + bit) {
+            x -= res + bit;
+            res = (res >> 1) + bit;
+        } else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return res;
+}
+
+static void model_init_twiddles(void) {
+    const double scale = (double)(1 << MODEL_TWIDDLE_BITS);
+
+    if (model_tw_ready) {
+        return;
+    }
+    for (uint32_t k = 0; k < UPT_DSP_MODEL_MAX_FFT_LEN / 2; k++) {
+        double angle = -2.0 * M_PI * k / UPT_DSP_MODEL_MAX_FFT_LEN;
+        model_tw_re[k] = (int64_t)lround(cos(angle) * scale);
+        model_tw_im[k] = (int64_t)lround(sin(angle) * scale);
+    }
+    model_tw_ready = 1;
+}
+
+/* In-place radix-2 complex FFT of model_re/model_im, n <= MAX_FFT_LEN. */
+static void model_fft(uint32_t n, int inverse) {
+    const int64_t half = (int64_t)1 << (MODEL_TWIDDLE_BITS - 1);
+
+    model_init_twiddles();
+
+    for (uint32_t i = 1, j = 0; i < n; i++) {
+        uint32_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            int64_t t = model_re[i];
+            model_re[i] = model_re[j];
+            model_re[j] = t;
+            t = model_im[i];
+            model_im[i] = model_im[j];
+            model_im[j] = t;
+        }
+    }
+
+    for (uint32_t len = 2; len <= n; len <<= 1) {
+        uint32_t stride = UPT_DSP_MODEL_MAX_FFT_LEN / len;
+        for (uint32_t i = 0; i < n; i += len) {
+            for (uint32_t k = 0; k < len / 2; k++) {
+                int64_t wr = model_tw_re[k * stride];
+                int64_t wi = inverse ? -model_tw_im[k * stride]
+                                     : model_tw_im[k * stride];
+                uint32_t a = i + k;
+                uint32_t b = a + len / 2;
+                int64_t tr = (model_re[b] * wr - model_im[b] * wi + half) >>
+                             MODEL_TWIDDLE_BITS;
+                int64_t ti = (model_re[b] * wi + model_im[b] * wr + half) >>
+                             MODEL_TWIDDLE_BITS;
+                model_re[b] = model_re[a] - tr;
+                model_im[b] = model_im[a] - ti;
+                model_re[a] += tr;
+                model_im[a] += ti;
+            }
+        }
+    }
+}
+
+/* Loads pSrc (real or half complex) and runs the transform cfg selects. */
+static enum_dsp_retcode_Type model_rfft(const upt_dsp_config_Type *cfg,
+                                        const int16_t *src16,
+                                        const int32_t *src32) {
+    uint32_t n = cfg->length;
+
+    if (!model_fft_len_valid(n)) {
+        return E_DSP_INVPARA;
+    }
+    if (cfg->dsp_ifftFlag == UPT_DSP_RFFT_MODE) {
+        for (uint32_t i = 0; i < n; i++) {
+            model_re[i] = src16 ? src16[i] : src32[i];
+            model_im[i] = 0;
+        }
+        model_fft(n, 0);
+    } else if (cfg->dsp_ifftFlag == UPT_DSP_IRFFT_MODE) {
+        for (uint32_t k = 0; k <= n / 2; k++) {
+            model_re[k] = src16 ? src16[2 * k] : src32[2 * k];
+            model_im[k] = src16 ? src16[2 * k + 1] : src32[2 * k + 1];
+        }
+        for (uint32_t k = n / 2 + 1; k < n; k++) {
+            model_re[k] = model_re[n - k];
+            model_im[k] = -model_im[n - k];
+        }
+        model_fft(n, 1);
+    } else {
+        return E_DSP_INVPARA;
+    }
+    return E_DSP_SUCCESS;
+}
+
+/* Interleaves the first n/2+1 bins (RFFT) or the n real samples (IRFFT). */
+static uint32_t model_gather_result(const upt_dsp_config_Type *cfg) {
+    uint32_t n = cfg->length;
+
+    if (cfg->dsp_ifftFlag == UPT_DSP_IRFFT_MODE) {
+        return n;
+    }
+    for (int32_t k = (int32_t)(n / 2); k >= 0; k--) {
+        int64_t re = model_re[k];
+        int64_t im = model_im[k];
+        model_re[2 * k] = re;
+        model_re[2 * k + 1] = im;
+    }
+    return n + 2;
+}
+
+static enum_dsp_retcode_Type model_fft_disable_irq(metal_dsp_Type *dsp) {
+    (void)dsp;
+    pthread_mutex_lock(&model_job_mutex);
+    model_irq_enabled = 0;
+    pthread_mutex_unlock(&model_job_mutex);
+    return E_DSP_SUCCESS;
+}
+
+static enum_dsp_retcode_Type model_fft_enable_irq(metal_dsp_Type *dsp) {
+    (void)dsp;
+    pthread_mutex_lock(&model_job_mutex);
+    model_irq_enabled = 1;
+    pthread_mutex_unlock(&model_job_mutex);
+    return E_DSP_SUCCESS;
+}
+
+static enum_dsp_retcode_Type model_fft_clear_irq(metal_dsp_Type *dsp) {
+    (void)dsp;
+    return E_DSP_SUCCESS;
+}
+
+static enum_dsp_retcode_Type model_rfft_q15(metal_dsp_Type *dsp,
+                                            const upt_dsp_config_Type *cfg,
+                                            int16_t *pSrc, int16_t *pDst,
+                                            int32_t *sfDst) {
+    enum_dsp_retcode_Type ret;
+    uint32_t count;
+    int32_t s;
+
+    (void)dsp;
+    if (model_fail) {
+        return E_DSP_ERROR;
+    }
+    if (cfg == NULL || pSrc == NULL || pDst == NULL || sfDst == NULL) {
+        return E_DSP_INVPARA;
+    }
+    ret = model_rfft(cfg, pSrc, NULL);
+    if (ret != E_DSP_SUCCESS) {
+        return ret;
+    }
+    count = model_gather_result(cfg);
+    s = model_block_shift(model_re, count, INT16_MIN, INT16_MAX);
+    for (uint32_t i = 0; i < count; i++) {
+        pDst[i] = (int16_t)model_round_shift(model_re[i], s);
+    }
+    *sfDst = s;
+    model_ops++;
+    return E_DSP_SUCCESS;
+}
+
+static enum_dsp_retcode_Type model_rfft_q31(metal_dsp_Type *dsp,
+                                            const upt_dsp_config_Type *cfg,
+                                            int32_t *pSrc, int32_t *pDst,
+                                            int32_t *sfDst) {
+    enum_dsp_retcode_Type ret;
+    uint32_t count;
+    int32_t s;
+
+    (void)dsp;
+    if (model_fail) {
+        return E_DSP_ERROR;
+    }
+    if (cfg == NULL || pSrc == NULL || pDst == NULL || sfDst == NULL) {
+        return E_DSP_INVPARA;
+    }
+    ret = model_rfft(cfg, NULL, pSrc);
+    if (ret != E_DSP_SUCCESS) {
+        return ret;
+    }
+    count = model_gather_result(cfg);
+    s = model_block_shift(model_re, count, INT32_MIN, INT32_MAX);
+    for (uint32_t i = 0; i < count; i++) {
+        pDst[i] = (int32_t)model_round_shift(model_re[i], s);
+    }
+    *sfDst = s;
+    model_ops++;
+    return E_DSP_SUCCESS;
+}
+
+static enum_dsp_retcode_Type model_dot_prod(const upt_dsp_config_Type *cfg,
+                                            const int16_t *a16,
+                                            const int16_t *b16,
+                                            const int32_t *a32,
+                                            const int32_t *b32,
+                                            uint32_t *points) {
+    uint32_t n = cfg->length ? cfg->length : 1;
+    uint32_t m = cfg->dim;
+    int conj = (b16 == NULL && b32 == NULL);
+
+    if (n > UPT_DSP_MODEL_MAX_FFT_LEN || m == 0 || (conj && m != 2)) {
+        return E_DSP_INVPARA;
+    }
+    for (uint32_t i = 0; i < n; i++) {
+        int64_t acc = 0;
+        for (uint32_t j = 0; j < m; j++) {
+            uint32_t idx = i * m + j;
+            if (a16 != NULL) {
+                acc += (int64_t)a16[idx] * (conj ? a16[idx] : b16[idx]);
+            } else {
+                acc += ((int64_t)a32[idx] * (conj ? a32[idx] : b32[idx])) >> 2;
+            }
+        }
+        /* q30 -> q15, or 2.60 -> q31. */
+        model_re[i] = a16 != NULL ? model_round_shift(acc, 15)
+                                  : model_round_shift(acc, 29);
+    }
+    *points = n;
+    return E_DSP_SUCCESS;
+}
+
+static enum_dsp_retcode_Type model_dot_prod_q15(metal_dsp_Type *dsp,
+                                                const upt_dsp_config_Type *cfg,
+                                                const int16_t *pSrcA,
+                                                const int16_t *pSrcB,
+                                                int16_t *pDst, int32_t *sfDst) {
+    enum_dsp_retcode_Type ret;
+    uint32_t n;
+    int32_t s;
+
+    (void)dsp;
+    if (model_fail) {
+        return E_DSP_ERROR;
+    }
+    if (cfg == NULL || pSrcA == NULL || pDst == NULL || sfDst == NULL ||
+        cfg->dim > MODEL_MAX_DOT_DIM) {
+        return E_DSP_INVPARA;
+    }
+    ret = model_dot_prod(cfg, pSrcA, pSrcB, NULL, NULL, &n);
+    if (ret != E_DSP_SUCCESS) {
+        return ret;
+    }
+    s = model_block_shift(model_re, n, INT16_MIN, INT16_MAX);
+    for (uint32_t i = 0; i < n; i++) {
+        pDst[i] = (int16_t)model_round_shift(model_re[i], s);
+    }
+    *sfDst = s;
+    model_ops++;
+    return E_DSP_SUCCESS;
+}
+
+static enum_dsp_retcode_Type model_dot_prod_q31(metal_dsp_Type *dsp,
+                                                const upt_dsp_config_Type *cfg,
+                                                const int32_t *pSrcA,
+                                                const int32_t *pSrcB,
+                                                int32_t *pDst, int32_t *sfDst) {
+    enum_dsp_retcode_Type ret;
+    uint32_t n;
+    int32_t s;
+
+    (void)dsp;
+    if (model_fail) {
+        return E_DSP_ERROR;
+    }
+    if (cfg == NULL || pSrcA == NULL || pDst == NULL || sfDst == NULL ||
+        cfg->dim > 3) {
+        return E_DSP_INVPARA;
+    }
+    ret = model_dot_prod(cfg, NULL, NULL, pSrcA, pSrcB, &n);
+    if (ret != E_DSP_SUCCESS) {
+        return ret;
+    }
+    s = model_block_shift(model_re, n, INT32_MIN, INT32_MAX);
+    for (uint32_t i = 0; i < n; i++) {
+        pDst[i] = (int32_t)model_round_shift(model_re[i], s);
+    }
+    *sfDst = s;
+    model_ops++;
+    return E_DSP_SUCCESS;
+}
+
+/*
+ * Square roots of v (scaled by 2^odd) into model_re, in q(frac_bits).
+ * Returns the block shift still to be applied to model_re.
+ */
+static int32_t model_sqrt(const int64_t *v, int32_t length, int32_t odd,
+                          int32_t frac_bits, int64_t hi) {
+    for (int32_t i = 0; i < length; i++) {
+        model_re[i] = (int64_t)model_isqrt((uint64_t)v[i] << (frac_bits + odd));
+    }
+    return model_block_shift(model_re, (uint32_t)length, 0, hi);
+}
+
+static enum_dsp_retcode_Type model_sqrt_q15(metal_dsp_Type *dsp,
+                                            int16_t *pSrc, int16_t *pDst,
+                                            int16_t *pScale, int32_t length) {
+    int32_t odd;
+    int32_t s;
+
+    (void)dsp;
+    if (model_fail) {
+        return E_DSP_ERROR;
+    }
+    if (pSrc == NULL || pDst == NULL || pScale == NULL || length < 1 ||
+        length > UPT_DSP_MODEL_MAX_FFT_LEN) {
+        return E_DSP_INVPARA;
+    }
+    for (int32_t i = 0; i < length; i++) {
+        if (pSrc[i] < 0) {
+            return E_DSP_INVPARA;
+        }
+        model_im[i] = pSrc[i];
+    }
+    odd = *pScale & 1;
+    s = model_sqrt(model_im, length, odd, 15, INT16_MAX);
+    for (int32_t i = 0; i < length; i++) {
+        pDst[i] = (int16_t)model_round_shift(model_re[i], s);
+    }
+    *pScale = (int16_t)((*pScale - odd) / 2 + s);
+    model_ops++;
+    return E_DSP_SUCCESS;
+}
+
+static enum_dsp_retcode_Type model_sqrt_q31(metal_dsp_Type *dsp,
+                                            int32_t *pSrc, int32_t *pDst,
+                                            int32_t *pScale, int32_t length) {
+    int32_t odd;
+    int32_t s;
+
+    (void)dsp;
+    if (model_fail) {
+        return E_DSP_ERROR;
+    }
+    if (pSrc == NULL || pDst == NULL || pScale == NULL || length < 1 ||
+        length > UPT_DSP_MODEL_MAX_FFT_LEN) {
+        return E_DSP_INVPARA;
+    }
+    for (int32_t i = 0; i < length; i++) {
+        if (pSrc[i] < 0) {
+            return E_DSP_INVPARA;
+        }
+        model_im[i] = pSrc[i];
+    }
+    odd = *pScale & 1;
+    s = model_sqrt(model_im, length, odd, 31, INT32_MAX);
+    for (int32_t i = 0; i < length; i++) {
+        pDst[i] = (int32_t)model_round_shift(model_re[i], s);
+    }
+    *pScale = (*pScale - odd) / 2 + s;
+    model_ops++;
+    return E_DSP_SUCCESS;
+}
+
+/* |X[k]| of an RFFT already in model_re/model_im, block normalised. */
+static int32_t model_magnitude(uint32_t n, int32_t *pMagnitude) {
+    int32_t pre = 0;
+    int32_t s;
+
+    for (uint32_t k = 0; k <= n / 2; k++) {
+        while (model_round_shift(model_re[k] < 0 ? -model_re[k] : model_re[k],
+                                 pre) > INT32_MAX ||
+               model_round_shift(model_im[k] < 0 ? -model_im[k] : model_im[k],
+                                 pre) > INT32_MAX) {
+            pre++;
+        }
+    }
+    for (uint32_t k = 0; k <= n / 2; k++) {
+        int64_t re = model_round_shift(model_re[k], pre);
+        int64_t im = model_round_shift(model_im[k], pre);
+        model_re[k] = (int64_t)model_isqrt((uint64_t)(re * re) +
+                                           (uint64_t)(im * im));
+    }
+    s = model_block_shift(model_re, n / 2 + 1, 0, INT32_MAX);
+    for (uint32_t k = 0; k <= n / 2; k++) {
+        pMagnitude[k] = (int32_t)model_round_shift(model_re[k], s);
+    }
+    return pre + s;
+}
+
+static enum_dsp_retcode_Type model_spectrum_q15(metal_dsp_Type *dsp,
+                                                int16_t *pSrc,
+                                                int32_t *pMagnitude,
+                                                int32_t *pScale,
+                                                int32_t length) {
+    upt_dsp_config_Type cfg = {
+        .length = (uint32_t)length,
+        .dsp_ifftFlag = UPT_DSP_RFFT_MODE,
+    };
+    enum_dsp_retcode_Type ret;
+
+    (void)dsp;
+    if (model_fail) {
+        return E_DSP_ERROR;
+    }
+    if (pSrc == NULL || pMagnitude == NULL || pScale == NULL) {
+        return E_DSP_INVPARA;
+    }
+    ret = model_rfft(&cfg, pSrc, NULL);
+    if (ret != E_DSP_SUCCESS) {
+        return ret;
+    }
+    *pScale = model_magnitude(cfg.length, pMagnitude);
+    model_ops++;
+    return E_DSP_SUCCESS;
+}
+
+static enum_dsp_retcode_Type model_spectrum_q31(metal_dsp_Type *dsp,
+                                                int32_t *pSrc,
+                                                int32_t *pMagnitude,
+                                                int32_t *pScale,
+                                                int32_t length) {
+    upt_dsp_config_Type cfg = {
+        .length = (uint32_t)length,
+        .dsp_ifftFlag = UPT_DSP_RFFT_MODE,
+    };
+    enum_dsp_retcode_Type ret;
+
+    (void)dsp;
+    if (model_fail) {
+        return E_DSP_ERROR;
+    }
+    if (pSrc == NULL || pMagnitude == NULL || pScale == NULL) {
+        return E_DSP_INVPARA;
+    }
+    ret = model_rfft(&cfg, NULL, pSrc);
+    if (ret != E_DSP_SUCCESS) {
+        return ret;
+    }
+    *pScale = model_magnitude(cfg.length, pMagnitude);
+    model_ops++;
+    return E_DSP_SUCCESS;
+}
+
+static void *model_worker_main(void *arg) {
+    (void)arg;
+    for (;;) {
+        void (*handler)(uint32_t id, void *data) = NULL;
+        void *data;
+        upt_dsp_job_Type *job;
+        enum_dsp_retcode_Type ret;
+
+        pthread_mutex_lock(&model_job_mutex);
+        while (model_job == NULL) {
+            pthread_cond_wait(&model_job_cond, &model_job_mutex);
+        }
+        job = model_job;
+        pthread_mutex_unlock(&model_job_mutex);
+
+        ret = upt_dsp_job_execute(&model_device, job);
+
+        pthread_mutex_lock(&model_job_mutex);
+        model_job = NULL;
+        model_job_ret = ret;
+        if (model_irq_enabled) {
+            handler = model_irq_handler;
+            data = model_irq_data;
+        }
+        pthread_mutex_unlock(&model_job_mutex);
+
+        /* The handler may start the next job */
+        if (handler != NULL) {
+            handler(0, data);
+        }
+    }
+    return NULL;
+}
+
+static enum_dsp_retcode_Type model_start_job(metal_dsp_Type *dsp,
+                                             upt_dsp_job_Type *job) {
+    enum_dsp_retcode_Type ret = E_DSP_SUCCESS;
+
+    (void)dsp;
+    if (job == NULL) {
+        return E_DSP_INVPARA;
+    }
+    pthread_mutex_lock(&model_job_mutex);
+    if (model_job != NULL) {
+        ret = E_DSP_INVINIT;
+    } else if (!model_worker_started &&
+               pthread_create(&model_worker, NULL, model_worker_main, NULL) != 0) {
+        ret = E_DSP_INVINIT;
+    } else {
+        model_worker_started = 1;
+        model_job = job;
+        pthread_cond_signal(&model_job_cond);
+    }
+    pthread_mutex_unlock(&model_job_mutex);
+    return ret;
+}
+
+static enum_dsp_retcode_Type model_job_status(metal_dsp_Type *dsp,
+                                              upt_dsp_job_Type *job) {
+    enum_dsp_retcode_Type ret;
+
+    (void)dsp;
+    (void)job;
+    pthread_mutex_lock(&model_job_mutex);
+    ret = model_job_ret;
+    pthread_mutex_unlock(&model_job_mutex);
+    return ret;
+}
+
+const struct metal_dsp_vtable upt_dsp_model_vtable = {
+    .fft_disable_irq = model_fft_disable_irq,
+    .fft_enable_irq = model_fft_enable_irq,
+    .fft_clear_irq = model_fft_clear_irq,
+    .rfft_q15 = model_rfft_q15,
+    .dot_prod_q15 = model_dot_prod_q15,
+    .dot_prod_q31 = model_dot_prod_q31,
+    .sqrt_q15 = model_sqrt_q15,
+    .sqrt_q31 = model_sqrt_q31,
+    .spectrum_q15 = model_spectrum_q15,
+    .spectrum_q31 = model_spectrum_q31,
+    .rfft_q31 = model_rfft_q31,
+};
+
+const upt_dsp_job_ops_Type upt_dsp_model_job_ops = {
+    .start_job = model_start_job,
+    .job_status = model_job_status,
+};
+
+/* src/dsp.c is not part of a host build, so provide its definitions here. */
+extern __inline__ enum_dsp_retcode_Type upt_dsp_fft_disable_irq(metal_dsp_Type *dsp);
+extern __inline__ enum_dsp_retcode_Type upt_dsp_fft_enable_irq(metal_dsp_Type *dsp);
+extern __inline__ enum_dsp_retcode_Type upt_dsp_fft_clear_irq(metal_dsp_Type *dsp);
+extern __inline__ enum_dsp_retcode_Type upt_dsp_rfft_q15(metal_dsp_Type *dsp,const upt_dsp_config_Type *cfg,
+												 int16_t *pSrc, int16_t *pDst,int32_t *sfDst);
+extern __inline__ enum_dsp_retcode_Type upt_dsp_rfft_q31(metal_dsp_Type *dsp,const upt_dsp_config_Type *cfg,
+												 int32_t *pSrc, int32_t *pDst,int32_t *sfDst);
+extern __inline__ enum_dsp_retcode_Type upt_dsp_dot_prod_q15(metal_dsp_Type *dsp,
+												 const upt_dsp_config_Type *cfg, const int16_t *pSrcA,
+												 const int16_t *pSrcB, int16_t *pDst, int32_t *sfDst);
+extern __inline__ enum_dsp_retcode_Type upt_dsp_dot_prod_q31(metal_dsp_Type *dsp,
+												 const upt_dsp_config_Type *cfg, const int32_t *pSrcA,
+												 const int32_t *pSrcB, int32_t *pDst, int32_t *sfDst);
+extern __inline__ enum_dsp_retcode_Type upt_dsp_sqrt_q15(metal_dsp_Type *dsp,
+												 int16_t *pSrc, int16_t *pDst,
+												 int16_t *pScale, int32_t length);
+extern __inline__ enum_dsp_retcode_Type upt_dsp_sqrt_q31(metal_dsp_Type *dsp,
+												 int32_t *pSrc, int32_t *pDst,
+												 int32_t *pScale, int32_t length);
+extern __inline__ enum_dsp_retcode_Type upt_dsp_spectrum_q15(metal_dsp_Type *dsp,
+												 int16_t *pSrc, int32_t *pMagnitude, int32_t *pScale,
+												 int32_t length);
+extern __inline__ enum_dsp_retcode_Type upt_dsp_spectrum_q31(metal_dsp_Type *dsp,
+												 int32_t *pSrc, int32_t *pMagnitude, int32_t *pScale,
+												 int32_t length);
+
+metal_dsp_Type *upt_dsp_get_device(enum_dsp_device_Type device_num) {
+    if (device_num == NAON_UDL_1_2_DSP) {
+        return &model_device;
+    }
+    return NULL;
+}
+
+#endif /* UPT_DSP_HOST_MODEL */
@@ -0,0 +1,580 @@
+/*
+ * Copyright (C) 2025 UpbeatTech Inc. All Rights Reserved
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX short identifier: Apache-2.0
+ */
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "metal/upt_critical.h"
+#include "upt_fft_plan.h"
+
+#define PLAN_PI 3.14159265358979323846
+
+/*
+ * The complex FFT is a decimation in frequency on natural order input.
+ * Each radix-4 pass stores its outputs as X0, X2, X1, X3, which makes it
+ * equivalent to two radix-2 passes: after the passes (and the last radix-2
+ * one when log2(n) is odd) the result is in bit reversed order and a single
+ * swap pass from the plan table puts it back in natural order.
+ */
+
+static int32_t plan_log2(int32_t n) {
+    int32_t bits = 0;
+
+    while ((1 << bits) < n) {
+        bits++;
+    }
+    return bits;
+}
+
+static int32_t plan_twiddle_count(int32_t n) {
+    return (n < 4) ? 1 : 3 * n / 4;
+}
+
+/* Indexes i < bitrev(i) of n points, palindromes are left in place */
+static int32_t plan_bitrev_count(int32_t n) {
+    int32_t bits = plan_log2(n);
+
+    return (n - (1 << ((bits + 1) / 2))) / 2;
+}
+
+uint32_t upt_fft_plan_buffer_size(int32_t size, fft_Type type,
+                                  upt_fft_data_Type data) {
+    int32_t n = (type == FFT_REAL) ? size / 2 : size;
+    uint32_t bytes;
+
+    (void)data; /* float and q31 have the same size */
+    if (size < ((type == FFT_REAL) ? 4 : 2) || size > UPT_FFT_PLAN_MAX_SIZE ||
+        (size & (size - 1)) != 0) {
+        return 0;
+    }
+    bytes = (uint32_t)plan_twiddle_count(n) * 2U * sizeof(int32_t);
+    if (type == FFT_REAL) {
+        bytes += (uint32_t)(size / 4) * 2U * sizeof(int32_t);
+    }
+    bytes += (uint32_t)plan_bitrev_count(n) * 2U * sizeof(uint16_t);
+    return bytes;
+}
+
+/* exp(-2*pi*i*k/n) for k < count, as [cos, -sin] */
+static void plan_fill_twiddle(void *table, int32_t count, int32_t n,
+                              upt_fft_data_Type data) {
+    for (int32_t k = 0; k < count; k++) {
+        double angle = 2.0 * PLAN_PI * k / n;
+        double c = cos(angle);
+        double s = -sin(angle);
+
+        if (data == UPT_FFT_F32) {
+            ((float *)table)[2 * k] = (float)c;
+            ((float *)table)[2 * k + 1] = (float)s;
+        } else {
+            double cq = floor(c * 2147483648.0 + 0.5);
+            double sq = floor(s * 2147483648.0 + 0.5);
+
+            ((int32_t *)table)[2 * k] =
+                (cq > 2147483647.0) ? INT32_MAX : (int32_t)cq;
+            ((int32_t *)table)[2 * k + 1] =
+                (sq > 2147483647.0) ? INT32_MAX : (int32_t)sq;
+        }
+    }
+}
+
+int32_t upt_fft_plan_init(upt_fft_plan_Type *plan, int32_t size, fft_Type type,
+                          upt_fft_data_Type data, void *buffer,
+                          uint32_t buffer_size) {
+    uint32_t needed = upt_fft_plan_buffer_size(size, type, data);
+    int32_t *words = (int32_t *)buffer;
+    uint16_t *bitrev;
+    int32_t bits;
+    int32_t count;
+
+    if (plan == NULL || buffer == NULL || needed == 0 ||
+        buffer_size < needed || ((uintptr_t)buffer & 3U) != 0) {
+        return -1;
+    }
+
+    plan->size = size;
+    plan->n = (type == FFT_REAL) ? size / 2 : size;
+    plan->type = type;
+    plan->data = data;
+
+    count = plan_twiddle_count(plan->n);
+    plan_fill_twiddle(words, count, plan->n, data);
+    plan->twiddle = words;
+    words += 2 * count;
+
+    plan->rtwiddle = NULL;
+    if (type == FFT_REAL) {
+        count = size / 4;
+        plan_fill_twiddle(words, count, size, data);
+        plan->rtwiddle = words;
+        words += 2 * count;
+    }
+
+    bitrev = (uint16_t *)words;
+    bits = plan_log2(plan->n);
+    count = 0;
+    for (int32_t i = 0; i < plan->n; i++) {
+        int32_t r = 0;
+
+        for (int32_t b = 0; b < bits; b++) {
+            r |= ((i >> b) & 1) << (bits - 1 - b);
+        }
+        if (i < r) {
+            bitrev[2 * count] = (uint16_t)i;
+            bitrev[2 * count + 1] = (uint16_t)r;
+            count++;
+        }
+    }
+    plan->bitrev = bitrev;
+    plan->bitrev_len = count;
+    return 0;
+}
+
+/*
+ * The cache is shared by all tasks. The lock (upt_critical.h) only covers
+ * the lookup, the reservation of a slot and its publication: the plan is
+ * built outside of it, since computing the twiddles takes too long to mask
+ * interrupts.
+ */
+
+typedef struct {
+    int32_t size;
+    fft_Type type;
+    upt_fft_data_Type data;
+    int32_t ready; // plan built, written under the lock
+    upt_fft_plan_Type plan;
+} plan_entry_Type;
+
+static uint32_t plan_pool[UPT_FFT_PLAN_POOL_SIZE / sizeof(uint32_t)];
+static uint32_t plan_pool_used;
+static plan_entry_Type plan_cache[UPT_FFT_PLAN_CACHE_SIZE];
+static int32_t plan_cache_len;
+
+const upt_fft_plan_Type *upt_fft_plan_get(int32_t size, fft_Type type,
+                                          upt_fft_data_Type data) {
+    uint32_t needed = upt_fft_plan_buffer_size(size, type, data);
+    plan_entry_Type *entry = NULL;
+    uint8_t *buffer;
+    uintptr_t state;
+
+    if (needed == 0) {
+        return NULL;
+    }
+
+    state = upt_critical_enter();
+    for (int32_t i = 0; i < plan_cache_len; i++) {
+        if (plan_cache[i].size == size && plan_cache[i].type == type &&
+            plan_cache[i].data == data) {
+            entry = &plan_cache[i];
+            break;
+        }
+    }
+    if (entry != NULL) {
+        /* NULL while another task is building it */
+        const upt_fft_plan_Type *plan = entry->ready ? &entry->plan : NULL;
+
+        upt_critical_exit(state);
+        return plan;
+    }
+    if (plan_cache_len == UPT_FFT_PLAN_CACHE_SIZE ||
+        needed > sizeof(plan_pool) - plan_pool_used) {
+        upt_critical_exit(state);
+        return NULL;
+    }
+    entry = &plan_cache[plan_cache_len++];
+    entry->size = size;
+    entry->type = type;
+    entry->data = data;
+    entry->ready = 0;
+    buffer = (uint8_t *)plan_pool + plan_pool_used;
+    plan_pool_used += needed;
+    upt_critical_exit(state);
+
+    /* The arguments were checked by upt_fft_plan_buffer_size() */
+    (void)upt_fft_plan_init(&entry->plan, size, type, data, buffer, needed);
+
+    state = upt_critical_enter();
+    entry->ready = 1;
+    upt_critical_exit(state);
+    return &entry->plan;
+}
+
+/*
+ * float kernels
+ */
+
+static inline void plan_radix4_f32(const upt_fft_plan_Type *plan, float *re,
+                                   float *im, int32_t stride) {
+    const float *tw = (const float *)plan->twiddle;
+    int32_t n = plan->n;
+    int32_t tw_step = 1;
+    int32_t span;
+
+    for (span = n; span >= 4; span >>= 2, tw_step <<= 2) {
+        int32_t qs = (span >> 2) * stride;
+
+        /* j = 0, no twiddle */
+        for (int32_t i = 0; i < n * stride; i += span * stride) {
+            float *r = re + i, *m = im + i;
+            float t0r = r[0] + r[2 * qs], t0i = m[0] + m[2 * qs];
+            float t1r = r[0] - r[2 * qs], t1i = m[0] - m[2 * qs];
+            float t2r = r[qs] + r[3 * qs], t2i = m[qs] + m[3 * qs];
+            float t3r = r[qs] - r[3 * qs], t3i = m[qs] - m[3 * qs];
+
+            r[0] = t0r + t2r;
+            m[0] = t0i + t2i;
+            r[qs] = t0r - t2r;
+            m[qs] = t0i - t2i;
+            r[2 * qs] = t1r + t3i;
+            m[2 * qs] = t1i - t3r;
+            r[3 * qs] = t1r - t3i;
+            m[3 * qs] = t1i + t3r;
+        }
+
+        for (int32_t j = 1; j < (span >> 2); j++) {
+            const float *w = tw + 2 * j * tw_step;
+            float w1r = w[0], w1i = w[1];
+            float w2r = w[2 * j * tw_step], w2i = w[2 * j * tw_step + 1];
+            float w3r = w[4 * j * tw_step], w3i = w[4 * j * tw_step + 1];
+
+            for (int32_t i = j * stride; i < n * stride; i += span * stride) {
+                float *r = re + i, *m = im + i;
+                float t0r = r[0] + r[2 * qs], t0i = m[0] + m[2 * qs];
+                float t1r = r[0] - r[2 * qs], t1i = m[0] - m[2 * qs];
+                float t2r = r[qs] + r[3 * qs], t2i = m[qs] + m[3 * qs];
+                float t3r = r[qs] - r[3 * qs], t3i = m[qs] - m[3 * qs];
+                float ar, ai;
+
+                r[0] = t0r + t2r;
+                m[0] = t0i + t2i;
+                /* X2 */
+                ar = t0r - t2r;
+                ai = t0i - t2i;
+                r[qs] = ar * w2r - ai * w2i;
+                m[qs] = ar * w2i + ai * w2r;
+                /* X1 = t1 - i t3 */
+                ar = t1r + t3i;
+                ai = t1i - t3r;
+                r[2 * qs] = ar * w1r - ai * w1i;
+                m[2 * qs] = ar * w1i + ai * w1r;
+                /* X3 = t1 + i t3 */
+                ar = t1r - t3i;
+                ai = t1i + t3r;
+                r[3 * qs] = ar * w3r - ai * w3i;
+                m[3 * qs] = ar * w3i + ai * w3r;
+            }
+        }
+    }
+
+    if (span == 2) {
+        for (int32_t i = 0; i < n * stride; i += 2 * stride) {
+            float tr = re[i + stride], ti = im[i + stride];
+
+            re[i + stride] = re[i] - tr;
+            im[i + stride] = im[i] - ti;
+            re[i] += tr;
+            im[i] += ti;
+        }
+    }
+
+    for (int32_t k = 0; k < plan->bitrev_len; k++) {
+        int32_t a = plan->bitrev[2 * k] * stride;
+        int32_t b = plan->bitrev[2 * k + 1] * stride;
+        float tr = re[a], ti = im[a];
+
+        re[a] = re[b];
+        im[a] = im[b];
+        re[b] = tr;
+        im[b] = ti;
+    }
+}
+
+/* Inverse as conj(FFT(conj(x))) / n */
+static inline void plan_complex_f32(const upt_fft_plan_Type *plan, float *re,
+                                    float *im, int32_t stride,
+                                    fft_direction_Type direction) {
+    int32_t n = plan->n;
+    float scale = 1.0f / (float)n;
+
+    if (direction == FFT_FORWARD) {
+        plan_radix4_f32(plan, re, im, stride);
+        return;
+    }
+    for (int32_t i = 0; i < n * stride; i += stride) {
+        im[i] = -im[i];
+    }
+    plan_radix4_f32(plan, re, im, stride);
+    for (int32_t i = 0; i < n * stride; i += stride) {
+        re[i] *= scale;
+        im[i] *= -scale;
+    }
+}
+
+/* Spectrum of the size real samples from the FFT of the n = size/2 pairs */
+static void plan_real_split_f32(const upt_fft_plan_Type *plan, float *y) {
+    const float *tw = (const float *)plan->rtwiddle;
+    int32_t n = plan->n;
+    float t = y[0];
+
+    y[0] = t + y[1];
+    y[1] = t - y[1];
+    y[n + 1] = -y[n + 1];
+
+    for (int32_t k = 1; k < n / 2; k++) {
+        float *zk = y + 2 * k, *zm = y + 2 * (n - k);
+        float wr = tw[2 * k], wi = tw[2 * k + 1];
+        float er = 0.5f * (zk[0] + zm[0]), ei = 0.5f * (zk[1] - zm[1]);
+        /* (Z[k] - conj(Z[n-k])) / 2i */
+        float or_ = 0.5f * (zk[1] + zm[1]), oi = -0.5f * (zk[0] - zm[0]);
+        float pr = or_ * wr - oi * wi, pi = or_ * wi + oi * wr;
+
+        zk[0] = er + pr;
+        zk[1] = ei + pi;
+        zm[0] = er - pr;
+        zm[1] = pi - ei;
+    }
+}
+
+/* Inverse of plan_real_split_f32(), before the inverse FFT of n points */
+static void plan_real_merge_f32(const upt_fft_plan_Type *plan, float *x) {
+    const float *tw = (const float *)plan->rtwiddle;
+    int32_t n = plan->n;
+    float t = x[0];
+
+    x[0] = 0.5f * (t + x[1]);
+    x[1] = 0.5f * (t - x[1]);
+    x[n + 1] = -x[n + 1];
+
+    for (int32_t k = 1; k < n / 2; k++) {
+        float *xk = x + 2 * k, *xm = x + 2 * (n - k);
+        float wr = tw[2 * k], wi = tw[2 * k + 1];
+        float er = 0.5f * (xk[0] + xm[0]), ei = 0.5f * (xk[1] - xm[1]);
+        float fr = 0.5f * (xk[0] - xm[0]), fi = 0.5f * (xk[1] + xm[1]);
+        /* odd part F * conj(W), then i times it */
+        float or_ = fr * wr + fi * wi, oi = fi * wr - fr * wi;
+
+        xk[0] = er - oi;
+        xk[1] = ei + or_;
+        xm[0] = er + oi;
+        xm[1] = or_ - ei;
+    }
+}
+
+void upt_fft_plan_execute_f32(const upt_fft_plan_Type *plan, float *data,
+                              fft_direction_Type direction) {
+    if (plan == NULL || data == NULL || plan->data != UPT_FFT_F32) {
+        return;
+    }
+    if (plan->type == FFT_COMPLEX) {
+        plan_complex_f32(plan, data, data + 1, 2, direction);
+    } else if (direction == FFT_FORWARD) {
+        plan_radix4_f32(plan, data, data + 1, 2);
+        plan_real_split_f32(plan, data);
+    } else {
+        plan_real_merge_f32(plan, data);
+        plan_complex_f32(plan, data, data + 1, 2, FFT_BACKWARD);
+    }
+}
+
+/*
+ * q31 kernels, same structure with Q31 twiddles. Sums are not scaled, the
+ * input must have the headroom for the growth of the transform.
+ */
+
+static inline void plan_mul_q31(int32_t ar, int32_t ai, int32_t wr, int32_t wi,
+                                int32_t *pr, int32_t *pi) {
+    int64_t r = (int64_t)ar * wr - (int64_t)ai * wi;
+    int64_t i = (int64_t)ar * wi + (int64_t)ai * wr;
+
+    *pr = (int32_t)((r + (1LL << 30)) >> 31);
+    *pi = (int32_t)((i + (1LL << 30)) >> 31);
+}
+
+static inline void plan_radix4_q31(const upt_fft_plan_Type *plan, int32_t *re,
+                                   int32_t *im, int32_t stride) {
+    const int32_t *tw = (const int32_t *)plan->twiddle;
+    int32_t n = plan->n;
+    int32_t tw_step = 1;
+    int32_t span;
+
+    for (span = n; span >= 4; span >>= 2, tw_step <<= 2) {
+        int32_t qs = (span >> 2) * stride;
+
+        /* j = 0, no twiddle */
+        for (int32_t i = 0; i < n * stride; i += span * stride) {
+            int32_t *r = re + i, *m = im + i;
+            int32_t t0r = r[0] + r[2 * qs], t0i = m[0] + m[2 * qs];
+            int32_t t1r = r[0] - r[2 * qs], t1i = m[0] - m[2 * qs];
+            int32_t t2r = r[qs] + r[3 * qs], t2i = m[qs] + m[3 * qs];
+            int32_t t3r = r[qs] - r[3 * qs], t3i = m[qs] - m[3 * qs];
+
+            r[0] = t0r + t2r;
+            m[0] = t0i + t2i;
+            r[qs] = t0r - t2r;
+            m[qs] = t0i - t2i;
+            r[2 * qs] = t1r + t3i;
+            m[2 * qs] = t1i - t3r;
+            r[3 * qs] = t1r - t3i;
+            m[3 * qs] = t1i + t3r;
+        }
+
+        for (int32_t j = 1; j < (span >> 2); j++) {
+            const int32_t *w = tw + 2 * j * tw_step;
+            int32_t w1r = w[0], w1i = w[1];
+            int32_t w2r = w[2 * j * tw_step], w2i = w[2 * j * tw_step + 1];
+            int32_t w3r = w[4 * j * tw_step], w3i = w[4 * j * tw_step + 1];
+
+            for (int32_t i = j * stride; i < n * stride; i += span * stride) {
+                int32_t *r = re + i, *m = im + i;
+                int32_t t0r = r[0] + r[2 * qs], t0i = m[0] + m[2 * qs];
+                int32_t t1r = r[0] - r[2 * qs], t1i = m[0] - m[2 * qs];
+                int32_t t2r = r[qs] + r[3 * qs], t2i = m[qs] + m[3 * qs];
+                int32_t t3r = r[qs] - r[3 * qs], t3i = m[qs] - m[3 * qs];
+
+                r[0] = t0r + t2r;
+                m[0] = t0i + t2i;
+                plan_mul_q31(t0r - t2r, t0i - t2i, w2r, w2i, &r[qs], &m[qs]);
+                plan_mul_q31(t1r + t3i, t1i - t3r, w1r, w1i, &r[2 * qs],
+                             &m[2 * qs]);
+                plan_mul_q31(t1r - t3i, t1i + t3r, w3r, w3i, &r[3 * qs],
+                             &m[3 * qs]);
+            }
+        }
+    }
+
+    if (span == 2) {
+        for (int32_t i = 0; i < n * stride; i += 2 * stride) {
+            int32_t tr = re[i + stride], ti = im[i + stride];
+
+            re[i + stride] = re[i] - tr;
+            im[i + stride] = im[i] - ti;
+            re[i] += tr;
+            im[i] += ti;
+        }
+    }
+
+    for (int32_t k = 0; k < plan->bitrev_len; k++) {
+        int32_t a = plan->bitrev[2 * k] * stride;
+        int32_t b = plan->bitrev[2 * k + 1] * stride;
+        int32_t tr = re[a], ti = im[a];
+
+        re[a] = re[b];
+        im[a] = im[b];
+        re[b] = tr;
+        im[b] = ti;
+    }
+}
+
+/* Inverse as conj(FFT(conj(x))) / n, rounded */
+static inline void plan_complex_q31(const upt_fft_plan_Type *plan, int32_t *re,
+                                    int32_t *im, int32_t stride,
+                                    fft_direction_Type direction) {
+    int32_t n = plan->n;
+    int32_t shift = plan_log2(n);
+    int32_t round = (1 << shift) >> 1;
+
+    if (direction == FFT_FORWARD) {
+        plan_radix4_q31(plan, re, im, stride);
+        return;
+    }
+    for (int32_t i = 0; i < n * stride; i += stride) {
+        im[i] = -im[i];
+    }
+    plan_radix4_q31(plan, re, im, stride);
+    for (int32_t i = 0; i < n * stride; i += stride) {
+        re[i] = (int32_t)(((int64_t)re[i] + round) >> shift);
+        im[i] = (int32_t)((round - (int64_t)im[i]) >> shift);
+    }
+}
+
+static void plan_real_split_q31(const upt_fft_plan_Type *plan, int32_t *y) {
+    const int32_t *tw = (const int32_t *)plan->rtwiddle;
+    int32_t n = plan->n;
+    int32_t t = y[0];
+
+    y[0] = t + y[1];
+    y[1] = t - y[1];
+    y[n + 1] = -y[n + 1];
+
+    for (int32_t k = 1; k < n / 2; k++) {
+        int32_t *zk = y + 2 * k, *zm = y + 2 * (n - k);
+        int32_t er = (int32_t)(((int64_t)zk[0] + zm[0]) >> 1);
+        int32_t ei = (int32_t)(((int64_t)zk[1] - zm[1]) >> 1);
+        int32_t or_ = (int32_t)(((int64_t)zk[1] + zm[1]) >> 1);
+        int32_t oi = (int32_t)(((int64_t)zm[0] - zk[0]) >> 1);
+        int32_t pr, pi;
+
+        plan_mul_q31(or_, oi, tw[2 * k], tw[2 * k + 1], &pr, &pi);
+        zk[0] = er + pr;
+        zk[1] = ei + pi;
+        zm[0] = er - pr;
+        zm[1] = pi - ei;
+    }
+}
+
+static void plan_real_merge_q31(const upt_fft_plan_Type *plan, int32_t *x) {
+    const int32_t *tw = (const int32_t *)plan->rtwiddle;
+    int32_t n = plan->n;
+    int32_t t = x[0];
+
+    x[0] = (int32_t)(((int64_t)t + x[1]) >> 1);
+    x[1] = (int32_t)(((int64_t)t - x[1]) >> 1);
+    x[n + 1] = -x[n + 1];
+
+    for (int32_t k = 1; k < n / 2; k++) {
+        int32_t *xk = x + 2 * k, *xm = x + 2 * (n - k);
+        int32_t er = (int32_t)(((int64_t)xk[0] + xm[0]) >> 1);
+        int32_t ei = (int32_t)(((int64_t)xk[1] - xm[1]) >> 1);
+        int32_t fr = (int32_t)(((int64_t)xk[0] - xm[0]) >> 1);
+        int32_t fi = (int32_t)(((int64_t)xk[1] + xm[1]) >> 1);
+        int32_t or_, oi;
+
+        /* F * conj(W) */
+        plan_mul_q31(fr, fi, tw[2 * k], -tw[2 * k + 1], &or_, &oi);
+        xk[0] = er - oi;
+        xk[1] = ei + or_;
+        xm[0] = er + oi;
+        xm[1] = or_ - ei;
+    }
+}
+
+void upt_fft_plan_execute_q31(const upt_fft_plan_Type *plan, int32_t *data,
+                              fft_direction_Type direction) {
+    if (plan == NULL || data == NULL || plan->data != UPT_FFT_Q31) {
+        return;
+    }
+    if (plan->type == FFT_COMPLEX) {
+        plan_complex_q31(plan, data, data + 1, 2, direction);
+    } else if (direction == FFT_FORWARD) {
+        plan_radix4_q31(plan, data, data + 1, 2);
+        plan_real_split_q31(plan, data);
+    } else {
+        plan_real_merge_q31(plan, data);
+        plan_complex_q31(plan, data, data + 1, 2, FFT_BACKWARD);
+    }
+}
+
+void upt_fft_plan_execute_split_q31(const upt_fft_plan_Type *plan,
+                                    int32_t *real, int32_t *imag,
+                                    fft_direction_Type direction) {
+    if (plan == NULL || real == NULL || imag == NULL ||
+        plan->data != UPT_FFT_Q31 || plan->type != FFT_COMPLEX) {
+        return;
+    }
+    plan_complex_q31(plan, real, imag, 1, direction);
+}
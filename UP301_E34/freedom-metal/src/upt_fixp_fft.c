@@ -22,6 +22,7 @@
 #include <stdlib.h>
 #include <time.h>
 
+#include "upt_fft_plan.h"
 #include "upt_fixp_fft.h"
 #include "upt_up301.h"
 
@@ -67,8 +68,8 @@ void compute_ifft_twiddle_factors(fixed_point_Type *twiddle_real, fixed_point_Ty
     }
 }
 
-// Perform the FFT using fixed-point arithmetic
-void fft_fixed(fixed_point_Type *real, fixed_point_Type *imag, int32_t N) {
+// Radix-2 FFT computing its twiddles, for the sizes without a cached plan
+static void fft_fixed_direct(fixed_point_Type *real, fixed_point_Type *imag, int32_t N) {
 	int32_t stages = (int32_t)(log(N) / log(2));
     fixed_point_Type twiddle_real[N / 2], twiddle_imag[N / 2];
 
@@ -121,8 +122,8 @@ void fft_fixed(fixed_point_Type *real, fixed_point_Type *imag, int32_t N) {
     }
 }
 
-// Perform IFFT using fixed-point arithmetic
-void ifft_fixed(fixed_point_Type *real, fixed_point_Type *imag, int32_t N) {
+// Radix-2 IFFT computing its twiddles, for the sizes without a cached plan
+static void ifft_fixed_direct(fixed_point_Type *real, fixed_point_Type *imag, int32_t N) {
 	int32_t stages = (int32_t)(log(N) / log(2));
     fixed_point_Type twiddle_real[N / 2], twiddle_imag[N / 2];
 
@@ -181,6 +182,28 @@ void ifft_fixed(fixed_point_Type *real, fixed_point_Type *imag, int32_t N) {
     }
 }
 
+// Perform the FFT using fixed-point arithmetic, not scaled
+void fft_fixed(fixed_point_Type *real, fixed_point_Type *imag, int32_t N) {
+    const upt_fft_plan_Type *plan = upt_fft_plan_get(N, FFT_COMPLEX, UPT_FFT_Q31);
+
+    if (plan == NULL) {
+        fft_fixed_direct(real, imag, N);
+        return;
+    }
+    upt_fft_plan_execute_split_q31(plan, real, imag, FFT_FORWARD);
+}
+
+// Perform IFFT using fixed-point arithmetic, scaled by 1/N
+void ifft_fixed(fixed_point_Type *real, fixed_point_Type *imag, int32_t N) {
+    const upt_fft_plan_Type *plan = upt_fft_plan_get(N, FFT_COMPLEX, UPT_FFT_Q31);
+
+    if (plan == NULL) {
+        ifft_fixed_direct(real, imag, N);
+        return;
+    }
+    upt_fft_plan_execute_split_q31(plan, real, imag, FFT_BACKWARD);
+}
+
 // Generate a random input array (real and imaginary parts)
 void generate_random_input_array(fixed_point_Type *real, fixed_point_Type *imag, int32_t N) {
     srand(time(NULL));  // Seed the random number generator
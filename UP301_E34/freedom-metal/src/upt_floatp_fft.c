@@ -40,15 +40,15 @@
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "upt_fft.h"
+#include "upt_fft_plan.h"
 
 #define TWO_PI 6.28318530
 #define USE_SPLIT_RADIX 1
 #define LARGE_BASE_CASE 1
 
-float twiddle_factors[128];
-
 /*
  * Prepare an FFT of correct size , types, input, output, direction
  */
@@ -60,7 +60,7 @@ int32_t upt_fft_init(fft_config_Type *config, int32_t size, fft_Type type,
 	             int32_t k=0, m=0;
 	             float two_pi_by_n=0;
 
-                    if (config == NULL || input == NULL || output == NULL || twiddle == NULL){
+                    if (config == NULL || input == NULL || output == NULL){
                     	    printf("Error! Please Check FFT Config/Input Data/Output Data/twiddle factors\n");
                     	    return -1;
                     }
@@ -77,6 +77,15 @@ int32_t upt_fft_init(fft_config_Type *config, int32_t size, fft_Type type,
                 config->twiddle_factors = twiddle;
                 config->input = input;
                 config->output = output;
+                config->plan = upt_fft_plan_get(size, type, UPT_FFT_F32);
+
+                if (twiddle == NULL) {
+                    if (config->plan == NULL) {
+                            printf("Error! Please Check FFT Size or twiddle factors\n");
+                            return -1;
+                    }
+                    return 0;
+                }
 
                 two_pi_by_n = TWO_PI / config->size;
 
@@ -99,6 +108,15 @@ void fft_destroy(fft_config_Type *config) {
 }
 
 void fft_execute(fft_config_Type *config) {
+                  if (config->plan != NULL) {
+                                // In place on the output, complex data has 2 floats per point
+                                int32_t len = (config->type == FFT_COMPLEX) ? 2 * config->size : config->size;
+
+                                if (config->output != config->input)
+                                          memcpy(config->output, config->input, len * sizeof(float));
+                                upt_fft_plan_execute_f32(config->plan, config->output, config->direction);
+                                return;
+                  }
                   if (config->type == FFT_REAL && config->direction == FFT_FORWARD)
                                 rfft(config->input, config->output, config->twiddle_factors, config->size);
                   else if (config->type == FFT_REAL && config->direction == FFT_BACKWARD)
@@ -0,0 +1,268 @@
+/*
+ * Copyright (C) 2025 UpbeatTech Inc. All Rights Reserved
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX short identifier: Apache-2.0
+ */
+
+/*
+ * Host test of metal/dsp_queue.h against the C model of the DSP block:
+ *  - a rfft -> spectrum -> sqrt chain gives the results of the blocking calls,
+ *  - a failing job cancels the rest of its chain,
+ *  - a chain with an unknown op is rejected at submission,
+ *  - jobs submitted from two threads at once all complete, once each,
+ *  - without job ops the same jobs run synchronously.
+ *
+ * Only built on a host, with the model. From the freedom-metal directory:
+ *
+ *   cc -O2 -DUPT_DSP_HOST_MODEL -I. tests/dsp_queue_test.c
+ *      src/dsp_queue.c src/up_dsp_model.c -lm -lpthread -o dsp_queue_test
+ */
+
+#if defined(UPT_DSP_HOST_MODEL)
+
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "metal/dsp.h"
+#include "metal/dsp_queue.h"
+#include "metal/drivers/up_dsp_model.h"
+
+#define TEST_FFT_LEN 512
+#define TEST_SQRT_LEN 256
+#define TEST_THREAD_JOBS 200
+
+static int16_t fft_in[TEST_FFT_LEN + 2];
+static int16_t fft_out[TEST_FFT_LEN + 2];
+static int16_t fft_ref[TEST_FFT_LEN + 2];
+static int32_t mag_out[TEST_FFT_LEN / 2 + 1];
+static int32_t mag_ref[TEST_FFT_LEN / 2 + 1];
+static int16_t sqrt_in[TEST_SQRT_LEN];
+static int16_t sqrt_out[TEST_SQRT_LEN];
+static int16_t sqrt_ref[TEST_SQRT_LEN];
+
+static sem_t chain_done;
+static int callbacks;
+static int failures;
+
+#define CHECK(cond)                                                        \
+    do {                                                                   \
+        if (!(cond)) {                                                     \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);         \
+            failures++;                                                    \
+        }                                                                  \
+    } while (0)
+
+/* Counts the completions, and posts chain_done for the last job of a chain */
+static void count_callback(upt_dsp_job_Type *job, void *arg) {
+    (void)job;
+    __atomic_add_fetch(&callbacks, 1, __ATOMIC_SEQ_CST);
+    if (arg != NULL) {
+        sem_post(&chain_done);
+    }
+}
+
+static void make_chain(upt_dsp_job_Type *fft, upt_dsp_job_Type *spectrum,
+                       upt_dsp_job_Type *sqrt) {
+    memset(fft, 0, sizeof(*fft));
+    memset(spectrum, 0, sizeof(*spectrum));
+    memset(sqrt, 0, sizeof(*sqrt));
+
+    fft->op = UPT_DSP_JOB_RFFT_Q15;
+    fft->cfg.length = TEST_FFT_LEN;
+    fft->cfg.dsp_ifftFlag = UPT_DSP_RFFT_MODE;
+    fft->pSrc = fft_in;
+    fft->pDst = fft_out;
+    fft->callback = count_callback;
+    fft->next = spectrum;
+
+    spectrum->op = UPT_DSP_JOB_SPECTRUM_Q15;
+    spectrum->cfg.length = TEST_FFT_LEN;
+    spectrum->pSrc = fft_in;
+    spectrum->pDst = mag_out;
+    spectrum->callback = count_callback;
+    spectrum->next = sqrt;
+
+    sqrt->op = UPT_DSP_JOB_SQRT_Q15;
+    sqrt->cfg.length = TEST_SQRT_LEN;
+    sqrt->pSrc = sqrt_in;
+    sqrt->pDst = sqrt_out;
+    sqrt->callback = count_callback;
+    sqrt->arg = &chain_done;
+}
+
+static void test_chain(upt_dsp_queue_Type *queue, int32_t fft_scale,
+                       int32_t mag_scale, int16_t sqrt_scale) {
+    upt_dsp_job_Type fft, spectrum, sqrt;
+
+    make_chain(&fft, &spectrum, &sqrt);
+    callbacks = 0;
+    memset(fft_out, 0, sizeof(fft_out));
+    upt_dsp_model_reset();
+
+    CHECK(upt_dsp_queue_submit(queue, &fft) == E_DSP_SUCCESS);
+    sem_wait(&chain_done);
+
+    CHECK(upt_dsp_job_done(&fft) && upt_dsp_job_done(&spectrum) &&
+          upt_dsp_job_done(&sqrt));
+    CHECK(fft.status == E_DSP_SUCCESS && spectrum.status == E_DSP_SUCCESS &&
+          sqrt.status == E_DSP_SUCCESS);
+    CHECK(memcmp(fft_out, fft_ref, sizeof(fft_ref)) == 0);
+    CHECK(fft.scale == fft_scale);
+    CHECK(memcmp(mag_out, mag_ref, sizeof(mag_ref)) == 0);
+    CHECK(spectrum.scale == mag_scale);
+    CHECK(memcmp(sqrt_out, sqrt_ref, sizeof(sqrt_ref)) == 0);
+    CHECK(sqrt.scale == sqrt_scale);
+    CHECK(callbacks == 3);
+    CHECK(upt_dsp_model_op_count() == 3);
+}
+
+static void test_cancel(upt_dsp_queue_Type *queue) {
+    upt_dsp_job_Type fft, spectrum, sqrt;
+
+    make_chain(&fft, &spectrum, &sqrt);
+    callbacks = 0;
+    upt_dsp_model_reset();
+    upt_dsp_model_force_error(1);
+
+    CHECK(upt_dsp_queue_submit(queue, &fft) == E_DSP_SUCCESS);
+    sem_wait(&chain_done);
+
+    CHECK(fft.status == E_DSP_ERROR && spectrum.status == E_DSP_ERROR &&
+          sqrt.status == E_DSP_ERROR);
+    CHECK(callbacks == 3);
+    /* Only the failing job reached the DSP */
+    CHECK(upt_dsp_model_op_count() == 0);
+    upt_dsp_model_force_error(0);
+}
+
+static void test_invalid_op(upt_dsp_queue_Type *queue) {
+    upt_dsp_job_Type fft, spectrum, sqrt;
+
+    make_chain(&fft, &spectrum, &sqrt);
+    spectrum.op = (enum_dsp_job_op_Type)99;
+    CHECK(upt_dsp_queue_submit(queue, &fft) == E_DSP_INVPARA);
+    CHECK(fft.state == UPT_DSP_JOB_IDLE && sqrt.state == UPT_DSP_JOB_IDLE);
+}
+
+typedef struct {
+    upt_dsp_queue_Type *queue;
+    upt_dsp_job_Type jobs[TEST_THREAD_JOBS];
+    int16_t out[TEST_THREAD_JOBS][64];
+} submitter_Type;
+
+static void *submitter_main(void *arg) {
+    submitter_Type *s = (submitter_Type *)arg;
+
+    for (int i = 0; i < TEST_THREAD_JOBS; i++) {
+        upt_dsp_job_Type *job = &s->jobs[i];
+
+        memset(job, 0, sizeof(*job));
+        job->op = UPT_DSP_JOB_SQRT_Q15;
+        job->cfg.length = 64;
+        job->pSrc = sqrt_in;
+        job->pDst = s->out[i];
+        job->callback = count_callback;
+        CHECK(upt_dsp_queue_submit(s->queue, job) == E_DSP_SUCCESS);
+    }
+    for (int i = 0; i < TEST_THREAD_JOBS; i++) {
+        CHECK(upt_dsp_job_wait(&s->jobs[i]) == E_DSP_SUCCESS);
+        CHECK(memcmp(s->out[i], sqrt_ref, sizeof(s->out[i])) == 0);
+    }
+    return NULL;
+}
+
+static void test_two_threads(upt_dsp_queue_Type *queue) {
+    static submitter_Type a, b;
+    pthread_t ta, tb;
+    uint32_t before = queue->completed;
+
+    a.queue = queue;
+    b.queue = queue;
+    callbacks = 0;
+    pthread_create(&ta, NULL, submitter_main, &a);
+    pthread_create(&tb, NULL, submitter_main, &b);
+    pthread_join(ta, NULL);
+    pthread_join(tb, NULL);
+
+    CHECK(__atomic_load_n(&callbacks, __ATOMIC_SEQ_CST) ==
+          2 * TEST_THREAD_JOBS);
+    CHECK(queue->completed == before + 2 * TEST_THREAD_JOBS);
+    CHECK(queue->head == NULL && queue->tail == NULL);
+}
+
+static void test_synchronous(metal_dsp_Type *dsp) {
+    upt_dsp_queue_Type queue;
+    upt_dsp_job_Type fft, spectrum, sqrt;
+
+    CHECK(upt_dsp_queue_init(&queue, dsp, NULL) == E_DSP_SUCCESS);
+    make_chain(&fft, &spectrum, &sqrt);
+    callbacks = 0;
+    memset(fft_out, 0, sizeof(fft_out));
+
+    CHECK(upt_dsp_queue_submit(&queue, &fft) == E_DSP_SUCCESS);
+    /* Completed before submit returns */
+    CHECK(upt_dsp_job_done(&sqrt) && callbacks == 3);
+    CHECK(memcmp(fft_out, fft_ref, sizeof(fft_ref)) == 0);
+    sem_wait(&chain_done);
+}
+
+int main(void) {
+    metal_dsp_Type *dsp = upt_dsp_get_device(NAON_UDL_1_2_DSP);
+    upt_dsp_config_Type cfg = {0};
+    upt_dsp_job_ops_Type incomplete = {0};
+    upt_dsp_queue_Type queue;
+    static int16_t work[TEST_FFT_LEN + 2];
+    int32_t fft_scale, mag_scale;
+    int16_t sqrt_scale = 0;
+
+    for (int i = 0; i < TEST_FFT_LEN; i++) {
+        fft_in[i] = (int16_t)((i * 7919) % 20000 - 10000);
+    }
+    for (int i = 0; i < TEST_SQRT_LEN; i++) {
+        sqrt_in[i] = (int16_t)(i * 97);
+    }
+
+    /* References from the blocking calls, which may modify their input */
+    cfg.length = TEST_FFT_LEN;
+    cfg.dsp_ifftFlag = UPT_DSP_RFFT_MODE;
+    memcpy(work, fft_in, sizeof(work));
+    CHECK(upt_dsp_rfft_q15(dsp, &cfg, work, fft_ref, &fft_scale) == 0);
+    memcpy(work, fft_in, sizeof(work));
+    CHECK(upt_dsp_spectrum_q15(dsp, work, mag_ref, &mag_scale,
+                               TEST_FFT_LEN) == 0);
+    CHECK(upt_dsp_sqrt_q15(dsp, sqrt_in, sqrt_ref, &sqrt_scale,
+                           TEST_SQRT_LEN) == 0);
+
+    sem_init(&chain_done, 0, 0);
+    CHECK(upt_dsp_queue_init(&queue, dsp, &incomplete) == E_DSP_INVPARA);
+    CHECK(upt_dsp_queue_init(&queue, dsp, &upt_dsp_model_job_ops) ==
+          E_DSP_SUCCESS);
+    upt_dsp_model_set_irq_handler(upt_dsp_queue_isr, &queue);
+
+    test_chain(&queue, fft_scale, mag_scale, sqrt_scale);
+    test_cancel(&queue);
+    test_invalid_op(&queue);
+    test_two_threads(&queue);
+    test_chain(&queue, fft_scale, mag_scale, sqrt_scale);
+    test_synchronous(dsp);
+
+    printf(failures == 0 ? "dsp_queue_test: OK\n"
+                         : "dsp_queue_test: %d failures\n",
+           failures);
+    return failures != 0;
+}
+
+#endif /* defined(UPT_DSP_HOST_MODEL) */
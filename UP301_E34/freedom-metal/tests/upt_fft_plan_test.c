@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2025 UpbeatTech Inc. All Rights Reserved
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX short identifier: Apache-2.0
+ */
+
+/*
+ * Host test of the plan cache of metal/drivers/upt_fft_plan.h:
+ *  - threads getting the same plans at once all end up with one plan per
+ *    size, type and format, and only see NULL while it is being built,
+ *  - a cached plan gives the results of a plan built by the caller,
+ *  - fft_fixed()/ifft_fixed() called from several threads give the results
+ *    of a single thread.
+ *
+ * Only built on a host. From the freedom-metal directory:
+ *
+ *   cc -O2 -DUPT_FFT_HOST_TEST -I. -Imetal/drivers -I../bsp
+ *      tests/upt_fft_plan_test.c src/upt_fft_plan.c src/upt_fixp_fft.c
+ *      -lm -lpthread -o upt_fft_plan_test
+ */
+
+#if defined(UPT_FFT_HOST_TEST)
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "metal/drivers/upt_fft_plan.h"
+#include "metal/drivers/upt_fixp_fft.h"
+
+#define TEST_THREADS 4
+#define TEST_ROUNDS 50
+#define TEST_FIXED_LEN 256
+
+static const int32_t test_sizes[] = {64, 128, 256, 512};
+#define TEST_SIZES (int32_t)(sizeof(test_sizes) / sizeof(test_sizes[0]))
+
+static const upt_fft_plan_Type *seen[TEST_THREADS][TEST_SIZES];
+static int32_t fixed_real[TEST_FIXED_LEN];
+static int32_t fixed_imag[TEST_FIXED_LEN];
+static int32_t fixed_real_ref[TEST_FIXED_LEN];
+static int32_t fixed_imag_ref[TEST_FIXED_LEN];
+static pthread_barrier_t start;
+static int failures;
+
+#define CHECK(cond)                                                        \
+    do {                                                                   \
+        if (!(cond)) {                                                     \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);         \
+            __atomic_add_fetch(&failures, 1, __ATOMIC_SEQ_CST);            \
+        }                                                                  \
+    } while (0)
+
+static void fill(int32_t *data, int32_t len, uint32_t seed) {
+    for (int32_t i = 0; i < len; i++) {
+        seed = seed * 1103515245U + 12345U;
+        data[i] = (int32_t)(seed >> 8) % (1 << 20);
+    }
+}
+
+/* Cached plan against one built in a private buffer */
+static void check_plan(const upt_fft_plan_Type *plan, int32_t size) {
+    static __thread uint32_t buffer[16384];
+    static __thread int32_t a[2 * 512], b[2 * 512];
+    upt_fft_plan_Type own;
+
+    CHECK(upt_fft_plan_init(&own, size, FFT_COMPLEX, UPT_FFT_Q31, buffer,
+                            sizeof(buffer)) == 0);
+    fill(a, 2 * size, (uint32_t)size);
+    memcpy(b, a, sizeof(a[0]) * 2 * size);
+    upt_fft_plan_execute_q31(plan, a, FFT_FORWARD);
+    upt_fft_plan_execute_q31(&own, b, FFT_FORWARD);
+    CHECK(memcmp(a, b, sizeof(a[0]) * 2 * size) == 0);
+}
+
+static void *getter_main(void *arg) {
+    int id = (int)(intptr_t)arg;
+    int32_t real[TEST_FIXED_LEN];
+    int32_t imag[TEST_FIXED_LEN];
+
+    pthread_barrier_wait(&start);
+    for (int32_t s = 0; s < TEST_SIZES; s++) {
+        const upt_fft_plan_Type *plan;
+
+        /* NULL only while another thread builds it */
+        while ((plan = upt_fft_plan_get(test_sizes[s], FFT_COMPLEX,
+                                        UPT_FFT_Q31)) == NULL) {
+        }
+        seen[id][s] = plan;
+        CHECK(plan->size == test_sizes[s] && plan->twiddle != NULL);
+        check_plan(plan, test_sizes[s]);
+    }
+    for (int r = 0; r < TEST_ROUNDS; r++) {
+        memcpy(real, fixed_real, sizeof(real));
+        memcpy(imag, fixed_imag, sizeof(imag));
+        fft_fixed(real, imag, TEST_FIXED_LEN);
+        CHECK(memcmp(real, fixed_real_ref, sizeof(real)) == 0 &&
+              memcmp(imag, fixed_imag_ref, sizeof(imag)) == 0);
+        ifft_fixed(real, imag, TEST_FIXED_LEN);
+    }
+    return NULL;
+}
+
+int main(void) {
+    static uint32_t buffer[4096];
+    pthread_t threads[TEST_THREADS];
+    upt_fft_plan_Type own;
+
+    fill(fixed_real, TEST_FIXED_LEN, 1);
+    fill(fixed_imag, TEST_FIXED_LEN, 2);
+    for (int32_t i = 0; i < TEST_FIXED_LEN; i++) {
+        fixed_real[i] >>= 4;
+        fixed_imag[i] >>= 4;
+    }
+
+    /* Reference from a plan of this thread, the cache is still empty */
+    CHECK(upt_fft_plan_init(&own, TEST_FIXED_LEN, FFT_COMPLEX, UPT_FFT_Q31,
+                            buffer, sizeof(buffer)) == 0);
+    memcpy(fixed_real_ref, fixed_real, sizeof(fixed_real));
+    memcpy(fixed_imag_ref, fixed_imag, sizeof(fixed_imag));
+    upt_fft_plan_execute_split_q31(&own, fixed_real_ref, fixed_imag_ref,
+                                   FFT_FORWARD);
+
+    pthread_barrier_init(&start, NULL, TEST_THREADS);
+    for (int i = 0; i < TEST_THREADS; i++) {
+        pthread_create(&threads[i], NULL, getter_main, (void *)(intptr_t)i);
+    }
+    for (int i = 0; i < TEST_THREADS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    for (int32_t s = 0; s < TEST_SIZES; s++) {
+        for (int i = 1; i < TEST_THREADS; i++) {
+            CHECK(seen[i][s] == seen[0][s]);
+        }
+        CHECK(upt_fft_plan_get(test_sizes[s], FFT_COMPLEX, UPT_FFT_Q31) ==
+              seen[0][s]);
+    }
+
+    printf(failures == 0 ? "upt_fft_plan_test: OK\n"
+                         : "upt_fft_plan_test: %d failures\n",
+           failures);
+    return failures != 0;
+}
+
+#endif /* defined(UPT_FFT_HOST_TEST) */